@@ -0,0 +1,158 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/config.hpp"
+#include "axom/core/AlignedAllocator.hpp"
+#include "axom/core/memory_management.hpp"
+
+#ifdef AXOM_USE_UMPIRE
+  #include "umpire/ResourceManager.hpp"
+
+  // NOTE: Umpire provides an AlignedAllocator since v4.1.0
+  #if defined(UMPIRE_VERSION_MAJOR) && \
+    (UMPIRE_VERSION_MAJOR > 4 ||       \
+     (UMPIRE_VERSION_MAJOR == 4 && UMPIRE_VERSION_MINOR >= 1))
+    #define AXOM_UMPIRE_HAS_ALIGNED_ALLOCATOR
+    #include "umpire/strategy/AlignedAllocator.hpp"
+  #else
+    #include "umpire/strategy/SizeLimiter.hpp"
+  #endif
+#endif
+
+#ifdef WIN32
+  #include <malloc.h>  // for _aligned_malloc, _aligned_free
+#else
+  #include <cstdlib>  // for posix_memalign, std::free
+#endif
+
+#ifdef __linux__
+  #include <sys/mman.h>  // for madvise
+#endif
+
+#include <limits>  // for std::numeric_limits
+#include <string>  // for std::string
+
+namespace axom
+{
+namespace
+{
+#ifdef AXOM_USE_UMPIRE
+/// Returns the ID of the aligned Umpire allocator with the given name,
+/// which is created over the HOST allocator if it does not exist
+int getUmpireAlignedAllocatorID(const std::string& name)
+{
+  umpire::ResourceManager& rm = umpire::ResourceManager::getInstance();
+  if(!rm.isAllocator(name))
+  {
+  #ifdef AXOM_UMPIRE_HAS_ALIGNED_ALLOCATOR
+    rm.makeAllocator<umpire::strategy::AlignedAllocator>(
+      name,
+      rm.getAllocator("HOST"),
+      AlignedAllocator::ALIGNMENT);
+  #else
+    // NOTE: an unlimited SizeLimiter is a pass-through to the HOST allocator,
+    // which gives the huge-page allocator an ID of its own
+    rm.makeAllocator<umpire::strategy::SizeLimiter>(
+      name,
+      rm.getAllocator("HOST"),
+      std::numeric_limits<std::size_t>::max());
+  #endif
+  }
+  return rm.getAllocator(name).getId();
+}
+#endif
+
+}  // end anonymous namespace
+
+// NOTE: C++11 requires a definition of ODR-used static constexpr members
+constexpr std::size_t AlignedAllocator::ALIGNMENT;
+constexpr std::size_t AlignedAllocator::HUGE_PAGE_SIZE;
+
+//------------------------------------------------------------------------------
+void* AlignedAllocator::allocate(std::size_t numbytes, bool useHugePages)
+{
+  const bool hugePages = useHugePages && numbytes >= HUGE_PAGE_SIZE;
+  const std::size_t alignment = hugePages ? HUGE_PAGE_SIZE : ALIGNMENT;
+
+  // NOTE: like std::malloc(), a zero-sized request returns a unique pointer
+  const std::size_t size = (numbytes > 0) ? numbytes : 1;
+
+#ifdef WIN32
+  void* p = _aligned_malloc(size, alignment);
+#else
+  void* p = nullptr;
+  if(posix_memalign(&p, alignment, size) != 0)
+  {
+    return nullptr;
+  }
+#endif
+
+  if(hugePages)
+  {
+    adviseHugePages(p, numbytes);
+  }
+
+  return p;
+}
+
+//------------------------------------------------------------------------------
+void AlignedAllocator::deallocate(void* p)
+{
+#ifdef WIN32
+  _aligned_free(p);
+#else
+  std::free(p);
+#endif
+}
+
+//------------------------------------------------------------------------------
+bool AlignedAllocator::adviseHugePages(void* p, std::size_t numbytes)
+{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  // NOTE: only the huge pages that are entirely in the range are advised, so
+  // that the advice does not apply to the neighboring allocations
+  const std::uintptr_t first = reinterpret_cast<std::uintptr_t>(p);
+  const std::uintptr_t begin =
+    (first + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+  const std::uintptr_t end =
+    (first + numbytes) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+
+  if(p == nullptr || end <= begin)
+  {
+    return false;
+  }
+
+  void* start = reinterpret_cast<void*>(begin);
+  return madvise(start, end - begin, MADV_HUGEPAGE) == 0;
+#else
+  static_cast<void>(p);
+  static_cast<void>(numbytes);
+  return false;
+#endif
+}
+
+//------------------------------------------------------------------------------
+int getAlignedAllocatorID()
+{
+#ifdef AXOM_USE_UMPIRE
+  static const int alignedID = getUmpireAlignedAllocatorID("AXOM_ALIGNED");
+  return alignedID;
+#else
+  return internal::ALIGNED_ALLOCATOR_ID;
+#endif
+}
+
+//------------------------------------------------------------------------------
+int getHugePageAllocatorID()
+{
+#ifdef AXOM_USE_UMPIRE
+  static const int hugePageID = getUmpireAlignedAllocatorID("AXOM_HUGE_PAGE");
+  return hugePageID;
+#else
+  return internal::HUGE_PAGE_ALLOCATOR_ID;
+#endif
+}
+
+} /* namespace axom */
@@ -0,0 +1,111 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_CORE_ALIGNEDALLOCATOR_HPP_
+#define AXOM_CORE_ALIGNEDALLOCATOR_HPP_
+
+#include "axom/config.hpp"  // for compile-time definitions
+
+// C/C++ includes
+#include <cstddef>  // for std::size_t
+#include <cstdint>  // for std::uintptr_t
+
+namespace axom
+{
+/*!
+ * \class AlignedAllocator
+ *
+ * \brief Allocates host memory with a cache-line alignment, and optionally
+ *  backs large allocations with transparent huge pages.
+ *
+ *  Allocations are aligned to ALIGNMENT bytes, i.e., a cache line and the
+ *  width of the widest SIMD registers, so that kernels may use aligned loads.
+ *  When huge pages are requested, allocations of at least HUGE_PAGE_SIZE bytes
+ *  are aligned to HUGE_PAGE_SIZE instead, and the kernel is advised, via
+ *  madvise(MADV_HUGEPAGE), to back them with transparent huge pages, which
+ *  reduces the TLB misses when streaming over multi-GB arrays. The advice is
+ *  a hint, which is ignored on platforms without transparent huge pages.
+ *
+ *  The allocator is stateless, and is the allocator behind
+ *  axom::getAlignedAllocatorID() and axom::getHugePageAllocatorID() when Axom
+ *  is built without Umpire.
+ *
+ * \see axom::getAlignedAllocatorID(), axom::getHugePageAllocatorID()
+ */
+class AlignedAllocator
+{
+public:
+  /// The alignment of all the allocations, in bytes
+  static constexpr std::size_t ALIGNMENT = 64;
+
+  /// The size of a huge page, in bytes, i.e., 2 MiB
+  static constexpr std::size_t HUGE_PAGE_SIZE = std::size_t(1) << 21;
+
+  /*!
+   * \brief Allocates the given number of bytes.
+   *
+   * \param [in] numbytes the number of bytes to allocate.
+   * \param [in] useHugePages if true, allocations of at least HUGE_PAGE_SIZE
+   *  bytes are aligned to, and backed by, huge pages (optional).
+   *
+   * \return p pointer to the allocation, aligned to at least ALIGNMENT bytes,
+   *  or a nullptr if the allocation failed.
+   */
+  static void* allocate(std::size_t numbytes, bool useHugePages = false);
+
+  /*!
+   * \brief Frees an allocation returned by allocate(), or a nullptr.
+   */
+  static void deallocate(void* p);
+
+  /*!
+   * \brief Advises the kernel to back the huge pages that are entirely
+   *  contained in the given range with transparent huge pages.
+   *
+   * \return true iff the advice was given for at least one huge page.
+   */
+  static bool adviseHugePages(void* p, std::size_t numbytes);
+
+  /*!
+   * \brief Returns true iff p is aligned to the given number of bytes.
+   */
+  static bool isAligned(const void* p, std::size_t alignment = ALIGNMENT)
+  {
+    return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+  }
+};
+
+/*!
+ * \brief Returns the ID of the host allocator whose allocations are aligned
+ *  to AlignedAllocator::ALIGNMENT bytes.
+ *
+ *  When Axom is built with Umpire, the allocator is an Umpire AlignedAllocator
+ *  over the HOST allocator, which is created on first use. Otherwise, it is
+ *  the built-in AlignedAllocator.
+ *
+ * \note Umpire versions before 4.1.0 do not provide an AlignedAllocator, in
+ *  which case the ID of the HOST allocator is returned, and the alignment is
+ *  that of std::malloc().
+ *
+ * \post ID != INVALID_ALLOCATOR_ID
+ */
+int getAlignedAllocatorID();
+
+/*!
+ * \brief Returns the ID of the aligned host allocator that backs large
+ *  allocations with transparent huge pages.
+ *
+ *  Allocations are aligned as with getAlignedAllocatorID(). In addition,
+ *  axom::allocate() and axom::reallocate() advise the kernel to use huge pages
+ *  for allocations of at least AlignedAllocator::HUGE_PAGE_SIZE bytes. Use it
+ *  for large, long-lived arrays, e.g., mesh coordinates or the BVH nodes.
+ *
+ * \post ID != INVALID_ALLOCATOR_ID
+ */
+int getHugePageAllocatorID();
+
+} /* namespace axom */
+
+#endif /* AXOM_CORE_ALIGNEDALLOCATOR_HPP_ */
@@ -7,14 +7,20 @@
 #define AXOM_ARRAY_HPP_
 
 #include "axom/config.hpp"                    // for compile-time defines
+#include "axom/core/FileMapping.hpp"          // for FileMapping
 #include "axom/core/Macros.hpp"               // for axom macros
 #include "axom/core/memory_management.hpp"    // for memory allocation functions
 #include "axom/core/utilities/Utilities.hpp"  // for processAbort()
 #include "axom/core/Types.hpp"                // for IndexType definition
 
 // C/C++ includes
-#include <cstring>   // for std::memcpy
-#include <iostream>  // for std::cerr
+#include <algorithm>    // for std::copy, std::fill_n
+#include <iostream>     // for std::cerr
+#include <memory>       // for std::uninitialized_copy, uninitialized_fill_n
+#include <new>          // for placement new
+#include <string>       // for std::string
+#include <type_traits>  // for std::is_trivially_copyable
+#include <utility>      // for std::move
 
 namespace axom
 {
@@ -66,6 +72,44 @@ constexpr IndexType ZERO = 0;
  *    \note The Array destructor does not deallocate a user-supplied buffer,
  *     since it does not manage that memory.
  *
+ *  * <b> Memory-Mapped Storage </b> <br />
+ *
+ *    An Array object may be constructed from a range of a binary file, which
+ *    is mapped into memory, e.g., to process meshes or point sets that are
+ *    larger than the memory of a rank. The pages of the file are read on
+ *    demand, may be evicted under memory pressure, and are shared through the
+ *    page cache by the processes that map the same file. The mapping is
+ *    read-only, or copy-on-write, in which case the Array may be modified
+ *    without modifying the file. The expected access pattern, e.g.,
+ *    sequential, may be given with advise(), to tune the read-ahead.
+ *
+ *    \warning Like an Array with external storage, a memory-mapped Array
+ *     has a fixed size and cannot be dynamically resized.
+ *
+ *    \note The Array destructor unmaps the file.
+ *
+ *  Arrays with native storage allocate their memory with the allocator that
+ *  is specified at construction, which defaults to the current default
+ *  allocator. E.g., arrays that are processed with SIMD kernels may use
+ *  getAlignedAllocatorID() for a cache-line aligned buffer, and large,
+ *  long-lived arrays may use getHugePageAllocatorID() to also back the buffer
+ *  with huge pages. Reallocations retain the allocator, hence, the alignment.
+ *  An Array can be moved, which transfers the ownership of its
+ *  buffer without reallocating or copying its elements, e.g., to return it
+ *  from a function or to store it in a standard container. Copies are
+ *  disabled, since they would silently duplicate potentially large buffers.
+ *
+ *  Elements of non-trivial types, e.g., `std::string`, are constructed,
+ *  moved and destroyed as they are added to, relocated within, or removed
+ *  from the Array. Trivially copyable and destructible types, e.g.,
+ *  arithmetic types or primal::Point, are relocated with a plain
+ *  reallocation instead, and are only constructed if their default
+ *  constructor is user-provided.
+ *
+ *  \note Types that are not trivially copyable and destructible, or that
+ *   have a user-provided default constructor, require an allocator for
+ *   memory that is accessible from the host.
+ *
  * \warning Reallocations tend to be costly operations in terms of performance.
  *  Use `reserve()` when the number of nodes is known a priori, or opt to
  *  use a constructor that takes an actual size and capacity when possible.
@@ -91,11 +135,14 @@ public:
    * \param [in] num_components the number of values per tuple. If not
    *  specified defaults to 1.
    * \param [in] capacity the number of tuples to allocate space for.
+   * \param [in] allocator_id the ID of the allocator to use (optional). If not
+   *  specified defaults to the current default allocator.
    *
    * \note If no capacity or capacity less than num_tuples is specified
    *  then it will default to at least num_tuples * DEFAULT_RESIZE_RATIO.
    * \note a capacity is specified for the number of tuples to store in the
    *  array and does not correspond to the actual bytesize.
+   * \note The elements are default-initialized.
    *
    * \pre num_tuples >= 0
    * \pre num_components >= 1
@@ -104,8 +151,12 @@ public:
    * \post size() == num_tuples
    * \post numComponents() == num_components
    * \post getResizeRatio() == DEFAULT_RESIZE_RATIO
+   * \post getAllocatorID() == allocator_id
    */
-  Array(IndexType num_tuples, IndexType num_components = 1, IndexType capacity = 0);
+  Array(IndexType num_tuples,
+        IndexType num_components = 1,
+        IndexType capacity = 0,
+        int allocator_id = getDefaultAllocatorID());
 
   /// @}
 
@@ -144,6 +195,74 @@ public:
 
   /// @}
 
+  /// \name Memory-Mapped Storage Array Constructors
+  /// @{
+
+  /*!
+   * \brief Constructs an Array instance that maps the given number of tuples
+   *  of a binary file into memory.
+   *
+   * \param [in] path the path of the file.
+   * \param [in] offset the offset of the first tuple in the file, in bytes.
+   * \param [in] num_tuples the number of tuples in the Array. If negative,
+   *  the Array holds all the whole tuples from the offset to the end of the
+   *  file.
+   * \param [in] num_components the number of values per tuple. If not
+   *  specified defaults to 1.
+   * \param [in] mode the access mode of the mapping. If not specified
+   *  defaults to FileMapping::Mode::READ_ONLY.
+   *
+   * \pre offset % alignof(T) == 0
+   * \pre num_components >= 1
+   *
+   * \post numComponents() == num_components
+   * \post isMapped() == true
+   * \post capacity() == size()
+   * \post getResizeRatio == 0.0
+   *
+   * \note The values are the raw bytes of the file, in the byte order of the
+   *  host, hence, T must be a trivially copyable type.
+   * \note The program aborts if the file cannot be mapped, e.g., if it does
+   *  not hold num_tuples tuples after the offset.
+   *
+   * \warning The values of a READ_ONLY Array must not be modified.
+   */
+  Array(const std::string& path,
+        std::size_t offset,
+        IndexType num_tuples,
+        IndexType num_components = 1,
+        FileMapping::Mode mode = FileMapping::Mode::READ_ONLY);
+
+  /// @}
+
+  /// \name Move Semantics
+  /// @{
+
+  /*!
+   * \brief Move constructor. Takes ownership of the buffer of other.
+   *
+   * \param [in] other the Array to move from.
+   *
+   * \post other.size() == 0
+   * \post other.capacity() == 0
+   * \post other.getData() == nullptr
+   */
+  Array(Array&& other) noexcept;
+
+  /*!
+   * \brief Move assignment. Releases the buffer of this instance and takes
+   *  ownership of the buffer of other.
+   *
+   * \param [in] other the Array to move from.
+   *
+   * \post other.size() == 0
+   * \post other.capacity() == 0
+   * \post other.getData() == nullptr
+   */
+  Array& operator=(Array&& other) noexcept;
+
+  /// @}
+
   /*!
    * Destructor. Frees the associated buffer unless the memory is external.
    */
@@ -243,6 +362,17 @@ public:
    */
   void append(const T& value);
 
+  /*!
+   * \brief Append a value to the end of the array by moving it.
+   *
+   * \param [in] value the value to append.
+   *
+   * \note Reallocation is done if the new size will exceed the capacity.
+   *
+   * \pre m_num_components == 1.
+   */
+  void append(T&& value);
+
   /*!
    * \brief Append tuples to the end of the array.
    *
@@ -380,10 +510,43 @@ public:
   IndexType numComponents() const { return m_num_components; }
 
   /*!
-   * \brief Return true iff the external buffer constructor was called.
+   * \brief Return true iff the external buffer constructor, or the
+   *  memory-mapped storage constructor, was called.
    */
   bool isExternal() const { return m_is_external; }
 
+  /*!
+   * \brief Return true iff the memory-mapped storage constructor was called.
+   */
+  bool isMapped() const { return m_mapping != nullptr; }
+
+  /*!
+   * \brief Advises the kernel of the expected access pattern of a range of
+   *  tuples of a memory-mapped Array, e.g., to read the tuples ahead of a
+   *  sequential sweep, or to prefetch tuples that are about to be accessed.
+   *
+   * \param [in] advice the expected access pattern.
+   * \param [in] pos the first tuple of the range. If not specified defaults
+   *  to 0.
+   * \param [in] n the number of tuples of the range. If not specified, or
+   *  negative, the range extends to the end of the Array.
+   *
+   * \return status true iff the advice was given. Always false if the Array
+   *  is not memory-mapped.
+   *
+   * \see FileMapping::advise()
+   */
+  bool advise(FileMapping::Advice advice,
+              IndexType pos = 0,
+              IndexType n = -1) const;
+
+  /*!
+   * \brief Return the ID of the allocator used to allocate the data array.
+   *
+   * \note Returns INVALID_ALLOCATOR_ID if the Array wraps an external buffer.
+   */
+  int getAllocatorID() const { return m_allocator_id; }
+
   /*!
    * \brief Return true iff a sidre constructor was called.
    */
@@ -429,6 +592,8 @@ protected:
    * \return a pointer to the beginning of the insertion space.
    *
    * \note Reallocation is done if the new size will exceed the capacity.
+   * \note The insertion space is uninitialized memory, hence, the caller must
+   *  construct the new elements in place, e.g., with placement new.
    */
   T* reserveForInsert(IndexType n, IndexType pos);
 
@@ -454,6 +619,38 @@ protected:
    */
   virtual void dynamicRealloc(IndexType new_num_tuples);
 
+  /// \name Internal element lifetime routines
+  /// @{
+
+  /*!
+   * \brief Reallocates the data array to hold the given number of tuples,
+   *  relocating the existing elements.
+   *
+   * \param [in] new_capacity the new number of tuples to allocate.
+   *
+   * \pre new_capacity >= m_num_tuples
+   */
+  void reallocateData(IndexType new_capacity);
+
+  /*!
+   * \brief Moves the existing elements to a new data array of the given
+   *  capacity, with a plain reallocation for trivially relocatable types, and
+   *  by moving each element to new storage otherwise.
+   */
+  void relocateData(IndexType new_capacity, std::true_type);
+  void relocateData(IndexType new_capacity, std::false_type);
+
+  /*! \brief Default-initializes the values in [first, first+n) */
+  static void constructValues(T* first, IndexType n);
+
+  /*! \brief Destroys the values in [first, first+n) */
+  static void destroyValues(T* first, IndexType n);
+
+  /*! \brief Releases the data array, unless it is external. */
+  void releaseData();
+
+  /// @}
+
   /// \name Internal bounds-checking routines
   /// @{
 
@@ -476,10 +673,23 @@ protected:
   IndexType m_capacity;
   IndexType m_num_components;
   double m_resize_ratio;
-  bool const m_is_external;
+  bool m_is_external;
+  int m_allocator_id;
+  std::unique_ptr<FileMapping> m_mapping;
+
+  /// Elements of trivially copyable and destructible types need not be
+  /// destroyed, and are relocated by a plain reallocation of the data array,
+  /// which also supports data arrays that are not accessible on the host.
+  static constexpr bool IS_TRIVIALLY_RELOCATABLE =
+    std::is_trivially_copyable<T>::value &&
+    std::is_trivially_destructible<T>::value;
+
+  /// Elements of trivially default constructible types need not be
+  /// constructed.
+  static constexpr bool IS_TRIVIALLY_CONSTRUCTIBLE =
+    std::is_trivially_default_constructible<T>::value;
 
   DISABLE_COPY_AND_ASSIGNMENT(Array);
-  DISABLE_MOVE_AND_ASSIGNMENT(Array);
 };
 
 //------------------------------------------------------------------------------
@@ -495,17 +705,22 @@ Array<T>::Array()
   , m_num_components(1)
   , m_resize_ratio(DEFAULT_RESIZE_RATIO)
   , m_is_external(false)
+  , m_allocator_id(getDefaultAllocatorID())
 { }
 
 //------------------------------------------------------------------------------
 template <typename T>
-Array<T>::Array(IndexType num_tuples, IndexType num_components, IndexType capacity)
+Array<T>::Array(IndexType num_tuples,
+                IndexType num_components,
+                IndexType capacity,
+                int allocator_id)
   : m_data(nullptr)
   , m_num_tuples(0)
   , m_capacity(0)
   , m_num_components(0)
   , m_resize_ratio(DEFAULT_RESIZE_RATIO)
   , m_is_external(false)
+  , m_allocator_id(allocator_id)
 {
   initialize(num_tuples, num_components, capacity);
 }
@@ -522,6 +737,7 @@ Array<T>::Array(T* data,
   , m_num_components(num_components)
   , m_resize_ratio(0.0)
   , m_is_external(true)
+  , m_allocator_id(INVALID_ALLOCATOR_ID)
 {
   m_capacity = (capacity < num_tuples) ? num_tuples : capacity;
 
@@ -531,16 +747,127 @@ Array<T>::Array(T* data,
   assert(m_data != nullptr || m_capacity <= 0);
 }
 
+//------------------------------------------------------------------------------
+template <typename T>
+Array<T>::Array(const std::string& path,
+                std::size_t offset,
+                IndexType num_tuples,
+                IndexType num_components,
+                FileMapping::Mode mode)
+  : m_data(nullptr)
+  , m_num_tuples(0)
+  , m_capacity(0)
+  , m_num_components(num_components)
+  , m_resize_ratio(0.0)
+  , m_is_external(true)
+  , m_allocator_id(INVALID_ALLOCATOR_ID)
+  , m_mapping(new FileMapping())
+{
+  static_assert(std::is_trivially_copyable<T>::value,
+                "A memory-mapped Array requires a trivially copyable type");
+  assert(m_num_components >= 1);
+  assert("pre: offset is aligned" && (offset % alignof(T) == 0));
+
+  const std::size_t tuple_bytes = sizeof(T) * m_num_components;
+  const std::size_t numbytes = (num_tuples < 0)
+    ? FileMapping::TO_END_OF_FILE
+    : static_cast<std::size_t>(num_tuples) * tuple_bytes;
+
+  if(!m_mapping->map(path, offset, numbytes, mode))
+  {
+    std::cerr << "Cannot map the Array: " << m_mapping->getErrorMessage()
+              << "\n";
+    utilities::processAbort();
+  }
+
+  m_data = static_cast<T*>(m_mapping->data());
+  m_num_tuples = static_cast<IndexType>(m_mapping->size() / tuple_bytes);
+  m_capacity = m_num_tuples;
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+Array<T>::Array(Array&& other) noexcept
+  : m_data(other.m_data)
+  , m_num_tuples(other.m_num_tuples)
+  , m_capacity(other.m_capacity)
+  , m_num_components(other.m_num_components)
+  , m_resize_ratio(other.m_resize_ratio)
+  , m_is_external(other.m_is_external)
+  , m_allocator_id(other.m_allocator_id)
+  , m_mapping(std::move(other.m_mapping))
+{
+  if(other.isInSidre())
+  {
+    std::cerr << "Cannot move from an Array whose data is owned by Sidre.";
+    utilities::processAbort();
+  }
+
+  other.m_data = nullptr;
+  other.m_num_tuples = 0;
+  other.m_capacity = 0;
+  other.m_is_external = false;
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+Array<T>& Array<T>::operator=(Array&& other) noexcept
+{
+  if(this == &other)
+  {
+    return *this;
+  }
+
+  if(isInSidre() || other.isInSidre())
+  {
+    std::cerr << "Cannot move an Array whose data is owned by Sidre.";
+    utilities::processAbort();
+  }
+
+  releaseData();
+
+  m_data = other.m_data;
+  m_num_tuples = other.m_num_tuples;
+  m_capacity = other.m_capacity;
+  m_num_components = other.m_num_components;
+  m_resize_ratio = other.m_resize_ratio;
+  m_is_external = other.m_is_external;
+  m_allocator_id = other.m_allocator_id;
+  m_mapping = std::move(other.m_mapping);
+
+  other.m_data = nullptr;
+  other.m_num_tuples = 0;
+  other.m_capacity = 0;
+  other.m_is_external = false;
+
+  return *this;
+}
+
 //------------------------------------------------------------------------------
 template <typename T>
 Array<T>::~Array()
 {
-  if(m_data != nullptr && !m_is_external)
+  releaseData();
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+inline bool Array<T>::advise(FileMapping::Advice advice,
+                             IndexType pos,
+                             IndexType n) const
+{
+  if(m_mapping == nullptr || pos < 0 || pos >= m_num_tuples)
   {
-    axom::deallocate(m_data);
+    return false;
   }
 
-  m_data = nullptr;
+  if(n < 0 || n > m_num_tuples - pos)
+  {
+    n = m_num_tuples - pos;
+  }
+
+  const std::size_t tuple_bytes = sizeof(T) * m_num_components;
+  return m_mapping->advise(advice, pos * tuple_bytes, n * tuple_bytes);
 }
 
 //------------------------------------------------------------------------------
@@ -555,7 +882,23 @@ inline void Array<T>::append(const T& value)
     dynamicRealloc(new_size);
   }
 
-  m_data[m_num_tuples] = value;
+  new(&m_data[m_num_tuples]) T(value);
+  updateNumTuples(new_size);
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+inline void Array<T>::append(T&& value)
+{
+  assert(m_num_components == 1);
+
+  IndexType new_size = m_num_tuples + 1;
+  if(new_size > m_capacity)
+  {
+    dynamicRealloc(new_size);
+  }
+
+  new(&m_data[m_num_tuples]) T(std::move(value));
   updateNumTuples(new_size);
 }
 
@@ -570,7 +913,7 @@ inline void Array<T>::append(const T* tuples, IndexType n)
   }
 
   T* cur_end = m_data + m_num_tuples * m_num_components;
-  std::memcpy(cur_end, tuples, n * m_num_components * sizeof(T));
+  std::uninitialized_copy(tuples, tuples + n * m_num_components, cur_end);
   updateNumTuples(new_size);
 }
 
@@ -583,8 +926,7 @@ inline void Array<T>::set(const T* tuples, IndexType n, IndexType pos)
   assert(pos + n <= m_num_tuples);
 
   T* set_position = &m_data[pos * m_num_components];
-  IndexType byte_size = n * m_num_components * sizeof(T);
-  std::memcpy(set_position, tuples, byte_size);
+  std::copy(tuples, tuples + n * m_num_components, set_position);
 }
 
 //------------------------------------------------------------------------------
@@ -593,7 +935,7 @@ inline void Array<T>::insert(const T& value, IndexType pos)
 {
   assert(m_num_components == 1);
   reserveForInsert(1, pos);
-  m_data[pos] = value;
+  new(&m_data[pos]) T(value);
 }
 
 //------------------------------------------------------------------------------
@@ -602,7 +944,7 @@ inline void Array<T>::insert(const T* tuples, IndexType n, IndexType pos)
 {
   assert(tuples != nullptr);
   T* insert_pos = reserveForInsert(n, pos);
-  std::memcpy(insert_pos, tuples, n * m_num_components * sizeof(T));
+  std::uninitialized_copy(tuples, tuples + n * m_num_components, insert_pos);
 }
 
 //------------------------------------------------------------------------------
@@ -610,7 +952,7 @@ template <typename T>
 inline void Array<T>::emplace(IndexType n, IndexType pos, const T& value)
 {
   T* insert_pos = reserveForInsert(n, pos);
-  std::fill_n(insert_pos, n * numComponents(), value);
+  std::uninitialized_fill_n(insert_pos, n * numComponents(), value);
 }
 
 //------------------------------------------------------------------------------
@@ -624,6 +966,17 @@ inline void Array<T>::resize(IndexType new_num_tuples)
     dynamicRealloc(new_num_tuples);
   }
 
+  if(new_num_tuples > m_num_tuples)
+  {
+    constructValues(m_data + m_num_tuples * m_num_components,
+                    (new_num_tuples - m_num_tuples) * m_num_components);
+  }
+  else
+  {
+    destroyValues(m_data + new_num_tuples * m_num_components,
+                  (m_num_tuples - new_num_tuples) * m_num_components);
+  }
+
   updateNumTuples(new_num_tuples);
 }
 
@@ -650,6 +1003,7 @@ inline void Array<T>::initialize(IndexType num_tuples,
       (num_tuples > MIN_DEFAULT_CAPACITY) ? num_tuples : MIN_DEFAULT_CAPACITY;
   }
   setCapacity(capacity);
+  constructValues(m_data, m_num_tuples * m_num_components);
 
   // sanity checks
   assert(m_data != nullptr);
@@ -677,11 +1031,14 @@ inline T* Array<T>::reserveForInsert(IndexType n, IndexType pos)
     dynamicRealloc(new_size);
   }
 
+  // relocate the trailing tuples, back to front, leaving uninitialized memory
+  // in their place
   T* const insert_pos = m_data + pos * m_num_components;
   T* cur_pos = m_data + (m_num_tuples * m_num_components) - 1;
   for(; cur_pos >= insert_pos; --cur_pos)
   {
-    *(cur_pos + n * m_num_components) = *cur_pos;
+    new(cur_pos + n * m_num_components) T(std::move(*cur_pos));
+    cur_pos->~T();
   }
 
   updateNumTuples(new_size);
@@ -716,13 +1073,12 @@ inline void Array<T>::setCapacity(IndexType new_capacity)
 
   if(new_capacity < m_num_tuples)
   {
+    destroyValues(m_data + new_capacity * m_num_components,
+                  (m_num_tuples - new_capacity) * m_num_components);
     updateNumTuples(new_capacity);
   }
 
-  m_data = axom::reallocate(m_data, new_capacity * m_num_components);
-  m_capacity = new_capacity;
-
-  assert(m_data != nullptr || m_capacity <= 0);
+  reallocateData(new_capacity);
 }
 
 //------------------------------------------------------------------------------
@@ -748,12 +1104,95 @@ inline void Array<T>::dynamicRealloc(IndexType new_num_tuples)
     utilities::processAbort();
   }
 
-  m_data = axom::reallocate(m_data, new_capacity * m_num_components);
+  reallocateData(new_capacity);
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+inline void Array<T>::reallocateData(IndexType new_capacity)
+{
+  assert(new_capacity >= m_num_tuples);
+
+  if(m_data == nullptr)
+  {
+    m_data = axom::allocate<T>(new_capacity * m_num_components, m_allocator_id);
+  }
+  else
+  {
+    relocateData(new_capacity,
+                 std::integral_constant<bool, IS_TRIVIALLY_RELOCATABLE>());
+  }
+
   m_capacity = new_capacity;
 
   assert(m_data != nullptr || m_capacity <= 0);
 }
 
+//------------------------------------------------------------------------------
+template <typename T>
+inline void Array<T>::relocateData(IndexType new_capacity, std::true_type)
+{
+  // NOTE: reallocate() preserves the allocator of the supplied pointer
+  m_data = axom::reallocate(m_data, new_capacity * m_num_components);
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+inline void Array<T>::relocateData(IndexType new_capacity, std::false_type)
+{
+  const IndexType num_values = m_num_tuples * m_num_components;
+
+  T* new_data =
+    axom::allocate<T>(new_capacity * m_num_components, m_allocator_id);
+  for(IndexType i = 0; i < num_values; ++i)
+  {
+    new(&new_data[i]) T(std::move(m_data[i]));
+  }
+  destroyValues(m_data, num_values);
+  axom::deallocate(m_data);
+  m_data = new_data;
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+inline void Array<T>::constructValues(T* first, IndexType n)
+{
+  if(!IS_TRIVIALLY_CONSTRUCTIBLE)
+  {
+    for(IndexType i = 0; i < n; ++i)
+    {
+      new(&first[i]) T;
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+inline void Array<T>::destroyValues(T* first, IndexType n)
+{
+  if(!IS_TRIVIALLY_RELOCATABLE)
+  {
+    for(IndexType i = 0; i < n; ++i)
+    {
+      first[i].~T();
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+inline void Array<T>::releaseData()
+{
+  if(m_data != nullptr && !m_is_external)
+  {
+    destroyValues(m_data, m_num_tuples * m_num_components);
+    axom::deallocate(m_data);
+  }
+
+  m_data = nullptr;
+  m_mapping.reset();
+}
+
 } /* namespace axom */
 
 #endif /* AXOM_ARRAY_HPP_ */
@@ -0,0 +1,703 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_CONCURRENTHASHMAP_HPP_
+#define AXOM_CONCURRENTHASHMAP_HPP_
+
+#include "axom/config.hpp"                          // for compile-time defines
+#include "axom/core/Macros.hpp"                     // for axom macros
+#include "axom/core/Types.hpp"                      // for IndexType
+#include "axom/core/execution/execution_space.hpp"  // for execution_space
+#include "axom/core/execution/for_all.hpp"          // for for_all()
+
+// C/C++ includes
+#include <atomic>       // for std::atomic
+#include <cassert>      // for assert()
+#include <cstdint>      // for std::uint8_t, std::uint64_t
+#include <functional>   // for std::hash, std::equal_to
+#include <iterator>     // for std::forward_iterator_tag
+#include <memory>       // for std::unique_ptr
+#include <thread>       // for std::this_thread::yield()
+#include <type_traits>  // for std::is_trivially_copyable
+#include <utility>      // for std::pair
+
+namespace axom
+{
+/*!
+ * \class ConcurrentHashMap
+ *
+ * \brief An open-addressing hash map that can be populated concurrently from
+ *  many threads.
+ *
+ *  The map stores its entries in a flat table of buckets, whose size is a
+ *  power of two, and resolves collisions with linear probing. Each bucket has
+ *  an atomic state, i.e., empty, busy or full, and a thread claims an empty
+ *  bucket with a compare-and-swap before it writes the entry. Hence,
+ *  concurrent_insert() and find() are thread-safe, and do not take any lock.
+ *  A thread that probes a bucket whose entry is being written waits until the
+ *  write is complete, which is short, since the keys and values are
+ *  trivially copyable.
+ *
+ *  The table is not resized by concurrent_insert(): the number of keys must be
+ *  reserved beforehand, e.g., with reserve(), or the constructor. In contrast,
+ *  insert() grows the table as needed, but must not be called concurrently
+ *  with any other method. The bulk_insert() method combines both, i.e., it
+ *  reserves space for a batch of entries, and inserts them in parallel, in the
+ *  given execution space.
+ *
+ *  The hash of a key is scrambled before it is mapped to a bucket, since
+ *  std::hash of the integer types is typically the identity, and, e.g.,
+ *  Morton codes would otherwise cluster in a few regions of the table.
+ *
+ *  Example Usage:
+ *  \code
+ *
+ *    // map the unique Morton codes of n points to the first such point
+ *    axom::ConcurrentHashMap< std::uint64_t, axom::IndexType > map;
+ *    map.bulk_insert< axom::OMP_EXEC >( codes, ids, n );
+ *
+ *    for ( const auto& entry : map )
+ *    {
+ *      // entry.first is a unique code, entry.second is the id of a point
+ *    }
+ *
+ *  \endcode
+ *
+ * \note Entries cannot be erased individually, only with clear().
+ *
+ * \note With concurrent insertions of the same key, the value of the first
+ *  insertion that claims a bucket is kept, which is not deterministic. Use
+ *  values that do not depend on the order of the insertions, or resolve the
+ *  conflicts afterwards, e.g., with an atomic min on the value, if the result
+ *  must be reproducible.
+ *
+ * \warning The map uses host atomics, hence, it may only be populated on the
+ *  host, i.e., in the SEQ_EXEC, THREAD_EXEC and OMP_EXEC execution spaces.
+ *
+ * \tparam KeyType the type of the keys, which must be trivially copyable.
+ * \tparam ValueType the type of the values, which must be trivially copyable.
+ * \tparam HashType the hash functor of the keys (optional).
+ * \tparam KeyEqualType the equality functor of the keys (optional).
+ */
+template <typename KeyType,
+          typename ValueType,
+          typename HashType = std::hash<KeyType>,
+          typename KeyEqualType = std::equal_to<KeyType>>
+class ConcurrentHashMap
+{
+  static_assert(std::is_trivially_copyable<KeyType>::value,
+                "ConcurrentHashMap requires trivially copyable keys");
+  static_assert(std::is_trivially_copyable<ValueType>::value,
+                "ConcurrentHashMap requires trivially copyable values");
+
+  template <bool IS_CONST>
+  class IteratorBase;
+
+public:
+  using key_type = KeyType;
+  using mapped_type = ValueType;
+  using value_type = std::pair<KeyType, ValueType>;
+  using hasher = HashType;
+  using key_equal = KeyEqualType;
+  using iterator = IteratorBase<false>;
+  using const_iterator = IteratorBase<true>;
+
+  /// The maximum ratio of the number of keys to the number of buckets
+  static constexpr double MAX_LOAD_FACTOR = 0.5;
+  static constexpr IndexType MIN_NUM_BUCKETS = 16;
+
+public:
+  /// \name Constructors
+  /// @{
+
+  /*!
+   * \brief Constructs an empty map, with space for the given number of keys.
+   *
+   * \param [in] numKeys the number of keys to reserve space for (optional).
+   * \param [in] hash the hash functor (optional).
+   * \param [in] equal the key equality functor (optional).
+   *
+   * \pre numKeys >= 0
+   * \post capacity() >= numKeys
+   */
+  explicit ConcurrentHashMap(IndexType numKeys = 0,
+                             const HashType& hash = HashType(),
+                             const KeyEqualType& equal = KeyEqualType());
+
+  /*!
+   * \brief Move constructor, takes over the table of the other map, which is
+   *  left empty.
+   */
+  ConcurrentHashMap(ConcurrentHashMap&& other) noexcept;
+
+  /*!
+   * \brief Move assignment, takes over the table of the other map, which is
+   *  left empty.
+   */
+  ConcurrentHashMap& operator=(ConcurrentHashMap&& other) noexcept;
+
+  ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+  ConcurrentHashMap& operator=(const ConcurrentHashMap&) = delete;
+
+  /// @}
+
+  /// \name Attribute Queries
+  /// @{
+
+  /*!
+   * \brief Returns the number of keys in the map.
+   */
+  IndexType size() const { return m_size.load(std::memory_order_relaxed); }
+
+  /*!
+   * \brief Checks if the map holds no keys.
+   */
+  bool empty() const { return size() == 0; }
+
+  /*!
+   * \brief Returns the number of keys that the map can hold without exceeding
+   *  the maximum load factor.
+   */
+  IndexType capacity() const
+  {
+    return static_cast<IndexType>(m_numBuckets * MAX_LOAD_FACTOR);
+  }
+
+  /*!
+   * \brief Returns the number of buckets of the table.
+   */
+  IndexType bucket_count() const { return m_numBuckets; }
+
+  /*!
+   * \brief Returns the ratio of the number of keys to the number of buckets.
+   */
+  double load_factor() const
+  {
+    return (m_numBuckets > 0) ? static_cast<double>(size()) / m_numBuckets
+                              : 0.;
+  }
+
+  /// @}
+
+  /// \name Serial Operations
+  /// @{
+
+  /*!
+   * \brief Reserves space for the given number of keys, rehashing the entries
+   *  into a larger table if needed.
+   *
+   * \param [in] numKeys the number of keys to reserve space for.
+   *
+   * \warning Not thread-safe.
+   * \post capacity() >= numKeys
+   */
+  void reserve(IndexType numKeys);
+
+  /*!
+   * \brief Removes all the entries of the map. The number of buckets is
+   *  retained.
+   *
+   * \warning Not thread-safe.
+   * \post size() == 0
+   */
+  void clear();
+
+  /*!
+   * \brief Inserts the given key and value, if the key is not in the map,
+   *  growing the table as needed.
+   *
+   * \param [in] key the key to insert.
+   * \param [in] value the value of the key.
+   *
+   * \return A pair of a pointer to the value of the key in the map, and a
+   *  boolean that is true iff the key was inserted, i.e., false if the key
+   *  was already in the map, in which case its value is not modified.
+   *
+   * \warning Not thread-safe. Use concurrent_insert() from parallel regions.
+   */
+  std::pair<ValueType*, bool> insert(const KeyType& key,
+                                     const ValueType& value);
+
+  /// @}
+
+  /// \name Thread-safe Operations
+  /// @{
+
+  /*!
+   * \brief Inserts the given key and value, if the key is not in the map,
+   *  without growing the table. May be called concurrently with
+   *  concurrent_insert() and find().
+   *
+   * \param [in] key the key to insert.
+   * \param [in] value the value of the key.
+   *
+   * \return Same as insert(), or a null pointer, and false, if the table is
+   *  full and the key is not in the map.
+   *
+   * \note The performance degrades as the load factor exceeds the maximum,
+   *  hence, callers should reserve space for all the keys beforehand.
+   */
+  std::pair<ValueType*, bool> concurrent_insert(const KeyType& key,
+                                                const ValueType& value);
+
+  /*!
+   * \brief Finds the value of the given key. May be called concurrently with
+   *  concurrent_insert() and find().
+   *
+   * \param [in] key the key to find.
+   *
+   * \return A pointer to the value of the key, or nullptr if the key is not in
+   *  the map.
+   */
+  /// @{
+  ValueType* find(const KeyType& key);
+  const ValueType* find(const KeyType& key) const;
+  /// @}
+
+  /*!
+   * \brief Checks if the given key is in the map. May be called concurrently
+   *  with concurrent_insert() and find().
+   */
+  bool contains(const KeyType& key) const { return find(key) != nullptr; }
+
+  /// @}
+
+  /// \name Bulk Operations
+  /// @{
+
+  /*!
+   * \brief Inserts a batch of keys and values in parallel, in the given
+   *  execution space.
+   *
+   *  Reserves space for all the keys of the batch, then inserts entry i of the
+   *  batch with concurrent_insert( keys[ i ], values[ i ] ).
+   *
+   * \param [in] keys buffer of the n keys to insert.
+   * \param [in] values buffer of the n values of the keys.
+   * \param [in] n the number of entries of the batch.
+   *
+   * \return The number of keys that were inserted, i.e., that were not in the
+   *  map, nor repeated earlier in the batch.
+   *
+   * \tparam ExecSpace a host execution space, defaults to SEQ_EXEC.
+   *
+   * \warning Not thread-safe, i.e., must not be called from a parallel region.
+   *
+   * \pre keys != nullptr
+   * \pre values != nullptr
+   */
+  template <typename ExecSpace = SEQ_EXEC>
+  IndexType bulk_insert(const KeyType* keys,
+                        const ValueType* values,
+                        IndexType n);
+
+  /// @}
+
+  /// \name Iteration
+  /// \warning The iterators are invalidated by reserve(), clear(), and by
+  ///  insert() when it grows the table. Iteration is not thread-safe, i.e.,
+  ///  must not be done concurrently with concurrent_insert().
+  /// @{
+
+  iterator begin() { return iterator(this, firstFullBucket(0)); }
+  iterator end() { return iterator(this, m_numBuckets); }
+  const_iterator begin() const
+  {
+    return const_iterator(this, firstFullBucket(0));
+  }
+  const_iterator end() const { return const_iterator(this, m_numBuckets); }
+
+  /// @}
+
+private:
+  /// The states of a bucket
+  enum BucketState : std::uint8_t
+  {
+    EMPTY = 0,
+    BUSY = 1,
+    FULL = 2
+  };
+
+  using StateType = std::atomic<std::uint8_t>;
+
+  /// A bucket stores its state next to its entry, i.e., in the same cache line
+  struct Bucket
+  {
+    StateType state;
+    value_type entry;
+  };
+
+  /// Returns the number of buckets of a table that can hold numKeys keys
+  static IndexType getNumBuckets(IndexType numKeys);
+
+  /// Scrambles the bits of the hash, with the finalizer of MurmurHash3
+  static std::uint64_t scramble(std::uint64_t h);
+
+  /// Returns the first bucket of the probe sequence of the key
+  IndexType getBucket(const KeyType& key) const
+  {
+    return static_cast<IndexType>(scramble(m_hash(key)) &
+                                  static_cast<std::uint64_t>(m_numBuckets - 1));
+  }
+
+  /// Waits until the entry of a busy bucket is written
+  void waitWhileBusy(IndexType bucket) const;
+
+  /// Returns the index of the first full bucket at or after the given one
+  IndexType firstFullBucket(IndexType bucket) const;
+
+  /// Allocates an empty table with the given number of buckets
+  void allocateTable(IndexType numBuckets);
+
+private:
+  HashType m_hash;
+  KeyEqualType m_equal;
+  IndexType m_numBuckets {0};
+  std::atomic<IndexType> m_size {0};
+  std::unique_ptr<Bucket[]> m_buckets;
+};
+
+//------------------------------------------------------------------------------
+//                  ITERATOR IMPLEMENTATION
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Forward iterator over the entries of a ConcurrentHashMap, in the
+ *  order of the buckets.
+ */
+template <typename K, typename V, typename H, typename E>
+template <bool IS_CONST>
+class ConcurrentHashMap<K, V, H, E>::IteratorBase
+{
+  using MapType = typename std::
+    conditional<IS_CONST, const ConcurrentHashMap, ConcurrentHashMap>::type;
+
+public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = typename ConcurrentHashMap::value_type;
+  using difference_type = IndexType;
+  using pointer =
+    typename std::conditional<IS_CONST, const value_type*, value_type*>::type;
+  using reference =
+    typename std::conditional<IS_CONST, const value_type&, value_type&>::type;
+
+  IteratorBase(MapType* map, IndexType bucket) : m_map(map), m_bucket(bucket)
+  { }
+
+  reference operator*() const { return m_map->m_buckets[m_bucket].entry; }
+  pointer operator->() const { return &m_map->m_buckets[m_bucket].entry; }
+
+  IteratorBase& operator++()
+  {
+    m_bucket = m_map->firstFullBucket(m_bucket + 1);
+    return *this;
+  }
+
+  IteratorBase operator++(int)
+  {
+    IteratorBase current = *this;
+    ++(*this);
+    return current;
+  }
+
+  bool operator==(const IteratorBase& other) const
+  {
+    return m_map == other.m_map && m_bucket == other.m_bucket;
+  }
+
+  bool operator!=(const IteratorBase& other) const
+  {
+    return !(*this == other);
+  }
+
+private:
+  MapType* m_map;
+  IndexType m_bucket;
+};
+
+//------------------------------------------------------------------------------
+//                  CONCURRENTHASHMAP IMPLEMENTATION
+//------------------------------------------------------------------------------
+
+template <typename K, typename V, typename H, typename E>
+constexpr double ConcurrentHashMap<K, V, H, E>::MAX_LOAD_FACTOR;
+
+template <typename K, typename V, typename H, typename E>
+constexpr IndexType ConcurrentHashMap<K, V, H, E>::MIN_NUM_BUCKETS;
+
+//------------------------------------------------------------------------------
+template <typename K, typename V, typename H, typename E>
+ConcurrentHashMap<K, V, H, E>::ConcurrentHashMap(IndexType numKeys,
+                                                 const H& hash,
+                                                 const E& equal)
+  : m_hash(hash)
+  , m_equal(equal)
+{
+  assert("pre: numKeys >= 0" && numKeys >= 0);
+  allocateTable(getNumBuckets(numKeys));
+}
+
+//------------------------------------------------------------------------------
+template <typename K, typename V, typename H, typename E>
+ConcurrentHashMap<K, V, H, E>::ConcurrentHashMap(
+  ConcurrentHashMap&& other) noexcept
+  : m_hash(std::move(other.m_hash))
+  , m_equal(std::move(other.m_equal))
+  , m_numBuckets(other.m_numBuckets)
+  , m_size(other.size())
+  , m_buckets(std::move(other.m_buckets))
+{
+  other.m_numBuckets = 0;
+  other.m_size = 0;
+}
+
+//------------------------------------------------------------------------------
+template <typename K, typename V, typename H, typename E>
+ConcurrentHashMap<K, V, H, E>& ConcurrentHashMap<K, V, H, E>::operator=(
+  ConcurrentHashMap&& other) noexcept
+{
+  if(this != &other)
+  {
+    m_hash = std::move(other.m_hash);
+    m_equal = std::move(other.m_equal);
+    m_numBuckets = other.m_numBuckets;
+    m_size = other.size();
+    m_buckets = std::move(other.m_buckets);
+
+    other.m_numBuckets = 0;
+    other.m_size = 0;
+  }
+  return *this;
+}
+
+//------------------------------------------------------------------------------
+template <typename K, typename V, typename H, typename E>
+void ConcurrentHashMap<K, V, H, E>::reserve(IndexType numKeys)
+{
+  if(numKeys <= capacity() && m_numBuckets > 0)
+  {
+    return;
+  }
+
+  // rehash the entries into a new table
+  std::unique_ptr<Bucket[]> oldBuckets = std::move(m_buckets);
+  const IndexType oldNumBuckets = m_numBuckets;
+
+  allocateTable(getNumBuckets(numKeys));
+  m_size = 0;
+
+  for(IndexType i = 0; i < oldNumBuckets; ++i)
+  {
+    if(oldBuckets[i].state.load(std::memory_order_relaxed) == FULL)
+    {
+      concurrent_insert(oldBuckets[i].entry.first, oldBuckets[i].entry.second);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+template <typename K, typename V, typename H, typename E>
+void ConcurrentHashMap<K, V, H, E>::clear()
+{
+  for(IndexType i = 0; i < m_numBuckets; ++i)
+  {
+    m_buckets[i].state.store(EMPTY, std::memory_order_relaxed);
+  }
+  m_size = 0;
+}
+
+//------------------------------------------------------------------------------
+template <typename K, typename V, typename H, typename E>
+std::pair<V*, bool> ConcurrentHashMap<K, V, H, E>::insert(const K& key,
+                                                          const V& value)
+{
+  if(size() >= capacity())
+  {
+    V* existing = find(key);
+    if(existing != nullptr)
+    {
+      return std::make_pair(existing, false);
+    }
+    reserve(2 * capacity());
+  }
+
+  return concurrent_insert(key, value);
+}
+
+//------------------------------------------------------------------------------
+template <typename K, typename V, typename H, typename E>
+std::pair<V*, bool> ConcurrentHashMap<K, V, H, E>::concurrent_insert(
+  const K& key,
+  const V& value)
+{
+  const IndexType mask = m_numBuckets - 1;
+
+  IndexType bucket = getBucket(key);
+  for(IndexType probe = 0; probe < m_numBuckets; ++probe)
+  {
+    Bucket& b = m_buckets[bucket];
+    std::uint8_t state = b.state.load(std::memory_order_acquire);
+
+    // claim an empty bucket, the entry is published by the release store
+    if(state == EMPTY &&
+       b.state.compare_exchange_strong(state,
+                                       BUSY,
+                                       std::memory_order_acquire,
+                                       std::memory_order_acquire))
+    {
+      b.entry.first = key;
+      b.entry.second = value;
+      b.state.store(FULL, std::memory_order_release);
+      m_size.fetch_add(1, std::memory_order_relaxed);
+      return std::make_pair(&b.entry.second, true);
+    }
+
+    // another thread claimed the bucket, compare the keys once it is written
+    if(state == BUSY)
+    {
+      waitWhileBusy(bucket);
+    }
+
+    if(m_equal(b.entry.first, key))
+    {
+      return std::make_pair(&b.entry.second, false);
+    }
+
+    bucket = (bucket + 1) & mask;
+  }
+
+  return std::make_pair(static_cast<V*>(nullptr), false);
+}
+
+//------------------------------------------------------------------------------
+template <typename K, typename V, typename H, typename E>
+V* ConcurrentHashMap<K, V, H, E>::find(const K& key)
+{
+  const ConcurrentHashMap* self = this;
+  return const_cast<V*>(self->find(key));
+}
+
+//------------------------------------------------------------------------------
+template <typename K, typename V, typename H, typename E>
+const V* ConcurrentHashMap<K, V, H, E>::find(const K& key) const
+{
+  const IndexType mask = m_numBuckets - 1;
+
+  IndexType bucket = getBucket(key);
+  for(IndexType probe = 0; probe < m_numBuckets; ++probe)
+  {
+    const Bucket& b = m_buckets[bucket];
+    const std::uint8_t state = b.state.load(std::memory_order_acquire);
+    if(state == EMPTY)
+    {
+      return nullptr;
+    }
+
+    if(state == BUSY)
+    {
+      waitWhileBusy(bucket);
+    }
+
+    if(m_equal(b.entry.first, key))
+    {
+      return &b.entry.second;
+    }
+
+    bucket = (bucket + 1) & mask;
+  }
+
+  return nullptr;
+}
+
+//------------------------------------------------------------------------------
+template <typename K, typename V, typename H, typename E>
+template <typename ExecSpace>
+IndexType ConcurrentHashMap<K, V, H, E>::bulk_insert(const K* keys,
+                                                     const V* values,
+                                                     IndexType n)
+{
+  static_assert(!execution_space<ExecSpace>::onDevice(),
+                "ConcurrentHashMap may only be populated on the host");
+  assert("pre: keys buffer is null" && (keys != nullptr || n == 0));
+  assert("pre: values buffer is null" && (values != nullptr || n == 0));
+
+  const IndexType numKeys = size();
+  reserve(numKeys + n);
+
+  ConcurrentHashMap* map = this;
+  for_all<ExecSpace>(
+    n,
+    AXOM_LAMBDA(IndexType i) { map->concurrent_insert(keys[i], values[i]); });
+
+  return size() - numKeys;
+}
+
+//------------------------------------------------------------------------------
+template <typename K, typename V, typename H, typename E>
+IndexType ConcurrentHashMap<K, V, H, E>::getNumBuckets(IndexType numKeys)
+{
+  const double minNumBuckets = numKeys / MAX_LOAD_FACTOR;
+
+  IndexType numBuckets = MIN_NUM_BUCKETS;
+  while(numBuckets < minNumBuckets)
+  {
+    numBuckets <<= 1;
+  }
+  return numBuckets;
+}
+
+//------------------------------------------------------------------------------
+template <typename K, typename V, typename H, typename E>
+std::uint64_t ConcurrentHashMap<K, V, H, E>::scramble(std::uint64_t h)
+{
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+//------------------------------------------------------------------------------
+template <typename K, typename V, typename H, typename E>
+void ConcurrentHashMap<K, V, H, E>::waitWhileBusy(IndexType bucket) const
+{
+  constexpr int NUM_SPINS = 64;
+
+  int spins = 0;
+  while(m_buckets[bucket].state.load(std::memory_order_acquire) == BUSY)
+  {
+    // the writer may have been preempted, e.g., with more threads than cores
+    if(++spins > NUM_SPINS)
+    {
+      std::this_thread::yield();
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+template <typename K, typename V, typename H, typename E>
+IndexType ConcurrentHashMap<K, V, H, E>::firstFullBucket(IndexType bucket) const
+{
+  while(bucket < m_numBuckets &&
+        m_buckets[bucket].state.load(std::memory_order_relaxed) != FULL)
+  {
+    ++bucket;
+  }
+  return bucket;
+}
+
+//------------------------------------------------------------------------------
+template <typename K, typename V, typename H, typename E>
+void ConcurrentHashMap<K, V, H, E>::allocateTable(IndexType numBuckets)
+{
+  // value-initialization sets the states to EMPTY
+  m_buckets.reset(new Bucket[numBuckets]());
+  m_numBuckets = numBuckets;
+}
+
+} /* namespace axom */
+
+#endif /* AXOM_CONCURRENTHASHMAP_HPP_ */
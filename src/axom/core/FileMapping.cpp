@@ -0,0 +1,268 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/config.hpp"
+#include "axom/core/FileMapping.hpp"
+
+#ifdef WIN32
+  #include <cstdlib>  // for std::malloc, std::free
+  #include <fstream>  // for std::ifstream
+#else
+  #include <fcntl.h>     // for open
+  #include <sys/mman.h>  // for mmap, munmap, madvise, posix_madvise
+  #include <sys/stat.h>  // for fstat
+  #include <unistd.h>    // for close, sysconf
+#endif
+
+#include <cerrno>   // for errno
+#include <cstring>  // for std::strerror
+#include <utility>  // for std::swap
+
+namespace axom
+{
+constexpr std::size_t FileMapping::TO_END_OF_FILE;
+
+namespace
+{
+#ifndef WIN32
+/// Returns the POSIX advice that corresponds to the given advice
+int getPosixAdvice(FileMapping::Advice advice)
+{
+  switch(advice)
+  {
+  case FileMapping::Advice::SEQUENTIAL:
+    return POSIX_MADV_SEQUENTIAL;
+  case FileMapping::Advice::RANDOM:
+    return POSIX_MADV_RANDOM;
+  case FileMapping::Advice::WILL_NEED:
+    return POSIX_MADV_WILLNEED;
+  default:
+    return POSIX_MADV_NORMAL;
+  }
+}
+#endif
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+FileMapping::~FileMapping() { release(); }
+
+//------------------------------------------------------------------------------
+FileMapping::FileMapping(FileMapping&& other) noexcept
+  : m_base(other.m_base)
+  , m_baseSize(other.m_baseSize)
+  , m_data(other.m_data)
+  , m_size(other.m_size)
+  , m_mode(other.m_mode)
+  , m_isMapped(other.m_isMapped)
+{
+  other.m_base = nullptr;
+  other.m_baseSize = 0;
+  other.m_data = nullptr;
+  other.m_size = 0;
+  other.m_isMapped = false;
+}
+
+//------------------------------------------------------------------------------
+FileMapping& FileMapping::operator=(FileMapping&& other) noexcept
+{
+  if(this != &other)
+  {
+    unmap();
+    std::swap(m_base, other.m_base);
+    std::swap(m_baseSize, other.m_baseSize);
+    std::swap(m_data, other.m_data);
+    std::swap(m_size, other.m_size);
+    std::swap(m_mode, other.m_mode);
+    std::swap(m_isMapped, other.m_isMapped);
+  }
+  return *this;
+}
+
+//------------------------------------------------------------------------------
+bool FileMapping::map(const std::string& path,
+                      std::size_t offset,
+                      std::size_t numbytes,
+                      Mode mode)
+{
+  unmap();
+  m_errorMessage.clear();
+
+#ifdef WIN32
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if(!file)
+  {
+    m_errorMessage = "cannot open file '" + path + "'";
+    return false;
+  }
+  const std::size_t fileSize = static_cast<std::size_t>(file.tellg());
+#else
+  const int fd = open(path.c_str(), O_RDONLY);
+  if(fd < 0)
+  {
+    m_errorMessage =
+      "cannot open file '" + path + "': " + std::strerror(errno);
+    return false;
+  }
+
+  struct stat fileStats;
+  if(fstat(fd, &fileStats) != 0)
+  {
+    m_errorMessage = "cannot stat file '" + path + "': " + std::strerror(errno);
+    close(fd);
+    return false;
+  }
+  const std::size_t fileSize = static_cast<std::size_t>(fileStats.st_size);
+#endif
+
+  if(numbytes == TO_END_OF_FILE)
+  {
+    numbytes = (offset < fileSize) ? fileSize - offset : 0;
+  }
+
+  if(offset > fileSize || numbytes > fileSize - offset)
+  {
+    m_errorMessage = "range [" + std::to_string(offset) + ", " +
+      std::to_string(offset + numbytes) + ") exceeds the size of file '" +
+      path + "', i.e., " + std::to_string(fileSize) + " bytes";
+#ifndef WIN32
+    close(fd);
+#endif
+    return false;
+  }
+
+  m_mode = mode;
+  if(numbytes == 0)
+  {
+#ifndef WIN32
+    close(fd);
+#endif
+    m_isMapped = true;
+    return true;
+  }
+
+#ifdef WIN32
+  m_base = std::malloc(numbytes);
+  file.seekg(static_cast<std::streamoff>(offset));
+  if(m_base == nullptr ||
+     !file.read(static_cast<char*>(m_base),
+                static_cast<std::streamsize>(numbytes)))
+  {
+    m_errorMessage = "cannot read file '" + path + "'";
+    std::free(m_base);
+    m_base = nullptr;
+    return false;
+  }
+  m_baseSize = numbytes;
+  m_data = m_base;
+#else
+  // mmap() requires an offset that is a multiple of the page size
+  const std::size_t pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+  const std::size_t pageOffset = offset % pageSize;
+
+  const int protection =
+    (mode == Mode::READ_ONLY) ? PROT_READ : PROT_READ | PROT_WRITE;
+  const int flags = (mode == Mode::READ_ONLY) ? MAP_SHARED : MAP_PRIVATE;
+
+  void* base = mmap(nullptr,
+                    numbytes + pageOffset,
+                    protection,
+                    flags,
+                    fd,
+                    static_cast<off_t>(offset - pageOffset));
+  const int mmapError = errno;
+
+  // the mapping remains valid after the file is closed
+  close(fd);
+
+  if(base == MAP_FAILED)
+  {
+    m_errorMessage =
+      "cannot map file '" + path + "': " + std::strerror(mmapError);
+    return false;
+  }
+
+  m_base = base;
+  m_baseSize = numbytes + pageOffset;
+  m_data = static_cast<char*>(base) + pageOffset;
+#endif
+
+  m_size = numbytes;
+  m_isMapped = true;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void FileMapping::unmap()
+{
+  release();
+
+  m_base = nullptr;
+  m_baseSize = 0;
+  m_data = nullptr;
+  m_size = 0;
+  m_isMapped = false;
+}
+
+//------------------------------------------------------------------------------
+bool FileMapping::advise(Advice advice,
+                         std::size_t offset,
+                         std::size_t numbytes) const
+{
+  if(m_data == nullptr || offset >= m_size)
+  {
+    return false;
+  }
+
+  if(numbytes > m_size - offset)
+  {
+    numbytes = m_size - offset;
+  }
+
+#ifdef WIN32
+  static_cast<void>(advice);
+  return false;
+#else
+  // the advice applies to whole pages, starting from a page boundary
+  const std::size_t pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+  const std::size_t first =
+    (static_cast<char*>(m_data) - static_cast<char*>(m_base)) + offset;
+  const std::size_t begin = first / pageSize * pageSize;
+
+  char* const address = static_cast<char*>(m_base) + begin;
+  const std::size_t length = first + numbytes - begin;
+
+  if(advice == Advice::DONT_NEED)
+  {
+    // NOTE: POSIX_MADV_DONTNEED is a no-op on Linux. madvise(MADV_DONTNEED)
+    // drops the pages, which are read back from the file on the next access,
+    // but it would discard the modified pages of a copy-on-write mapping
+    if(m_mode != Mode::READ_ONLY)
+    {
+      return false;
+    }
+    return madvise(address, length, MADV_DONTNEED) == 0;
+  }
+
+  return posix_madvise(address, length, getPosixAdvice(advice)) == 0;
+#endif
+}
+
+//------------------------------------------------------------------------------
+void FileMapping::release()
+{
+  if(m_base == nullptr)
+  {
+    return;
+  }
+
+#ifdef WIN32
+  std::free(m_base);
+#else
+  munmap(m_base, m_baseSize);
+#endif
+}
+
+} /* namespace axom */
@@ -0,0 +1,183 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_CORE_FILEMAPPING_HPP_
+#define AXOM_CORE_FILEMAPPING_HPP_
+
+#include "axom/config.hpp"       // for compile-time definitions
+#include "axom/core/Macros.hpp"  // for DISABLE_COPY_AND_ASSIGNMENT
+
+// C/C++ includes
+#include <cstddef>  // for std::size_t
+#include <string>   // for std::string
+
+namespace axom
+{
+/*!
+ * \class FileMapping
+ *
+ * \brief Maps a byte range of a file into the address space of the process.
+ *
+ *  The pages of the mapping are read from the file on demand, i.e., when they
+ *  are first accessed, and may be evicted by the kernel under memory
+ *  pressure, hence, the mapped range need not fit in memory. The processes
+ *  that map the same file share the pages of the page cache, until a process
+ *  writes to a copy-on-write mapping, in which case the written pages become
+ *  private to that process. The file is never modified.
+ *
+ *  The access pattern of the mapping may be given to the kernel with
+ *  advise(), e.g., to read ahead aggressively ahead of a sequential sweep, or
+ *  to prefetch a range that is about to be accessed.
+ *
+ *  A FileMapping owns its mapping, which is unmapped by the destructor. It
+ *  may be moved, but not copied.
+ *
+ * \note On platforms without mmap(), i.e., Windows, the range is read into a
+ *  heap buffer instead, which has the semantics of a copy-on-write mapping,
+ *  and advise() does nothing.
+ *
+ * \see Array
+ */
+class FileMapping
+{
+public:
+  /// Maps the rest of the file, after the offset
+  static constexpr std::size_t TO_END_OF_FILE = static_cast<std::size_t>(-1);
+
+  /*!
+   * \brief The access modes of a mapping.
+   */
+  enum class Mode
+  {
+    READ_ONLY,     //!< the mapping may only be read
+    COPY_ON_WRITE  //!< writes go to private copies of the pages, not the file
+  };
+
+  /*!
+   * \brief The expected access patterns of a range of a mapping.
+   */
+  enum class Advice
+  {
+    NORMAL,      //!< no particular pattern, the default
+    SEQUENTIAL,  //!< sequential accesses, read ahead aggressively
+    RANDOM,      //!< random accesses, do not read ahead
+    WILL_NEED,   //!< the range will be accessed soon, prefetch it
+    DONT_NEED    //!< the range will not be accessed soon, drop its pages
+  };
+
+public:
+  /*!
+   * \brief Constructs an empty FileMapping, i.e., that maps nothing.
+   */
+  FileMapping() = default;
+
+  /*!
+   * \brief Unmaps the mapping, if any.
+   */
+  ~FileMapping();
+
+  /*!
+   * \brief Move constructor, takes over the mapping of other.
+   */
+  FileMapping(FileMapping&& other) noexcept;
+
+  /*!
+   * \brief Move assignment, unmaps the mapping of this instance, if any, and
+   *  takes over the mapping of other.
+   */
+  FileMapping& operator=(FileMapping&& other) noexcept;
+
+  /*!
+   * \brief Maps the given byte range of a file.
+   *
+   * \param [in] path the path of the file.
+   * \param [in] offset the offset of the range in the file, in bytes. Need
+   *  not be a multiple of the page size.
+   * \param [in] numbytes the number of bytes of the range, or TO_END_OF_FILE.
+   * \param [in] mode the access mode of the mapping (optional).
+   *
+   * \return status true if the range was mapped, false if the file could not
+   *  be opened or mapped, or the range exceeds the size of the file, in which
+   *  case an error message is available from getErrorMessage().
+   *
+   * \note Unmaps the previous mapping of this instance, if any.
+   * \note A range of zero bytes is mapped successfully, with a null data().
+   */
+  bool map(const std::string& path,
+           std::size_t offset,
+           std::size_t numbytes,
+           Mode mode = Mode::READ_ONLY);
+
+  /*!
+   * \brief Unmaps the mapping, if any.
+   *
+   * \post isMapped() == false
+   */
+  void unmap();
+
+  /*!
+   * \brief Advises the kernel of the access pattern of a range of the mapping.
+   *
+   * \param [in] advice the expected access pattern.
+   * \param [in] offset the offset of the range in the mapping, in bytes
+   *  (optional). Defaults to the beginning of the mapping.
+   * \param [in] numbytes the number of bytes of the range (optional). Defaults
+   *  to the rest of the mapping.
+   *
+   * \return status true iff the advice was given. The advice is a hint, which
+   *  the kernel is free to ignore.
+   *
+   * \note DONT_NEED drops the pages of a READ_ONLY mapping, which are read
+   *  back from the file when they are next accessed. It returns false for a
+   *  COPY_ON_WRITE mapping, since dropping its pages would discard the
+   *  writes.
+   */
+  bool advise(Advice advice,
+              std::size_t offset = 0,
+              std::size_t numbytes = TO_END_OF_FILE) const;
+
+  /*!
+   * \brief Returns true iff a range is mapped.
+   */
+  bool isMapped() const { return m_isMapped; }
+
+  /*!
+   * \brief Returns a pointer to the first byte of the mapped range.
+   */
+  void* data() const { return m_data; }
+
+  /*!
+   * \brief Returns the number of bytes of the mapped range.
+   */
+  std::size_t size() const { return m_size; }
+
+  /*!
+   * \brief Returns the access mode of the mapping.
+   */
+  Mode getMode() const { return m_mode; }
+
+  /*!
+   * \brief Returns a description of the last error of map().
+   */
+  const std::string& getErrorMessage() const { return m_errorMessage; }
+
+private:
+  /// Releases the mapping without resetting the members
+  void release();
+
+  void* m_base {nullptr};     /*!< the page-aligned start of the mapping */
+  std::size_t m_baseSize {0}; /*!< the number of bytes from m_base */
+  void* m_data {nullptr};     /*!< the first byte of the requested range */
+  std::size_t m_size {0};     /*!< the number of bytes of the range */
+  Mode m_mode {Mode::READ_ONLY};
+  bool m_isMapped {false};
+  std::string m_errorMessage;
+
+  DISABLE_COPY_AND_ASSIGNMENT(FileMapping);
+};
+
+} /* namespace axom */
+
+#endif /* AXOM_CORE_FILEMAPPING_HPP_ */
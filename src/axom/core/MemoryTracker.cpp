@@ -0,0 +1,257 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/config.hpp"
+#include "axom/core/MemoryTracker.hpp"
+
+#include <algorithm>  // for std::max
+#include <cstdlib>    // for std::getenv, std::atoi
+#include <iomanip>    // for std::setw
+
+namespace axom
+{
+namespace
+{
+/// The label of the allocations of the calling thread
+thread_local const char* s_label = nullptr;
+
+/// Returns true iff the AXOM_TRACK_MEMORY environment variable is non-zero
+bool trackingRequestedByEnvironment()
+{
+  const char* env = std::getenv("AXOM_TRACK_MEMORY");
+  return env != nullptr && std::atoi(env) != 0;
+}
+
+void add(MemoryStats& stats, std::size_t numbytes)
+{
+  stats.liveBytes += numbytes;
+  stats.peakBytes = std::max(stats.peakBytes, stats.liveBytes);
+  ++stats.numAllocations;
+}
+
+void remove(MemoryStats& stats, std::size_t numbytes)
+{
+  stats.liveBytes -= numbytes;
+  ++stats.numDeallocations;
+}
+
+void reset(MemoryStats& stats)
+{
+  stats.peakBytes = stats.liveBytes;
+  stats.numAllocations = 0;
+  stats.numDeallocations = 0;
+}
+
+void printRow(std::ostream& os, const std::string& name, const MemoryStats& s)
+{
+  os << "  " << std::left << std::setw(24) << name << std::right
+     << std::setw(16) << s.liveBytes << std::setw(16) << s.peakBytes
+     << std::setw(12) << s.numAllocations << std::setw(12)
+     << s.numDeallocations << "\n";
+}
+
+}  // end anonymous namespace
+
+std::atomic<bool> MemoryTracker::s_enabled(trackingRequestedByEnvironment());
+
+//------------------------------------------------------------------------------
+MemoryTracker& MemoryTracker::instance()
+{
+  // NOTE: intentionally leaked, so that memory may be deallocated from the
+  // destructors of other static objects
+  static MemoryTracker* tracker = new MemoryTracker;
+  return *tracker;
+}
+
+//------------------------------------------------------------------------------
+MemoryTracker::MemoryTracker() { }
+
+//------------------------------------------------------------------------------
+void MemoryTracker::setEnabled(bool enabled)
+{
+  s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+const std::string* MemoryTracker::internLabel(const char* label)
+{
+  return (label == nullptr) ? nullptr : &*m_labels.insert(label).first;
+}
+
+//------------------------------------------------------------------------------
+void MemoryTracker::addAllocation(const Record& record)
+{
+  add(m_total, record.numbytes);
+  add(m_byAllocator[record.allocatorID], record.numbytes);
+  add(m_byLabel[record.label], record.numbytes);
+}
+
+//------------------------------------------------------------------------------
+void MemoryTracker::removeAllocation(const Record& record)
+{
+  remove(m_total, record.numbytes);
+  remove(m_byAllocator[record.allocatorID], record.numbytes);
+  remove(m_byLabel[record.label], record.numbytes);
+}
+
+//------------------------------------------------------------------------------
+void MemoryTracker::recordAllocation(void* p,
+                                     std::size_t numbytes,
+                                     int allocatorID)
+{
+  if(p == nullptr)
+  {
+    return;
+  }
+
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+  const Record record {numbytes, allocatorID, internLabel(s_label)};
+  m_records[p] = record;
+  addAllocation(record);
+}
+
+//------------------------------------------------------------------------------
+void MemoryTracker::recordDeallocation(void* p)
+{
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+  auto it = m_records.find(p);
+  if(it == m_records.end())
+  {
+    return;
+  }
+
+  removeAllocation(it->second);
+  m_records.erase(it);
+}
+
+//------------------------------------------------------------------------------
+void MemoryTracker::updateRecord(void* oldp,
+                                 void* newp,
+                                 std::size_t numbytes,
+                                 int allocatorID)
+{
+  Record record {numbytes, allocatorID, nullptr};
+
+  auto it = m_records.find(oldp);
+  if(it == m_records.end())
+  {
+    record.label = internLabel(s_label);
+  }
+  else
+  {
+    record.allocatorID = it->second.allocatorID;
+    record.label = it->second.label;
+    removeAllocation(it->second);
+    m_records.erase(it);
+  }
+
+  if(newp != nullptr)
+  {
+    // NOTE: newp is already tracked if the reallocation was done through
+    // axom::allocate() and axom::deallocate()
+    it = m_records.find(newp);
+    if(it != m_records.end())
+    {
+      removeAllocation(it->second);
+    }
+    m_records[newp] = record;
+    addAllocation(record);
+  }
+}
+
+//------------------------------------------------------------------------------
+MemoryStats MemoryTracker::getTotalStats() const
+{
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+  return m_total;
+}
+
+//------------------------------------------------------------------------------
+std::map<int, MemoryStats> MemoryTracker::getStatsByAllocator() const
+{
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+  return m_byAllocator;
+}
+
+//------------------------------------------------------------------------------
+std::map<std::string, MemoryStats> MemoryTracker::getStatsByLabel() const
+{
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+  std::map<std::string, MemoryStats> stats;
+  for(const auto& entry : m_byLabel)
+  {
+    const std::string name =
+      (entry.first == nullptr) ? std::string() : *entry.first;
+    stats[name] = entry.second;
+  }
+  return stats;
+}
+
+//------------------------------------------------------------------------------
+std::size_t MemoryTracker::getNumLabels() const
+{
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+  return m_labels.size();
+}
+
+//------------------------------------------------------------------------------
+void MemoryTracker::resetStats()
+{
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+  reset(m_total);
+  for(auto& entry : m_byAllocator)
+  {
+    reset(entry.second);
+  }
+  for(auto& entry : m_byLabel)
+  {
+    reset(entry.second);
+  }
+}
+
+//------------------------------------------------------------------------------
+void MemoryTracker::print(std::ostream& os) const
+{
+  const std::map<int, MemoryStats> byAllocator = getStatsByAllocator();
+  const std::map<std::string, MemoryStats> byLabel = getStatsByLabel();
+  const MemoryStats total = getTotalStats();
+
+  os << "Memory usage" << (isEnabled() ? "" : " (tracking disabled)") << ":\n"
+     << "  " << std::left << std::setw(24) << "" << std::right
+     << std::setw(16) << "live bytes" << std::setw(16) << "peak bytes"
+     << std::setw(12) << "allocs" << std::setw(12) << "deallocs"
+     << "\n";
+
+  printRow(os, "total", total);
+
+  os << " by allocator:\n";
+  for(const auto& entry : byAllocator)
+  {
+    printRow(os, "allocator " + std::to_string(entry.first), entry.second);
+  }
+
+  os << " by label:\n";
+  for(const auto& entry : byLabel)
+  {
+    printRow(os,
+             entry.first.empty() ? "(unlabeled)" : entry.first,
+             entry.second);
+  }
+}
+
+//------------------------------------------------------------------------------
+ScopedMemoryLabel::ScopedMemoryLabel(const char* label) : m_previous(s_label)
+{
+  s_label = label;
+}
+
+//------------------------------------------------------------------------------
+ScopedMemoryLabel::~ScopedMemoryLabel() { s_label = m_previous; }
+
+} /* namespace axom */
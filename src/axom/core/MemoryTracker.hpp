@@ -0,0 +1,251 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_CORE_MEMORYTRACKER_HPP_
+#define AXOM_CORE_MEMORYTRACKER_HPP_
+
+#include "axom/config.hpp"       // for compile-time definitions
+#include "axom/core/Macros.hpp"  // for DISABLE_COPY_AND_ASSIGNMENT
+
+// C/C++ includes
+#include <atomic>         // for std::atomic
+#include <cstddef>        // for std::size_t
+#include <map>            // for std::map
+#include <mutex>          // for std::mutex
+#include <ostream>        // for std::ostream
+#include <set>            // for std::set
+#include <string>         // for std::string
+#include <unordered_map>  // for std::unordered_map
+
+namespace axom
+{
+/*!
+ * \brief Allocation statistics of an allocator or of a label.
+ */
+struct MemoryStats
+{
+  std::size_t liveBytes {0};        /*!< bytes currently allocated */
+  std::size_t peakBytes {0};        /*!< high-water mark of liveBytes */
+  std::size_t numAllocations {0};   /*!< number of allocations */
+  std::size_t numDeallocations {0}; /*!< number of deallocations */
+};
+
+/*!
+ * \class MemoryTracker
+ *
+ * \brief Optional accounting of the memory allocated through axom::allocate(),
+ *  axom::reallocate() and axom::deallocate().
+ *
+ *  When enabled, the tracker records the size, the allocator and the label
+ *  of each allocation, and keeps the live bytes, the peak bytes and the
+ *  allocation counts per allocator ID and per label. Labels identify the
+ *  subsystem that owns the memory, e.g., "spin::BVH", and are set for the
+ *  allocations of the calling thread with a ScopedMemoryLabel. A label is
+ *  only copied into the tracker when an allocation is recorded under it.
+ *  Reallocations keep the allocator and the label of the original allocation.
+ *
+ *  The tracker is disabled by default, in which case the memory management
+ *  routines only pay for checking an atomic flag. Tracking is enabled with
+ *  setEnabled(), or by setting the AXOM_TRACK_MEMORY environment variable to
+ *  a non-zero value. Allocations made while the tracker is disabled are not
+ *  accounted for, even if they are deallocated after it has been enabled.
+ *
+ *  The tracker is a process-wide singleton, accessed via
+ *  MemoryTracker::instance(). Use print(), or slic::logMemoryStats(), for a
+ *  summary of the statistics.
+ *
+ * \see ScopedMemoryLabel
+ */
+class MemoryTracker
+{
+public:
+  /*!
+   * \brief Returns the process-wide MemoryTracker instance.
+   */
+  static MemoryTracker& instance();
+
+  /*!
+   * \brief Returns true iff memory tracking is enabled.
+   */
+  static bool isEnabled()
+  {
+    return s_enabled.load(std::memory_order_relaxed);
+  }
+
+  /*!
+   * \brief Enables or disables memory tracking.
+   *
+   * \note Disabling the tracker does not reset its statistics.
+   */
+  static void setEnabled(bool enabled);
+
+  /// \name Recording
+  /// @{
+
+  /*!
+   * \brief Records an allocation of numbytes bytes at p, with the given
+   *  allocator, under the label of the calling thread.
+   */
+  void recordAllocation(void* p, std::size_t numbytes, int allocatorID);
+
+  /*!
+   * \brief Records the deallocation of p. Untracked pointers are ignored.
+   */
+  void recordDeallocation(void* p);
+
+  /*!
+   * \brief Reallocates oldp with the given function and records the
+   *  reallocation to the returned pointer, with numbytes bytes.
+   *
+   *  The reallocation retains the allocator and the label of oldp. If oldp is
+   *  not tracked, it is recorded as a new allocation with the given allocator.
+   *
+   * \param [in] oldp the pointer to reallocate.
+   * \param [in] numbytes the new size of the allocation.
+   * \param [in] allocatorID the allocator of oldp.
+   * \param [in] reallocate the function that reallocates oldp and returns the
+   *  new pointer.
+   *
+   * \note The reallocation is done while holding the lock of the tracker,
+   *  since oldp may be handed out to another thread as soon as it is freed.
+   *  The lock is recursive, so the function may allocate and deallocate.
+   */
+  template <typename ReallocateFunc>
+  void* recordReallocation(void* oldp,
+                           std::size_t numbytes,
+                           int allocatorID,
+                           ReallocateFunc&& reallocate)
+  {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    void* newp = reallocate();
+    updateRecord(oldp, newp, numbytes, allocatorID);
+    return newp;
+  }
+
+  /// @}
+
+  /// \name Queries
+  /// @{
+
+  /*!
+   * \brief Returns the statistics over all the allocators and labels.
+   */
+  MemoryStats getTotalStats() const;
+
+  /*!
+   * \brief Returns the statistics of each allocator, keyed by allocator ID.
+   */
+  std::map<int, MemoryStats> getStatsByAllocator() const;
+
+  /*!
+   * \brief Returns the statistics of each label.
+   *
+   * \note Allocations made without a label are listed under an empty label.
+   */
+  std::map<std::string, MemoryStats> getStatsByLabel() const;
+
+  /*!
+   * \brief Returns the number of distinct labels that allocations have been
+   *  recorded under.
+   */
+  std::size_t getNumLabels() const;
+
+  /*!
+   * \brief Resets the counts and the peaks. Live allocations remain tracked,
+   *  and the peaks are reset to the current live bytes.
+   */
+  void resetStats();
+
+  /*!
+   * \brief Prints a table of the statistics, per allocator and per label, to
+   *  the given stream.
+   */
+  void print(std::ostream& os) const;
+
+  /// @}
+
+private:
+  /// A live, tracked allocation
+  struct Record
+  {
+    std::size_t numbytes;
+    int allocatorID;
+    const std::string* label;  // interned in m_labels
+  };
+
+  MemoryTracker();
+
+  /// Returns the interned copy of the given label. Expects the lock to be held
+  const std::string* internLabel(const char* label);
+
+  void addAllocation(const Record& record);
+  void removeAllocation(const Record& record);
+
+  /// Moves the record of oldp, if any, to newp. Expects the lock to be held
+  void updateRecord(void* oldp,
+                    void* newp,
+                    std::size_t numbytes,
+                    int allocatorID);
+
+  static std::atomic<bool> s_enabled;
+
+  mutable std::recursive_mutex m_mutex;  // protects the state below
+  std::unordered_map<void*, Record> m_records;
+  std::set<std::string> m_labels;
+  MemoryStats m_total;
+  std::map<int, MemoryStats> m_byAllocator;
+  std::map<const std::string*, MemoryStats> m_byLabel;
+
+  DISABLE_COPY_AND_ASSIGNMENT(MemoryTracker);
+  DISABLE_MOVE_AND_ASSIGNMENT(MemoryTracker);
+};
+
+/*!
+ * \class ScopedMemoryLabel
+ *
+ * \brief Attributes the memory allocated by the calling thread, during the
+ *  lifetime of the ScopedMemoryLabel, to the given label.
+ *
+ *  Labels nest, i.e., the innermost label applies, and the enclosing label is
+ *  restored when the ScopedMemoryLabel goes out of scope.
+ *
+ *  A ScopedMemoryLabel only swaps a thread-local pointer, and does not lock
+ *  or allocate, such that it may be placed on hot paths. The label is
+ *  copied by the MemoryTracker when it records an allocation, so it must
+ *  outlive the ScopedMemoryLabel, e.g., it may be a string literal.
+ *
+ * \code{.cpp}
+ *   {
+ *     axom::ScopedMemoryLabel label("spin::BVH");
+ *     buffer = axom::allocate<double>(n);  // accounted to "spin::BVH"
+ *   }
+ * \endcode
+ */
+class ScopedMemoryLabel
+{
+public:
+  /*!
+   * \brief Sets the label of the calling thread.
+   * \param [in] label the label, e.g., the name of the subsystem.
+   *
+   * \pre label outlives the ScopedMemoryLabel
+   */
+  explicit ScopedMemoryLabel(const char* label);
+
+  /*!
+   * \brief Restores the enclosing label of the calling thread.
+   */
+  ~ScopedMemoryLabel();
+
+private:
+  const char* m_previous;
+
+  DISABLE_COPY_AND_ASSIGNMENT(ScopedMemoryLabel);
+  DISABLE_MOVE_AND_ASSIGNMENT(ScopedMemoryLabel);
+};
+
+} /* namespace axom */
+
+#endif /* AXOM_CORE_MEMORYTRACKER_HPP_ */
@@ -0,0 +1,409 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/config.hpp"
+#include "axom/core/PoolAllocator.hpp"
+#include "axom/core/memory_management.hpp"
+
+#ifdef AXOM_USE_UMPIRE
+  #include "umpire/ResourceManager.hpp"
+  #include "umpire/strategy/DynamicPool.hpp"
+#endif
+
+#include <algorithm>  // for std::min, std::max, std::find
+#include <cstdlib>    // for std::malloc, std::free
+#include <string>     // for std::string
+
+namespace axom
+{
+namespace
+{
+/// Upper bound on the number of bytes held in a thread's cache per size class
+constexpr std::size_t CACHE_BYTES_PER_CLASS = std::size_t(1) << 20;
+
+/// Upper bound on the number of blocks held in a thread's cache per size class
+constexpr int MAX_CACHED_BLOCKS = 256;
+
+/// Lower bound on the number of blocks held in a thread's cache per size class
+constexpr int MIN_CACHED_BLOCKS = 4;
+
+// NOTE: the counters of a ThreadCache are only written by the owning thread,
+// hence, they do not need an atomic read-modify-write
+template <typename T, typename U>
+inline void increment(std::atomic<T>& counter, U value)
+{
+  counter.store(counter.load(std::memory_order_relaxed) + static_cast<T>(value),
+                std::memory_order_relaxed);
+}
+
+template <typename T, typename U>
+inline void decrement(std::atomic<T>& counter, U value)
+{
+  counter.store(counter.load(std::memory_order_relaxed) - static_cast<T>(value),
+                std::memory_order_relaxed);
+}
+
+}  // end anonymous namespace
+
+//------------------------------------------------------------------------------
+struct PoolAllocator::ThreadCacheOwner
+{
+  ThreadCacheOwner()
+  {
+    for(int c = 0; c < NUM_SIZE_CLASSES; ++c)
+    {
+      cache.heads[c] = nullptr;
+      cache.counts[c] = 0;
+    }
+    cache.numAllocations = 0;
+    cache.numDeallocations = 0;
+    cache.numCacheHits = 0;
+    cache.numLargeAllocations = 0;
+    cache.bytesInUse = 0;
+
+    PoolAllocator::instance().registerCache(&cache);
+  }
+
+  ~ThreadCacheOwner()
+  {
+    s_cache = nullptr;
+    s_retired = true;
+    PoolAllocator::instance().retireCache(&cache);
+  }
+
+  ThreadCache cache;
+
+  // NOTE: trivially destructible, hence, still valid while the thread-local
+  // ThreadCacheOwner is destroyed and after, e.g., for deallocations from the
+  // destructors of static objects
+  static thread_local ThreadCache* s_cache;
+  static thread_local bool s_retired;
+};
+
+thread_local PoolAllocator::ThreadCache*
+  PoolAllocator::ThreadCacheOwner::s_cache = nullptr;
+thread_local bool PoolAllocator::ThreadCacheOwner::s_retired = false;
+
+// NOTE: C++11 requires a definition of ODR-used static constexpr members
+constexpr std::size_t PoolAllocator::MIN_BLOCK_SIZE;
+constexpr int PoolAllocator::NUM_SIZE_CLASSES;
+constexpr std::size_t PoolAllocator::MAX_BLOCK_SIZE;
+constexpr std::size_t PoolAllocator::SLAB_SIZE;
+
+//------------------------------------------------------------------------------
+PoolAllocator& PoolAllocator::instance()
+{
+  // NOTE: intentionally leaked, so that blocks may be returned to the pool
+  // from the destructors of other static objects
+  static PoolAllocator* pool = new PoolAllocator;
+  return *pool;
+}
+
+//------------------------------------------------------------------------------
+PoolAllocator::PoolAllocator() : m_bytesReserved(0), m_retiredBytesInUse(0)
+{ }
+
+//------------------------------------------------------------------------------
+PoolAllocator::ThreadCache* PoolAllocator::getThreadCache()
+{
+  if(ThreadCacheOwner::s_cache == nullptr && !ThreadCacheOwner::s_retired)
+  {
+    thread_local ThreadCacheOwner owner;
+    ThreadCacheOwner::s_cache = &owner.cache;
+  }
+  return ThreadCacheOwner::s_cache;
+}
+
+//------------------------------------------------------------------------------
+int PoolAllocator::getSizeClass(std::size_t numbytes)
+{
+  int sizeClass = 0;
+  std::size_t blockSize = MIN_BLOCK_SIZE;
+  while(blockSize < numbytes)
+  {
+    blockSize <<= 1;
+    ++sizeClass;
+  }
+  return sizeClass;
+}
+
+//------------------------------------------------------------------------------
+int PoolAllocator::getCacheCapacity(int sizeClass)
+{
+  const std::size_t blockSize = MIN_BLOCK_SIZE << sizeClass;
+  const int capacity = static_cast<int>(CACHE_BYTES_PER_CLASS / blockSize);
+  return std::max(MIN_CACHED_BLOCKS, std::min(MAX_CACHED_BLOCKS, capacity));
+}
+
+//------------------------------------------------------------------------------
+std::size_t PoolAllocator::getBlockSize(std::size_t numbytes)
+{
+  if(numbytes > MAX_BLOCK_SIZE)
+  {
+    return numbytes;
+  }
+  return MIN_BLOCK_SIZE << getSizeClass(numbytes);
+}
+
+//------------------------------------------------------------------------------
+void* PoolAllocator::allocate(std::size_t numbytes)
+{
+  ThreadCache* cache = getThreadCache();
+
+  if(numbytes > MAX_BLOCK_SIZE)
+  {
+    void* p = std::malloc(numbytes);
+    if(p != nullptr && cache != nullptr)
+    {
+      increment(cache->numAllocations, 1);
+      increment(cache->numLargeAllocations, 1);
+      increment(cache->bytesInUse, numbytes);
+    }
+    return p;
+  }
+
+  const int sizeClass = getSizeClass(numbytes);
+  const std::size_t blockSize = MIN_BLOCK_SIZE << sizeClass;
+
+  if(cache == nullptr)
+  {
+    // the calling thread is exiting, bypass its cache
+    FreeList& list = m_freeLists[sizeClass];
+    std::lock_guard<std::mutex> lock(list.mutex);
+    if(list.head != nullptr)
+    {
+      FreeBlock* block = list.head;
+      list.head = block->next;
+      --list.count;
+      return block;
+    }
+    m_bytesReserved += blockSize;
+    return std::malloc(blockSize);
+  }
+
+  bool hit = true;
+  if(cache->heads[sizeClass] == nullptr)
+  {
+    hit = false;
+    if(!refill(*cache, sizeClass, getCacheCapacity(sizeClass) / 2))
+    {
+      return nullptr;
+    }
+  }
+
+  FreeBlock* block = cache->heads[sizeClass];
+  cache->heads[sizeClass] = block->next;
+  --cache->counts[sizeClass];
+
+  increment(cache->numAllocations, 1);
+  if(hit)
+  {
+    increment(cache->numCacheHits, 1);
+  }
+  increment(cache->bytesInUse, blockSize);
+
+  return block;
+}
+
+//------------------------------------------------------------------------------
+void PoolAllocator::deallocate(void* p, std::size_t numbytes)
+{
+  if(p == nullptr)
+  {
+    return;
+  }
+
+  ThreadCache* cache = getThreadCache();
+  const std::size_t blockSize = getBlockSize(numbytes);
+
+  if(cache != nullptr)
+  {
+    increment(cache->numDeallocations, 1);
+    decrement(cache->bytesInUse, blockSize);
+  }
+
+  if(numbytes > MAX_BLOCK_SIZE)
+  {
+    std::free(p);
+    return;
+  }
+
+  const int sizeClass = getSizeClass(numbytes);
+  FreeBlock* block = static_cast<FreeBlock*>(p);
+
+  if(cache == nullptr)
+  {
+    // the calling thread is exiting, bypass its cache
+    FreeList& list = m_freeLists[sizeClass];
+    std::lock_guard<std::mutex> lock(list.mutex);
+    block->next = list.head;
+    list.head = block;
+    ++list.count;
+    return;
+  }
+
+  block->next = cache->heads[sizeClass];
+  cache->heads[sizeClass] = block;
+  ++cache->counts[sizeClass];
+
+  const int capacity = getCacheCapacity(sizeClass);
+  if(cache->counts[sizeClass] > capacity)
+  {
+    spill(*cache, sizeClass, cache->counts[sizeClass] - capacity / 2);
+  }
+}
+
+//------------------------------------------------------------------------------
+bool PoolAllocator::refill(ThreadCache& cache, int sizeClass, int n)
+{
+  const std::size_t blockSize = MIN_BLOCK_SIZE << sizeClass;
+  FreeList& list = m_freeLists[sizeClass];
+  n = std::max(n, 1);
+
+  std::lock_guard<std::mutex> lock(list.mutex);
+
+  if(list.head == nullptr)
+  {
+    // carve a new slab, holding at least n blocks
+    const std::size_t slabSize =
+      std::max(SLAB_SIZE, blockSize * static_cast<std::size_t>(n));
+    char* slab = static_cast<char*>(std::malloc(slabSize));
+    if(slab == nullptr)
+    {
+      return false;
+    }
+    m_bytesReserved += slabSize;
+
+    const std::size_t numBlocks = slabSize / blockSize;
+    for(std::size_t i = numBlocks; i-- > 0;)
+    {
+      FreeBlock* block = reinterpret_cast<FreeBlock*>(slab + i * blockSize);
+      block->next = list.head;
+      list.head = block;
+    }
+    list.count += static_cast<int>(numBlocks);
+  }
+
+  for(int i = 0; i < n && list.head != nullptr; ++i)
+  {
+    FreeBlock* block = list.head;
+    list.head = block->next;
+    --list.count;
+
+    block->next = cache.heads[sizeClass];
+    cache.heads[sizeClass] = block;
+    ++cache.counts[sizeClass];
+  }
+
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void PoolAllocator::spill(ThreadCache& cache, int sizeClass, int n)
+{
+  if(n <= 0)
+  {
+    return;
+  }
+
+  // detach the first n blocks of the cache as a chain
+  FreeBlock* first = cache.heads[sizeClass];
+  FreeBlock* last = first;
+  for(int i = 1; i < n; ++i)
+  {
+    last = last->next;
+  }
+  cache.heads[sizeClass] = last->next;
+  cache.counts[sizeClass] -= n;
+
+  FreeList& list = m_freeLists[sizeClass];
+  std::lock_guard<std::mutex> lock(list.mutex);
+  last->next = list.head;
+  list.head = first;
+  list.count += n;
+}
+
+//------------------------------------------------------------------------------
+void PoolAllocator::flushThreadCache()
+{
+  ThreadCache* cache = getThreadCache();
+  if(cache == nullptr)
+  {
+    return;
+  }
+
+  for(int c = 0; c < NUM_SIZE_CLASSES; ++c)
+  {
+    spill(*cache, c, cache->counts[c]);
+  }
+}
+
+//------------------------------------------------------------------------------
+void PoolAllocator::registerCache(ThreadCache* cache)
+{
+  std::lock_guard<std::mutex> lock(m_cachesMutex);
+  m_caches.push_back(cache);
+}
+
+//------------------------------------------------------------------------------
+void PoolAllocator::retireCache(ThreadCache* cache)
+{
+  for(int c = 0; c < NUM_SIZE_CLASSES; ++c)
+  {
+    spill(*cache, c, cache->counts[c]);
+  }
+
+  std::lock_guard<std::mutex> lock(m_cachesMutex);
+  m_caches.erase(std::find(m_caches.begin(), m_caches.end(), cache));
+
+  m_retiredStats.numAllocations += cache->numAllocations;
+  m_retiredStats.numDeallocations += cache->numDeallocations;
+  m_retiredStats.numCacheHits += cache->numCacheHits;
+  m_retiredStats.numLargeAllocations += cache->numLargeAllocations;
+  m_retiredBytesInUse += cache->bytesInUse;
+}
+
+//------------------------------------------------------------------------------
+PoolAllocatorStats PoolAllocator::getStats() const
+{
+  std::lock_guard<std::mutex> lock(m_cachesMutex);
+
+  PoolAllocatorStats stats = m_retiredStats;
+  long long bytesInUse = m_retiredBytesInUse;
+  for(const ThreadCache* cache : m_caches)
+  {
+    stats.numAllocations += cache->numAllocations;
+    stats.numDeallocations += cache->numDeallocations;
+    stats.numCacheHits += cache->numCacheHits;
+    stats.numLargeAllocations += cache->numLargeAllocations;
+    bytesInUse += cache->bytesInUse;
+  }
+
+  stats.bytesInUse = static_cast<std::size_t>(std::max(bytesInUse, 0LL));
+  stats.bytesReserved = m_bytesReserved;
+  return stats;
+}
+
+//------------------------------------------------------------------------------
+int getPoolAllocatorID()
+{
+#ifdef AXOM_USE_UMPIRE
+  static const int poolID = []() {
+    umpire::ResourceManager& rm = umpire::ResourceManager::getInstance();
+    const std::string name = "AXOM_POOL";
+    if(!rm.isAllocator(name))
+    {
+      rm.makeAllocator<umpire::strategy::DynamicPool>(name,
+                                                      rm.getAllocator("HOST"));
+    }
+    return rm.getAllocator(name).getId();
+  }();
+  return poolID;
+#else
+  return internal::POOL_ALLOCATOR_ID;
+#endif
+}
+
+} /* namespace axom */
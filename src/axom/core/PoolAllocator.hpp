@@ -0,0 +1,194 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_CORE_POOLALLOCATOR_HPP_
+#define AXOM_CORE_POOLALLOCATOR_HPP_
+
+#include "axom/config.hpp"       // for compile-time definitions
+#include "axom/core/Macros.hpp"  // for DISABLE_COPY_AND_ASSIGNMENT
+
+// C/C++ includes
+#include <atomic>   // for std::atomic
+#include <cstddef>  // for std::size_t
+#include <mutex>    // for std::mutex
+#include <vector>   // for std::vector
+
+namespace axom
+{
+/*!
+ * \brief Usage statistics of the PoolAllocator, accumulated over all threads.
+ */
+struct PoolAllocatorStats
+{
+  std::size_t numAllocations {0};       /*!< number of allocate() calls */
+  std::size_t numDeallocations {0};     /*!< number of deallocate() calls */
+  std::size_t numCacheHits {0};         /*!< allocations served by a cache */
+  std::size_t numLargeAllocations {0};  /*!< allocations > MAX_BLOCK_SIZE */
+  std::size_t bytesInUse {0};           /*!< bytes currently allocated */
+  std::size_t bytesReserved {0};        /*!< bytes held in the slabs */
+};
+
+/*!
+ * \class PoolAllocator
+ *
+ * \brief A thread-safe, size-class pooled allocator for host memory.
+ *
+ *  Requests are rounded up to a power-of-two size class, from MIN_BLOCK_SIZE
+ *  to MAX_BLOCK_SIZE bytes. The blocks of each size class are carved out of
+ *  large slabs that are requested from the system allocator and recycled
+ *  through free lists. Each thread keeps a small cache of free blocks per
+ *  size class, hence, most allocations and deallocations do not take a lock.
+ *  Blocks are exchanged with the shared free lists in batches when a cache
+ *  runs empty or overflows, and the cache of a thread is returned to the
+ *  shared free lists when the thread exits.
+ *
+ *  Requests larger than MAX_BLOCK_SIZE are forwarded to std::malloc().
+ *
+ *  The pool is a process-wide singleton, accessed via
+ *  PoolAllocator::instance(), and never returns its slabs to the system. It is the allocator behind
+ *  axom::getPoolAllocatorID() when Axom is built without Umpire. Short-lived
+ *  buffers that are allocated repeatedly, e.g., the scratch arrays of a query,
+ *  can opt into the pool by passing that ID to axom::allocate(), axom::Array,
+ *  sidre::Buffer::allocate(), or the spin BVH.
+ *
+ * \note Unlike std::free(), deallocate() requires the size of the block,
+ *  which axom::deallocate() records in front of each allocation.
+ *
+ * \see axom::getPoolAllocatorID()
+ */
+class PoolAllocator
+{
+public:
+  /// The smallest size class, in bytes
+  static constexpr std::size_t MIN_BLOCK_SIZE = 32;
+
+  /// The number of size classes, i.e., powers of two from MIN_BLOCK_SIZE
+  static constexpr int NUM_SIZE_CLASSES = 14;
+
+  /// The largest size class, in bytes, i.e., 256 KiB
+  static constexpr std::size_t MAX_BLOCK_SIZE = MIN_BLOCK_SIZE
+    << (NUM_SIZE_CLASSES - 1);
+
+  /// The size of the slabs that are carved into blocks, in bytes
+  static constexpr std::size_t SLAB_SIZE = std::size_t(1) << 20;
+
+  /*!
+   * \brief Returns the process-wide PoolAllocator instance.
+   */
+  static PoolAllocator& instance();
+
+  /*!
+   * \brief Allocates a block of at least the given number of bytes.
+   *
+   * \param [in] numbytes the number of bytes to allocate.
+   * \return p pointer to the block, aligned to at least 16 bytes, or a nullptr
+   *  if the allocation failed.
+   */
+  void* allocate(std::size_t numbytes);
+
+  /*!
+   * \brief Returns a block to the pool.
+   *
+   * \param [in] p pointer to a block returned by allocate(), or a nullptr.
+   * \param [in] numbytes the number of bytes p was allocated with.
+   */
+  void deallocate(void* p, std::size_t numbytes);
+
+  /*!
+   * \brief Returns the actual number of bytes of the block that serves a
+   *  request of the given number of bytes.
+   */
+  static std::size_t getBlockSize(std::size_t numbytes);
+
+  /*!
+   * \brief Returns the usage statistics of the pool.
+   *
+   * \note The statistics are a snapshot, which may be stale by the time they
+   *  are returned if other threads are using the pool concurrently.
+   */
+  PoolAllocatorStats getStats() const;
+
+  /*!
+   * \brief Returns the free blocks of the calling thread's cache to the
+   *  shared free lists, e.g., before a thread goes idle for a long time.
+   */
+  void flushThreadCache();
+
+private:
+  /// A free block, linked in the free list of its size class
+  struct FreeBlock
+  {
+    FreeBlock* next;
+  };
+
+  /// The per-thread cache of free blocks and usage counters
+  struct ThreadCache
+  {
+    FreeBlock* heads[NUM_SIZE_CLASSES];
+    int counts[NUM_SIZE_CLASSES];
+
+    // only updated by the owning thread; atomic for concurrent getStats()
+    std::atomic<std::size_t> numAllocations;
+    std::atomic<std::size_t> numDeallocations;
+    std::atomic<std::size_t> numCacheHits;
+    std::atomic<std::size_t> numLargeAllocations;
+    std::atomic<long long> bytesInUse;
+  };
+
+  /// Owns the cache of a thread and retires it when the thread exits
+  struct ThreadCacheOwner;
+
+  /// The shared free list of a size class
+  struct FreeList
+  {
+    std::mutex mutex;
+    FreeBlock* head {nullptr};
+    int count {0};
+  };
+
+  PoolAllocator();
+
+  /// Returns the cache of the calling thread, or a nullptr once it has retired
+  static ThreadCache* getThreadCache();
+
+  static int getSizeClass(std::size_t numbytes);
+  static int getCacheCapacity(int sizeClass);
+
+  /// Moves up to n blocks of the given size class from the shared free list,
+  /// carving a new slab if needed, to the cache. Returns false if out of memory
+  bool refill(ThreadCache& cache, int sizeClass, int n);
+
+  /// Moves n blocks of the given size class from the cache to the free list
+  void spill(ThreadCache& cache, int sizeClass, int n);
+
+  void registerCache(ThreadCache* cache);
+  void retireCache(ThreadCache* cache);
+
+  FreeList m_freeLists[NUM_SIZE_CLASSES];
+  std::atomic<std::size_t> m_bytesReserved;
+
+  mutable std::mutex m_cachesMutex;  // protects the state below
+  std::vector<ThreadCache*> m_caches;
+  PoolAllocatorStats m_retiredStats;
+  long long m_retiredBytesInUse;
+
+  DISABLE_COPY_AND_ASSIGNMENT(PoolAllocator);
+  DISABLE_MOVE_AND_ASSIGNMENT(PoolAllocator);
+};
+
+/*!
+ * \brief Returns the ID of the pooled host allocator.
+ *
+ *  When Axom is built with Umpire, the pool is an Umpire DynamicPool over the
+ *  HOST allocator, which is created on first use. Otherwise, it is the built-in
+ *  PoolAllocator.
+ *
+ * \post ID != INVALID_ALLOCATOR_ID
+ */
+int getPoolAllocatorID();
+
+} /* namespace axom */
+
+#endif /* AXOM_CORE_POOLALLOCATOR_HPP_ */
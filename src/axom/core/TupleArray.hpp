@@ -0,0 +1,402 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_TUPLEARRAY_HPP_
+#define AXOM_TUPLEARRAY_HPP_
+
+#include "axom/config.hpp"                  // for compile-time defines
+#include "axom/core/Macros.hpp"             // for axom macros
+#include "axom/core/memory_management.hpp"  // for memory allocation functions
+#include "axom/core/TupleView.hpp"          // for TupleView, layouts
+#include "axom/core/Types.hpp"              // for IndexType definition
+
+// C/C++ includes
+#include <cassert>      // for assert()
+#include <type_traits>  // for std::is_trivially_copyable
+
+namespace axom
+{
+/*!
+ * \class TupleArray
+ *
+ * \brief An owning, resizable container of tuples with a compile-time number
+ *  of components, in a given memory layout.
+ *
+ *  A TupleArray complements the Array class, whose number of components is
+ *  set at runtime and whose tuples are always interleaved, i.e., in the AoS
+ *  layout. The default layout of a TupleArray is the SoA layout, in which each
+ *  component is contiguous, such that a loop over a component, e.g., the
+ *  x-coordinates of a set of points, vectorizes. The components are padded to
+ *  a multiple of COMPONENT_ALIGNMENT bytes, hence, they are aligned to a
+ *  cache line when the buffer is, e.g., when it is allocated with the
+ *  allocator returned by axom::getAlignedAllocatorID(). The AoSoA< W >
+ *  layout keeps the components of a tuple within the same block of W tuples,
+ *  for kernels that access all the components of each tuple.
+ *
+ *  All the tuples are stored in a single buffer, allocated by the given
+ *  allocator. Element access is through operator()( i, c ), or through the
+ *  proxy returned by operator[]( i ). Kernels should access the tuples through
+ *  view(), which is small and trivially copyable, and is captured in device
+ *  lambdas.
+ *
+ *  Example Usage:
+ *  \code
+ *
+ *    axom::TupleArray< double, 3 > pts( n );
+ *    auto v = pts.view();
+ *    axom::for_all< exec >( n, AXOM_LAMBDA( axom::IndexType i )
+ *    {
+ *      v( i, 0 ) = ...; v( i, 1 ) = ...; v( i, 2 ) = ...;
+ *    } );
+ *
+ *    const double* x = pts.getComponent( 0 );  // SoA layout only
+ *
+ *  \endcode
+ *
+ * \tparam T the type of the components, which must be trivially copyable.
+ * \tparam N the number of components per tuple.
+ * \tparam Layout the memory layout, i.e., layout::SoA (the default),
+ *  layout::AoS or layout::AoSoA< W >.
+ *
+ * \note The resize operations copy the tuples with axom::copy(), and hence
+ *  support any allocator. The element accessors and fill() dereference the
+ *  buffer on the host.
+ *
+ * \see TupleView, Array
+ */
+template <typename T, int N, typename Layout = layout::SoA>
+class TupleArray
+{
+  static_assert(std::is_trivially_copyable<T>::value,
+                "TupleArray requires a trivially copyable type");
+  static_assert(N > 0, "A tuple must have at least one component");
+
+public:
+  using ViewType = TupleView<T, N, Layout>;
+  using ConstViewType = TupleView<const T, N, Layout>;
+
+  static constexpr double DEFAULT_RESIZE_RATIO = 2.0;
+
+  /// The alignment of each component of the SoA layout, in bytes
+  static constexpr std::size_t COMPONENT_ALIGNMENT = 64;
+
+public:
+  /*!
+   * \brief Constructs a TupleArray with the given number of tuples.
+   *
+   * \param [in] num_tuples the number of tuples (optional).
+   * \param [in] capacity the number of tuples to allocate space for
+   *  (optional). Defaults to num_tuples.
+   * \param [in] allocator_id the ID of the allocator to use (optional).
+   *
+   * \note The values of the tuples are not initialized.
+   *
+   * \post size() == num_tuples
+   * \post capacity() >= max( num_tuples, capacity )
+   */
+  explicit TupleArray(IndexType num_tuples = 0,
+                      IndexType capacity = 0,
+                      int allocator_id = getDefaultAllocatorID())
+    : m_allocator_id(allocator_id)
+  {
+    assert(num_tuples >= 0);
+    assert(capacity >= 0);
+
+    reallocate(num_tuples > capacity ? num_tuples : capacity);
+    m_num_tuples = num_tuples;
+  }
+
+  /*!
+   * \brief Move constructor.
+   *
+   * \post other.size() == 0
+   */
+  TupleArray(TupleArray&& other) noexcept
+    : m_data(other.m_data)
+    , m_num_tuples(other.m_num_tuples)
+    , m_capacity(other.m_capacity)
+    , m_resize_ratio(other.m_resize_ratio)
+    , m_allocator_id(other.m_allocator_id)
+  {
+    other.m_data = nullptr;
+    other.m_num_tuples = 0;
+    other.m_capacity = 0;
+  }
+
+  /*!
+   * \brief Move assignment.
+   *
+   * \post other.size() == 0
+   */
+  TupleArray& operator=(TupleArray&& other) noexcept
+  {
+    if(this != &other)
+    {
+      deallocate(m_data);
+      m_data = other.m_data;
+      m_num_tuples = other.m_num_tuples;
+      m_capacity = other.m_capacity;
+      m_resize_ratio = other.m_resize_ratio;
+      m_allocator_id = other.m_allocator_id;
+
+      other.m_data = nullptr;
+      other.m_num_tuples = 0;
+      other.m_capacity = 0;
+    }
+    return *this;
+  }
+
+  /*!
+   * \brief Destructor, frees the buffer of the tuples.
+   */
+  ~TupleArray() { deallocate(m_data); }
+
+  /// \name Attributes
+  /// @{
+
+  /*!
+   * \brief Returns the number of tuples.
+   */
+  IndexType size() const { return m_num_tuples; }
+
+  /*!
+   * \brief Returns true iff the TupleArray has no tuples.
+   */
+  bool empty() const { return m_num_tuples == 0; }
+
+  /*!
+   * \brief Returns the number of tuples that fit in the buffer.
+   */
+  IndexType capacity() const { return m_capacity; }
+
+  /*!
+   * \brief Returns the number of components per tuple.
+   */
+  static constexpr int numComponents() { return N; }
+
+  /*!
+   * \brief Sets the ratio by which the capacity grows when append() exceeds
+   *  the capacity.
+   */
+  void setResizeRatio(double ratio) { m_resize_ratio = ratio; }
+
+  /*!
+   * \brief Returns the ratio by which the capacity grows.
+   */
+  double getResizeRatio() const { return m_resize_ratio; }
+
+  /*!
+   * \brief Returns the ID of the allocator of the buffer.
+   */
+  int getAllocatorID() const { return m_allocator_id; }
+
+  /// @}
+
+  /// \name Element access
+  /// @{
+
+  /*!
+   * \brief Returns a reference to the given component of the given tuple.
+   *
+   * \pre 0 <= i < size()
+   * \pre 0 <= c < N
+   */
+  /// @{
+  T& operator()(IndexType i, int c) { return view()(i, c); }
+  const T& operator()(IndexType i, int c) const { return view()(i, c); }
+  /// @}
+
+  /*!
+   * \brief Returns a proxy of the given tuple.
+   *
+   * \pre 0 <= i < size()
+   */
+  /// @{
+  typename ViewType::TupleRefType operator[](IndexType i) { return view()[i]; }
+  typename ConstViewType::TupleRefType operator[](IndexType i) const
+  {
+    return view()[i];
+  }
+  /// @}
+
+  /*!
+   * \brief Returns a pointer to the contiguous elements of the given
+   *  component, which is only valid for the SoA layout.
+   *
+   * \pre 0 <= c < N
+   */
+  /// @{
+  T* getComponent(int c) { return view().getComponent(c); }
+  const T* getComponent(int c) const { return view().getComponent(c); }
+  /// @}
+
+  /*!
+   * \brief Returns a pointer to the buffer of the tuples.
+   */
+  /// @{
+  T* getData() { return m_data; }
+  const T* getData() const { return m_data; }
+  /// @}
+
+  /*!
+   * \brief Returns a view of the tuples, for use in kernels.
+   *
+   * \note The view is invalidated when the buffer is reallocated.
+   */
+  /// @{
+  ViewType view() { return ViewType(m_data, m_num_tuples, m_capacity); }
+  ConstViewType view() const
+  {
+    return ConstViewType(m_data, m_num_tuples, m_capacity);
+  }
+  /// @}
+
+  /// @}
+
+  /// \name Modifiers
+  /// @{
+
+  /*!
+   * \brief Sets all the components of all the tuples to the given value.
+   */
+  void fill(const T& value)
+  {
+    ViewType v = view();
+    for(IndexType i = 0; i < m_num_tuples; ++i)
+    {
+      for(int c = 0; c < N; ++c)
+      {
+        v(i, c) = value;
+      }
+    }
+  }
+
+  /*!
+   * \brief Appends a tuple.
+   *
+   * \param [in] tuple the N components of the tuple.
+   *
+   * \post size() is incremented by one.
+   */
+  void append(const T* tuple)
+  {
+    assert(tuple != nullptr);
+
+    if(m_num_tuples == m_capacity)
+    {
+      const IndexType grown =
+        static_cast<IndexType>(m_capacity * m_resize_ratio + 0.5);
+      reallocate(grown > m_capacity ? grown : m_capacity + 1);
+    }
+
+    ++m_num_tuples;
+    view().store(m_num_tuples - 1, tuple);
+  }
+
+  /*!
+   * \brief Sets the number of tuples, reallocating the buffer if the new
+   *  number of tuples exceeds the capacity. New tuples are not initialized.
+   *
+   * \post size() == num_tuples
+   */
+  void resize(IndexType num_tuples)
+  {
+    assert(num_tuples >= 0);
+    if(num_tuples > m_capacity)
+    {
+      reallocate(num_tuples);
+    }
+    m_num_tuples = num_tuples;
+  }
+
+  /*!
+   * \brief Ensures that the buffer fits at least the given number of tuples.
+   *
+   * \post capacity() >= capacity
+   */
+  void reserve(IndexType capacity)
+  {
+    if(capacity > m_capacity)
+    {
+      reallocate(capacity);
+    }
+  }
+
+  /*!
+   * \brief Shrinks the buffer to the smallest capacity that fits size().
+   */
+  void shrink() { reallocate(m_num_tuples); }
+
+  /// @}
+
+private:
+  /// Returns the smallest valid capacity that is at least the given capacity
+  static IndexType roundCapacity(IndexType capacity)
+  {
+    // align the components of the SoA layout to COMPONENT_ALIGNMENT
+    constexpr IndexType SOA_MULTIPLE = (sizeof(T) < COMPONENT_ALIGNMENT &&
+                                        COMPONENT_ALIGNMENT % sizeof(T) == 0)
+      ? COMPONENT_ALIGNMENT / sizeof(T)
+      : 1;
+    constexpr IndexType MULTIPLE =
+      Layout::CONTIGUOUS_COMPONENTS ? SOA_MULTIPLE : Layout::CAPACITY_MULTIPLE;
+
+    return (capacity + MULTIPLE - 1) / MULTIPLE * MULTIPLE;
+  }
+
+  /// Moves the tuples to a new buffer with (at least) the given capacity
+  void reallocate(IndexType capacity)
+  {
+    capacity = roundCapacity(capacity);
+    if(capacity == m_capacity)
+    {
+      return;
+    }
+
+    T* data = allocate<T>(static_cast<std::size_t>(capacity) * N,
+                          m_allocator_id);
+    assert(data != nullptr || capacity == 0);
+
+    if(m_num_tuples > 0)
+    {
+      if(Layout::CONTIGUOUS_COMPONENTS)
+      {
+        // the components of the SoA layout are offset by the capacity
+        for(int c = 0; c < N; ++c)
+        {
+          const IndexType src = c * m_capacity;
+          const IndexType dst = c * capacity;
+          copy(data + dst, m_data + src, m_num_tuples * sizeof(T));
+        }
+      }
+      else
+      {
+        // the other layouts do not depend on the capacity, copy the prefix of
+        // the buffer up to the last tuple
+        const IndexType last = m_num_tuples - 1;
+        const IndexType numElements =
+          Layout::template tupleOffset<N>(last) +
+          Layout::template componentOffset<N>(N - 1, m_capacity) + 1;
+        copy(data, m_data, numElements * sizeof(T));
+      }
+    }
+
+    deallocate(m_data);
+    m_data = data;
+    m_capacity = capacity;
+  }
+
+  T* m_data {nullptr};
+  IndexType m_num_tuples {0};
+  IndexType m_capacity {0};
+  double m_resize_ratio {DEFAULT_RESIZE_RATIO};
+  int m_allocator_id;
+
+  DISABLE_COPY_AND_ASSIGNMENT(TupleArray);
+};
+
+} /* namespace axom */
+
+#endif /* AXOM_TUPLEARRAY_HPP_ */
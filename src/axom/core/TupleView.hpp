@@ -0,0 +1,408 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_TUPLEVIEW_HPP_
+#define AXOM_TUPLEVIEW_HPP_
+
+#include "axom/config.hpp"           // for compile-time defines
+#include "axom/core/Array.hpp"       // for axom::Array
+#include "axom/core/Macros.hpp"      // for axom macros
+#include "axom/core/StackArray.hpp"  // for axom::StackArray
+#include "axom/core/Types.hpp"       // for IndexType
+
+// C/C++ includes
+#include <cassert>      // for assert()
+#include <type_traits>  // for std::remove_const, std::is_same
+
+namespace axom
+{
+/*!
+ * \brief The memory layouts of a set of tuples with N components each.
+ *
+ *  Each layout maps component c of tuple i to the element at
+ *  base( c ) + tupleOffset( i ), where base( c ) is the address of the first
+ *  element of component c. Hence, a set of tuples is described by the N
+ *  base pointers of its components, regardless of its layout.
+ *
+ *  * <b> SoA </b>, i.e., structure of arrays: each component is contiguous,
+ *    e.g., { x0, x1, ..., y0, y1, ..., z0, z1, ... }, which is the layout of
+ *    the coordinates of the mint meshes, and suits vectorized kernels.
+ *
+ *  * <b> AoS </b>, i.e., array of structures: the components of a tuple are
+ *    contiguous, e.g., { x0, y0, z0, x1, y1, z1, ... }, which is the layout of
+ *    a multi-component axom::Array, and of an array of primal::Point.
+ *
+ *  * <b> AoSoA<W> </b>, i.e., array of structures of arrays: the tuples are
+ *    stored in blocks of W tuples, with the SoA layout within each block,
+ *    e.g., { x0, x1, y0, y1, z0, z1, x2, x3, y2, y3, ... } for W = 2. A block
+ *    of a component fills a SIMD register when W is the SIMD width, while the
+ *    components of a tuple remain close in memory.
+ *
+ * \see TupleView, TupleArray
+ */
+namespace layout
+{
+/// Structure of arrays, i.e., each component is contiguous
+struct SoA
+{
+  template <int N>
+  AXOM_HOST_DEVICE static constexpr IndexType tupleOffset(IndexType i)
+  {
+    return i;
+  }
+
+  /// The offset of the first element of a component, in a single buffer
+  template <int N>
+  static constexpr IndexType componentOffset(int c, IndexType stride)
+  {
+    return c * stride;
+  }
+
+  /// The number of tuples of a buffer are a multiple of this value
+  static constexpr IndexType CAPACITY_MULTIPLE = 1;
+
+  static constexpr bool CONTIGUOUS_COMPONENTS = true;
+};
+
+/// Array of structures, i.e., the components of each tuple are contiguous
+struct AoS
+{
+  template <int N>
+  AXOM_HOST_DEVICE static constexpr IndexType tupleOffset(IndexType i)
+  {
+    return i * N;
+  }
+
+  template <int N>
+  static constexpr IndexType componentOffset(int c, IndexType)
+  {
+    return c;
+  }
+
+  static constexpr IndexType CAPACITY_MULTIPLE = 1;
+
+  static constexpr bool CONTIGUOUS_COMPONENTS = false;
+};
+
+/// Array of structures of arrays, i.e., blocks of W tuples in the SoA layout
+template <int W>
+struct AoSoA
+{
+  static_assert(W > 0, "The width of an AoSoA block must be positive");
+
+  template <int N>
+  AXOM_HOST_DEVICE static constexpr IndexType tupleOffset(IndexType i)
+  {
+    return (i / W) * W * N + i % W;
+  }
+
+  template <int N>
+  static constexpr IndexType componentOffset(int c, IndexType)
+  {
+    return c * W;
+  }
+
+  static constexpr IndexType CAPACITY_MULTIPLE = W;
+
+  static constexpr bool CONTIGUOUS_COMPONENTS = false;
+};
+
+} /* namespace layout */
+
+/*!
+ * \class TupleRef
+ *
+ * \brief A reference to a tuple of a TupleView or a TupleArray, i.e., a proxy
+ *  whose components alias the elements of the tuple, in any layout.
+ *
+ * \tparam T the type of the components, const-qualified for read-only access.
+ * \tparam N the number of components.
+ * \tparam Layout the memory layout of the tuples.
+ */
+template <typename T, int N, typename Layout>
+class TupleRef
+{
+public:
+  using ValueType = typename std::remove_const<T>::type;
+
+  AXOM_HOST_DEVICE TupleRef(const StackArray<T*, N>& components,
+                            IndexType offset)
+    : m_components(components)
+    , m_offset(offset)
+  { }
+
+  /*!
+   * \brief Returns the number of components of the tuple.
+   */
+  AXOM_HOST_DEVICE static constexpr int size() { return N; }
+
+  /*!
+   * \brief Returns a reference to the given component of the tuple.
+   *
+   * \pre 0 <= c < N
+   */
+  AXOM_HOST_DEVICE T& operator[](int c) const
+  {
+    return m_components[c][m_offset];
+  }
+
+  /*!
+   * \brief Copies the components of the tuple into the given buffer, e.g.,
+   *  the data() of a primal::Point.
+   */
+  AXOM_HOST_DEVICE void load(ValueType* values) const
+  {
+    for(int c = 0; c < N; ++c)
+    {
+      values[c] = m_components[c][m_offset];
+    }
+  }
+
+  /*!
+   * \brief Copies the given N values into the components of the tuple.
+   */
+  AXOM_HOST_DEVICE void store(const ValueType* values) const
+  {
+    for(int c = 0; c < N; ++c)
+    {
+      m_components[c][m_offset] = values[c];
+    }
+  }
+
+  /*!
+   * \brief Returns a copy of the components of the tuple.
+   */
+  AXOM_HOST_DEVICE operator StackArray<ValueType, N>() const
+  {
+    StackArray<ValueType, N> values;
+    load(&values[0]);
+    return values;
+  }
+
+private:
+  StackArray<T*, N> m_components;
+  IndexType m_offset;
+};
+
+/*!
+ * \class TupleView
+ *
+ * \brief A non-owning view of a set of tuples with N components each, in a
+ *  given memory layout.
+ *
+ *  A TupleView is described by the base pointers of its N components, and
+ *  maps component c of tuple i to base( c )[ Layout::tupleOffset( i ) ].
+ *  Hence, a view may alias data in any layout, without copying it, e.g.,
+ *
+ *  * the interleaved tuples of a multi-component axom::Array, with
+ *    make_tuple_view(),
+ *  * the separate coordinate arrays of a mint mesh, with
+ *    mint::MeshCoordinates::getTupleView(),
+ *  * the tuples of a TupleArray, with TupleArray::view().
+ *
+ *  Kernels that are templated on the layout of a view, or that take any
+ *  view through its operator()( i, c ), are written once for all the layouts.
+ *  A TupleView is small and trivially copyable, and may be captured in device
+ *  lambdas.
+ *
+ *  Example Usage:
+ *  \code
+ *
+ *    template < typename ExecSpace, typename Layout >
+ *    void translate( axom::TupleView< double, 3, Layout > pts,
+ *                    const double (&v)[ 3 ] )
+ *    {
+ *      const double vx = v[ 0 ], vy = v[ 1 ], vz = v[ 2 ];
+ *      axom::for_all< ExecSpace >( pts.size(),
+ *        AXOM_LAMBDA( axom::IndexType i )
+ *      {
+ *        pts( i, 0 ) += vx;
+ *        pts( i, 1 ) += vy;
+ *        pts( i, 2 ) += vz;
+ *      } );
+ *    }
+ *
+ *  \endcode
+ *
+ * \tparam T the type of the components, const-qualified for read-only views.
+ * \tparam N the number of components per tuple.
+ * \tparam Layout the memory layout, i.e., layout::SoA (the default),
+ *  layout::AoS or layout::AoSoA< W >.
+ */
+template <typename T, int N, typename Layout = layout::SoA>
+class TupleView
+{
+  static_assert(N > 0, "A tuple must have at least one component");
+
+public:
+  using ValueType = typename std::remove_const<T>::type;
+  using TupleRefType = TupleRef<T, N, Layout>;
+
+  static constexpr int NUM_COMPONENTS = N;
+
+public:
+  /*!
+   * \brief Constructs an empty view.
+   */
+  AXOM_HOST_DEVICE TupleView() : m_size(0)
+  {
+    for(int c = 0; c < N; ++c)
+    {
+      m_components[c] = nullptr;
+    }
+  }
+
+  /*!
+   * \brief Constructs a view from the base pointers of its components, e.g.,
+   *  from N separate arrays in the SoA layout.
+   *
+   * \param [in] components the address of the first element of each
+   *  component.
+   * \param [in] size the number of tuples.
+   */
+  AXOM_HOST_DEVICE TupleView(const StackArray<T*, N>& components,
+                             IndexType size)
+    : m_components(components)
+    , m_size(size)
+  { }
+
+  /*!
+   * \brief Constructs a view of the tuples of a single buffer.
+   *
+   * \param [in] data the buffer of the tuples.
+   * \param [in] size the number of tuples.
+   * \param [in] stride the number of elements between the first elements of
+   *  consecutive components, in the SoA layout (optional). If not specified,
+   *  or negative, defaults to size. Ignored by the other layouts.
+   *
+   * \pre data != nullptr || size == 0
+   */
+  AXOM_HOST_DEVICE TupleView(T* data, IndexType size, IndexType stride = -1)
+    : m_size(size)
+  {
+    assert(data != nullptr || size == 0);
+
+    const IndexType s = (stride < 0) ? size : stride;
+    for(int c = 0; c < N; ++c)
+    {
+      m_components[c] = data + Layout::template componentOffset<N>(c, s);
+    }
+  }
+
+  /*!
+   * \brief Converts a view to a read-only view.
+   */
+  template <typename U,
+            typename = typename std::enable_if<
+              std::is_same<const U, T>::value &&
+              !std::is_same<U, T>::value>::type>
+  AXOM_HOST_DEVICE TupleView(const TupleView<U, N, Layout>& other)
+    : m_size(other.size())
+  {
+    for(int c = 0; c < N; ++c)
+    {
+      m_components[c] = other.getComponentBase(c);
+    }
+  }
+
+  /*!
+   * \brief Returns the number of tuples.
+   */
+  AXOM_HOST_DEVICE IndexType size() const { return m_size; }
+
+  /*!
+   * \brief Returns the number of components per tuple.
+   */
+  AXOM_HOST_DEVICE static constexpr int numComponents() { return N; }
+
+  /*!
+   * \brief Returns a reference to the given component of the given tuple.
+   *
+   * \pre 0 <= i < size()
+   * \pre 0 <= c < N
+   */
+  AXOM_HOST_DEVICE T& operator()(IndexType i, int c) const
+  {
+    assert(i >= 0 && i < m_size);
+    assert(c >= 0 && c < N);
+    return m_components[c][Layout::template tupleOffset<N>(i)];
+  }
+
+  /*!
+   * \brief Returns a proxy of the given tuple.
+   *
+   * \pre 0 <= i < size()
+   */
+  AXOM_HOST_DEVICE TupleRefType operator[](IndexType i) const
+  {
+    assert(i >= 0 && i < m_size);
+    return TupleRefType(m_components, Layout::template tupleOffset<N>(i));
+  }
+
+  /*!
+   * \brief Copies the components of the given tuple into values.
+   */
+  AXOM_HOST_DEVICE void load(IndexType i, ValueType* values) const
+  {
+    (*this)[i].load(values);
+  }
+
+  /*!
+   * \brief Copies the given N values into the components of the given tuple.
+   */
+  AXOM_HOST_DEVICE void store(IndexType i, const ValueType* values) const
+  {
+    (*this)[i].store(values);
+  }
+
+  /*!
+   * \brief Returns a pointer to the contiguous elements of the given
+   *  component, which is only valid for the SoA layout.
+   *
+   * \pre 0 <= c < N
+   */
+  AXOM_HOST_DEVICE T* getComponent(int c) const
+  {
+    static_assert(Layout::CONTIGUOUS_COMPONENTS,
+                  "Only the components of the SoA layout are contiguous");
+    return m_components[c];
+  }
+
+  /*!
+   * \brief Returns the address of the first element of the given component,
+   *  for any layout.
+   */
+  AXOM_HOST_DEVICE T* getComponentBase(int c) const { return m_components[c]; }
+
+private:
+  StackArray<T*, N> m_components;
+  IndexType m_size;
+};
+
+/*!
+ * \brief Returns a view of the tuples of a multi-component Array, which are
+ *  stored in the AoS layout, without copying them.
+ *
+ * \pre array.numComponents() == N
+ */
+/// @{
+template <int N, typename T>
+TupleView<T, N, layout::AoS> make_tuple_view(Array<T>& array)
+{
+  assert(array.numComponents() == N);
+  return TupleView<T, N, layout::AoS>(array.getData(), array.size());
+}
+
+template <int N, typename T>
+TupleView<const T, N, layout::AoS> make_tuple_view(const Array<T>& array)
+{
+  assert(array.numComponents() == N);
+  return TupleView<const T, N, layout::AoS>(array.getData(), array.size());
+}
+/// @}
+
+} /* namespace axom */
+
+#endif /* AXOM_TUPLEVIEW_HPP_ */
@@ -0,0 +1,267 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <random>
+
+#include "benchmark/benchmark_api.h"
+
+#include "axom/core/execution/execution_space.hpp"
+#include "axom/core/memory_management.hpp"
+#include "axom/core/numerics/Determinants.hpp"
+#include "axom/core/numerics/Matrix.hpp"
+#include "axom/core/numerics/batched_linear_algebra.hpp"
+#include "axom/core/numerics/jacobi_eigensolve.hpp"
+#include "axom/core/numerics/linear_solve.hpp"
+
+/*!
+ * \file
+ *
+ * \brief Compares the batched, structure-of-arrays, small dense linear
+ *  algebra kernels against calling the per-matrix routines on a
+ *  numerics::Matrix for each matrix of the batch, for 2x2, 3x3 and 4x4
+ *  matrices, as a function of the number of matrices.
+ */
+
+//------------------------------------------------------------------------------
+namespace
+{
+constexpr unsigned int SEED = 42;
+
+// Fills a batch of n NxN random matrices, in structure-of-arrays layout. The
+// matrices are diagonally dominant, hence non-singular, and symmetric.
+template <int N>
+void fillBatch(double* A, int n)
+{
+  std::mt19937 gen(SEED);
+  std::uniform_real_distribution<double> dist(-1., 1.);
+
+  for(int k = 0; k < n; ++k)
+  {
+    for(int i = 0; i < N; ++i)
+    {
+      for(int j = i; j < N; ++j)
+      {
+        const double value = dist(gen) + ((i == j) ? N : 0.);
+        A[(i * N + j) * n + k] = value;
+        A[(j * N + i) * n + k] = value;
+      }
+    }
+  }
+}
+
+// Copies matrix k of the batch into M
+template <int N>
+void getMatrix(const double* A, int n, int k, axom::numerics::Matrix<double>& M)
+{
+  for(int i = 0; i < N; ++i)
+  {
+    for(int j = 0; j < N; ++j)
+    {
+      M(i, j) = A[(i * N + j) * n + k];
+    }
+  }
+}
+
+// From 1K to 1M matrices
+void CustomArgs(benchmark::internal::Benchmark* b)
+{
+  for(int n = 1 << 10; n <= 1 << 20; n <<= 2)
+  {
+    b->Arg(n);
+  }
+}
+
+/// Buffers of a batch of n NxN systems, allocated in the execution space
+template <int N>
+struct Batch
+{
+  explicit Batch(int n)
+    : A(axom::allocate<double>(N * N * n))
+    , V(axom::allocate<double>(N * N * n))
+    , b(axom::allocate<double>(N * n))
+    , x(axom::allocate<double>(N * n))
+    , status(axom::allocate<int>(n))
+  {
+    fillBatch<N>(A, n);
+    for(int i = 0; i < N * n; ++i)
+    {
+      b[i] = 1.;
+    }
+  }
+
+  ~Batch()
+  {
+    axom::deallocate(A);
+    axom::deallocate(V);
+    axom::deallocate(b);
+    axom::deallocate(x);
+    axom::deallocate(status);
+  }
+
+  double* A;
+  double* V;
+  double* b;
+  double* x;
+  int* status;
+};
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+// Baseline: linear_solve() on a numerics::Matrix for each system
+template <int N>
+void linear_solve_per_matrix(benchmark::State& state)
+{
+  const int n = state.range_x();
+  Batch<N> batch(n);
+
+  axom::numerics::Matrix<double> M(N, N);
+  double bk[N];
+  double xk[N];
+  while(state.KeepRunning())
+  {
+    for(int k = 0; k < n; ++k)
+    {
+      getMatrix<N>(batch.A, n, k, M);
+      for(int i = 0; i < N; ++i)
+      {
+        bk[i] = batch.b[i * n + k];
+      }
+      axom::numerics::linear_solve(M, bk, xk);
+      for(int i = 0; i < N; ++i)
+      {
+        batch.x[i * n + k] = xk[i];
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(linear_solve_per_matrix, 2)->Apply(CustomArgs);
+BENCHMARK_TEMPLATE(linear_solve_per_matrix, 3)->Apply(CustomArgs);
+BENCHMARK_TEMPLATE(linear_solve_per_matrix, 4)->Apply(CustomArgs);
+
+template <int N, typename ExecSpace>
+void batched_linear_solve(benchmark::State& state)
+{
+  const int n = state.range_x();
+  Batch<N> batch(n);
+
+  while(state.KeepRunning())
+  {
+    axom::numerics::batched_linear_solve<N, ExecSpace>(batch.A,
+                                                       batch.b,
+                                                       batch.x,
+                                                       batch.status,
+                                                       n);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE2(batched_linear_solve, 2, axom::SEQ_EXEC)->Apply(CustomArgs);
+BENCHMARK_TEMPLATE2(batched_linear_solve, 3, axom::SEQ_EXEC)->Apply(CustomArgs);
+BENCHMARK_TEMPLATE2(batched_linear_solve, 4, axom::SEQ_EXEC)->Apply(CustomArgs);
+#ifdef AXOM_USE_OPENMP
+BENCHMARK_TEMPLATE2(batched_linear_solve, 2, axom::OMP_EXEC)->Apply(CustomArgs);
+BENCHMARK_TEMPLATE2(batched_linear_solve, 3, axom::OMP_EXEC)->Apply(CustomArgs);
+BENCHMARK_TEMPLATE2(batched_linear_solve, 4, axom::OMP_EXEC)->Apply(CustomArgs);
+#endif
+
+//------------------------------------------------------------------------------
+// Baseline: determinant() on a numerics::Matrix for each matrix
+template <int N>
+void determinant_per_matrix(benchmark::State& state)
+{
+  const int n = state.range_x();
+  Batch<N> batch(n);
+
+  axom::numerics::Matrix<double> M(N, N);
+  while(state.KeepRunning())
+  {
+    for(int k = 0; k < n; ++k)
+    {
+      getMatrix<N>(batch.A, n, k, M);
+      batch.x[k] = axom::numerics::determinant(M);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(determinant_per_matrix, 3)->Apply(CustomArgs);
+
+template <int N, typename ExecSpace>
+void batched_determinant(benchmark::State& state)
+{
+  const int n = state.range_x();
+  Batch<N> batch(n);
+
+  while(state.KeepRunning())
+  {
+    axom::numerics::batched_determinant<N, ExecSpace>(batch.A, batch.x, n);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE2(batched_determinant, 3, axom::SEQ_EXEC)->Apply(CustomArgs);
+#ifdef AXOM_USE_OPENMP
+BENCHMARK_TEMPLATE2(batched_determinant, 3, axom::OMP_EXEC)->Apply(CustomArgs);
+#endif
+
+//------------------------------------------------------------------------------
+// Baseline: jacobi_eigensolve() on a numerics::Matrix for each matrix
+template <int N>
+void jacobi_eigensolve_per_matrix(benchmark::State& state)
+{
+  const int n = state.range_x();
+  Batch<N> batch(n);
+
+  axom::numerics::Matrix<double> M(N, N);
+  axom::numerics::Matrix<double> V(N, N);
+  double lambdas[N];
+  while(state.KeepRunning())
+  {
+    for(int k = 0; k < n; ++k)
+    {
+      getMatrix<N>(batch.A, n, k, M);
+      axom::numerics::jacobi_eigensolve(M, V, lambdas);
+      for(int i = 0; i < N; ++i)
+      {
+        batch.x[i * n + k] = lambdas[i];
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(jacobi_eigensolve_per_matrix, 3)->Apply(CustomArgs);
+
+template <int N, typename ExecSpace>
+void batched_symmetric_eigensolve(benchmark::State& state)
+{
+  const int n = state.range_x();
+  Batch<N> batch(n);
+
+  while(state.KeepRunning())
+  {
+    axom::numerics::batched_symmetric_eigensolve<N, ExecSpace>(batch.A,
+                                                               batch.x,
+                                                               batch.V,
+                                                               batch.status,
+                                                               n);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE2(batched_symmetric_eigensolve, 3, axom::SEQ_EXEC)
+  ->Apply(CustomArgs);
+#ifdef AXOM_USE_OPENMP
+BENCHMARK_TEMPLATE2(batched_symmetric_eigensolve, 3, axom::OMP_EXEC)
+  ->Apply(CustomArgs);
+#endif
+
+/// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+  ::benchmark::Initialize(&argc, argv);
+
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
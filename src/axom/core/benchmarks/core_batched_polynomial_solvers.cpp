@@ -0,0 +1,170 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <random>
+
+#include "benchmark/benchmark_api.h"
+
+#include "axom/core/execution/execution_space.hpp"
+#include "axom/core/memory_management.hpp"
+#include "axom/core/numerics/batched_polynomial_solvers.hpp"
+#include "axom/core/numerics/polynomial_solvers.hpp"
+
+/*!
+ * \file
+ *
+ * \brief Compares the batched, structure-of-arrays, quadratic and cubic
+ *  polynomial root solvers against calling solve_quadratic() and
+ *  solve_cubic() for each polynomial, as a function of the number of
+ *  polynomials.
+ */
+
+//------------------------------------------------------------------------------
+namespace
+{
+constexpr unsigned int SEED = 42;
+
+// From 1K to 1M polynomials
+void CustomArgs(benchmark::internal::Benchmark* b)
+{
+  for(int n = 1 << 10; n <= 1 << 20; n <<= 2)
+  {
+    b->Arg(n);
+  }
+}
+
+/// Buffers of a batch of n random polynomials of the given degree
+template <int DEGREE>
+struct PolynomialBatch
+{
+  explicit PolynomialBatch(int n)
+    : coeff(axom::allocate<double>((DEGREE + 1) * n))
+    , roots(axom::allocate<double>(DEGREE * n))
+    , numRoots(axom::allocate<int>(n))
+  {
+    std::mt19937 gen(SEED);
+    std::uniform_real_distribution<double> dist(-10., 10.);
+    for(int i = 0; i < (DEGREE + 1) * n; ++i)
+    {
+      coeff[i] = dist(gen);
+    }
+  }
+
+  ~PolynomialBatch()
+  {
+    axom::deallocate(coeff);
+    axom::deallocate(roots);
+    axom::deallocate(numRoots);
+  }
+
+  double* coeff;
+  double* roots;
+  int* numRoots;
+};
+
+/// Calls the given pointwise solver on each polynomial of the batch
+template <int DEGREE, typename Solver>
+void solve_per_polynomial(PolynomialBatch<DEGREE>& batch, int n, Solver solve)
+{
+  double c[DEGREE + 1];
+  double r[DEGREE];
+  for(int k = 0; k < n; ++k)
+  {
+    for(int i = 0; i <= DEGREE; ++i)
+    {
+      c[i] = batch.coeff[i * n + k];
+    }
+    solve(c, r, batch.numRoots[k]);
+    for(int j = 0; j < DEGREE; ++j)
+    {
+      batch.roots[j * n + k] = r[j];
+    }
+  }
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+// Baseline: solve_quadratic() for each polynomial
+void solve_quadratic_per_polynomial(benchmark::State& state)
+{
+  const int n = state.range_x();
+  PolynomialBatch<2> batch(n);
+
+  while(state.KeepRunning())
+  {
+    solve_per_polynomial(batch, n, axom::numerics::solve_quadratic);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(solve_quadratic_per_polynomial)->Apply(CustomArgs);
+
+template <typename ExecSpace>
+void batched_solve_quadratic(benchmark::State& state)
+{
+  const int n = state.range_x();
+  PolynomialBatch<2> batch(n);
+
+  while(state.KeepRunning())
+  {
+    axom::numerics::batched_solve_quadratic<ExecSpace>(batch.coeff,
+                                                       batch.roots,
+                                                       batch.numRoots,
+                                                       nullptr,
+                                                       n);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(batched_solve_quadratic, axom::SEQ_EXEC)->Apply(CustomArgs);
+#ifdef AXOM_USE_OPENMP
+BENCHMARK_TEMPLATE(batched_solve_quadratic, axom::OMP_EXEC)->Apply(CustomArgs);
+#endif
+
+//------------------------------------------------------------------------------
+// Baseline: solve_cubic() for each polynomial
+void solve_cubic_per_polynomial(benchmark::State& state)
+{
+  const int n = state.range_x();
+  PolynomialBatch<3> batch(n);
+
+  while(state.KeepRunning())
+  {
+    solve_per_polynomial(batch, n, axom::numerics::solve_cubic);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(solve_cubic_per_polynomial)->Apply(CustomArgs);
+
+template <typename ExecSpace>
+void batched_solve_cubic(benchmark::State& state)
+{
+  const int n = state.range_x();
+  PolynomialBatch<3> batch(n);
+
+  while(state.KeepRunning())
+  {
+    axom::numerics::batched_solve_cubic<ExecSpace>(batch.coeff,
+                                                   batch.roots,
+                                                   batch.numRoots,
+                                                   nullptr,
+                                                   n);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(batched_solve_cubic, axom::SEQ_EXEC)->Apply(CustomArgs);
+#ifdef AXOM_USE_OPENMP
+BENCHMARK_TEMPLATE(batched_solve_cubic, axom::OMP_EXEC)->Apply(CustomArgs);
+#endif
+
+/// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+  ::benchmark::Initialize(&argc, argv);
+
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
@@ -0,0 +1,388 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/config.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#if defined(AXOM_USE_SPARSEHASH)
+  #include <sparsehash/dense_hash_map>
+#endif
+
+#include "benchmark/benchmark_api.h"
+
+#include "axom/core/ConcurrentHashMap.hpp"
+#include "axom/core/execution/execution_space.hpp"
+#include "axom/core/execution/for_all.hpp"
+
+/*!
+ * \file
+ *
+ * \brief Compares axom::ConcurrentHashMap against std::unordered_map and
+ *  google::dense_hash_map on two workloads of Axom's index construction:
+ *
+ *  * Morton keys, i.e., the Morton codes of the grid cells of random points,
+ *    as in the levels of a sparse octree. Points that share a cell repeat a
+ *    key.
+ *  * Face keys, i.e., the sorted nodes of the six faces of each cell of a
+ *    hexahedral grid, as when the faces of an unstructured mesh are built.
+ *    Interior faces are inserted by both of their cells.
+ *
+ *  Each benchmark inserts all the keys into an empty map, with space reserved
+ *  for the number of keys, and maps each unique key to its first occurrence.
+ */
+
+//------------------------------------------------------------------------------
+namespace
+{
+using IndexType = axom::IndexType;
+using MortonKey = std::uint64_t;
+
+constexpr unsigned int SEED = 42;
+constexpr int MORTON_BITS_PER_DIM = 7;
+
+/// The sorted nodes of a quadrilateral face
+struct FaceKey
+{
+  IndexType nodes[4];
+
+  bool operator==(const FaceKey& other) const
+  {
+    return nodes[0] == other.nodes[0] && nodes[1] == other.nodes[1] &&
+      nodes[2] == other.nodes[2] && nodes[3] == other.nodes[3];
+  }
+};
+
+struct FaceKeyHash
+{
+  std::size_t operator()(const FaceKey& key) const
+  {
+    std::uint64_t h = 0xcbf29ce484222325ULL;
+    for(int i = 0; i < 4; ++i)
+    {
+      h = (h ^ static_cast<std::uint64_t>(key.nodes[i])) * 0x100000001b3ULL;
+    }
+    return static_cast<std::size_t>(h);
+  }
+};
+
+/// Spreads the low 21 bits of x, so that there are two zero bits between bits
+MortonKey spreadBits(MortonKey x)
+{
+  x &= 0x1fffff;
+  x = (x | x << 32) & 0x1f00000000ffffULL;
+  x = (x | x << 16) & 0x1f0000ff0000ffULL;
+  x = (x | x << 8) & 0x100f00f00f00f00fULL;
+  x = (x | x << 4) & 0x10c30c30c30c30c3ULL;
+  x = (x | x << 2) & 0x1249249249249249ULL;
+  return x;
+}
+
+/// The Morton codes of the grid cells of n random points in the unit cube
+std::vector<MortonKey> getMortonKeys(int n)
+{
+  std::mt19937 gen(SEED);
+  std::uniform_int_distribution<MortonKey> dist(
+    0,
+    (MortonKey(1) << MORTON_BITS_PER_DIM) - 1);
+
+  std::vector<MortonKey> keys(n);
+  for(auto& key : keys)
+  {
+    const MortonKey i = dist(gen);
+    const MortonKey j = dist(gen);
+    const MortonKey k = dist(gen);
+    key = spreadBits(i) | spreadBits(j) << 1 | spreadBits(k) << 2;
+  }
+  return keys;
+}
+
+/// The faces of the cells of a res^3 hexahedral grid, six per cell
+std::vector<FaceKey> getFaceKeys(int res)
+{
+  // the local nodes of the faces of a hexahedron, numbered as (di,dj,dk) bits
+  const int HEX_FACES[6][4] = {{0, 2, 4, 6},
+                               {1, 3, 5, 7},
+                               {0, 1, 4, 5},
+                               {2, 3, 6, 7},
+                               {0, 1, 2, 3},
+                               {4, 5, 6, 7}};
+
+  const IndexType np = res + 1;
+  std::vector<FaceKey> keys;
+  keys.reserve(6 * res * res * res);
+  for(IndexType k = 0; k < res; ++k)
+  {
+    for(IndexType j = 0; j < res; ++j)
+    {
+      for(IndexType i = 0; i < res; ++i)
+      {
+        IndexType cellNodes[8];
+        for(int n = 0; n < 8; ++n)
+        {
+          cellNodes[n] =
+            (i + (n & 1)) + np * ((j + ((n >> 1) & 1)) + np * (k + (n >> 2)));
+        }
+
+        for(int f = 0; f < 6; ++f)
+        {
+          FaceKey key;
+          for(int n = 0; n < 4; ++n)
+          {
+            key.nodes[n] = cellNodes[HEX_FACES[f][n]];
+          }
+          std::sort(key.nodes, key.nodes + 4);
+          keys.push_back(key);
+        }
+      }
+    }
+  }
+  return keys;
+}
+
+std::vector<IndexType> getIds(std::size_t n)
+{
+  std::vector<IndexType> ids(n);
+  for(std::size_t i = 0; i < n; ++i)
+  {
+    ids[i] = static_cast<IndexType>(i);
+  }
+  return ids;
+}
+
+// From 16K to 1M points
+void MortonArgs(benchmark::internal::Benchmark* b)
+{
+  for(int n = 1 << 14; n <= 1 << 20; n <<= 2)
+  {
+    b->Arg(n);
+  }
+}
+
+// From 16^3 to 64^3 cells, i.e., 24K to 1.5M faces
+void FaceArgs(benchmark::internal::Benchmark* b)
+{
+  for(int res = 16; res <= 64; res <<= 1)
+  {
+    b->Arg(res);
+  }
+}
+
+/// The keys of a workload, the argument of the benchmark is its size
+struct MortonWorkload
+{
+  using KeyType = MortonKey;
+  using HashType = std::hash<MortonKey>;
+  static std::vector<KeyType> getKeys(int n) { return getMortonKeys(n); }
+  static KeyType getEmptyKey() { return ~MortonKey(0); }
+};
+
+struct FaceWorkload
+{
+  using KeyType = FaceKey;
+  using HashType = FaceKeyHash;
+  static std::vector<KeyType> getKeys(int res) { return getFaceKeys(res); }
+  static KeyType getEmptyKey() { return FaceKey {{-1, -1, -1, -1}}; }
+};
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+template <typename Workload>
+void insert_std_unordered_map(benchmark::State& state)
+{
+  using KeyType = typename Workload::KeyType;
+  using MapType =
+    std::unordered_map<KeyType, IndexType, typename Workload::HashType>;
+
+  const auto keys = Workload::getKeys(state.range_x());
+  const IndexType n = static_cast<IndexType>(keys.size());
+
+  while(state.KeepRunning())
+  {
+    MapType map;
+    map.reserve(n);
+    for(IndexType i = 0; i < n; ++i)
+    {
+      map.insert(std::make_pair(keys[i], i));
+    }
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(insert_std_unordered_map, MortonWorkload)->Apply(MortonArgs);
+BENCHMARK_TEMPLATE(insert_std_unordered_map, FaceWorkload)->Apply(FaceArgs);
+
+#if defined(AXOM_USE_SPARSEHASH)
+template <typename Workload>
+void insert_dense_hash_map(benchmark::State& state)
+{
+  using KeyType = typename Workload::KeyType;
+  using MapType =
+    google::dense_hash_map<KeyType, IndexType, typename Workload::HashType>;
+
+  const auto keys = Workload::getKeys(state.range_x());
+  const IndexType n = static_cast<IndexType>(keys.size());
+
+  while(state.KeepRunning())
+  {
+    MapType map;
+    map.set_empty_key(Workload::getEmptyKey());
+    map.resize(n);
+    for(IndexType i = 0; i < n; ++i)
+    {
+      map.insert(std::make_pair(keys[i], i));
+    }
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(insert_dense_hash_map, MortonWorkload)->Apply(MortonArgs);
+BENCHMARK_TEMPLATE(insert_dense_hash_map, FaceWorkload)->Apply(FaceArgs);
+#endif
+
+template <typename Workload, typename ExecSpace>
+void insert_concurrent_hash_map(benchmark::State& state)
+{
+  using KeyType = typename Workload::KeyType;
+  using MapType =
+    axom::ConcurrentHashMap<KeyType, IndexType, typename Workload::HashType>;
+
+  const auto keys = Workload::getKeys(state.range_x());
+  const auto ids = getIds(keys.size());
+  const IndexType n = static_cast<IndexType>(keys.size());
+
+  while(state.KeepRunning())
+  {
+    MapType map(n);
+    map.template bulk_insert<ExecSpace>(keys.data(), ids.data(), n);
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(insert_concurrent_hash_map, MortonWorkload, axom::SEQ_EXEC)
+  ->Apply(MortonArgs);
+BENCHMARK_TEMPLATE(insert_concurrent_hash_map, FaceWorkload, axom::SEQ_EXEC)
+  ->Apply(FaceArgs);
+#ifdef AXOM_USE_OPENMP
+BENCHMARK_TEMPLATE(insert_concurrent_hash_map, MortonWorkload, axom::OMP_EXEC)
+  ->Apply(MortonArgs);
+BENCHMARK_TEMPLATE(insert_concurrent_hash_map, FaceWorkload, axom::OMP_EXEC)
+  ->Apply(FaceArgs);
+#endif
+
+//------------------------------------------------------------------------------
+template <typename Workload>
+void find_std_unordered_map(benchmark::State& state)
+{
+  using KeyType = typename Workload::KeyType;
+  using MapType =
+    std::unordered_map<KeyType, IndexType, typename Workload::HashType>;
+
+  const auto keys = Workload::getKeys(state.range_x());
+  const IndexType n = static_cast<IndexType>(keys.size());
+
+  MapType map;
+  map.reserve(n);
+  for(IndexType i = 0; i < n; ++i)
+  {
+    map.insert(std::make_pair(keys[i], i));
+  }
+
+  while(state.KeepRunning())
+  {
+    IndexType sum = 0;
+    for(IndexType i = 0; i < n; ++i)
+    {
+      sum += map.find(keys[i])->second;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(find_std_unordered_map, MortonWorkload)->Apply(MortonArgs);
+
+#if defined(AXOM_USE_SPARSEHASH)
+template <typename Workload>
+void find_dense_hash_map(benchmark::State& state)
+{
+  using KeyType = typename Workload::KeyType;
+  using MapType =
+    google::dense_hash_map<KeyType, IndexType, typename Workload::HashType>;
+
+  const auto keys = Workload::getKeys(state.range_x());
+  const IndexType n = static_cast<IndexType>(keys.size());
+
+  MapType map;
+  map.set_empty_key(Workload::getEmptyKey());
+  map.resize(n);
+  for(IndexType i = 0; i < n; ++i)
+  {
+    map.insert(std::make_pair(keys[i], i));
+  }
+
+  while(state.KeepRunning())
+  {
+    IndexType sum = 0;
+    for(IndexType i = 0; i < n; ++i)
+    {
+      sum += map.find(keys[i])->second;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(find_dense_hash_map, MortonWorkload)->Apply(MortonArgs);
+#endif
+
+template <typename Workload, typename ExecSpace>
+void find_concurrent_hash_map(benchmark::State& state)
+{
+  using KeyType = typename Workload::KeyType;
+  using MapType =
+    axom::ConcurrentHashMap<KeyType, IndexType, typename Workload::HashType>;
+
+  const auto keys = Workload::getKeys(state.range_x());
+  const auto ids = getIds(keys.size());
+  const IndexType n = static_cast<IndexType>(keys.size());
+
+  MapType map(n);
+  map.bulk_insert(keys.data(), ids.data(), n);
+
+  std::vector<IndexType> found(n);
+  const MapType* map_ptr = &map;
+  const KeyType* keys_ptr = keys.data();
+  IndexType* found_ptr = found.data();
+
+  while(state.KeepRunning())
+  {
+    axom::for_all<ExecSpace>(
+      n,
+      AXOM_LAMBDA(IndexType i) { found_ptr[i] = *map_ptr->find(keys_ptr[i]); });
+    benchmark::DoNotOptimize(found_ptr[n - 1]);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(find_concurrent_hash_map, MortonWorkload, axom::SEQ_EXEC)
+  ->Apply(MortonArgs);
+#ifdef AXOM_USE_OPENMP
+BENCHMARK_TEMPLATE(find_concurrent_hash_map, MortonWorkload, axom::OMP_EXEC)
+  ->Apply(MortonArgs);
+#endif
+
+/// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+  ::benchmark::Initialize(&argc, argv);
+
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
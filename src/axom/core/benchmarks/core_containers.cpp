@@ -0,0 +1,285 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+
+#include "axom/core/Array.hpp"
+#include "axom/core/StackArray.hpp"
+#include "axom/core/execution/execution_space.hpp"
+#include "axom/core/execution/for_all.hpp"
+
+/*!
+ * \file
+ *
+ * \brief Measures the growth, insertion and resize operations of axom::Array
+ *  against std::vector, and the cost of capturing a StackArray by value in
+ *  an axom::for_all kernel, as a function of the number of elements.
+ */
+
+//------------------------------------------------------------------------------
+namespace
+{
+// From 1K to 4M elements
+void SizeArgs(benchmark::internal::Benchmark* b)
+{
+  for(int n = 1 << 10; n <= 1 << 22; n <<= 2)
+  {
+    b->Arg(n);
+  }
+}
+
+// From 1K to 16K elements, for the operations that are quadratic in n
+void SmallSizeArgs(benchmark::internal::Benchmark* b)
+{
+  for(int n = 1 << 10; n <= 1 << 14; n <<= 1)
+  {
+    b->Arg(n);
+  }
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+// Growth
+//------------------------------------------------------------------------------
+template <typename T>
+void array_append(benchmark::State& state)
+{
+  const int n = state.range_x();
+
+  while(state.KeepRunning())
+  {
+    axom::Array<T> arr(0);
+    for(int i = 0; i < n; ++i)
+    {
+      arr.append(static_cast<T>(i));
+    }
+    benchmark::DoNotOptimize(arr.getData());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(array_append, int)->Apply(SizeArgs);
+BENCHMARK_TEMPLATE(array_append, double)->Apply(SizeArgs);
+
+template <typename T>
+void vector_push_back(benchmark::State& state)
+{
+  const int n = state.range_x();
+
+  while(state.KeepRunning())
+  {
+    std::vector<T> vec;
+    for(int i = 0; i < n; ++i)
+    {
+      vec.push_back(static_cast<T>(i));
+    }
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(vector_push_back, int)->Apply(SizeArgs);
+BENCHMARK_TEMPLATE(vector_push_back, double)->Apply(SizeArgs);
+
+void array_append_reserved(benchmark::State& state)
+{
+  const int n = state.range_x();
+
+  while(state.KeepRunning())
+  {
+    axom::Array<double> arr(0, 1, n);
+    for(int i = 0; i < n; ++i)
+    {
+      arr.append(static_cast<double>(i));
+    }
+    benchmark::DoNotOptimize(arr.getData());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(array_append_reserved)->Apply(SizeArgs);
+
+void array_append_tuples(benchmark::State& state)
+{
+  const int n = state.range_x();
+  const double tuple[3] = {1., 2., 3.};
+
+  while(state.KeepRunning())
+  {
+    axom::Array<double> arr(0, 3);
+    for(int i = 0; i < n; ++i)
+    {
+      arr.append(tuple, 1);
+    }
+    benchmark::DoNotOptimize(arr.getData());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(array_append_tuples)->Apply(SizeArgs);
+
+//------------------------------------------------------------------------------
+// Insertion
+//------------------------------------------------------------------------------
+void array_insert_front(benchmark::State& state)
+{
+  const int n = state.range_x();
+
+  while(state.KeepRunning())
+  {
+    axom::Array<double> arr(0);
+    for(int i = 0; i < n; ++i)
+    {
+      arr.insert(static_cast<double>(i), 0);
+    }
+    benchmark::DoNotOptimize(arr.getData());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(array_insert_front)->Apply(SmallSizeArgs);
+
+void vector_insert_front(benchmark::State& state)
+{
+  const int n = state.range_x();
+
+  while(state.KeepRunning())
+  {
+    std::vector<double> vec;
+    for(int i = 0; i < n; ++i)
+    {
+      vec.insert(vec.begin(), static_cast<double>(i));
+    }
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(vector_insert_front)->Apply(SmallSizeArgs);
+
+void array_insert_middle(benchmark::State& state)
+{
+  const int n = state.range_x();
+
+  while(state.KeepRunning())
+  {
+    axom::Array<double> arr(0);
+    for(int i = 0; i < n; ++i)
+    {
+      arr.insert(static_cast<double>(i), arr.size() / 2);
+    }
+    benchmark::DoNotOptimize(arr.getData());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(array_insert_middle)->Apply(SmallSizeArgs);
+
+//------------------------------------------------------------------------------
+// Resize
+//------------------------------------------------------------------------------
+void array_resize_and_fill(benchmark::State& state)
+{
+  const int n = state.range_x();
+
+  while(state.KeepRunning())
+  {
+    axom::Array<double> arr(0);
+    arr.resize(n);
+    arr.fill(1.);
+    benchmark::DoNotOptimize(arr.getData());
+  }
+  state.SetBytesProcessed(state.iterations() * n * sizeof(double));
+}
+BENCHMARK(array_resize_and_fill)->Apply(SizeArgs);
+
+void vector_resize(benchmark::State& state)
+{
+  const int n = state.range_x();
+
+  while(state.KeepRunning())
+  {
+    std::vector<double> vec;
+    vec.resize(n, 1.);
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetBytesProcessed(state.iterations() * n * sizeof(double));
+}
+BENCHMARK(vector_resize)->Apply(SizeArgs);
+
+//------------------------------------------------------------------------------
+// StackArray
+//------------------------------------------------------------------------------
+
+// Scales the N components of each tuple by the N factors of a StackArray,
+// which the kernel captures by value
+template <int N>
+void stack_array_capture(benchmark::State& state)
+{
+  const int n = state.range_x();
+  std::vector<double> data(static_cast<std::size_t>(n) * N, 1.);
+  double* values = data.data();
+
+  axom::StackArray<double, N> factors;
+  for(int c = 0; c < N; ++c)
+  {
+    factors[c] = 1. + 1e-9 * c;
+  }
+
+  while(state.KeepRunning())
+  {
+    axom::for_all<axom::SEQ_EXEC>(
+      n,
+      AXOM_LAMBDA(axom::IndexType i) {
+        for(int c = 0; c < N; ++c)
+        {
+          values[i * N + c] *= factors[c];
+        }
+      });
+    benchmark::DoNotOptimize(values);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(stack_array_capture, 3)->Apply(SizeArgs);
+BENCHMARK_TEMPLATE(stack_array_capture, 8)->Apply(SizeArgs);
+
+// Same kernel, with the factors read through a pointer
+template <int N>
+void raw_array_pointer(benchmark::State& state)
+{
+  const int n = state.range_x();
+  std::vector<double> data(static_cast<std::size_t>(n) * N, 1.);
+  double* values = data.data();
+
+  double factors_storage[N];
+  for(int c = 0; c < N; ++c)
+  {
+    factors_storage[c] = 1. + 1e-9 * c;
+  }
+  const double* factors = factors_storage;
+
+  while(state.KeepRunning())
+  {
+    axom::for_all<axom::SEQ_EXEC>(
+      n,
+      AXOM_LAMBDA(axom::IndexType i) {
+        for(int c = 0; c < N; ++c)
+        {
+          values[i * N + c] *= factors[c];
+        }
+      });
+    benchmark::DoNotOptimize(values);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(raw_array_pointer, 3)->Apply(SizeArgs);
+BENCHMARK_TEMPLATE(raw_array_pointer, 8)->Apply(SizeArgs);
+
+/// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+  ::benchmark::Initialize(&argc, argv);
+
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
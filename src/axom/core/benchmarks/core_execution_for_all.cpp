@@ -0,0 +1,195 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "benchmark/benchmark_api.h"
+
+#include "axom/core/execution/ThreadPool.hpp"
+#include "axom/core/execution/execution_space.hpp"
+#include "axom/core/execution/for_all.hpp"
+#include "axom/core/memory_management.hpp"
+
+/*!
+ * \file
+ *
+ * \brief Measures the overhead of a call to axom::for_all in each host
+ *  execution space, with an empty kernel over a few iterations, and the
+ *  throughput of a memory-bound kernel, i.e., daxpy, as a function of the
+ *  number of iterations and of the number of threads.
+ *
+ *  The thread counts of the scaling benchmarks range from 1 to the number of
+ *  threads at startup, i.e., OMP_NUM_THREADS or AXOM_NUM_THREADS, by powers
+ *  of 2.
+ */
+
+//------------------------------------------------------------------------------
+namespace
+{
+// The number of threads at startup, which the scaling benchmarks restore
+const int MAX_THREADS = axom::getNumThreads();
+
+// From 1 to 4K iterations
+void OverheadArgs(benchmark::internal::Benchmark* b)
+{
+  for(int n = 1; n <= 1 << 12; n <<= 3)
+  {
+    b->Arg(n);
+  }
+}
+
+// From 1K to 16M iterations
+void SizeArgs(benchmark::internal::Benchmark* b)
+{
+  for(int n = 1 << 10; n <= 1 << 24; n <<= 2)
+  {
+    b->Arg(n);
+  }
+}
+
+// 1M and 16M iterations, from 1 thread to MAX_THREADS threads
+void ScalingArgs(benchmark::internal::Benchmark* b)
+{
+  for(int n = 1 << 20; n <= 1 << 24; n <<= 4)
+  {
+    for(int t = 1; t <= MAX_THREADS; t <<= 1)
+    {
+      b->ArgPair(n, t);
+    }
+  }
+}
+
+/// Buffers of the daxpy kernel, allocated in the execution space
+template <typename ExecSpace>
+struct Vectors
+{
+  explicit Vectors(int n)
+  {
+    const int allocID = axom::execution_space<ExecSpace>::allocatorID();
+    x = axom::allocate<double>(n, allocID);
+    y = axom::allocate<double>(n, allocID);
+
+    double* xx = x;
+    double* yy = y;
+    axom::for_all<ExecSpace>(
+      n,
+      AXOM_LAMBDA(axom::IndexType i) {
+        xx[i] = 1.;
+        yy[i] = 2.;
+      });
+  }
+
+  ~Vectors()
+  {
+    axom::deallocate(x);
+    axom::deallocate(y);
+  }
+
+  double* x;
+  double* y;
+};
+
+template <typename ExecSpace>
+void daxpy(int n, double a, const double* x, double* y)
+{
+  axom::for_all<ExecSpace>(
+    n,
+    AXOM_LAMBDA(axom::IndexType i) { y[i] += a * x[i]; });
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+// Overhead
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void for_all_overhead(benchmark::State& state)
+{
+  const int n = state.range_x();
+  Vectors<ExecSpace> v(n);
+  double* y = v.y;
+
+  while(state.KeepRunning())
+  {
+    axom::for_all<ExecSpace>(
+      n,
+      AXOM_LAMBDA(axom::IndexType i) { y[i] = 0.; });
+    benchmark::DoNotOptimize(y);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(for_all_overhead, axom::SEQ_EXEC)->Apply(OverheadArgs);
+BENCHMARK_TEMPLATE(for_all_overhead, axom::THREAD_EXEC<>)->Apply(OverheadArgs);
+#ifdef AXOM_USE_OPENMP
+BENCHMARK_TEMPLATE(for_all_overhead, axom::OMP_EXEC)->Apply(OverheadArgs);
+#endif
+
+//------------------------------------------------------------------------------
+// Throughput
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void for_all_daxpy(benchmark::State& state)
+{
+  const int n = state.range_x();
+  Vectors<ExecSpace> v(n);
+
+  while(state.KeepRunning())
+  {
+    daxpy<ExecSpace>(n, 0.5, v.x, v.y);
+    benchmark::DoNotOptimize(v.y);
+  }
+  state.SetBytesProcessed(state.iterations() * n * 3 * sizeof(double));
+}
+BENCHMARK_TEMPLATE(for_all_daxpy, axom::SEQ_EXEC)->Apply(SizeArgs);
+BENCHMARK_TEMPLATE(for_all_daxpy, axom::THREAD_EXEC<>)->Apply(SizeArgs);
+BENCHMARK_TEMPLATE(for_all_daxpy,
+                   axom::THREAD_EXEC<axom::SCHEDULE_DYNAMIC, 4096>)
+  ->Apply(SizeArgs);
+#ifdef AXOM_USE_OPENMP
+BENCHMARK_TEMPLATE(for_all_daxpy, axom::OMP_EXEC)->Apply(SizeArgs);
+BENCHMARK_TEMPLATE(for_all_daxpy,
+                   axom::OMP_SCHEDULED_EXEC<axom::SCHEDULE_DYNAMIC, 4096>)
+  ->Apply(SizeArgs);
+#endif
+
+//------------------------------------------------------------------------------
+// Scaling
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void for_all_daxpy_scaling(benchmark::State& state)
+{
+  const int n = state.range_x();
+  const int numThreads = state.range_y();
+  Vectors<ExecSpace> v(n);
+
+  // sets the threads of both the axom::ThreadPool and OpenMP
+  axom::setNumThreads(numThreads);
+
+  while(state.KeepRunning())
+  {
+    daxpy<ExecSpace>(n, 0.5, v.x, v.y);
+    benchmark::DoNotOptimize(v.y);
+  }
+  state.SetBytesProcessed(state.iterations() * n * 3 * sizeof(double));
+
+  axom::setNumThreads(MAX_THREADS);
+}
+BENCHMARK_TEMPLATE(for_all_daxpy_scaling, axom::THREAD_EXEC<>)
+  ->Apply(ScalingArgs)
+  ->UseRealTime();
+#ifdef AXOM_USE_OPENMP
+BENCHMARK_TEMPLATE(for_all_daxpy_scaling, axom::OMP_EXEC)
+  ->Apply(ScalingArgs)
+  ->UseRealTime();
+#endif
+
+/// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+  ::benchmark::Initialize(&argc, argv);
+
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
@@ -0,0 +1,297 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+
+#include "axom/core/numerics/Determinants.hpp"
+#include "axom/core/numerics/Matrix.hpp"
+#include "axom/core/numerics/StackMatrix.hpp"
+#include "axom/core/numerics/eigen_solve.hpp"
+#include "axom/core/numerics/jacobi_eigensolve.hpp"
+#include "axom/core/numerics/linear_solve.hpp"
+#include "axom/core/numerics/matvecops.hpp"
+#include "axom/core/numerics/polynomial_solvers.hpp"
+
+/*!
+ * \file
+ *
+ * \brief Measures the single-matrix numerics routines, i.e., determinant(),
+ *  linear_solve(), jacobi_eigensolve(), eigen_solve(), matrix_multiply() and
+ *  the polynomial solvers, on a Matrix and on a StackMatrix of the same size.
+ *  The batched counterparts are measured by the batched_* benchmarks.
+ */
+
+//------------------------------------------------------------------------------
+namespace
+{
+constexpr unsigned int SEED = 42;
+
+// Returns a random, symmetric and diagonally dominant, NxN Matrix
+axom::numerics::Matrix<double> randomMatrix(int N)
+{
+  std::mt19937 gen(SEED);
+  std::uniform_real_distribution<double> dist(-1., 1.);
+
+  axom::numerics::Matrix<double> A(N, N);
+  for(int i = 0; i < N; ++i)
+  {
+    for(int j = i; j < N; ++j)
+    {
+      const double value = dist(gen) + ((i == j) ? N : 0.);
+      A(i, j) = value;
+      A(j, i) = value;
+    }
+  }
+  return A;
+}
+
+// Returns a copy of an NxN Matrix as a StackMatrix
+template <int N>
+axom::numerics::StackMatrix<double, N> toStackMatrix(
+  const axom::numerics::Matrix<double>& A)
+{
+  axom::numerics::StackMatrix<double, N> M;
+  for(int i = 0; i < N; ++i)
+  {
+    for(int j = 0; j < N; ++j)
+    {
+      M(i, j) = A(i, j);
+    }
+  }
+  return M;
+}
+
+// From 4x4 to 256x256 matrices
+void MatrixSizeArgs(benchmark::internal::Benchmark* b)
+{
+  for(int n = 4; n <= 256; n <<= 2)
+  {
+    b->Arg(n);
+  }
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+// Determinant
+//------------------------------------------------------------------------------
+template <int N>
+void matrix_determinant(benchmark::State& state)
+{
+  const axom::numerics::Matrix<double> A = randomMatrix(N);
+
+  while(state.KeepRunning())
+  {
+    benchmark::DoNotOptimize(axom::numerics::determinant(A));
+  }
+}
+BENCHMARK_TEMPLATE(matrix_determinant, 3);
+BENCHMARK_TEMPLATE(matrix_determinant, 4);
+BENCHMARK_TEMPLATE(matrix_determinant, 8);
+
+template <int N>
+void stack_matrix_determinant(benchmark::State& state)
+{
+  const auto A = toStackMatrix<N>(randomMatrix(N));
+
+  while(state.KeepRunning())
+  {
+    benchmark::DoNotOptimize(axom::numerics::determinant(A));
+  }
+}
+BENCHMARK_TEMPLATE(stack_matrix_determinant, 3);
+BENCHMARK_TEMPLATE(stack_matrix_determinant, 4);
+BENCHMARK_TEMPLATE(stack_matrix_determinant, 8);
+
+//------------------------------------------------------------------------------
+// Linear solve
+//------------------------------------------------------------------------------
+template <int N>
+void matrix_linear_solve(benchmark::State& state)
+{
+  const axom::numerics::Matrix<double> A = randomMatrix(N);
+  double b[N], x[N];
+  for(int i = 0; i < N; ++i)
+  {
+    b[i] = 1.;
+  }
+
+  while(state.KeepRunning())
+  {
+    // linear_solve() overwrites the matrix with its LU decomposition
+    axom::numerics::Matrix<double> LU(A);
+    benchmark::DoNotOptimize(axom::numerics::linear_solve(LU, b, x));
+  }
+}
+BENCHMARK_TEMPLATE(matrix_linear_solve, 3);
+BENCHMARK_TEMPLATE(matrix_linear_solve, 4);
+BENCHMARK_TEMPLATE(matrix_linear_solve, 8);
+
+template <int N>
+void stack_matrix_linear_solve(benchmark::State& state)
+{
+  const auto A = toStackMatrix<N>(randomMatrix(N));
+  double b[N], x[N];
+  for(int i = 0; i < N; ++i)
+  {
+    b[i] = 1.;
+  }
+
+  while(state.KeepRunning())
+  {
+    auto LU = A;
+    benchmark::DoNotOptimize(axom::numerics::linear_solve(LU, b, x));
+  }
+}
+BENCHMARK_TEMPLATE(stack_matrix_linear_solve, 3);
+BENCHMARK_TEMPLATE(stack_matrix_linear_solve, 4);
+BENCHMARK_TEMPLATE(stack_matrix_linear_solve, 8);
+
+//------------------------------------------------------------------------------
+// Eigensolvers
+//------------------------------------------------------------------------------
+template <int N>
+void matrix_jacobi_eigensolve(benchmark::State& state)
+{
+  const axom::numerics::Matrix<double> A = randomMatrix(N);
+  axom::numerics::Matrix<double> V(N, N);
+  double lambdas[N];
+
+  while(state.KeepRunning())
+  {
+    benchmark::DoNotOptimize(
+      axom::numerics::jacobi_eigensolve(A, V, lambdas));
+  }
+}
+BENCHMARK_TEMPLATE(matrix_jacobi_eigensolve, 3);
+BENCHMARK_TEMPLATE(matrix_jacobi_eigensolve, 4);
+
+template <int N>
+void stack_matrix_jacobi_eigensolve(benchmark::State& state)
+{
+  const auto A = toStackMatrix<N>(randomMatrix(N));
+  axom::numerics::StackMatrix<double, N> V;
+  double lambdas[N];
+
+  while(state.KeepRunning())
+  {
+    benchmark::DoNotOptimize(
+      axom::numerics::jacobi_eigensolve(A, V, lambdas));
+  }
+}
+BENCHMARK_TEMPLATE(stack_matrix_jacobi_eigensolve, 3);
+BENCHMARK_TEMPLATE(stack_matrix_jacobi_eigensolve, 4);
+
+template <int N>
+void matrix_eigen_solve(benchmark::State& state)
+{
+  const axom::numerics::Matrix<double> A = randomMatrix(N);
+  double u[N * N];
+  double lambdas[N];
+
+  while(state.KeepRunning())
+  {
+    axom::numerics::Matrix<double> M(A);
+    benchmark::DoNotOptimize(axom::numerics::eigen_solve(M, N, u, lambdas));
+  }
+}
+BENCHMARK_TEMPLATE(matrix_eigen_solve, 3);
+BENCHMARK_TEMPLATE(matrix_eigen_solve, 4);
+
+//------------------------------------------------------------------------------
+// Matrix operators
+//------------------------------------------------------------------------------
+void matrix_multiply(benchmark::State& state)
+{
+  const int n = state.range_x();
+  const axom::numerics::Matrix<double> A = randomMatrix(n);
+  const axom::numerics::Matrix<double> B = randomMatrix(n);
+  axom::numerics::Matrix<double> C(n, n);
+
+  while(state.KeepRunning())
+  {
+    benchmark::DoNotOptimize(axom::numerics::matrix_multiply(A, B, C));
+  }
+  state.SetItemsProcessed(state.iterations() * 2 * n * n * n);
+}
+BENCHMARK(matrix_multiply)->Apply(MatrixSizeArgs);
+
+template <int N>
+void stack_matrix_multiply(benchmark::State& state)
+{
+  const auto A = toStackMatrix<N>(randomMatrix(N));
+  const auto B = toStackMatrix<N>(randomMatrix(N));
+  axom::numerics::StackMatrix<double, N> C;
+
+  while(state.KeepRunning())
+  {
+    axom::numerics::matrix_multiply(A, B, C);
+    benchmark::DoNotOptimize(&C(0, 0));
+  }
+  state.SetItemsProcessed(state.iterations() * 2 * N * N * N);
+}
+BENCHMARK_TEMPLATE(stack_matrix_multiply, 4);
+
+void matrix_vector_multiply(benchmark::State& state)
+{
+  const int n = state.range_x();
+  const axom::numerics::Matrix<double> A = randomMatrix(n);
+  std::vector<double> x(n, 1.), y(n);
+
+  while(state.KeepRunning())
+  {
+    axom::numerics::matrix_vector_multiply(A, x.data(), y.data());
+    benchmark::DoNotOptimize(y.data());
+  }
+  state.SetItemsProcessed(state.iterations() * 2 * n * n);
+}
+BENCHMARK(matrix_vector_multiply)->Apply(MatrixSizeArgs);
+
+//------------------------------------------------------------------------------
+// Polynomial solvers
+//------------------------------------------------------------------------------
+void solve_quadratic(benchmark::State& state)
+{
+  // (x - 1) * (x - 2)
+  const double coeff[3] = {2., -3., 1.};
+  double roots[2];
+  int numRoots;
+
+  while(state.KeepRunning())
+  {
+    benchmark::DoNotOptimize(
+      axom::numerics::solve_quadratic(coeff, roots, numRoots));
+  }
+}
+BENCHMARK(solve_quadratic);
+
+void solve_cubic(benchmark::State& state)
+{
+  // (x - 1) * (x - 2) * (x - 3)
+  const double coeff[4] = {-6., 11., -6., 1.};
+  double roots[3];
+  int numRoots;
+
+  while(state.KeepRunning())
+  {
+    benchmark::DoNotOptimize(
+      axom::numerics::solve_cubic(coeff, roots, numRoots));
+  }
+}
+BENCHMARK(solve_cubic);
+
+/// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+  ::benchmark::Initialize(&argc, argv);
+
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
@@ -174,8 +174,6 @@ void demoMatrix()
 
   // _eigs_start
   // Solve for eigenvectors and values using the power method
-  // The power method calls rand(), so we need to initialize it with srand().
-  std::srand(std::time(0));
   double eigvec[nrows * ncols];
   double eigval[nrows];
   int res = numerics::eigen_solve(A, nrows, eigvec, eigval);
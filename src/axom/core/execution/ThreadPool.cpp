@@ -0,0 +1,223 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/config.hpp"
+#include "axom/core/execution/ThreadPool.hpp"
+
+#include <cstdlib>  // for std::getenv, std::atoi
+
+#ifdef AXOM_USE_OPENMP
+  #include <omp.h>
+#endif
+
+namespace axom
+{
+namespace
+{
+/// Flags the threads that are currently executing a parallel region
+thread_local bool s_inParallelRegion = false;
+
+/// RAII helper that flags the calling thread as being in a parallel region
+struct ParallelRegionGuard
+{
+  ParallelRegionGuard() : m_previous(s_inParallelRegion)
+  {
+    s_inParallelRegion = true;
+  }
+  ~ParallelRegionGuard() { s_inParallelRegion = m_previous; }
+
+  bool m_previous;
+};
+
+}  // end anonymous namespace
+
+//------------------------------------------------------------------------------
+ThreadPool& ThreadPool::instance()
+{
+  static ThreadPool pool;
+  return pool;
+}
+
+//------------------------------------------------------------------------------
+ThreadPool::ThreadPool()
+  : m_numThreads(1)
+  , m_task(nullptr)
+  , m_generation(0)
+  , m_pending(0)
+  , m_shutdown(false)
+{
+  startWorkers(getDefaultNumThreads());
+}
+
+//------------------------------------------------------------------------------
+ThreadPool::~ThreadPool() { stopWorkers(); }
+
+//------------------------------------------------------------------------------
+int ThreadPool::getDefaultNumThreads()
+{
+  const char* env = std::getenv("AXOM_NUM_THREADS");
+  if(env != nullptr)
+  {
+    const int numThreads = std::atoi(env);
+    if(numThreads > 0)
+    {
+      return numThreads;
+    }
+  }
+
+  const int hwThreads = static_cast<int>(std::thread::hardware_concurrency());
+  return (hwThreads > 0) ? hwThreads : 1;
+}
+
+//------------------------------------------------------------------------------
+bool ThreadPool::inParallelRegion() { return s_inParallelRegion; }
+
+//------------------------------------------------------------------------------
+void ThreadPool::setNumThreads(int numThreads)
+{
+  if(numThreads < 1)
+  {
+    numThreads = getDefaultNumThreads();
+  }
+
+  std::lock_guard<std::mutex> launchLock(m_launchMutex);
+  if(numThreads == m_numThreads)
+  {
+    return;
+  }
+
+  stopWorkers();
+  startWorkers(numThreads);
+}
+
+//------------------------------------------------------------------------------
+void ThreadPool::parallel(const TaskType& task)
+{
+  // nested or single-threaded regions are executed by the caller
+  if(s_inParallelRegion || m_numThreads == 1)
+  {
+    ParallelRegionGuard guard;
+    task(0, 1);
+    return;
+  }
+
+  std::lock_guard<std::mutex> launchLock(m_launchMutex);
+
+  // the pool may have been resized before the lock was acquired
+  const int numThreads = m_numThreads;
+  if(numThreads == 1)
+  {
+    ParallelRegionGuard guard;
+    task(0, 1);
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_task = &task;
+    m_pending = numThreads - 1;
+    ++m_generation;
+  }
+  m_workReady.notify_all();
+
+  {
+    ParallelRegionGuard guard;
+    task(0, numThreads);
+  }
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_workDone.wait(lock, [this] { return m_pending == 0; });
+  m_task = nullptr;
+}
+
+//------------------------------------------------------------------------------
+void ThreadPool::startWorkers(int numThreads)
+{
+  m_shutdown = false;
+  m_numThreads = numThreads;
+
+  m_workers.reserve(numThreads - 1);
+  for(int tid = 1; tid < numThreads; ++tid)
+  {
+    m_workers.emplace_back(&ThreadPool::workerLoop, this, tid, m_generation);
+  }
+}
+
+//------------------------------------------------------------------------------
+void ThreadPool::stopWorkers()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_shutdown = true;
+  }
+  m_workReady.notify_all();
+
+  for(auto& worker : m_workers)
+  {
+    worker.join();
+  }
+
+  m_workers.clear();
+  m_numThreads = 1;
+}
+
+//------------------------------------------------------------------------------
+void ThreadPool::workerLoop(int threadID, unsigned long seenGeneration)
+{
+  while(true)
+  {
+    const TaskType* task = nullptr;
+    int numThreads = 0;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_workReady.wait(lock, [this, seenGeneration] {
+        return m_shutdown || m_generation != seenGeneration;
+      });
+
+      if(m_shutdown)
+      {
+        return;
+      }
+
+      seenGeneration = m_generation;
+      task = m_task;
+      numThreads = m_numThreads;
+    }
+
+    {
+      ParallelRegionGuard guard;
+      (*task)(threadID, numThreads);
+    }
+
+    bool lastOne = false;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      lastOne = (--m_pending == 0);
+    }
+
+    if(lastOne)
+    {
+      m_workDone.notify_one();
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void setNumThreads(int numThreads)
+{
+  ThreadPool::instance().setNumThreads(numThreads);
+
+#ifdef AXOM_USE_OPENMP
+  if(numThreads > 0)
+  {
+    omp_set_num_threads(numThreads);
+  }
+#endif
+}
+
+//------------------------------------------------------------------------------
+int getNumThreads() { return ThreadPool::instance().getNumThreads(); }
+
+}  // end namespace axom
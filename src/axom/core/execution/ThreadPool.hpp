@@ -0,0 +1,146 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_CORE_EXECUTION_THREADPOOL_HPP_
+#define AXOM_CORE_EXECUTION_THREADPOOL_HPP_
+
+#include "axom/config.hpp"       // for compile-time definitions
+#include "axom/core/Macros.hpp"  // for DISABLE_COPY_AND_ASSIGNMENT
+
+// C/C++ includes
+#include <atomic>              // for std::atomic
+#include <condition_variable>  // for std::condition_variable
+#include <functional>          // for std::function
+#include <mutex>               // for std::mutex
+#include <thread>              // for std::thread
+#include <vector>              // for std::vector
+
+namespace axom
+{
+/*!
+ * \class ThreadPool
+ *
+ * \brief A persistent pool of std::thread workers used by the THREAD_EXEC
+ *  execution space.
+ *
+ *  The ThreadPool executes parallel regions, i.e., a task that is invoked
+ *  once by every thread in the pool. The calling thread participates in the
+ *  parallel region as thread 0, hence, a pool with N threads spawns N-1
+ *  worker threads, which sleep between parallel regions.
+ *
+ *  The pool is a process-wide singleton, accessed via ThreadPool::instance().
+ *  Its size is determined, in order of precedence, by the last call to
+ *  axom::setNumThreads(), by the AXOM_NUM_THREADS environment variable, or
+ *  by std::thread::hardware_concurrency().
+ *
+ * \note A parallel region that is launched from within another parallel
+ *  region, i.e., from one of the threads of the pool, is executed serially
+ *  by the calling thread. Parallel regions launched concurrently from
+ *  distinct application threads are serialized.
+ *
+ * \see THREAD_EXEC
+ */
+class ThreadPool
+{
+public:
+  /*!
+   * \brief Signature of a task executed within a parallel region.
+   *
+   *  The task is called with the ID of the thread executing it, in
+   *  [0, numThreads), and the total number of threads in the region.
+   */
+  using TaskType = std::function<void(int threadID, int numThreads)>;
+
+  /*!
+   * \brief Returns the process-wide ThreadPool instance.
+   */
+  static ThreadPool& instance();
+
+  /*!
+   * \brief Destructor. Joins all the worker threads.
+   */
+  ~ThreadPool();
+
+  /*!
+   * \brief Returns the number of threads in the pool, including the caller.
+   * \post getNumThreads() >= 1
+   */
+  int getNumThreads() const { return m_numThreads; }
+
+  /*!
+   * \brief Resizes the pool to the given number of threads.
+   *
+   * \param [in] numThreads the number of threads, including the caller.
+   *
+   * \note Values less than 1 reset the pool to its default size.
+   * \warning Must not be called from within a parallel region.
+   */
+  void setNumThreads(int numThreads);
+
+  /*!
+   * \brief Returns true iff the calling thread is executing a parallel region.
+   */
+  static bool inParallelRegion();
+
+  /*!
+   * \brief Executes the given task on all the threads in the pool and returns
+   *  when all threads have completed the task.
+   *
+   * \param [in] task the task to execute.
+   */
+  void parallel(const TaskType& task);
+
+  /*!
+   * \brief Returns the default number of threads for the pool.
+   */
+  static int getDefaultNumThreads();
+
+private:
+  ThreadPool();
+
+  void startWorkers(int numThreads);
+  void stopWorkers();
+  void workerLoop(int threadID, unsigned long seenGeneration);
+
+  std::atomic<int> m_numThreads;  // written under m_launchMutex
+  std::vector<std::thread> m_workers;
+
+  std::mutex m_launchMutex;  // serializes parallel regions
+  std::mutex m_mutex;        // protects the state below
+  std::condition_variable m_workReady;
+  std::condition_variable m_workDone;
+
+  const TaskType* m_task;
+  unsigned long m_generation;
+  int m_pending;
+  bool m_shutdown;
+
+  DISABLE_COPY_AND_ASSIGNMENT(ThreadPool);
+  DISABLE_MOVE_AND_ASSIGNMENT(ThreadPool);
+};
+
+/// \name Thread Count Control
+/// @{
+
+/*!
+ * \brief Sets the number of threads used by the CPU execution spaces.
+ *
+ * \param [in] numThreads the number of threads to use.
+ *
+ * \note Resizes the axom::ThreadPool and, when Axom is compiled with OpenMP,
+ *  also sets the number of OpenMP threads via omp_set_num_threads().
+ */
+void setNumThreads(int numThreads);
+
+/*!
+ * \brief Returns the number of threads used by the THREAD_EXEC execution space.
+ */
+int getNumThreads();
+
+/// @}
+
+} /* namespace axom */
+
+#endif /* AXOM_CORE_EXECUTION_THREADPOOL_HPP_ */
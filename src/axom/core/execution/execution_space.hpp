@@ -26,15 +26,40 @@
  *
  *    Indicates parallel execution with OpenMP on the CPU.
  *
- *    Defined when AXOM_USE_OPENMP and AXOM_USE_RAJA are defined. In addition,
- *    using this execution space requires linking to a RAJA that is configured
- *    with OpenMp, i.e., RAJA_ENABLE_OPENMP must be defined in the generated
- *    RAJA/config.hpp.
+ *    Defined when AXOM_USE_OPENMP is defined. When Axom is also compiled with
+ *    RAJA, the loops are dispatched through RAJA, which requires linking to a
+ *    RAJA that is configured with OpenMP, i.e., RAJA_ENABLE_OPENMP must be
+ *    defined in the generated RAJA/config.hpp. Otherwise, axom::for_all()
+ *    falls back to a native OpenMP implementation.
  *
  *    The default memory allocator when using this execution space is HOST.
  *
  *    When using this execution space, the data must reside on CPU/host memory.
  *
+ *  * <b>OMP_SCHEDULED_EXEC<SCHEDULE, CHUNK_SIZE><b> <br />
+ *
+ *    Indicates parallel execution with OpenMP on the CPU using the given
+ *    loop schedule and chunk size. Loops are always dispatched with the native
+ *    OpenMP implementation, irrespective of whether RAJA is available.
+ *
+ *    Defined when AXOM_USE_OPENMP is defined.
+ *
+ *  * <b>THREAD_EXEC<SCHEDULE, CHUNK_SIZE><b> <br />
+ *
+ *    Indicates parallel execution on the CPU using the portable std::thread
+ *    pool, i.e., axom::ThreadPool, with the given loop schedule and chunk size.
+ *    Always defined. The number of worker threads may be controlled at runtime
+ *    by calling axom::setNumThreads() or by setting the AXOM_NUM_THREADS
+ *    environment variable.
+ *
+ *    \note THREAD_EXEC does not bind any RAJA policies. It may only be used
+ *     with axom::for_all() and the other generic execution routines in core.
+ *     In particular, the kernels of mint, e.g., mint::for_all_nodes(), and
+ *     of spin, e.g., spin::BVH, use RAJA policies when Axom is built with
+ *     RAJA, and do not compile with THREAD_EXEC. Runtime policy dispatch
+ *     only uses THREAD_EXEC for kernels that opt in through
+ *     axom::supports_thread_exec.
+ *
  *  * <b>CUDA_EXEC<BLOCKSIZE></b> <br />
  *
  *    Indicates parallel execution with CUDA on the GPU.
@@ -60,6 +85,20 @@
 
 namespace axom
 {
+/*!
+ * \brief Enumerates the loop schedules supported by the CPU execution spaces.
+ *
+ * \see OMP_SCHEDULED_EXEC
+ * \see THREAD_EXEC
+ */
+enum ScheduleType
+{
+  SCHEDULE_STATIC,   //!< iterations are split in equal blocks among threads
+  SCHEDULE_DYNAMIC,  //!< threads grab chunks of iterations on demand
+  SCHEDULE_GUIDED,   //!< dynamic, with chunks that shrink as work runs out
+  SCHEDULE_RUNTIME   //!< schedule is set at runtime, e.g., via OMP_SCHEDULE
+};
+
 /*!
  * \brief The execution_space is a traits class that binds the execution
  *  space to a corresponding RAJA execution policies and default memory
@@ -91,7 +130,9 @@ struct execution_space
 // execution_space traits specialization
 #include "axom/core/execution/internal/seq_exec.hpp"
 
-#if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
+#include "axom/core/execution/internal/thread_exec.hpp"
+
+#if defined(AXOM_USE_OPENMP)
   #include "axom/core/execution/internal/omp_exec.hpp"
 #endif
 
@@ -17,6 +17,81 @@
 
 namespace axom
 {
+namespace internal
+{
+/*!
+ * \brief Dispatches a loop over the range I:[begin,end-1] to the backend that
+ *  implements the given execution space.
+ *
+ * \note The primary template forwards to RAJA, when available, and otherwise
+ *  executes the loop sequentially. It is specialized for the execution spaces
+ *  that are implemented natively in Axom.
+ */
+template <typename ExecSpace>
+struct for_all_exec
+{
+  template <typename KernelType>
+  static inline void run(IndexType begin, IndexType end, KernelType&& kernel)
+  {
+#ifdef AXOM_USE_RAJA
+
+    using loop_exec = typename execution_space<ExecSpace>::loop_policy;
+    RAJA::forall<loop_exec>(RAJA::RangeSegment(begin, end),
+                            std::forward<KernelType>(kernel));
+
+#else
+
+    constexpr bool is_serial = std::is_same<ExecSpace, SEQ_EXEC>::value;
+    AXOM_STATIC_ASSERT(is_serial);
+    for(IndexType i = begin; i < end; ++i)
+    {
+      kernel(i);
+    }
+
+#endif
+  }
+};
+
+#if defined(AXOM_USE_OPENMP) && !defined(AXOM_USE_RAJA)
+template <>
+struct for_all_exec<OMP_EXEC>
+{
+  template <typename KernelType>
+  static inline void run(IndexType begin, IndexType end, KernelType&& kernel)
+  {
+    omp_for_all<SCHEDULE_STATIC, 0>(begin, end, std::forward<KernelType>(kernel));
+  }
+};
+#endif
+
+#if defined(AXOM_USE_OPENMP)
+template <ScheduleType SCHEDULE, int CHUNK_SIZE>
+struct for_all_exec<OMP_SCHEDULED_EXEC<SCHEDULE, CHUNK_SIZE>>
+{
+  template <typename KernelType>
+  static inline void run(IndexType begin, IndexType end, KernelType&& kernel)
+  {
+    omp_for_all<SCHEDULE, CHUNK_SIZE>(begin,
+                                      end,
+                                      std::forward<KernelType>(kernel));
+  }
+};
+#endif
+
+template <ScheduleType SCHEDULE, int CHUNK_SIZE>
+struct for_all_exec<THREAD_EXEC<SCHEDULE, CHUNK_SIZE>>
+{
+  template <typename KernelType>
+  static inline void run(IndexType begin, IndexType end, KernelType&& kernel)
+  {
+    thread_for_all<SCHEDULE, CHUNK_SIZE>(begin,
+                                         end,
+                                         std::forward<KernelType>(kernel));
+  }
+};
+
+}  // namespace internal
+
 /// \name Generic Loop Traversal Functions
 /// @{
 
@@ -30,6 +105,10 @@ namespace axom
  * \tparam ExecSpace the execution space where to run the supplied kernel
  * \tparam KernelType the type of the supplied kernel (detected by the compiler)
  *
+ * \note When Axom is compiled without RAJA, the CPU execution spaces, i.e.,
+ *  OMP_EXEC, OMP_SCHEDULED_EXEC and THREAD_EXEC, are still supported through
+ *  their native implementations.
+ *
  * \see axom::execution_space
  *
  * Usage Example:
@@ -53,23 +132,9 @@ inline void for_all(const IndexType& begin,
                     KernelType&& kernel) noexcept
 {
   AXOM_STATIC_ASSERT(execution_space<ExecSpace>::valid());
-
-#ifdef AXOM_USE_RAJA
-
-  using loop_exec = typename execution_space<ExecSpace>::loop_policy;
-  RAJA::forall<loop_exec>(RAJA::RangeSegment(begin, end),
-                          std::forward<KernelType>(kernel));
-
-#else
-
-  constexpr bool is_serial = std::is_same<ExecSpace, SEQ_EXEC>::value;
-  AXOM_STATIC_ASSERT(is_serial);
-  for(IndexType i = begin; i < end; ++i)
-  {
-    kernel(i);
-  }
-
-#endif
+  internal::for_all_exec<ExecSpace>::run(begin,
+                                         end,
+                                         std::forward<KernelType>(kernel));
 }
 
 /*!
@@ -0,0 +1,289 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_CORE_EXECUTION_CPU_PRIMITIVES_HPP_
+#define AXOM_CORE_EXECUTION_CPU_PRIMITIVES_HPP_
+
+#include "axom/config.hpp"                         /* compile time defs */
+#include "axom/core/execution/execution_space.hpp" /* execution_space traits */
+#include "axom/core/execution/for_all.hpp"         /* for axom::for_all() */
+#include "axom/core/execution/ThreadPool.hpp"      /* for axom::ThreadPool */
+#include "axom/core/Types.hpp"                     /* for axom::IndexType */
+
+#ifdef AXOM_USE_OPENMP
+  #include <omp.h>
+#endif
+
+// C/C++ includes
+#include <algorithm>  // for std::stable_sort, std::merge, std::min
+#include <utility>    // for std::pair, std::swap
+#include <vector>     // for std::vector
+
+/*!
+ * \file
+ *
+ * \brief Block-parallel implementations of the parallel primitives, i.e.,
+ *  axom::reduce(), axom::exclusive_scan(), axom::min_max() and
+ *  axom::sort_pairs(), for the CPU execution spaces.
+ *
+ *  The input is split in (at most) one contiguous block per thread. Each
+ *  block is processed sequentially by a single iteration of an
+ *  axom::for_all() over the blocks, hence, the same implementation serves
+ *  SEQ_EXEC, OMP_EXEC, OMP_SCHEDULED_EXEC and THREAD_EXEC.
+ */
+
+namespace axom
+{
+namespace internal
+{
+/*!
+ * \brief Returns the number of threads available to the given CPU execution
+ *  space. The primary template corresponds to sequential execution.
+ */
+template <typename ExecSpace>
+struct exec_num_threads
+{
+  static inline int get() noexcept { return 1; }
+};
+
+#ifdef AXOM_USE_OPENMP
+template <>
+struct exec_num_threads<OMP_EXEC>
+{
+  static inline int get() noexcept { return omp_get_max_threads(); }
+};
+
+template <ScheduleType SCHEDULE, int CHUNK_SIZE>
+struct exec_num_threads<OMP_SCHEDULED_EXEC<SCHEDULE, CHUNK_SIZE>>
+  : exec_num_threads<OMP_EXEC>
+{ };
+#endif
+
+template <ScheduleType SCHEDULE, int CHUNK_SIZE>
+struct exec_num_threads<THREAD_EXEC<SCHEDULE, CHUNK_SIZE>>
+{
+  static inline int get() noexcept
+  {
+    return ThreadPool::instance().getNumThreads();
+  }
+};
+
+/*!
+ * \brief Splits the index range [0,N) in contiguous blocks of nearly equal
+ *  size, one block per thread, or fewer if the blocks would be smaller than
+ *  MIN_BLOCK_SIZE.
+ */
+class BlockPartition
+{
+public:
+  static constexpr IndexType MIN_BLOCK_SIZE = 4096;
+
+  BlockPartition(IndexType N, int numThreads)
+    : m_numBlocks(static_cast<int>(std::min<IndexType>(numThreads,
+                                                       N / MIN_BLOCK_SIZE)))
+  {
+    m_numBlocks = (m_numBlocks < 1) ? 1 : m_numBlocks;
+    m_blockSize = N / m_numBlocks;
+    m_remainder = N % m_numBlocks;
+  }
+
+  /// \brief Returns the number of blocks.
+  inline int numBlocks() const noexcept { return m_numBlocks; }
+
+  /// \brief Returns the first index of block b, or N when b == numBlocks().
+  inline IndexType begin(int b) const noexcept
+  {
+    return b * m_blockSize + std::min<IndexType>(b, m_remainder);
+  }
+
+  /// \brief Returns one past the last index of block b.
+  inline IndexType end(int b) const noexcept { return begin(b + 1); }
+
+private:
+  int m_numBlocks;
+  IndexType m_blockSize;
+  IndexType m_remainder;
+};
+
+//------------------------------------------------------------------------------
+template <typename T, typename BinaryOp>
+inline T serial_reduce(const T* input,
+                       IndexType begin,
+                       IndexType end,
+                       T init,
+                       BinaryOp op)
+{
+  for(IndexType i = begin; i < end; ++i)
+  {
+    init = op(init, input[i]);
+  }
+  return init;
+}
+
+//------------------------------------------------------------------------------
+template <typename T, typename BinaryOp>
+inline T serial_exclusive_scan(const T* input,
+                               IndexType begin,
+                               IndexType end,
+                               T* output,
+                               T init,
+                               BinaryOp op)
+{
+  for(IndexType i = begin; i < end; ++i)
+  {
+    // read before writing, so that the scan may be done in place
+    const T value = input[i];
+    output[i] = init;
+    init = op(init, value);
+  }
+  return init;
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace, typename T, typename BinaryOp>
+inline T cpu_reduce(const T* input, IndexType N, T init, BinaryOp op)
+{
+  const BlockPartition blocks(N, exec_num_threads<ExecSpace>::get());
+  const int nblocks = blocks.numBlocks();
+  if(nblocks == 1)
+  {
+    return serial_reduce(input, 0, N, init, op);
+  }
+
+  std::vector<T> partials(nblocks);
+  for_all<ExecSpace>(nblocks, [&](IndexType b) {
+    const IndexType ibegin = blocks.begin(b);
+    partials[b] =
+      serial_reduce(input, ibegin + 1, blocks.end(b), input[ibegin], op);
+  });
+
+  return serial_reduce(partials.data(), 0, nblocks, init, op);
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace, typename T, typename BinaryOp>
+inline T cpu_exclusive_scan(const T* input,
+                            IndexType N,
+                            T* output,
+                            T init,
+                            BinaryOp op)
+{
+  const BlockPartition blocks(N, exec_num_threads<ExecSpace>::get());
+  const int nblocks = blocks.numBlocks();
+  if(nblocks == 1)
+  {
+    return serial_exclusive_scan(input, 0, N, output, init, op);
+  }
+
+  // STEP 0: reduce each block
+  std::vector<T> partials(nblocks);
+  for_all<ExecSpace>(nblocks, [&](IndexType b) {
+    const IndexType ibegin = blocks.begin(b);
+    partials[b] =
+      serial_reduce(input, ibegin + 1, blocks.end(b), input[ibegin], op);
+  });
+
+  // STEP 1: scan the block partials to get the offset of each block
+  T* offsets = partials.data();
+  const T total = serial_exclusive_scan(offsets, 0, nblocks, offsets, init, op);
+
+  // STEP 2: scan each block, starting from its offset
+  for_all<ExecSpace>(nblocks, [&](IndexType b) {
+    serial_exclusive_scan(input,
+                          blocks.begin(b),
+                          blocks.end(b),
+                          output,
+                          partials[b],
+                          op);
+  });
+
+  return total;
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace, typename T>
+inline void cpu_min_max(const T* input, IndexType N, T& min, T& max)
+{
+  const BlockPartition blocks(N, exec_num_threads<ExecSpace>::get());
+  const int nblocks = blocks.numBlocks();
+
+  std::vector<T> mins(nblocks, min);
+  std::vector<T> maxs(nblocks, max);
+  for_all<ExecSpace>(nblocks, [&](IndexType b) {
+    T bmin = mins[b];
+    T bmax = maxs[b];
+    for(IndexType i = blocks.begin(b); i < blocks.end(b); ++i)
+    {
+      bmin = (input[i] < bmin) ? input[i] : bmin;
+      bmax = (bmax < input[i]) ? input[i] : bmax;
+    }
+    mins[b] = bmin;
+    maxs[b] = bmax;
+  });
+
+  for(int b = 0; b < nblocks; ++b)
+  {
+    min = (mins[b] < min) ? mins[b] : min;
+    max = (max < maxs[b]) ? maxs[b] : max;
+  }
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace, typename KeyType, typename ValueType>
+inline void cpu_sort_pairs(KeyType* keys, ValueType* values, IndexType N)
+{
+  using PairType = std::pair<KeyType, ValueType>;
+  auto compare = [](const PairType& a, const PairType& b) {
+    return a.first < b.first;
+  };
+
+  const BlockPartition blocks(N, exec_num_threads<ExecSpace>::get());
+  const int nblocks = blocks.numBlocks();
+
+  std::vector<PairType> buffer(N);
+  std::vector<PairType> scratch((nblocks > 1) ? N : 0);
+
+  // STEP 0: gather the pairs and sort each block
+  for_all<ExecSpace>(nblocks, [&](IndexType b) {
+    const IndexType ibegin = blocks.begin(b);
+    const IndexType iend = blocks.end(b);
+    for(IndexType i = ibegin; i < iend; ++i)
+    {
+      buffer[i] = PairType(keys[i], values[i]);
+    }
+    std::stable_sort(buffer.begin() + ibegin, buffer.begin() + iend, compare);
+  });
+
+  // STEP 1: merge adjacent sorted runs, doubling the run length at each pass.
+  // std::merge() is stable, hence, so is the resulting sort.
+  PairType* src = buffer.data();
+  PairType* dst = scratch.data();
+  for(int width = 1; width < nblocks; width *= 2)
+  {
+    const int nmerges = (nblocks + 2 * width - 1) / (2 * width);
+    for_all<ExecSpace>(nmerges, [&](IndexType m) {
+      const int first = static_cast<int>(m) * 2 * width;
+      const IndexType lo = blocks.begin(first);
+      const IndexType mid = blocks.begin(std::min(first + width, nblocks));
+      const IndexType hi = blocks.begin(std::min(first + 2 * width, nblocks));
+      std::merge(src + lo, src + mid, src + mid, src + hi, dst + lo, compare);
+    });
+    std::swap(src, dst);
+  }
+
+  // STEP 2: scatter the sorted pairs back to the user-supplied arrays
+  for_all<ExecSpace>(nblocks, [&](IndexType b) {
+    for(IndexType i = blocks.begin(b); i < blocks.end(b); ++i)
+    {
+      keys[i] = src[i].first;
+      values[i] = src[i].second;
+    }
+  });
+}
+
+}  // namespace internal
+}  // namespace axom
+
+#endif /* AXOM_CORE_EXECUTION_CPU_PRIMITIVES_HPP_ */
@@ -8,12 +8,16 @@
 
 #include "axom/config.hpp"
 #include "axom/core/memory_management.hpp"
+#include "axom/core/Macros.hpp"  // for AXOM_STATIC_ASSERT
+#include "axom/core/Types.hpp"   // for axom::IndexType
 
 // RAJA includes
-#include "RAJA/RAJA.hpp"
+#ifdef AXOM_USE_RAJA
+  #include "RAJA/RAJA.hpp"
 
-#ifndef RAJA_ENABLE_OPENMP
-  #error OMP_EXEC requires an OpenMP enabled RAJA
+  #ifndef RAJA_ENABLE_OPENMP
+    #error OMP_EXEC requires an OpenMP enabled RAJA
+  #endif
 #endif
 
 // Umpire includes
@@ -21,6 +25,9 @@
   #include "umpire/Umpire.hpp"
 #endif
 
+// OpenMP includes
+#include <omp.h>
+
 namespace axom
 {
 /*!
@@ -29,17 +36,39 @@ namespace axom
 struct OMP_EXEC
 { };
 
+/*!
+ * \brief Indicates parallel execution on the CPU using OpenMP with the
+ *  specified loop schedule.
+ *
+ * \tparam SCHEDULE the OpenMP loop schedule, e.g., SCHEDULE_DYNAMIC
+ * \tparam CHUNK_SIZE the number of loop iterations per chunk (optional). When
+ *  zero, the OpenMP default chunk size for the given schedule is used.
+ *
+ * \note Loops in this execution space are always dispatched natively with
+ *  OpenMP, even when Axom is compiled with RAJA.
+ */
+template <ScheduleType SCHEDULE, int CHUNK_SIZE = 0>
+struct OMP_SCHEDULED_EXEC
+{ };
+
 /*!
  * \brief execution_space traits specialization for OMP_EXEC
  */
 template <>
 struct execution_space<OMP_EXEC>
 {
+#ifdef AXOM_USE_RAJA
   using loop_policy = RAJA::omp_parallel_for_exec;
 
   using reduce_policy = RAJA::omp_reduce;
   using atomic_policy = RAJA::omp_atomic;
   using sync_policy = RAJA::omp_synchronize;
+#else
+  using loop_policy = void;
+  using reduce_policy = void;
+  using atomic_policy = void;
+  using sync_policy = void;
+#endif
 
   static constexpr bool async() noexcept { return false; };
   static constexpr bool valid() noexcept { return true; };
@@ -56,6 +85,90 @@ struct execution_space<OMP_EXEC>
   };
 };
 
+/*!
+ * \brief execution_space traits specialization for OMP_SCHEDULED_EXEC
+ *
+ * \note The RAJA policies are the same as the ones bound to OMP_EXEC, since
+ *  the schedule only applies to loops dispatched via axom::for_all().
+ */
+template <ScheduleType SCHEDULE, int CHUNK_SIZE>
+struct execution_space<OMP_SCHEDULED_EXEC<SCHEDULE, CHUNK_SIZE>>
+  : execution_space<OMP_EXEC>
+{
+  static constexpr char* name() noexcept
+  {
+    return (char*)"[OMP_SCHEDULED_EXEC]";
+  };
+};
+
+namespace internal
+{
+/*!
+ * \brief Loops over the range I:[begin,end-1] in parallel using OpenMP with
+ *  the specified loop schedule.
+ *
+ * \param [in] begin start index of the iteration.
+ * \param [in] end length of the iteration space.
+ * \param [in] kernel user-supplied kernel, i.e., a lambda or functor.
+ *
+ * \tparam SCHEDULE the OpenMP loop schedule
+ * \tparam CHUNK_SIZE the chunk size, or zero for the OpenMP default.
+ */
+template <ScheduleType SCHEDULE, int CHUNK_SIZE, typename KernelType>
+inline void omp_for_all(IndexType begin, IndexType end, KernelType&& kernel)
+{
+  AXOM_STATIC_ASSERT(CHUNK_SIZE >= 0);
+
+  if(SCHEDULE == SCHEDULE_DYNAMIC)
+  {
+    const int chunk = (CHUNK_SIZE > 0) ? CHUNK_SIZE : 1;
+
+#pragma omp parallel for schedule(dynamic, chunk)
+    for(IndexType i = begin; i < end; ++i)
+    {
+      kernel(i);
+    }
+  }
+  else if(SCHEDULE == SCHEDULE_GUIDED)
+  {
+    const int chunk = (CHUNK_SIZE > 0) ? CHUNK_SIZE : 1;
+
+#pragma omp parallel for schedule(guided, chunk)
+    for(IndexType i = begin; i < end; ++i)
+    {
+      kernel(i);
+    }
+  }
+  else if(SCHEDULE == SCHEDULE_RUNTIME)
+  {
+#pragma omp parallel for schedule(runtime)
+    for(IndexType i = begin; i < end; ++i)
+    {
+      kernel(i);
+    }
+  }
+  else if(CHUNK_SIZE > 0)
+  {
+    const int chunk = (CHUNK_SIZE > 0) ? CHUNK_SIZE : 1;
+
+#pragma omp parallel for schedule(static, chunk)
+    for(IndexType i = begin; i < end; ++i)
+    {
+      kernel(i);
+    }
+  }
+  else
+  {
+#pragma omp parallel for schedule(static)
+    for(IndexType i = begin; i < end; ++i)
+    {
+      kernel(i);
+    }
+  }
+}
+
+}  // namespace internal
+
 } /* namespace axom */
 
 #endif /* AXOM_OMP_EXEC_HPP_ */
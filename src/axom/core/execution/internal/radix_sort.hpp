@@ -0,0 +1,192 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_CORE_EXECUTION_RADIX_SORT_HPP_
+#define AXOM_CORE_EXECUTION_RADIX_SORT_HPP_
+
+#include "axom/config.hpp"                         /* compile time defs */
+#include "axom/core/execution/execution_space.hpp" /* execution_space traits */
+#include "axom/core/execution/for_all.hpp"         /* for axom::for_all() */
+#include "axom/core/execution/internal/cpu_primitives.hpp"
+#include "axom/core/Macros.hpp" /* for AXOM_STATIC_ASSERT_MSG */
+#include "axom/core/Types.hpp"  /* for axom::IndexType */
+
+// C/C++ includes
+#include <algorithm>    // for std::fill
+#include <type_traits>  // for std::is_unsigned
+#include <utility>      // for std::swap
+#include <vector>       // for std::vector
+
+namespace axom
+{
+namespace internal
+{
+/*!
+ * \brief Traits of the least-significant-digit (LSD) radix sort for the
+ *  given unsigned integral key type.
+ *
+ *  Keys are sorted with 11-bit digits, i.e., 3 passes for 32-bit keys and
+ *  6 passes for 64-bit keys. The 2048-entry histogram of each block still
+ *  fits in the L1 cache, and, compared to 8-bit digits, saves two full
+ *  scatter passes over 64-bit keys, which more than offsets the less
+ *  cache-friendly scatter.
+ */
+template <typename KeyType>
+struct radix_sort_traits
+{
+  AXOM_STATIC_ASSERT_MSG(std::is_unsigned<KeyType>::value,
+                         "radix sort requires unsigned integral keys");
+
+  static constexpr int KEY_BITS = static_cast<int>(sizeof(KeyType)) * 8;
+  static constexpr int RADIX_BITS = 11;
+  static constexpr int NUM_BINS = 1 << RADIX_BITS;
+  static constexpr int NUM_PASSES = (KEY_BITS + RADIX_BITS - 1) / RADIX_BITS;
+
+  /// \brief Returns the digit of the given key for the given pass.
+  static inline int digit(KeyType key, int pass) noexcept
+  {
+    return static_cast<int>((key >> (pass * RADIX_BITS)) & (NUM_BINS - 1));
+  }
+};
+
+/*!
+ * \brief Below this many keys, sort_pairs() uses a comparison sort, since the
+ *  fixed cost of the radix sort histograms outweighs its linear complexity.
+ */
+constexpr IndexType RADIX_SORT_MIN_SIZE = 2048;
+
+/*!
+ * \brief Sorts the given unsigned integral keys in ascending order, and
+ *  applies the same permutation to the values, using a block-parallel LSD
+ *  radix sort.
+ *
+ *  Each pass computes a digit histogram for each block. Scanning the
+ *  histograms in bin-major, block-minor order gives each block the offset
+ *  where to scatter its keys for each digit, which makes every pass, and
+ *  therefore the sort, stable.
+ *
+ *  Passes over digits that are the same for all the keys, e.g., the unused
+ *  upper bits of Morton codes, are detected up front and skipped.
+ *
+ * \param [in,out] keys pointer to the array of keys to sort.
+ * \param [in,out] values pointer to the array of values associated with keys.
+ * \param [in] N the number of key-value pairs.
+ *
+ * \tparam ExecSpace the CPU execution space where to sort
+ */
+template <typename ExecSpace, typename KeyType, typename ValueType>
+inline void cpu_radix_sort_pairs(KeyType* keys, ValueType* values, IndexType N)
+{
+  using traits = radix_sort_traits<KeyType>;
+  constexpr int NUM_BINS = traits::NUM_BINS;
+  constexpr int NUM_PASSES = traits::NUM_PASSES;
+
+  const BlockPartition blocks(N, exec_num_threads<ExecSpace>::get());
+  const int nblocks = blocks.numBlocks();
+
+  // STEP 0: compute the per-block histograms of all digits in a single sweep
+  std::vector<IndexType> histograms(nblocks * NUM_PASSES * NUM_BINS, 0);
+  for_all<ExecSpace>(nblocks, [&](IndexType b) {
+    IndexType* hist = &histograms[b * NUM_PASSES * NUM_BINS];
+    for(IndexType i = blocks.begin(b); i < blocks.end(b); ++i)
+    {
+      for(int pass = 0; pass < NUM_PASSES; ++pass)
+      {
+        ++hist[pass * NUM_BINS + traits::digit(keys[i], pass)];
+      }
+    }
+  });
+
+  // STEP 1: skip the passes where all keys share the same digit
+  std::vector<int> passes;
+  for(int pass = 0; pass < NUM_PASSES; ++pass)
+  {
+    const int bin = traits::digit(keys[0], pass);
+    IndexType count = 0;
+    for(int b = 0; b < nblocks; ++b)
+    {
+      count += histograms[(b * NUM_PASSES + pass) * NUM_BINS + bin];
+    }
+
+    if(count != N)
+    {
+      passes.push_back(pass);
+    }
+  }
+
+  if(passes.empty())
+  {
+    return;
+  }
+
+  // STEP 2: scatter the keys and values by digit, ping-ponging between the
+  // user-supplied arrays and the scratch buffers
+  std::vector<KeyType> keys_buffer(N);
+  std::vector<ValueType> values_buffer(N);
+  std::vector<IndexType> offsets(nblocks * NUM_BINS);
+
+  KeyType* src_keys = keys;
+  ValueType* src_values = values;
+  KeyType* dst_keys = keys_buffer.data();
+  ValueType* dst_values = values_buffer.data();
+
+  for(std::size_t ipass = 0; ipass < passes.size(); ++ipass)
+  {
+    const int pass = passes[ipass];
+
+    // the histograms from STEP 0 only hold for the original key order
+    if(ipass > 0)
+    {
+      for_all<ExecSpace>(nblocks, [&](IndexType b) {
+        IndexType* hist = &histograms[(b * NUM_PASSES + pass) * NUM_BINS];
+        std::fill(hist, hist + NUM_BINS, 0);
+        for(IndexType i = blocks.begin(b); i < blocks.end(b); ++i)
+        {
+          ++hist[traits::digit(src_keys[i], pass)];
+        }
+      });
+    }
+
+    IndexType offset = 0;
+    for(int bin = 0; bin < NUM_BINS; ++bin)
+    {
+      for(int b = 0; b < nblocks; ++b)
+      {
+        offsets[b * NUM_BINS + bin] = offset;
+        offset += histograms[(b * NUM_PASSES + pass) * NUM_BINS + bin];
+      }
+    }
+
+    for_all<ExecSpace>(nblocks, [&](IndexType b) {
+      IndexType* offset = &offsets[b * NUM_BINS];
+      for(IndexType i = blocks.begin(b); i < blocks.end(b); ++i)
+      {
+        const IndexType pos = offset[traits::digit(src_keys[i], pass)]++;
+        dst_keys[pos] = src_keys[i];
+        dst_values[pos] = src_values[i];
+      }
+    });
+
+    std::swap(src_keys, dst_keys);
+    std::swap(src_values, dst_values);
+  }
+
+  // STEP 3: copy back if the result ended up in the scratch buffers
+  if(src_keys != keys)
+  {
+    for_all<ExecSpace>(nblocks, [&](IndexType b) {
+      for(IndexType i = blocks.begin(b); i < blocks.end(b); ++i)
+      {
+        keys[i] = src_keys[i];
+        values[i] = src_values[i];
+      }
+    });
+  }
+}
+
+}  // namespace internal
+}  // namespace axom
+
+#endif /* AXOM_CORE_EXECUTION_RADIX_SORT_HPP_ */
@@ -0,0 +1,164 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_THREAD_EXEC_HPP_
+#define AXOM_THREAD_EXEC_HPP_
+
+#include "axom/config.hpp"
+#include "axom/core/memory_management.hpp"
+#include "axom/core/Macros.hpp"                  // for AXOM_STATIC_ASSERT
+#include "axom/core/Types.hpp"                   // for axom::IndexType
+#include "axom/core/execution/ThreadPool.hpp"  // for axom::ThreadPool
+
+// Umpire includes
+#ifdef AXOM_USE_UMPIRE
+  #include "umpire/Umpire.hpp"
+#endif
+
+// C/C++ includes
+#include <algorithm>  // for std::min, std::max
+#include <atomic>     // for std::atomic
+
+namespace axom
+{
+/*!
+ * \brief Indicates parallel execution on the CPU using the axom::ThreadPool.
+ *
+ * \tparam SCHEDULE the loop schedule (optional). Defaults to SCHEDULE_STATIC.
+ * \tparam CHUNK_SIZE the number of loop iterations per chunk (optional). When
+ *  zero, a static schedule splits the iteration space in one contiguous block
+ *  per thread, and the dynamic and guided schedules use a minimum chunk of 1.
+ *
+ * \note SCHEDULE_RUNTIME is treated as SCHEDULE_STATIC.
+ */
+template <ScheduleType SCHEDULE = SCHEDULE_STATIC, int CHUNK_SIZE = 0>
+struct THREAD_EXEC
+{ };
+
+/*!
+ * \brief execution_space traits specialization for THREAD_EXEC
+ *
+ * \note THREAD_EXEC does not map to any RAJA policies.
+ */
+template <ScheduleType SCHEDULE, int CHUNK_SIZE>
+struct execution_space<THREAD_EXEC<SCHEDULE, CHUNK_SIZE>>
+{
+  using loop_policy = void;
+  using reduce_policy = void;
+  using atomic_policy = void;
+  using sync_policy = void;
+
+  static constexpr bool async() noexcept { return false; };
+  static constexpr bool valid() noexcept { return true; };
+  static constexpr bool onDevice() noexcept { return false; };
+  static constexpr char* name() noexcept { return (char*)"[THREAD_EXEC]"; };
+
+  static int allocatorID() noexcept
+  {
+#ifdef AXOM_USE_UMPIRE
+    return axom::getUmpireResourceAllocatorID(umpire::resource::Host);
+#else
+    return axom::getDefaultAllocatorID();
+#endif
+  };
+};
+
+namespace internal
+{
+/*!
+ * \brief Loops over the range I:[begin,end-1] in parallel on the threads of
+ *  the axom::ThreadPool with the specified loop schedule.
+ *
+ * \param [in] begin start index of the iteration.
+ * \param [in] end length of the iteration space.
+ * \param [in] kernel user-supplied kernel, i.e., a lambda or functor.
+ *
+ * \tparam SCHEDULE the loop schedule
+ * \tparam CHUNK_SIZE the chunk size, or zero for the default.
+ */
+template <ScheduleType SCHEDULE, int CHUNK_SIZE, typename KernelType>
+inline void thread_for_all(IndexType begin, IndexType end, KernelType&& kernel)
+{
+  AXOM_STATIC_ASSERT(CHUNK_SIZE >= 0);
+
+  const IndexType N = end - begin;
+  if(N <= 0)
+  {
+    return;
+  }
+
+  // next iteration to grab for the dynamic and guided schedules
+  std::atomic<IndexType> next(begin);
+
+  ThreadPool::instance().parallel([&](int tid, int nthreads) {
+    if(SCHEDULE == SCHEDULE_DYNAMIC)
+    {
+      const IndexType chunk = (CHUNK_SIZE > 0) ? CHUNK_SIZE : 1;
+      for(IndexType ibegin = next.fetch_add(chunk); ibegin < end;
+          ibegin = next.fetch_add(chunk))
+      {
+        const IndexType iend = std::min(ibegin + chunk, end);
+        for(IndexType i = ibegin; i < iend; ++i)
+        {
+          kernel(i);
+        }
+      }
+    }
+    else if(SCHEDULE == SCHEDULE_GUIDED)
+    {
+      const IndexType min_chunk = (CHUNK_SIZE > 0) ? CHUNK_SIZE : 1;
+      IndexType ibegin = next.load();
+      while(ibegin < end)
+      {
+        const IndexType remaining = end - ibegin;
+        const IndexType chunk = std::max(min_chunk, remaining / (2 * nthreads));
+        if(!next.compare_exchange_weak(ibegin, ibegin + chunk))
+        {
+          continue;  // ibegin is updated by compare_exchange_weak()
+        }
+
+        const IndexType iend = std::min(ibegin + chunk, end);
+        for(IndexType i = ibegin; i < iend; ++i)
+        {
+          kernel(i);
+        }
+        ibegin = next.load();
+      }
+    }
+    else if(CHUNK_SIZE > 0)
+    {
+      // static, round-robin assignment of fixed-size chunks
+      const IndexType stride = static_cast<IndexType>(CHUNK_SIZE) * nthreads;
+      for(IndexType ibegin = begin + tid * CHUNK_SIZE; ibegin < end;
+          ibegin += stride)
+      {
+        const IndexType iend = std::min(ibegin + CHUNK_SIZE, end);
+        for(IndexType i = ibegin; i < iend; ++i)
+        {
+          kernel(i);
+        }
+      }
+    }
+    else
+    {
+      // static, one contiguous block per thread
+      const IndexType blocksize = N / nthreads;
+      const IndexType remainder = N % nthreads;
+      const IndexType ibegin =
+        begin + tid * blocksize + std::min<IndexType>(tid, remainder);
+      const IndexType iend = ibegin + blocksize + (tid < remainder ? 1 : 0);
+      for(IndexType i = ibegin; i < iend; ++i)
+      {
+        kernel(i);
+      }
+    }
+  });
+}
+
+}  // namespace internal
+
+} /* namespace axom */
+
+#endif /* AXOM_THREAD_EXEC_HPP_ */
@@ -0,0 +1,59 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_CORE_EXECUTION_OPERATORS_HPP_
+#define AXOM_CORE_EXECUTION_OPERATORS_HPP_
+
+#include "axom/config.hpp"       /* compile time defs */
+#include "axom/core/Macros.hpp"  /* for AXOM_HOST_DEVICE */
+
+namespace axom
+{
+/// \name Binary Operators for the Parallel Primitives
+/// @{
+
+/*!
+ * \brief Binary functor that returns the sum of its arguments.
+ *
+ * \see axom::reduce(), axom::exclusive_scan()
+ */
+template <typename T>
+struct plus
+{
+  AXOM_HOST_DEVICE
+  constexpr T operator()(const T& a, const T& b) const { return a + b; }
+};
+
+/*!
+ * \brief Binary functor that returns the minimum of its arguments.
+ */
+template <typename T>
+struct minimum
+{
+  AXOM_HOST_DEVICE
+  constexpr T operator()(const T& a, const T& b) const
+  {
+    return (b < a) ? b : a;
+  }
+};
+
+/*!
+ * \brief Binary functor that returns the maximum of its arguments.
+ */
+template <typename T>
+struct maximum
+{
+  AXOM_HOST_DEVICE
+  constexpr T operator()(const T& a, const T& b) const
+  {
+    return (a < b) ? b : a;
+  }
+};
+
+/// @}
+
+} /* namespace axom */
+
+#endif /* AXOM_CORE_EXECUTION_OPERATORS_HPP_ */
@@ -0,0 +1,169 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_CORE_EXECUTION_REDUCE_HPP_
+#define AXOM_CORE_EXECUTION_REDUCE_HPP_
+
+#include "axom/config.hpp"                         /* compile time defs */
+#include "axom/core/execution/execution_space.hpp" /* execution_space traits */
+#include "axom/core/execution/for_all.hpp"         /* for axom::for_all() */
+#include "axom/core/execution/operators.hpp"       /* for axom::plus */
+#include "axom/core/execution/scan.hpp"            /* for exclusive_scan() */
+#include "axom/core/execution/internal/cpu_primitives.hpp"
+#include "axom/core/Macros.hpp"            /* for axom macros */
+#include "axom/core/memory_management.hpp" /* for allocate()/deallocate() */
+#include "axom/core/Types.hpp"             /* for axom::IndexType */
+
+// C/C++ includes
+#include <limits>       // for std::numeric_limits
+#include <type_traits>  // for std::common_type
+
+namespace axom
+{
+namespace internal
+{
+/*!
+ * \brief Dispatches a reduction to the implementation that corresponds to
+ *  the given execution space.
+ */
+template <typename ExecSpace, bool ON_DEVICE = execution_space<ExecSpace>::onDevice()>
+struct reduce_exec
+{
+  template <typename T, typename BinaryOp>
+  static inline T reduce(const T* input, IndexType N, T init, BinaryOp op)
+  {
+    return cpu_reduce<ExecSpace>(input, N, init, op);
+  }
+
+  template <typename T>
+  static inline void min_max(const T* input, IndexType N, T& min, T& max)
+  {
+    cpu_min_max<ExecSpace>(input, N, min, max);
+  }
+};
+
+#ifdef AXOM_USE_RAJA
+template <typename ExecSpace>
+struct reduce_exec<ExecSpace, true>
+{
+  template <typename T, typename BinaryOp>
+  static inline T reduce(const T* input, IndexType N, T init, BinaryOp op)
+  {
+    // an exclusive scan into scratch space yields the reduction as its total
+    const int allocatorID = execution_space<ExecSpace>::allocatorID();
+    T* scratch = axom::allocate<T>(N, allocatorID);
+    const T total = exclusive_scan<ExecSpace>(input, N, scratch, init, op);
+    axom::deallocate(scratch);
+    return total;
+  }
+
+  template <typename T>
+  static inline void min_max(const T* input, IndexType N, T& min, T& max)
+  {
+    using reduce_policy = typename execution_space<ExecSpace>::reduce_policy;
+    RAJA::ReduceMin<reduce_policy, T> rmin(min);
+    RAJA::ReduceMax<reduce_policy, T> rmax(max);
+
+    for_all<ExecSpace>(
+      N,
+      AXOM_LAMBDA(IndexType i) {
+        rmin.min(input[i]);
+        rmax.max(input[i]);
+      });
+
+    min = rmin.get();
+    max = rmax.get();
+  }
+};
+#endif
+
+}  // namespace internal
+
+/// \name Generic Parallel Primitives
+/// @{
+
+/*!
+ * \brief Reduces the entries of the given array with a binary operator.
+ *
+ * \param [in] input pointer to the array of values to reduce.
+ * \param [in] N the number of entries in the array.
+ * \param [in] init the initial value of the reduction.
+ * \param [in] op associative binary operator, e.g., axom::plus.
+ *
+ * \return the result of `init op input[0] op ... op input[N-1]`.
+ *
+ * \tparam ExecSpace the execution space where to compute the reduction
+ * \tparam T the type of the values
+ * \tparam BinaryOp the type of the binary operator, defaults to axom::plus
+ *
+ * \note The order in which the entries are combined is unspecified, hence
+ *  floating-point results may differ slightly across execution spaces and
+ *  number of threads.
+ *
+ * \pre input must be accessible from the execution space.
+ *
+ * Usage Example:
+ * \code
+ *
+ *    const double* A = ...
+ *
+ *    double sum = axom::reduce< axom::OMP_EXEC >( A, N );
+ *    double max = axom::reduce< axom::OMP_EXEC >( A, N, A[ 0 ],
+ *                                                 axom::maximum< double >{} );
+ *
+ * \endcode
+ */
+template <typename ExecSpace, typename T, typename BinaryOp = axom::plus<T>>
+inline T reduce(const T* input,
+                IndexType N,
+                typename std::common_type<T>::type init = T(),
+                BinaryOp op = BinaryOp {})
+{
+  AXOM_STATIC_ASSERT(execution_space<ExecSpace>::valid());
+
+  if(N <= 0)
+  {
+    return init;
+  }
+
+  return internal::reduce_exec<ExecSpace>::reduce(input, N, init, op);
+}
+
+/*!
+ * \brief Computes the minimum and maximum entries of the given array.
+ *
+ * \param [in] input pointer to the array of values.
+ * \param [in] N the number of entries in the array.
+ * \param [out] min the minimum entry.
+ * \param [out] max the maximum entry.
+ *
+ * \tparam ExecSpace the execution space where to compute the reduction
+ * \tparam T the type of the values, which must be less-than comparable
+ *
+ * \note When N is zero, min and max are set to std::numeric_limits<T>::max()
+ *  and std::numeric_limits<T>::lowest() respectively.
+ *
+ * \pre input must be accessible from the execution space.
+ */
+template <typename ExecSpace, typename T>
+inline void min_max(const T* input, IndexType N, T& min, T& max)
+{
+  AXOM_STATIC_ASSERT(execution_space<ExecSpace>::valid());
+
+  min = std::numeric_limits<T>::max();
+  max = std::numeric_limits<T>::lowest();
+  if(N <= 0)
+  {
+    return;
+  }
+
+  internal::reduce_exec<ExecSpace>::min_max(input, N, min, max);
+}
+
+/// @}
+
+} /* namespace axom */
+
+#endif /* AXOM_CORE_EXECUTION_REDUCE_HPP_ */
@@ -0,0 +1,87 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/core/execution/runtime_policy.hpp"
+
+// C/C++ includes
+#include <algorithm>  // for std::transform
+#include <cctype>     // for std::tolower
+
+namespace axom
+{
+namespace
+{
+const char* const POLICY_NAMES[NUM_RUNTIME_POLICIES] = {"seq",
+                                                        "thread",
+                                                        "omp",
+                                                        "cuda"};
+
+}  // end anonymous namespace
+
+//------------------------------------------------------------------------------
+const char* getRuntimePolicyName(RuntimePolicy policy)
+{
+  const int id = static_cast<int>(policy);
+  return (id >= 0 && id < NUM_RUNTIME_POLICIES) ? POLICY_NAMES[id] : "unknown";
+}
+
+//------------------------------------------------------------------------------
+bool parseRuntimePolicy(const std::string& name, RuntimePolicy& policy)
+{
+  std::string lower(name);
+  std::transform(lower.begin(), lower.end(), lower.begin(), [](char c) {
+    return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+  });
+
+  for(int id = 0; id < NUM_RUNTIME_POLICIES; ++id)
+  {
+    if(lower == POLICY_NAMES[id])
+    {
+      policy = static_cast<RuntimePolicy>(id);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+//------------------------------------------------------------------------------
+bool isRuntimePolicyEnabled(RuntimePolicy policy)
+{
+  switch(policy)
+  {
+  case POLICY_SEQ:
+  case POLICY_THREAD:
+    return true;
+#ifdef AXOM_USE_OPENMP
+  case POLICY_OMP:
+    return true;
+#endif
+#if defined(AXOM_USE_CUDA) && defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
+  case POLICY_CUDA:
+    return true;
+#endif
+  default:
+    return false;
+  }
+}
+
+//------------------------------------------------------------------------------
+std::string getEnabledRuntimePolicyNames()
+{
+  std::string names;
+  for(int id = 0; id < NUM_RUNTIME_POLICIES; ++id)
+  {
+    const RuntimePolicy policy = static_cast<RuntimePolicy>(id);
+    if(isRuntimePolicyEnabled(policy))
+    {
+      names += names.empty() ? "" : ", ";
+      names += getRuntimePolicyName(policy);
+    }
+  }
+  return names;
+}
+
+}  // end namespace axom
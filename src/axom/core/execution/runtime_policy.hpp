@@ -0,0 +1,301 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_RUNTIME_POLICY_HPP_
+#define AXOM_RUNTIME_POLICY_HPP_
+
+#include "axom/config.hpp"                          // compile-time defs
+#include "axom/core/execution/ThreadPool.hpp"       // for setNumThreads()
+#include "axom/core/execution/execution_space.hpp"  // execution spaces
+
+// C/C++ includes
+#include <string>       // for std::string
+#include <type_traits>  // for std::false_type, std::decay
+
+/*!
+ * \file
+ *
+ * \brief Selects the execution space of a kernel at runtime.
+ *
+ *  The kernels of Axom, e.g., axom::for_all(), spin::BVH or
+ *  mint::for_all_cells, take their execution space as a template parameter.
+ *  An application that picks the execution space at runtime, e.g., from an
+ *  input deck, would otherwise have to branch on it at each call site.
+ *  Instead, the kernel is written once, as a functor that is called with an
+ *  instance of the execution space, and dispatch_runtime_policy()
+ *  instantiates it for each execution space that is enabled in the build,
+ *  and calls the one that corresponds to the runtime policy.
+ *
+ *  Example Usage:
+ *  \code
+ *
+ *    struct ScaleKernel
+ *    {
+ *      double* x;
+ *      int n;
+ *
+ *      template < typename ExecSpace >
+ *      void operator()( ExecSpace ) const
+ *      {
+ *        double* x_ = x;
+ *        axom::for_all< ExecSpace >( n, AXOM_LAMBDA( axom::IndexType i )
+ *        {
+ *          x_[ i ] *= 2.;
+ *        } );
+ *      }
+ *    };
+ *
+ *    axom::RuntimePolicy policy;
+ *    if ( !axom::parseRuntimePolicy( deck.getString( "policy" ), policy ) )
+ *    {
+ *      // handle the invalid policy name
+ *    }
+ *
+ *    axom::dispatch_runtime_policy( policy, ScaleKernel{ x, n },
+ *                                   deck.getInt( "threads" ) );
+ *
+ *  \endcode
+ *
+ *  With C++14, the functor may be a generic lambda, e.g.,
+ *  [&]( auto exec ) { using ExecSpace = decltype( exec ); ... }.
+ */
+
+namespace axom
+{
+/*!
+ * \brief Enumerates the execution spaces that may be selected at runtime.
+ *
+ * \see dispatch_runtime_policy()
+ */
+enum RuntimePolicy
+{
+  POLICY_SEQ,     //!< sequential execution, i.e., SEQ_EXEC
+  POLICY_THREAD,  //!< the portable thread pool, i.e., THREAD_EXEC<>
+  POLICY_OMP,     //!< OpenMP, i.e., OMP_EXEC
+  POLICY_CUDA     //!< CUDA, i.e., CUDA_EXEC<256>
+};
+
+/*!
+ * \brief The number of values of the RuntimePolicy enum.
+ */
+constexpr int NUM_RUNTIME_POLICIES = 4;
+
+/*!
+ * \brief Returns the name of the given policy, i.e., "seq", "thread", "omp"
+ *  or "cuda".
+ */
+const char* getRuntimePolicyName(RuntimePolicy policy);
+
+/*!
+ * \brief Converts the given name to a runtime policy.
+ *
+ * \param [in] name the name of the policy, as returned by
+ *  getRuntimePolicyName(). The comparison is case-insensitive.
+ * \param [out] policy the corresponding policy.
+ *
+ * \return status true if the name is valid, false otherwise, in which case
+ *  policy is not modified.
+ *
+ * \note A valid name may refer to a policy that is not enabled in this build.
+ * \see isRuntimePolicyEnabled()
+ */
+bool parseRuntimePolicy(const std::string& name, RuntimePolicy& policy);
+
+/*!
+ * \brief Checks if the execution space of the given policy is enabled in this
+ *  build of Axom.
+ */
+bool isRuntimePolicyEnabled(RuntimePolicy policy);
+
+/*!
+ * \brief Returns the comma-separated names of the enabled policies, e.g., to
+ *  list the valid choices of a command line option.
+ */
+std::string getEnabledRuntimePolicyNames();
+
+/*!
+ * \brief Traits class that indicates if a kernel may be called with
+ *  THREAD_EXEC, i.e., if it only uses the primitives of Axom that support the
+ *  thread pool, such as axom::for_all().
+ *
+ *  THREAD_EXEC does not map to any RAJA policies. Hence, when Axom is built
+ *  with RAJA, the kernels that use RAJA directly, or through, e.g.,
+ *  mint::for_all_nodes() or spin::BVH, do not compile with THREAD_EXEC. For
+ *  this reason, a kernel is not dispatched with POLICY_THREAD, unless it opts
+ *  in by specializing this class, e.g.,
+ *  \code
+ *
+ *    namespace axom
+ *    {
+ *    template <>
+ *    struct supports_thread_exec< ScaleKernel > : std::true_type { };
+ *    }
+ *
+ *  \endcode
+ *
+ * \see dispatch_runtime_policy()
+ */
+template <typename KernelType>
+struct supports_thread_exec : std::false_type
+{ };
+
+/*!
+ * \brief Calls the given kernel with the execution space of the given policy.
+ *
+ *  The kernel is instantiated for each enabled execution space, hence, it
+ *  must be valid for all of them, e.g., it must be a device-compatible
+ *  kernel if CUDA is enabled. Kernels that may only run on the host are
+ *  dispatched with dispatch_host_runtime_policy(). The kernel is instantiated
+ *  with THREAD_EXEC only if supports_thread_exec is true for it.
+ *
+ * \param [in] policy the runtime policy.
+ * \param [in] kernel functor that is called as kernel( ExecSpace{} ).
+ * \param [in] numThreads the number of threads for the CPU execution spaces
+ *  (optional). When positive, calls axom::setNumThreads( numThreads ) before
+ *  calling a CPU parallel kernel. The setting persists after the call.
+ *
+ * \return status true if the kernel was called, false if the policy is not
+ *  enabled in this build, or if it is POLICY_THREAD and the kernel does not
+ *  support THREAD_EXEC.
+ *
+ * \see setNumThreads(), supports_thread_exec
+ */
+template <typename KernelType>
+bool dispatch_runtime_policy(RuntimePolicy policy,
+                             KernelType&& kernel,
+                             int numThreads = 0);
+
+/*!
+ * \brief Calls the given kernel with the execution space of the given policy,
+ *  which must be a CPU policy.
+ *
+ *  Same as dispatch_runtime_policy(), except that the kernel is only
+ *  instantiated for the CPU execution spaces, and POLICY_CUDA is rejected.
+ *
+ * \return status true if the kernel was called, false if the policy is not
+ *  enabled in this build, is not a CPU policy, or if it is POLICY_THREAD and
+ *  the kernel does not support THREAD_EXEC.
+ */
+template <typename KernelType>
+bool dispatch_host_runtime_policy(RuntimePolicy policy,
+                                  KernelType&& kernel,
+                                  int numThreads = 0);
+
+} /* namespace axom */
+
+//------------------------------------------------------------------------------
+// IMPLEMENTATION
+//------------------------------------------------------------------------------
+namespace axom
+{
+namespace internal
+{
+/// Calls the kernel with THREAD_EXEC, iff the kernel supports it
+template <bool USE_THREAD_POOL>
+struct thread_policy_dispatcher
+{
+  template <typename KernelType>
+  static bool dispatch(KernelType&& kernel)
+  {
+    kernel(THREAD_EXEC<> {});
+    return true;
+  }
+};
+
+template <>
+struct thread_policy_dispatcher<false>
+{
+  template <typename KernelType>
+  static bool dispatch(KernelType&&)
+  {
+    return false;
+  }
+};
+
+#if defined(AXOM_USE_CUDA) && defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
+/// Calls the kernel with CUDA_EXEC, unless restricted to the host
+template <bool USE_DEVICE>
+struct device_policy_dispatcher
+{
+  template <typename KernelType>
+  static bool dispatch(KernelType&& kernel)
+  {
+    kernel(CUDA_EXEC<256> {});
+    return true;
+  }
+};
+
+template <>
+struct device_policy_dispatcher<false>
+{
+  template <typename KernelType>
+  static bool dispatch(KernelType&&)
+  {
+    return false;
+  }
+};
+#endif
+
+/*!
+ * \brief Dispatches the kernel to the execution space of the given policy,
+ *  among the enabled ones, and the CUDA one iff USE_DEVICE is true.
+ */
+template <bool USE_DEVICE, typename KernelType>
+inline bool dispatch_policy(RuntimePolicy policy,
+                            KernelType&& kernel,
+                            int numThreads)
+{
+  if(numThreads > 0 && (policy == POLICY_THREAD || policy == POLICY_OMP))
+  {
+    setNumThreads(numThreads);
+  }
+
+  using ThreadDispatcher = thread_policy_dispatcher<
+    supports_thread_exec<typename std::decay<KernelType>::type>::value>;
+
+  switch(policy)
+  {
+  case POLICY_SEQ:
+    kernel(SEQ_EXEC {});
+    return true;
+  case POLICY_THREAD:
+    return ThreadDispatcher::dispatch(kernel);
+#ifdef AXOM_USE_OPENMP
+  case POLICY_OMP:
+    kernel(OMP_EXEC {});
+    return true;
+#endif
+#if defined(AXOM_USE_CUDA) && defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
+  case POLICY_CUDA:
+    return device_policy_dispatcher<USE_DEVICE>::dispatch(kernel);
+#endif
+  default:
+    return false;
+  }
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+template <typename KernelType>
+inline bool dispatch_runtime_policy(RuntimePolicy policy,
+                                    KernelType&& kernel,
+                                    int numThreads)
+{
+  return internal::dispatch_policy<true>(policy, kernel, numThreads);
+}
+
+//------------------------------------------------------------------------------
+template <typename KernelType>
+inline bool dispatch_host_runtime_policy(RuntimePolicy policy,
+                                         KernelType&& kernel,
+                                         int numThreads)
+{
+  return internal::dispatch_policy<false>(policy, kernel, numThreads);
+}
+
+} /* namespace axom */
+
+#endif /* AXOM_RUNTIME_POLICY_HPP_ */
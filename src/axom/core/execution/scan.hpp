@@ -0,0 +1,135 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_CORE_EXECUTION_SCAN_HPP_
+#define AXOM_CORE_EXECUTION_SCAN_HPP_
+
+#include "axom/config.hpp"                         /* compile time defs */
+#include "axom/core/execution/execution_space.hpp" /* execution_space traits */
+#include "axom/core/execution/operators.hpp"       /* for axom::plus */
+#include "axom/core/execution/synchronize.hpp"     /* for synchronize() */
+#include "axom/core/execution/internal/cpu_primitives.hpp"
+#include "axom/core/Macros.hpp"            /* for axom macros */
+#include "axom/core/memory_management.hpp" /* for axom::copy() */
+#include "axom/core/Types.hpp"             /* for axom::IndexType */
+
+// C/C++ includes
+#include <type_traits>  // for std::common_type
+
+namespace axom
+{
+namespace internal
+{
+/*!
+ * \brief Dispatches an exclusive scan to the implementation that corresponds
+ *  to the given execution space.
+ */
+template <typename ExecSpace, bool ON_DEVICE = execution_space<ExecSpace>::onDevice()>
+struct scan_exec
+{
+  template <typename T, typename BinaryOp>
+  static inline T exclusive_scan(const T* input,
+                                 IndexType N,
+                                 T* output,
+                                 T init,
+                                 BinaryOp op)
+  {
+    return cpu_exclusive_scan<ExecSpace>(input, N, output, init, op);
+  }
+};
+
+#ifdef AXOM_USE_RAJA
+template <typename ExecSpace>
+struct scan_exec<ExecSpace, true>
+{
+  template <typename T, typename BinaryOp>
+  static inline T exclusive_scan(const T* input,
+                                 IndexType N,
+                                 T* output,
+                                 T init,
+                                 BinaryOp op)
+  {
+    // NOTE: grab the last input entry first, since the scan may be in place
+    T last;
+    axom::copy(&last, const_cast<T*>(input + N - 1), sizeof(T));
+
+    using loop_policy = typename execution_space<ExecSpace>::loop_policy;
+    RAJA::exclusive_scan<loop_policy>(input, input + N, output, op, init);
+    axom::synchronize<ExecSpace>();
+
+    T total;
+    axom::copy(&total, output + N - 1, sizeof(T));
+    return op(total, last);
+  }
+};
+#endif
+
+}  // namespace internal
+
+/// \name Generic Parallel Primitives
+/// @{
+
+/*!
+ * \brief Computes the exclusive prefix scan of the given array.
+ *
+ *  Upon return, `output[i] = init op input[0] op ... op input[i-1]`, such
+ *  that output[0] is equal to init.
+ *
+ * \param [in] input pointer to the array of values to scan.
+ * \param [in] N the number of entries in the array.
+ * \param [out] output pointer to the array, of length N, where to store the
+ *  result. May be the same as input, in which case the scan is done in place.
+ * \param [in] init the initial value of the scan.
+ * \param [in] op associative binary operator, e.g., axom::plus.
+ *
+ * \return the reduction of all entries, i.e.,
+ *  `init op input[0] op ... op input[N-1]`, which is the value that would
+ *  follow the last entry of the output. For example, this is the total number
+ *  of entries when scanning per-item counts to compute the offsets of a
+ *  compressed sparse row layout.
+ *
+ * \tparam ExecSpace the execution space where to compute the scan
+ * \tparam T the type of the values
+ * \tparam BinaryOp the type of the binary operator, defaults to axom::plus
+ *
+ * \pre input and output must be accessible from the execution space.
+ *
+ * Usage Example:
+ * \code
+ *
+ *    const IndexType* counts = ...
+ *    IndexType* offsets = ...
+ *
+ *    IndexType total = axom::exclusive_scan< axom::OMP_EXEC >( counts, N,
+ *                                                             offsets );
+ *
+ * \endcode
+ */
+template <typename ExecSpace, typename T, typename BinaryOp = axom::plus<T>>
+inline T exclusive_scan(const T* input,
+                        IndexType N,
+                        T* output,
+                        typename std::common_type<T>::type init = T(),
+                        BinaryOp op = BinaryOp {})
+{
+  AXOM_STATIC_ASSERT(execution_space<ExecSpace>::valid());
+
+  if(N <= 0)
+  {
+    return init;
+  }
+
+  return internal::scan_exec<ExecSpace>::exclusive_scan(input,
+                                                        N,
+                                                        output,
+                                                        init,
+                                                        op);
+}
+
+/// @}
+
+} /* namespace axom */
+
+#endif /* AXOM_CORE_EXECUTION_SCAN_HPP_ */
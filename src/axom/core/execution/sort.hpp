@@ -0,0 +1,144 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_CORE_EXECUTION_SORT_HPP_
+#define AXOM_CORE_EXECUTION_SORT_HPP_
+
+#include "axom/config.hpp"                         /* compile time defs */
+#include "axom/core/execution/execution_space.hpp" /* execution_space traits */
+#include "axom/core/execution/internal/cpu_primitives.hpp"
+#include "axom/core/execution/internal/radix_sort.hpp"
+#include "axom/core/Macros.hpp" /* for axom macros */
+#include "axom/core/Types.hpp"  /* for axom::IndexType */
+
+// C/C++ includes
+#include <type_traits>  // for std::is_integral, std::is_unsigned
+
+namespace axom
+{
+namespace internal
+{
+/*!
+ * \brief Dispatches a key-value sort to the implementation that corresponds
+ *  to the given execution space.
+ */
+template <typename ExecSpace, bool ON_DEVICE = execution_space<ExecSpace>::onDevice()>
+struct sort_exec
+{
+  template <typename KeyType, typename ValueType>
+  static inline void sort_pairs(KeyType* keys, ValueType* values, IndexType N)
+  {
+    using use_radix_sort =
+      std::integral_constant<bool,
+                             std::is_integral<KeyType>::value &&
+                               std::is_unsigned<KeyType>::value>;
+    sort_pairs(keys, values, N, use_radix_sort {});
+  }
+
+private:
+  template <typename KeyType, typename ValueType>
+  static inline void sort_pairs(KeyType* keys,
+                                ValueType* values,
+                                IndexType N,
+                                std::true_type)
+  {
+    if(N < RADIX_SORT_MIN_SIZE)
+    {
+      cpu_sort_pairs<ExecSpace>(keys, values, N);
+    }
+    else
+    {
+      cpu_radix_sort_pairs<ExecSpace>(keys, values, N);
+    }
+  }
+
+  template <typename KeyType, typename ValueType>
+  static inline void sort_pairs(KeyType* keys,
+                                ValueType* values,
+                                IndexType N,
+                                std::false_type)
+  {
+    cpu_sort_pairs<ExecSpace>(keys, values, N);
+  }
+};
+
+#ifdef AXOM_USE_RAJA
+template <typename ExecSpace>
+struct sort_exec<ExecSpace, true>
+{
+  template <typename KeyType, typename ValueType>
+  static inline void sort_pairs(KeyType* keys, ValueType* values, IndexType N)
+  {
+  #if(RAJA_VERSION_MAJOR > 0) || \
+    ((RAJA_VERSION_MAJOR == 0) && (RAJA_VERSION_MINOR >= 12))
+
+    using loop_policy = typename execution_space<ExecSpace>::loop_policy;
+    RAJA::stable_sort_pairs<loop_policy>(keys, keys + N, values);
+
+  #else
+
+    // NOTE: RAJA versions prior to v0.12.0 do not provide a sort, fall back to
+    // sorting on the host, which requires unified memory.
+    cpu_sort_pairs<SEQ_EXEC>(keys, values, N);
+
+  #endif
+  }
+};
+#endif
+
+}  // namespace internal
+
+/// \name Generic Parallel Primitives
+/// @{
+
+/*!
+ * \brief Sorts the given keys in ascending order and applies the same
+ *  permutation to the associated values.
+ *
+ *  The sort is stable, i.e., values with equal keys retain their relative
+ *  order.
+ *
+ *  On the CPU, unsigned integral keys, e.g., Morton codes, are sorted with a
+ *  parallel LSD radix sort, which is linear in N. Other key types are sorted
+ *  with a parallel merge sort.
+ *
+ * \param [in,out] keys pointer to the array of keys to sort.
+ * \param [in,out] values pointer to the array of values associated with keys.
+ * \param [in] N the number of key-value pairs.
+ *
+ * \tparam ExecSpace the execution space where to sort
+ * \tparam KeyType the type of the keys, which must be less-than comparable
+ * \tparam ValueType the type of the values
+ *
+ * \pre keys and values must be accessible from the execution space.
+ *
+ * Usage Example:
+ * \code
+ *
+ *    uint32* mortonCodes = ...
+ *    int32* ids = ...
+ *
+ *    axom::sort_pairs< axom::OMP_EXEC >( mortonCodes, ids, N );
+ *
+ * \endcode
+ */
+template <typename ExecSpace, typename KeyType, typename ValueType>
+inline void sort_pairs(KeyType* keys, ValueType* values, IndexType N)
+{
+  AXOM_STATIC_ASSERT(execution_space<ExecSpace>::valid());
+
+  if(N <= 1)
+  {
+    return;
+  }
+
+  internal::sort_exec<ExecSpace>::sort_pairs(keys, values, N);
+}
+
+/// @}
+
+} /* namespace axom */
+
+#endif /* AXOM_CORE_EXECUTION_SORT_HPP_ */
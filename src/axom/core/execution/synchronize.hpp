@@ -12,6 +12,31 @@
 
 namespace axom
 {
+namespace internal
+{
+/*!
+ * \brief Synchronizes with the given RAJA synchronization policy. Execution
+ *  spaces that do not bind a synchronization policy, i.e., void, are no-ops.
+ */
+template <typename SyncPolicy>
+struct synchronize_exec
+{
+  static inline void run() noexcept
+  {
+#ifdef AXOM_USE_RAJA
+    RAJA::synchronize<SyncPolicy>();
+#endif
+  }
+};
+
+template <>
+struct synchronize_exec<void>
+{
+  static inline void run() noexcept { }
+};
+
+}  // namespace internal
+
 /*!
  * \brief Synchronizes all execution threads when using an ASYNC policy with
  *  the specified execution space.
@@ -23,10 +48,8 @@ inline void synchronize() noexcept
 {
   AXOM_STATIC_ASSERT(execution_space<ExecSpace>::valid());
 
-#ifdef AXOM_USE_RAJA
   using sync_policy = typename execution_space<ExecSpace>::sync_policy;
-  RAJA::synchronize<sync_policy>();
-#endif
+  internal::synchronize_exec<sync_policy>::run();
 }
 
 template <>
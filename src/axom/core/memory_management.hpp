@@ -7,7 +7,10 @@
 #define AXOM_MEMORYMANAGEMENT_HPP_
 
 // Axom includes
-#include "axom/config.hpp"  // for AXOM compile-time definitions
+#include "axom/config.hpp"                 // for AXOM compile-time definitions
+#include "axom/core/AlignedAllocator.hpp"  // for axom::getAlignedAllocatorID
+#include "axom/core/MemoryTracker.hpp"     // for axom::MemoryTracker
+#include "axom/core/PoolAllocator.hpp"     // for axom::getPoolAllocatorID
 
 // Umpire includes
 #ifdef AXOM_USE_UMPIRE
@@ -23,6 +26,187 @@ namespace axom
 {
 constexpr int INVALID_ALLOCATOR_ID = -1;
 
+#ifndef AXOM_USE_UMPIRE
+
+namespace internal
+{
+/// \name Built-in allocators, used when Axom is compiled without Umpire
+/// @{
+
+constexpr int MALLOC_ALLOCATOR_ID = 0;    /*!< std::malloc() and std::free() */
+constexpr int POOL_ALLOCATOR_ID = 1;      /*!< axom::PoolAllocator */
+constexpr int ALIGNED_ALLOCATOR_ID = 2;   /*!< axom::AlignedAllocator */
+constexpr int HUGE_PAGE_ALLOCATOR_ID = 3; /*!< with huge pages */
+
+/*!
+ * \brief Header in front of each allocation, which records the allocator and
+ *  the size of the allocation for deallocate() and reallocate().
+ *
+ * \note The header is 16 bytes, hence, preserves the alignment of the
+ *  underlying allocation. The aligned allocators reserve AlignedAllocator::
+ *  ALIGNMENT bytes in front of each allocation, and put the header at the end
+ *  of that prefix, which preserves the larger alignment.
+ */
+struct AllocationHeader
+{
+  std::size_t numbytes; /*!< size of the allocation, including the header */
+  int allocatorID;      /*!< the allocator of the allocation */
+  int padding;
+};
+
+static_assert(sizeof(AllocationHeader) == 16,
+              "AllocationHeader must preserve 16-byte alignment");
+
+/*!
+ * \brief Returns a reference to the ID of the current default allocator.
+ */
+inline int& defaultAllocatorID()
+{
+  static int allocatorID = MALLOC_ALLOCATOR_ID;
+  return allocatorID;
+}
+
+/*!
+ * \brief Returns true iff the given ID is the ID of a built-in allocator.
+ */
+inline bool is_builtin_allocator(int allocID) noexcept
+{
+  return allocID >= MALLOC_ALLOCATOR_ID && allocID <= HUGE_PAGE_ALLOCATOR_ID;
+}
+
+/*!
+ * \brief Returns the number of bytes in front of the allocations of the given
+ *  allocator, which end with the AllocationHeader.
+ */
+inline std::size_t get_prefix_size(int allocID) noexcept
+{
+  return (allocID == ALIGNED_ALLOCATOR_ID || allocID == HUGE_PAGE_ALLOCATOR_ID)
+    ? AlignedAllocator::ALIGNMENT
+    : sizeof(AllocationHeader);
+}
+
+/*!
+ * \brief Allocates the given number of bytes, and a header, with the given
+ *  allocator. Returns a pointer to the memory after the header.
+ *
+ * \note Unknown allocator IDs fall back to std::malloc().
+ */
+inline void* allocate_bytes(std::size_t numbytes, int allocID) noexcept
+{
+  if(!is_builtin_allocator(allocID))
+  {
+    allocID = MALLOC_ALLOCATOR_ID;
+  }
+
+  const std::size_t prefix = get_prefix_size(allocID);
+  numbytes += prefix;
+
+  void* p = nullptr;
+  switch(allocID)
+  {
+  case POOL_ALLOCATOR_ID:
+    p = PoolAllocator::instance().allocate(numbytes);
+    break;
+  case ALIGNED_ALLOCATOR_ID:
+    p = AlignedAllocator::allocate(numbytes);
+    break;
+  case HUGE_PAGE_ALLOCATOR_ID:
+    p = AlignedAllocator::allocate(numbytes, true);
+    break;
+  default:
+    p = std::malloc(numbytes);
+  }
+
+  if(p == nullptr)
+  {
+    return nullptr;
+  }
+
+  AllocationHeader* header =
+    reinterpret_cast<AllocationHeader*>(static_cast<char*>(p) + prefix) - 1;
+  header->numbytes = numbytes;
+  header->allocatorID = allocID;
+  return header + 1;
+}
+
+/*!
+ * \brief Returns the header of the given allocation.
+ */
+inline AllocationHeader* get_header(void* p) noexcept
+{
+  return static_cast<AllocationHeader*>(p) - 1;
+}
+
+/*!
+ * \brief Frees the given allocation, including its header.
+ */
+inline void deallocate_bytes(void* p) noexcept
+{
+  const AllocationHeader* header = get_header(p);
+  void* base = static_cast<char*>(p) - get_prefix_size(header->allocatorID);
+
+  switch(header->allocatorID)
+  {
+  case POOL_ALLOCATOR_ID:
+    PoolAllocator::instance().deallocate(base, header->numbytes);
+    break;
+  case ALIGNED_ALLOCATOR_ID:
+  case HUGE_PAGE_ALLOCATOR_ID:
+    AlignedAllocator::deallocate(base);
+    break;
+  default:
+    std::free(base);
+  }
+}
+
+/*!
+ * \brief Reallocates the given allocation, with the same allocator, to the
+ *  given number of bytes.
+ */
+inline void* reallocate_bytes(void* p, std::size_t numbytes) noexcept
+{
+  AllocationHeader* header = get_header(p);
+  const int allocID = header->allocatorID;
+  const std::size_t prefix = get_prefix_size(allocID);
+  const std::size_t newbytes = numbytes + prefix;
+
+  if(allocID == MALLOC_ALLOCATOR_ID)
+  {
+    header = static_cast<AllocationHeader*>(std::realloc(header, newbytes));
+    if(header == nullptr)
+    {
+      return nullptr;
+    }
+    header->numbytes = newbytes;
+    return header + 1;
+  }
+
+  // pool blocks stay in place as long as the size class is the same
+  if(allocID == POOL_ALLOCATOR_ID &&
+     PoolAllocator::getBlockSize(newbytes) ==
+       PoolAllocator::getBlockSize(header->numbytes))
+  {
+    return p;
+  }
+
+  // NOTE: std::realloc() does not preserve the alignment, hence, aligned
+  // allocations are moved to a new allocation, as are the pool blocks
+  void* q = allocate_bytes(numbytes, allocID);
+  if(q != nullptr)
+  {
+    const std::size_t oldbytes = header->numbytes - prefix;
+    std::memcpy(q, p, (oldbytes < numbytes) ? oldbytes : numbytes);
+    deallocate_bytes(p);
+  }
+  return q;
+}
+
+/// @}
+
+} /* namespace internal */
+
+#endif /* AXOM_USE_UMPIRE */
+
 /// \name Memory Management Routines
 /// @{
 
@@ -46,8 +230,12 @@ inline int getUmpireResourceAllocatorID(
 /*!
  * \brief Sets the default memory allocator to use.
  * \param [in] allocatorID ID of the Umpire allocator to use.
- * 
- * \note This function has no effect when Axom is not compiled with Umpire.
+ *
+ * \note When Axom is not compiled with Umpire, the only valid IDs are those of
+ *  the built-in allocators, i.e., the initial default allocator, which uses
+ *  std::malloc(), and the allocators returned by getPoolAllocatorID(),
+ *  getAlignedAllocatorID() and getHugePageAllocatorID(). Other IDs are
+ *  ignored.
  */
 inline void setDefaultAllocator(int allocatorID)
 {
@@ -56,7 +244,10 @@ inline void setDefaultAllocator(int allocatorID)
   umpire::Allocator allocator = rm.getAllocator(allocatorID);
   rm.setDefaultAllocator(allocator);
 #else
-  static_cast<void>(allocatorID);  // silence compiler warnings
+  if(internal::is_builtin_allocator(allocatorID))
+  {
+    internal::defaultAllocatorID() = allocatorID;
+  }
 #endif
 }
 
@@ -70,7 +261,7 @@ inline int getDefaultAllocatorID()
 #ifdef AXOM_USE_UMPIRE
   return umpire::ResourceManager::getInstance().getDefaultAllocator().getId();
 #else
-  return 0;
+  return internal::defaultAllocatorID();
 #endif
 }
 
@@ -147,12 +338,24 @@ inline T* allocate(std::size_t n, int allocID) noexcept
 
   umpire::ResourceManager& rm = umpire::ResourceManager::getInstance();
   umpire::Allocator allocator = rm.getAllocator(allocID);
-  return static_cast<T*>(allocator.allocate(numbytes));
+  T* pointer = static_cast<T*>(allocator.allocate(numbytes));
+
+  if(numbytes >= AlignedAllocator::HUGE_PAGE_SIZE &&
+     allocID == getHugePageAllocatorID())
+  {
+    AlignedAllocator::adviseHugePages(pointer, numbytes);
+  }
 
 #else
-  static_cast<void>(allocID);  // silence compiler warnings
-  return static_cast<T*>(std::malloc(numbytes));
+  T* pointer = static_cast<T*>(internal::allocate_bytes(numbytes, allocID));
 #endif
+
+  if(MemoryTracker::isEnabled())
+  {
+    MemoryTracker::instance().recordAllocation(pointer, numbytes, allocID);
+  }
+
+  return pointer;
 }
 //------------------------------------------------------------------------------
 template <typename T>
@@ -160,6 +363,12 @@ inline void deallocate(T*& pointer) noexcept
 {
   if(pointer == nullptr) return;
 
+  // NOTE: must be recorded before the memory can be handed out again
+  if(MemoryTracker::isEnabled())
+  {
+    MemoryTracker::instance().recordDeallocation(pointer);
+  }
+
 #ifdef AXOM_USE_UMPIRE
 
   umpire::ResourceManager& rm = umpire::ResourceManager::getInstance();
@@ -167,7 +376,7 @@ inline void deallocate(T*& pointer) noexcept
 
 #else
 
-  std::free(pointer);
+  internal::deallocate_bytes(pointer);
 
 #endif
 
@@ -175,8 +384,27 @@ inline void deallocate(T*& pointer) noexcept
 }
 
 //------------------------------------------------------------------------------
+namespace internal
+{
+/*!
+ * \brief Returns the ID of the allocator of the given pointer.
+ * \pre p != nullptr
+ */
+inline int get_allocator_id(void* p) noexcept
+{
+#ifdef AXOM_USE_UMPIRE
+  return umpire::ResourceManager::getInstance().getAllocator(p).getId();
+#else
+  return get_header(p)->allocatorID;
+#endif
+}
+
+/*!
+ * \brief Reallocates the given pointer without recording it in the
+ *  MemoryTracker. See axom::reallocate().
+ */
 template <typename T>
-inline T* reallocate(T* pointer, std::size_t n) noexcept
+inline T* reallocate_untracked(T* pointer, std::size_t n) noexcept
 {
   const std::size_t numbytes = n * sizeof(T);
 
@@ -223,19 +451,55 @@ inline T* reallocate(T* pointer, std::size_t n) noexcept
 
 #else
 
-  pointer = static_cast<T*>(std::realloc(pointer, numbytes));
-
-  // Consistently handle realloc(0) for std::realloc to match Umpire's behavior
-  if(n == 0 && pointer == nullptr)
+  // NOTE: Like Umpire, a nullptr is reallocated with the default allocator.
+  // The header makes realloc(0) return a valid pointer, as in Umpire.
+  if(pointer == nullptr)
   {
-    pointer = axom::allocate<T>(0);
+    pointer = axom::allocate<T>(n);
+  }
+  else
+  {
+    pointer = static_cast<T*>(reallocate_bytes(pointer, numbytes));
   }
 
 #endif
 
+#ifdef AXOM_USE_UMPIRE
+  if(pointer != nullptr && numbytes >= AlignedAllocator::HUGE_PAGE_SIZE &&
+     get_allocator_id(pointer) == getHugePageAllocatorID())
+  {
+    AlignedAllocator::adviseHugePages(pointer, numbytes);
+  }
+#endif
+
   return pointer;
 }
 
+} /* namespace internal */
+
+//------------------------------------------------------------------------------
+template <typename T>
+inline T* reallocate(T* pointer, std::size_t n) noexcept
+{
+  if(!MemoryTracker::isEnabled())
+  {
+    return internal::reallocate_untracked(pointer, n);
+  }
+
+  // NOTE: Like Umpire, a nullptr is reallocated with the default allocator
+  if(pointer == nullptr)
+  {
+    return axom::allocate<T>(n);
+  }
+
+  void* newp = MemoryTracker::instance().recordReallocation(
+    pointer,
+    n * sizeof(T),
+    internal::get_allocator_id(pointer),
+    [=]() -> void* { return internal::reallocate_untracked(pointer, n); });
+  return static_cast<T*>(newp);
+}
+
 //------------------------------------------------------------------------------
 inline void copy(void* dst, void* src, std::size_t numbytes) noexcept
 {
@@ -6,8 +6,9 @@
 #ifndef AXOM_NUMERICS_DETERMINANTS_HPP_
 #define AXOM_NUMERICS_DETERMINANTS_HPP_
 
-#include "axom/core/numerics/LU.hpp"      // for lu_decompose()
-#include "axom/core/numerics/Matrix.hpp"  // for Matrix
+#include "axom/core/numerics/LU.hpp"           // for lu_decompose()
+#include "axom/core/numerics/Matrix.hpp"       // for Matrix
+#include "axom/core/numerics/StackMatrix.hpp"  // for StackMatrix
 
 #include "axom/core/Macros.hpp"
 
@@ -50,9 +51,10 @@ real determinant(const real& a00, const real& a01,
  * \return det the determinant of the 3x3 matrix.
  */
 template <typename real>
-inline real determinant(const real& a00,  const real& a01,  const real& a02,
-                        const real& a10,  const real& a11,  const real& a12,
-                        const real& a20,  const real& a21,  const real& a22)
+inline AXOM_HOST_DEVICE
+real determinant(const real& a00,  const real& a01,  const real& a02,
+                 const real& a10,  const real& a11,  const real& a12,
+                 const real& a20,  const real& a21,  const real& a22)
 {
   const real m01 = a00 * a11 - a10 * a01;
   const real m02 = a00 * a21 - a20 * a01;
@@ -83,7 +85,7 @@ inline real determinant(const real& a00,  const real& a01,  const real& a02,
  * \return det the determinant of the 4x4 matrix
  */
 template <typename real>
-inline real determinant(
+inline AXOM_HOST_DEVICE real determinant(
   const real& a00, const real& a01, const real& a02, const real& a03,
   const real& a10, const real& a11, const real& a12, const real& a13,
   const real& a20, const real& a21, const real& a22, const real& a23,
@@ -178,6 +180,72 @@ real determinant(const Matrix<real>& A)
 
   return (det);
 }
+/*!
+ * \brief Computes the determinant of the given square StackMatrix.
+ * \param [in] A an \f$ N \times N \f$ input matrix
+ * \return det the computed determinant.
+ *
+ * \note The determinant of 1x1, 2x2, 3x3 and 4x4 matrices is computed in
+ *  closed form. Larger matrices are LU-decomposed, without allocating memory.
+ */
+/// @{
+template <typename real>
+inline AXOM_HOST_DEVICE real determinant(const StackMatrix<real, 1, 1>& A)
+{
+  return A(0, 0);
+}
+
+template <typename real>
+inline AXOM_HOST_DEVICE real determinant(const StackMatrix<real, 2, 2>& A)
+{
+  return determinant(A(0,0), A(0,1),
+                     A(1,0), A(1,1));
+}
+
+template <typename real>
+inline AXOM_HOST_DEVICE real determinant(const StackMatrix<real, 3, 3>& A)
+{
+  return determinant(A(0,0), A(0,1), A(0,2),
+                     A(1,0), A(1,1), A(1,2),
+                     A(2,0), A(2,1), A(2,2));
+}
+
+template <typename real>
+inline AXOM_HOST_DEVICE real determinant(const StackMatrix<real, 4, 4>& A)
+{
+  return determinant(A(0,0), A(0,1), A(0,2), A(0,3),
+                     A(1,0), A(1,1), A(1,2), A(1,3),
+                     A(2,0), A(2,1), A(2,2), A(2,3),
+                     A(3,0), A(3,1), A(3,2), A(3,3));
+}
+
+template <typename real, int N>
+real determinant(const StackMatrix<real, N, N>& A)
+{
+  StackMatrix<real, N, N> lu = A;
+  int pivots[N];
+
+  real det = 0.0;
+  if(lu_decompose(lu, pivots) == LU_SUCCESS)
+  {
+    // count number of row interchanges
+    int row_interchanges = 0;
+    for(int i = 0; i < N; ++i)
+    {
+      row_interchanges += (pivots[i] != i) ? 1 : 0;
+    }  // END for all rows
+
+    det = ((row_interchanges & 1) == 0) ? 1.0 : -1.0;
+    for(int i = 0; i < N; ++i)
+    {
+      det *= lu(i, i);
+    }
+  }
+
+  return (det);
+}
+/// @}
+
 /// @}
 // clang-format on
 
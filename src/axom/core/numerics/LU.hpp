@@ -9,6 +9,7 @@
 #include "axom/core/utilities/Utilities.hpp"  // NearlyEqual(), swap() and abs()
 #include "axom/core/memory_management.hpp"    // alloc() and free()
 #include "axom/core/numerics/Matrix.hpp"      // for Matrix
+#include "axom/core/numerics/StackMatrix.hpp"  // for StackMatrix
 
 // C/C++ includes
 #include <cstring>  // for memcpy()
@@ -74,6 +75,22 @@ int lu_decompose(Matrix<T>& A, int* pivots);
 template <typename T>
 int lu_solve(const Matrix<T>& A, const int* pivots, const T* b, T* x);
 
+/*!
+ * \brief Overloads of lu_decompose() and lu_solve() for a StackMatrix.
+ *
+ * \note These overloads do not allocate memory.
+ */
+/// @{
+template <typename T, int N>
+int lu_decompose(StackMatrix<T, N, N>& A, int* pivots);
+
+template <typename T, int N>
+int lu_solve(const StackMatrix<T, N, N>& A,
+             const int* pivots,
+             const T* b,
+             T* x);
+/// @}
+
 /// @}
 
 } /* end namespace numerics */
@@ -86,8 +103,13 @@ namespace axom
 {
 namespace numerics
 {
-template <typename T>
-int lu_decompose(Matrix<T>& LU, int* pivots)
+namespace internal
+{
+/*!
+ * \brief Implements lu_decompose() for a Matrix or a StackMatrix.
+ */
+template <typename T, typename MatrixType>
+int lu_decompose_impl(MatrixType& LU, int* pivots)
 {
   // Sanity Checks
   assert("pre: pivots buffer is NULL" && (pivots != nullptr));
@@ -149,8 +171,16 @@ int lu_decompose(Matrix<T>& LU, int* pivots)
 }
 
 //------------------------------------------------------------------------------
-template <typename T>
-int lu_solve(const Matrix<T>& A, const int* pivots, const T* b, T* x)
+/*!
+ * \brief Implements lu_solve() for a Matrix or a StackMatrix, given a buffer,
+ *  rhs, of A.getNumRows() entries for the permuted right-hand side.
+ */
+template <typename T, typename MatrixType>
+int lu_solve_impl(const MatrixType& A,
+                  const int* pivots,
+                  const T* b,
+                  T* x,
+                  T* rhs)
 {
   // Sanity checks
   assert("pre: pivots buffer is NULL!" && (pivots != nullptr));
@@ -163,7 +193,6 @@ int lu_solve(const Matrix<T>& A, const int* pivots, const T* b, T* x)
   }
 
   const int size = A.getNumRows();
-  T* rhs = axom::allocate<T>(size);
   memcpy(rhs, b, size * sizeof(T));
 
   // forward-solve L part (top-to-bottom)
@@ -194,10 +223,46 @@ int lu_solve(const Matrix<T>& A, const int* pivots, const T* b, T* x)
     }  // END for j
   }    // END for i
 
-  axom::deallocate(rhs);
   return LU_SUCCESS;
 }
 
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+template <typename T>
+int lu_decompose(Matrix<T>& LU, int* pivots)
+{
+  return internal::lu_decompose_impl<T>(LU, pivots);
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+int lu_solve(const Matrix<T>& A, const int* pivots, const T* b, T* x)
+{
+  T* rhs = axom::allocate<T>(A.getNumRows());
+  const int rc = internal::lu_solve_impl(A, pivots, b, x, rhs);
+  axom::deallocate(rhs);
+  return rc;
+}
+
+//------------------------------------------------------------------------------
+template <typename T, int N>
+int lu_decompose(StackMatrix<T, N, N>& A, int* pivots)
+{
+  return internal::lu_decompose_impl<T>(A, pivots);
+}
+
+//------------------------------------------------------------------------------
+template <typename T, int N>
+int lu_solve(const StackMatrix<T, N, N>& A,
+             const int* pivots,
+             const T* b,
+             T* x)
+{
+  T rhs[N];
+  return internal::lu_solve_impl(A, pivots, b, x, rhs);
+}
+
 } /* end namespace numerics */
 } /* end namespace axom */
 
@@ -0,0 +1,287 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_NUMERICS_STACKMATRIX_HPP_
+#define AXOM_NUMERICS_STACKMATRIX_HPP_
+
+#include "axom/config.hpp"                    // for compile-time defines
+#include "axom/core/Macros.hpp"               // for axom macros
+#include "axom/core/Types.hpp"                // for IndexType
+#include "axom/core/utilities/Utilities.hpp"  // for utilities::swap()
+
+// C/C++ includes
+#include <cassert>   // for assert()
+#include <iostream>  // for std::ostream
+
+namespace axom
+{
+namespace numerics
+{
+/*!
+ * \class StackMatrix
+ *
+ * \brief An \f$ M \times N \f$ matrix whose dimensions are known at
+ *  compile-time, and whose entries are stored in place, e.g., on the stack.
+ *
+ *  StackMatrix is the fixed-size counterpart of Matrix. It never allocates
+ *  memory, and, since the dimensions are compile-time constants, the loops of
+ *  the matrix operators over its entries can be fully unrolled. It is meant
+ *  for the many small matrices, e.g., the 3x3 Jacobians, that are built in
+ *  tight loops.
+ *
+ *  The matrix operators of Matrix, i.e., matrix_multiply(), matrix_transpose()
+ *  etc. in matvecops.hpp, determinant(), lu_decompose(), lu_solve(),
+ *  linear_solve(), jacobi_eigensolve() and eigen_sort(), are overloaded for
+ *  StackMatrix, with the same semantics. The dimensions of the operands are
+ *  checked at compile-time.
+ *
+ *  Like StackArray, StackMatrix is an aggregate, hence, it can be initialized
+ *  with a brace-enclosed list of its entries, in column-major order, and used
+ *  in constant expressions.
+ *
+ * \note The underlying storage layout is column-major, as for Matrix.
+ *
+ *  Example Usage:
+ *  \code
+ *
+ *    using Matrix3 = axom::numerics::StackMatrix< double, 3, 3 >;
+ *
+ *    Matrix3 J = Matrix3::zeros();
+ *    J( 0, 0 ) = ...
+ *
+ *    double det = axom::numerics::determinant( J );
+ *
+ *    // column-major initialization, i.e., A(0,1) = 3
+ *    constexpr axom::numerics::StackMatrix< double, 2, 2 > A{ { 1, 2, 3, 4 } };
+ *    static_assert( A( 0, 1 ) == 3, "" );
+ *
+ *  \endcode
+ *
+ * \tparam T the underlying matrix data type, e.g., float, double, etc.
+ * \tparam M the number of rows of the matrix.
+ * \tparam N the number of columns of the matrix, defaults to M.
+ *
+ * \see Matrix, StackArray
+ */
+template <typename T, int M, int N = M>
+struct StackMatrix
+{
+  AXOM_STATIC_ASSERT_MSG(M > 0 && N > 0, "matrix dimensions must be positive");
+
+  /*!
+   * \brief Returns the number of rows in the matrix.
+   */
+  AXOM_HOST_DEVICE static constexpr int getNumRows() { return M; }
+
+  /*!
+   * \brief Returns the number of columns in the matrix.
+   */
+  AXOM_HOST_DEVICE static constexpr int getNumColumns() { return N; }
+
+  /*!
+   * \brief Checks if the matrix is square.
+   */
+  AXOM_HOST_DEVICE static constexpr bool isSquare() { return M == N; }
+
+  /*!
+   * \brief Returns the size of the diagonal.
+   */
+  AXOM_HOST_DEVICE static constexpr int getDiagonalSize()
+  {
+    return (M < N) ? M : N;
+  }
+
+  /*!
+   * \brief Given an \f$ M \times N \f$ matrix, \f$ \mathcal{A} \f$, return a
+   *  const reference to the matrix element \f$ \mathcal{A}_{ij} \f$
+   *
+   * \param [in] i the row index of the matrix element,
+   * \param [in] j the column index of the matrix element.
+   * \return A(i,j) the element at the given row and column.
+   *
+   * \pre (i >= 0) && (i < M)
+   * \pre (j >= 0) && (j < N)
+   */
+  AXOM_HOST_DEVICE constexpr const T& operator()(IndexType i, IndexType j) const
+  {
+    return m_data[j * M + i];
+  }
+
+  /*!
+   * \brief Given an \f$ M \times N \f$ matrix, \f$ \mathcal{A} \f$, return a
+   *  reference to the matrix element \f$ \mathcal{A}_{ij} \f$
+   *
+   * \param [in] i the row index of the matrix element,
+   * \param [in] j the column index of the matrix element.
+   * \return A(i,j) the element at the given row and column.
+   *
+   * \pre (i >= 0) && (i < M)
+   * \pre (j >= 0) && (j < N)
+   */
+  AXOM_HOST_DEVICE T& operator()(IndexType i, IndexType j)
+  {
+    assert((i >= 0) && (i < M));
+    assert((j >= 0) && (j < N));
+    return m_data[j * M + i];
+  }
+
+  /*!
+   * \brief Returns a pointer to the jth column of the matrix.
+   *
+   * \param [in] j the column index.
+   * \return ptr pointer to the M entries of the jth column.
+   *
+   * \pre (j >= 0) && (j < N)
+   */
+  /// @{
+
+  AXOM_HOST_DEVICE constexpr const T* getColumn(IndexType j) const
+  {
+    return &m_data[j * M];
+  }
+
+  AXOM_HOST_DEVICE T* getColumn(IndexType j) { return &m_data[j * M]; }
+
+  /// @}
+
+  /*!
+   * \brief Returns a pointer to the raw data of the matrix, in column-major
+   *  order.
+   */
+  /// @{
+
+  AXOM_HOST_DEVICE constexpr const T* data() const { return &m_data[0]; }
+
+  AXOM_HOST_DEVICE T* data() { return &m_data[0]; }
+
+  /// @}
+
+  /*!
+   * \brief Assigns the given value to all the entries of the matrix.
+   * \param [in] val the value to assign.
+   */
+  AXOM_HOST_DEVICE void fill(const T& val)
+  {
+    for(int i = 0; i < M * N; ++i)
+    {
+      m_data[i] = val;
+    }
+  }
+
+  /*!
+   * \brief Assigns the given value to the diagonal entries of the matrix.
+   * \param [in] val the value to assign.
+   */
+  AXOM_HOST_DEVICE void fillDiagonal(const T& val)
+  {
+    for(int i = 0; i < getDiagonalSize(); ++i)
+    {
+      m_data[i * M + i] = val;
+    }
+  }
+
+  /*!
+   * \brief Swaps the rows of the matrix.
+   *
+   * \param [in] i the index of the first row.
+   * \param [in] j the index of the second row.
+   *
+   * \pre (i >= 0) && (i < M)
+   * \pre (j >= 0) && (j < M)
+   */
+  AXOM_HOST_DEVICE void swapRows(IndexType i, IndexType j)
+  {
+    assert((i >= 0) && (i < M));
+    assert((j >= 0) && (j < M));
+    for(int k = 0; k < N; ++k)
+    {
+      utilities::swap(m_data[k * M + i], m_data[k * M + j]);
+    }
+  }
+
+  /*!
+   * \brief Swaps the columns of the matrix.
+   *
+   * \param [in] i the index of the first column.
+   * \param [in] j the index of the second column.
+   *
+   * \pre (i >= 0) && (i < N)
+   * \pre (j >= 0) && (j < N)
+   */
+  AXOM_HOST_DEVICE void swapColumns(IndexType i, IndexType j)
+  {
+    assert((i >= 0) && (i < N));
+    assert((j >= 0) && (j < N));
+    for(int k = 0; k < M; ++k)
+    {
+      utilities::swap(m_data[i * M + k], m_data[j * M + k]);
+    }
+  }
+
+  /*!
+   * \brief Returns the identity matrix.
+   * \pre M == N
+   */
+  AXOM_HOST_DEVICE static StackMatrix identity()
+  {
+    AXOM_STATIC_ASSERT_MSG(M == N, "the identity matrix must be square");
+    StackMatrix I = zeros();
+    I.fillDiagonal(static_cast<T>(1));
+    return I;
+  }
+
+  /*!
+   * \brief Returns a matrix whose entries are all zero.
+   */
+  AXOM_HOST_DEVICE static StackMatrix zeros()
+  {
+    StackMatrix Z;
+    Z.fill(static_cast<T>(0));
+    return Z;
+  }
+
+  /*!
+   * \brief Returns a matrix whose entries are all one.
+   */
+  AXOM_HOST_DEVICE static StackMatrix ones()
+  {
+    StackMatrix O;
+    O.fill(static_cast<T>(1));
+    return O;
+  }
+
+  T m_data[M * N];
+};
+
+/*!
+ * \brief Overloaded output stream operator. Outputs the matrix coefficients
+ *  in to the given output stream.
+ *
+ * \param [in,out] os output stream object.
+ * \param [in] A user-supplied matrix instance.
+ * \return os the updated output stream object.
+ */
+template <typename T, int M, int N>
+std::ostream& operator<<(std::ostream& os, const StackMatrix<T, M, N>& A)
+{
+  for(int i = 0; i < M; ++i)
+  {
+    os << "[ ";
+    for(int j = 0; j < N; ++j)
+    {
+      os << A(i, j) << " ";
+    }  // END for all j
+
+    os << "]\n";
+
+  }  // END for all i
+
+  return (os);
+}
+
+} /* end namespace numerics */
+} /* end namespace axom */
+
+#endif /* AXOM_NUMERICS_STACKMATRIX_HPP_ */
@@ -0,0 +1,659 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_NUMERICS_BATCHED_LINEAR_ALGEBRA_HPP_
+#define AXOM_NUMERICS_BATCHED_LINEAR_ALGEBRA_HPP_
+
+#include "axom/config.hpp"                           // compile-time defs
+#include "axom/core/Macros.hpp"                      // AXOM_HOST_DEVICE
+#include "axom/core/Types.hpp"                       // IndexType
+#include "axom/core/execution/execution_space.hpp"   // execution spaces
+#include "axom/core/execution/for_all.hpp"           // for_all()
+#include "axom/core/numerics/Determinants.hpp"       // determinant()
+#include "axom/core/numerics/LU.hpp"                 // LU return codes
+#include "axom/core/numerics/jacobi_eigensolve.hpp"  // JACOBI constants
+#include "axom/core/utilities/Utilities.hpp"         // abs(), isNearlyEqual()
+
+// C/C++ includes
+#include <cassert>      // for assert()
+#include <cmath>        // for sqrt()
+#include <type_traits>  // for std::is_floating_point
+
+/*!
+ * \file
+ *
+ * \brief Batched LU decomposition, linear solve, determinant and symmetric
+ *  eigensolve for many small, fixed-size, N x N matrices, with N = 2, 3 or 4.
+ *
+ *  The batches are stored in a structure-of-arrays layout, i.e., entry (i,j)
+ *  of matrix k, in a batch of n matrices, is stored at A[ (i*N + j)*n + k ],
+ *  and entry i of vector k is stored at b[ i*n + k ]. Hence, the same entry
+ *  of consecutive matrices is contiguous in memory, which makes the loop over
+ *  the batch unit-stride, and amenable to vectorization. The matrices are
+ *  processed in parallel via axom::for_all() in the given execution space.
+ *
+ *  In contrast to the routines that operate on a single numerics::Matrix,
+ *  the batched routines do not allocate memory, and are meant for the many
+ *  tiny systems that arise, e.g., in Newton iterations over the cells of a
+ *  mesh, or in oriented bounding box fits.
+ *
+ * \note The supplied buffers must be accessible in the given execution space,
+ *  e.g., allocated with the default allocator of the execution space.
+ *
+ *  Example Usage:
+ *  \code
+ *
+ *    // solve n 3x3 systems, A x = b, in parallel
+ *    double* A = axom::allocate< double >( 9 * n );
+ *    double* b = axom::allocate< double >( 3 * n );
+ *    double* x = axom::allocate< double >( 3 * n );
+ *    int* status = axom::allocate< int >( n );
+ *    ...
+ *    axom::numerics::batched_linear_solve< 3, axom::OMP_EXEC >(A, b, x,
+ *                                                            status, n);
+ *
+ *  \endcode
+ */
+
+namespace axom
+{
+namespace numerics
+{
+/// \name Batched Matrix Operators
+/// @{
+
+/*!
+ * \brief Computes the determinants of a batch of N x N matrices.
+ *
+ * \param [in] A the batch of matrices, in structure-of-arrays layout
+ * \param [out] det buffer of n entries, where the determinants are stored
+ * \param [in] n the number of matrices in the batch
+ *
+ * \tparam N the number of rows, and columns, of the matrices
+ * \tparam ExecSpace the execution space where to run the kernel
+ *
+ * \pre A != nullptr
+ * \pre det != nullptr
+ */
+template <int N, typename ExecSpace = SEQ_EXEC, typename T>
+void batched_determinant(const T* A, T* det, IndexType n);
+
+/*!
+ * \brief Performs an in-place LU-decomposition with partial pivoting on each
+ *  matrix of a batch of N x N matrices.
+ *
+ *  The L and U factors of each matrix are stored in-place, as by
+ *  lu_decompose(). However, the row-interchanges are stored as a permutation,
+ *  i.e., row i of the decomposition of a matrix is row pivots[i] of the
+ *  matrix.
+ *
+ * \param [in,out] A the batch of matrices, in structure-of-arrays layout
+ * \param [out] pivots buffer of N*n entries, where the row permutation of
+ *  each matrix is stored, in structure-of-arrays layout
+ * \param [out] status buffer of n entries, where the return code of each
+ *  matrix is stored, i.e., LU_SUCCESS or LU_SINGULAR_MATRIX (optional)
+ * \param [in] n the number of matrices in the batch
+ *
+ * \tparam N the number of rows, and columns, of the matrices
+ * \tparam ExecSpace the execution space where to run the kernel
+ *
+ * \pre A != nullptr
+ * \pre pivots != nullptr
+ */
+template <int N, typename ExecSpace = SEQ_EXEC, typename T>
+void batched_lu_decompose(T* A, int* pivots, int* status, IndexType n);
+
+/*!
+ * \brief Solves the systems \f$ A_k x_k = b_k \f$ of a batch, given the LU
+ *  decompositions of the matrices computed by batched_lu_decompose().
+ *
+ * \param [in] LU the batch of LU-decomposed matrices
+ * \param [in] pivots the row permutations of the matrices
+ * \param [in] b the batch of right-hand sides, in structure-of-arrays layout
+ * \param [out] x the batch of solution vectors (computed)
+ * \param [in] n the number of systems in the batch
+ *
+ * \tparam N the number of rows, and columns, of the matrices
+ * \tparam ExecSpace the execution space where to run the kernel
+ *
+ * \note The solution of a system is unspecified if its matrix is singular.
+ *
+ * \pre LU != nullptr
+ * \pre pivots != nullptr
+ * \pre b != nullptr
+ * \pre x != nullptr
+ */
+template <int N, typename ExecSpace = SEQ_EXEC, typename T>
+void batched_lu_solve(const T* LU,
+                      const int* pivots,
+                      const T* b,
+                      T* x,
+                      IndexType n);
+
+/*!
+ * \brief Solves the linear systems \f$ A_k x_k = b_k \f$ of a batch.
+ *
+ * \param [in] A the batch of matrices, in structure-of-arrays layout
+ * \param [in] b the batch of right-hand sides, in structure-of-arrays layout
+ * \param [out] x the batch of solution vectors (computed)
+ * \param [out] status buffer of n entries, where the return code of each
+ *  system is stored, i.e., LU_SUCCESS or LU_SINGULAR_MATRIX (optional)
+ * \param [in] n the number of systems in the batch
+ *
+ * \tparam N the number of rows, and columns, of the matrices
+ * \tparam ExecSpace the execution space where to run the kernel
+ *
+ * \note Unlike linear_solve(), the input matrices are not modified.
+ * \note The solution of a system is unspecified if its matrix is singular.
+ *
+ * \pre A != nullptr
+ * \pre b != nullptr
+ * \pre x != nullptr
+ */
+template <int N, typename ExecSpace = SEQ_EXEC, typename T>
+void batched_linear_solve(const T* A,
+                          const T* b,
+                          T* x,
+                          int* status,
+                          IndexType n);
+
+/*!
+ * \brief Computes the eigenvalues and eigenvectors of a batch of real
+ *  symmetric N x N matrices using the cyclic Jacobi method.
+ *
+ * \param [in] A the batch of symmetric matrices, in structure-of-arrays layout
+ * \param [out] lambdas the eigenvalues of each matrix, in ascending order,
+ *  stored in structure-of-arrays layout, i.e., N*n entries
+ * \param [out] V the eigenvectors of each matrix, stored as the columns of
+ *  the matrix, in the same order as the eigenvalues
+ * \param [out] status buffer of n entries, where the return code of each
+ *  matrix is stored, i.e., JACOBI_EIGENSOLVE_SUCCESS or
+ *  JACOBI_EIGENSOLVE_FAILURE if the iteration did not converge (optional)
+ * \param [in] n the number of matrices in the batch
+ * \param [in] maxIterations the maximum number of Jacobi sweeps (optional)
+ *
+ * \tparam N the number of rows, and columns, of the matrices
+ * \tparam ExecSpace the execution space where to run the kernel
+ *
+ * \note Only the upper triangular part of each matrix is read.
+ *
+ * \pre A != nullptr
+ * \pre lambdas != nullptr
+ * \pre V != nullptr
+ *
+ * \see jacobi_eigensolve()
+ */
+template <int N, typename ExecSpace = SEQ_EXEC, typename T>
+void batched_symmetric_eigensolve(
+  const T* A,
+  T* lambdas,
+  T* V,
+  int* status,
+  IndexType n,
+  int maxIterations = JACOBI_DEFAULT_MAX_ITERATIONS);
+
+/// @}
+
+} /* end namespace numerics */
+} /* end namespace axom */
+
+//------------------------------------------------------------------------------
+// IMPLEMENTATION
+//------------------------------------------------------------------------------
+namespace axom
+{
+namespace numerics
+{
+namespace internal
+{
+/// Gathers matrix k of a batch of n matrices into a local array
+template <int N, typename T>
+AXOM_HOST_DEVICE inline void load_matrix(const T* A,
+                                         IndexType n,
+                                         IndexType k,
+                                         T (&a)[N][N])
+{
+  for(int i = 0; i < N; ++i)
+  {
+    for(int j = 0; j < N; ++j)
+    {
+      a[i][j] = A[(i * N + j) * n + k];
+    }
+  }
+}
+
+/// Scatters a local array to matrix k of a batch of n matrices
+template <int N, typename T>
+AXOM_HOST_DEVICE inline void store_matrix(const T (&a)[N][N],
+                                          IndexType n,
+                                          IndexType k,
+                                          T* A)
+{
+  for(int i = 0; i < N; ++i)
+  {
+    for(int j = 0; j < N; ++j)
+    {
+      A[(i * N + j) * n + k] = a[i][j];
+    }
+  }
+}
+
+/// Computes the determinant of a local 2x2, 3x3 or 4x4 matrix
+template <typename T>
+AXOM_HOST_DEVICE inline T determinant(const T (&a)[2][2])
+{
+  return numerics::determinant(a[0][0], a[0][1], a[1][0], a[1][1]);
+}
+
+template <typename T>
+AXOM_HOST_DEVICE inline T determinant(const T (&a)[3][3])
+{
+  // clang-format off
+  return numerics::determinant(a[0][0], a[0][1], a[0][2],
+                               a[1][0], a[1][1], a[1][2],
+                               a[2][0], a[2][1], a[2][2]);
+  // clang-format on
+}
+
+template <typename T>
+AXOM_HOST_DEVICE inline T determinant(const T (&a)[4][4])
+{
+  // clang-format off
+  return numerics::determinant(a[0][0], a[0][1], a[0][2], a[0][3],
+                               a[1][0], a[1][1], a[1][2], a[1][3],
+                               a[2][0], a[2][1], a[2][2], a[2][3],
+                               a[3][0], a[3][1], a[3][2], a[3][3]);
+  // clang-format on
+}
+
+/*!
+ * \brief LU-decomposition with partial pivoting of a local matrix, stored
+ *  in-place as by lu_decompose(). On return, row i of the decomposition is
+ *  row perm[i] of the input matrix.
+ *
+ * \note The rows are interchanged with conditional swaps, rather than by
+ *  indexing with the pivot, and the factorization does not return early for
+ *  a singular matrix. Hence, all the indices are known at compile-time once
+ *  the loops are unrolled, which lets the compiler keep the matrix in
+ *  registers and replace the pivoting branches with selects.
+ */
+template <int N, typename T>
+AXOM_HOST_DEVICE inline int lu_decompose(T (&lu)[N][N], int (&perm)[N])
+{
+  int rc = LU_SUCCESS;
+
+  for(int i = 0; i < N; ++i)
+  {
+    perm[i] = i;
+  }
+
+  for(int i = 0; i < N; ++i)
+  {
+    // move the max element of the ith column, below the diagonal, to lu[i][i]
+    for(int j = i + 1; j < N; ++j)
+    {
+      const bool swap = utilities::abs(lu[i][i]) < utilities::abs(lu[j][i]);
+      for(int l = 0; l < N; ++l)
+      {
+        const T a = lu[i][l];
+        const T b = lu[j][l];
+        lu[i][l] = swap ? b : a;
+        lu[j][l] = swap ? a : b;
+      }
+      const int pi = perm[i];
+      const int pj = perm[j];
+      perm[i] = swap ? pj : pi;
+      perm[j] = swap ? pi : pj;
+    }
+
+    const bool singular = utilities::isNearlyEqual(lu[i][i], static_cast<T>(0));
+    rc = singular ? LU_SINGULAR_MATRIX : rc;
+
+    // scale upper triangular entries by the diagonal
+    const T scale_factor =
+      static_cast<T>(1) / (singular ? static_cast<T>(1) : lu[i][i]);
+    for(int j = i + 1; j < N; ++j)
+    {
+      lu[i][j] *= scale_factor;
+    }
+
+    // update sub-matrix by subtracting the upper triangular part
+    for(int irow = i + 1; irow < N; ++irow)
+    {
+      for(int jcol = i + 1; jcol < N; ++jcol)
+      {
+        lu[irow][jcol] -= lu[irow][i] * lu[i][jcol];
+      }
+    }
+  }
+
+  return rc;
+}
+
+/*!
+ * \brief Solves \f$ LU x = b \f$ for a local LU-decomposed matrix, where the
+ *  right-hand side is already permuted, i.e., b[i] is entry perm[i] of the
+ *  original right-hand side. The right-hand side is supplied in x, and is
+ *  overwritten by the solution.
+ */
+template <int N, typename T>
+AXOM_HOST_DEVICE inline void lu_solve(const T (&lu)[N][N], T (&x)[N])
+{
+  // forward-solve L part (top-to-bottom)
+  for(int i = 0; i < N; ++i)
+  {
+    for(int j = 0; j < i; ++j)
+    {
+      x[i] -= lu[i][j] * x[j];
+    }
+
+    x[i] /= lu[i][i];
+  }
+
+  // back-substitute U part (bottom-to-top)
+  for(int i = N - 1; i >= 0; --i)
+  {
+    for(int j = i + 1; j < N; ++j)
+    {
+      x[i] -= lu[i][j] * x[j];
+    }
+  }
+}
+
+/*!
+ * \brief Cyclic Jacobi eigensolve of a local symmetric matrix, which is
+ *  reduced to a diagonal matrix in the process. The eigenvalues are sorted in
+ *  ascending order, along with the eigenvectors, i.e., the columns of v.
+ */
+template <int N, typename T>
+AXOM_HOST_DEVICE inline int symmetric_eigensolve(T (&a)[N][N],
+                                                 T (&lambdas)[N],
+                                                 T (&v)[N][N],
+                                                 int maxIterations)
+{
+  const T TOL = static_cast<T>(JACOBI_DEFAULT_TOLERANCE);
+
+  for(int i = 0; i < N; ++i)
+  {
+    for(int j = 0; j < N; ++j)
+    {
+      v[i][j] = (i == j) ? 1 : 0;
+    }
+  }
+
+  // NOTE: only the upper triangular part is read, symmetrize
+  for(int i = 0; i < N; ++i)
+  {
+    for(int j = 0; j < i; ++j)
+    {
+      a[i][j] = a[j][i];
+    }
+  }
+
+  bool converged = false;
+  for(int iter = 0; !converged && iter <= maxIterations; ++iter)
+  {
+    T sum = 0;
+    for(int p = 0; p < N; ++p)
+    {
+      for(int q = p + 1; q < N; ++q)
+      {
+        sum += a[p][q] * a[p][q];
+      }
+    }
+
+    converged = utilities::isNearlyEqual(sqrt(sum) / (4 * N), T(0), TOL);
+    if(converged || iter == maxIterations)
+    {
+      break;
+    }
+
+    for(int p = 0; p < N; ++p)
+    {
+      for(int q = p + 1; q < N; ++q)
+      {
+        const T app = a[p][p];
+        const T aqq = a[q][q];
+        const T apq = a[p][q];
+        const T g = 100 * utilities::abs(apq);
+
+        // the off-diagonal element is negligible w.r.t. the diagonal
+        if(utilities::abs(app) + g == utilities::abs(app) &&
+           utilities::abs(aqq) + g == utilities::abs(aqq))
+        {
+          a[p][q] = a[q][p] = 0;
+          continue;
+        }
+
+        // compute the rotation that annihilates a[p][q]
+        const T theta = (aqq - app) / (2 * apq);
+        T t = 1 / (utilities::abs(theta) + sqrt(theta * theta + 1));
+        if(theta < 0)
+        {
+          t = -t;
+        }
+        const T c = 1 / sqrt(t * t + 1);
+        const T s = t * c;
+
+        // A = J^T A J, V = V J
+        for(int k = 0; k < N; ++k)
+        {
+          const T akp = a[k][p];
+          const T akq = a[k][q];
+          a[k][p] = c * akp - s * akq;
+          a[k][q] = s * akp + c * akq;
+
+          const T vkp = v[k][p];
+          const T vkq = v[k][q];
+          v[k][p] = c * vkp - s * vkq;
+          v[k][q] = s * vkp + c * vkq;
+        }
+        for(int k = 0; k < N; ++k)
+        {
+          const T apk = a[p][k];
+          const T aqk = a[q][k];
+          a[p][k] = c * apk - s * aqk;
+          a[q][k] = s * apk + c * aqk;
+        }
+      }
+    }
+  }
+
+  for(int i = 0; i < N; ++i)
+  {
+    lambdas[i] = a[i][i];
+  }
+
+  // sort eigenvalues in ascending order
+  for(int i = 0; i < N - 1; ++i)
+  {
+    int m = i;
+    for(int j = i + 1; j < N; ++j)
+    {
+      if(lambdas[j] < lambdas[m])
+      {
+        m = j;
+      }
+    }
+
+    if(m != i)
+    {
+      utilities::swap(lambdas[i], lambdas[m]);
+      for(int k = 0; k < N; ++k)
+      {
+        utilities::swap(v[k][i], v[k][m]);
+      }
+    }
+  }
+
+  return converged ? JACOBI_EIGENSOLVE_SUCCESS : JACOBI_EIGENSOLVE_FAILURE;
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+template <int N, typename ExecSpace, typename T>
+void batched_determinant(const T* A, T* det, IndexType n)
+{
+  AXOM_STATIC_ASSERT_MSG(N >= 2 && N <= 4, "N must be 2, 3 or 4");
+  assert("pre: matrices buffer is null" && (A != nullptr));
+  assert("pre: determinants buffer is null" && (det != nullptr));
+
+  for_all<ExecSpace>(
+    n,
+    AXOM_LAMBDA(IndexType k) {
+      T a[N][N];
+      internal::load_matrix(A, n, k, a);
+      det[k] = internal::determinant(a);
+    });
+}
+
+//------------------------------------------------------------------------------
+template <int N, typename ExecSpace, typename T>
+void batched_lu_decompose(T* A, int* pivots, int* status, IndexType n)
+{
+  AXOM_STATIC_ASSERT_MSG(N >= 2 && N <= 4, "N must be 2, 3 or 4");
+  AXOM_STATIC_ASSERT_MSG(std::is_floating_point<T>::value,
+                         "pre: T is a floating point type");
+  assert("pre: matrices buffer is null" && (A != nullptr));
+  assert("pre: pivots buffer is null" && (pivots != nullptr));
+
+  for_all<ExecSpace>(
+    n,
+    AXOM_LAMBDA(IndexType k) {
+      T lu[N][N];
+      int perm[N];
+      internal::load_matrix(A, n, k, lu);
+      const int rc = internal::lu_decompose(lu, perm);
+
+      internal::store_matrix(lu, n, k, A);
+      for(int i = 0; i < N; ++i)
+      {
+        pivots[i * n + k] = perm[i];
+      }
+      if(status != nullptr)
+      {
+        status[k] = rc;
+      }
+    });
+}
+
+//------------------------------------------------------------------------------
+template <int N, typename ExecSpace, typename T>
+void batched_lu_solve(const T* LU,
+                      const int* pivots,
+                      const T* b,
+                      T* x,
+                      IndexType n)
+{
+  AXOM_STATIC_ASSERT_MSG(N >= 2 && N <= 4, "N must be 2, 3 or 4");
+  assert("pre: matrices buffer is null" && (LU != nullptr));
+  assert("pre: pivots buffer is null" && (pivots != nullptr));
+  assert("pre: right-hand side buffer is null" && (b != nullptr));
+  assert("pre: solution buffer is null" && (x != nullptr));
+
+  for_all<ExecSpace>(
+    n,
+    AXOM_LAMBDA(IndexType k) {
+      T lu[N][N];
+      T xk[N];
+      internal::load_matrix(LU, n, k, lu);
+      for(int i = 0; i < N; ++i)
+      {
+        xk[i] = b[pivots[i * n + k] * n + k];
+      }
+
+      internal::lu_solve(lu, xk);
+
+      for(int i = 0; i < N; ++i)
+      {
+        x[i * n + k] = xk[i];
+      }
+    });
+}
+
+//------------------------------------------------------------------------------
+template <int N, typename ExecSpace, typename T>
+void batched_linear_solve(const T* A,
+                          const T* b,
+                          T* x,
+                          int* status,
+                          IndexType n)
+{
+  AXOM_STATIC_ASSERT_MSG(N >= 2 && N <= 4, "N must be 2, 3 or 4");
+  AXOM_STATIC_ASSERT_MSG(std::is_floating_point<T>::value,
+                         "pre: T is a floating point type");
+  assert("pre: matrices buffer is null" && (A != nullptr));
+  assert("pre: right-hand side buffer is null" && (b != nullptr));
+  assert("pre: solution buffer is null" && (x != nullptr));
+
+  for_all<ExecSpace>(
+    n,
+    AXOM_LAMBDA(IndexType k) {
+      T lu[N][N];
+      int perm[N];
+      T xk[N];
+      internal::load_matrix(A, n, k, lu);
+
+      const int rc = internal::lu_decompose(lu, perm);
+      for(int i = 0; i < N; ++i)
+      {
+        xk[i] = b[perm[i] * n + k];
+      }
+      internal::lu_solve(lu, xk);
+
+      for(int i = 0; i < N; ++i)
+      {
+        x[i * n + k] = xk[i];
+      }
+      if(status != nullptr)
+      {
+        status[k] = rc;
+      }
+    });
+}
+
+//------------------------------------------------------------------------------
+template <int N, typename ExecSpace, typename T>
+void batched_symmetric_eigensolve(const T* A,
+                                  T* lambdas,
+                                  T* V,
+                                  int* status,
+                                  IndexType n,
+                                  int maxIterations)
+{
+  AXOM_STATIC_ASSERT_MSG(N >= 2 && N <= 4, "N must be 2, 3 or 4");
+  AXOM_STATIC_ASSERT_MSG(std::is_floating_point<T>::value,
+                         "pre: T is a floating point type");
+  assert("pre: matrices buffer is null" && (A != nullptr));
+  assert("pre: eigenvalues buffer is null" && (lambdas != nullptr));
+  assert("pre: eigenvectors buffer is null" && (V != nullptr));
+
+  for_all<ExecSpace>(
+    n,
+    AXOM_LAMBDA(IndexType k) {
+      T a[N][N];
+      T v[N][N];
+      T lk[N];
+      internal::load_matrix(A, n, k, a);
+
+      const int rc = internal::symmetric_eigensolve(a, lk, v, maxIterations);
+
+      internal::store_matrix(v, n, k, V);
+      for(int i = 0; i < N; ++i)
+      {
+        lambdas[i * n + k] = lk[i];
+      }
+      if(status != nullptr)
+      {
+        status[k] = rc;
+      }
+    });
+}
+
+} /* end namespace numerics */
+} /* end namespace axom */
+
+#endif /* AXOM_NUMERICS_BATCHED_LINEAR_ALGEBRA_HPP_ */
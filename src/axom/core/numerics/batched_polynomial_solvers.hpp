@@ -0,0 +1,284 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_NUMERICS_BATCHED_POLYNOMIAL_SOLVERS_HPP_
+#define AXOM_NUMERICS_BATCHED_POLYNOMIAL_SOLVERS_HPP_
+
+#include "axom/config.hpp"                           // compile-time defs
+#include "axom/core/Macros.hpp"                      // AXOM_HOST_DEVICE
+#include "axom/core/Types.hpp"                       // IndexType
+#include "axom/core/execution/execution_space.hpp"  // execution spaces
+#include "axom/core/execution/for_all.hpp"          // for_all()
+#include "axom/core/numerics/internal/polynomial_solvers_impl.hpp"
+
+// C/C++ includes
+#include <cassert>  // for assert()
+
+/*!
+ * \file
+ *
+ * \brief Batched variants of the linear, quadratic and cubic polynomial root
+ *  solvers of polynomial_solvers.hpp, which find the real roots of many
+ *  polynomials at once.
+ *
+ *  The batches are stored in a structure-of-arrays layout, i.e., coefficient
+ *  i of polynomial k, in a batch of n polynomials, is stored at
+ *  coeff[ i*n + k ], and root j of polynomial k is stored at roots[ j*n + k ].
+ *  As for the pointwise solvers, coefficient i multiplies \f$ x^i \f$. The
+ *  polynomials are processed in parallel via axom::for_all() in the given
+ *  execution space.
+ *
+ *  Each polynomial is solved by the same code as the pointwise solvers,
+ *  hence, the number of roots, the return status and the roots are identical
+ *  to those of solve_linear(), solve_quadratic() and solve_cubic(). The roots
+ *  entries that are not set by the pointwise solver are set to zero.
+ *
+ * \note The supplied buffers must be accessible in the given execution space,
+ *  e.g., allocated with the default allocator of the execution space.
+ *
+ *  Example Usage:
+ *  \code
+ *
+ *    // find the real roots of n cubic polynomials in parallel
+ *    double* coeff = axom::allocate< double >( 4 * n );
+ *    double* roots = axom::allocate< double >( 3 * n );
+ *    int* numRoots = axom::allocate< int >( n );
+ *    ...
+ *    axom::numerics::batched_solve_cubic< axom::OMP_EXEC >(coeff, roots,
+ *                                                        numRoots, nullptr,
+ *                                                        n);
+ *
+ *  \endcode
+ */
+
+namespace axom
+{
+namespace numerics
+{
+/// \name Batched Polynomial Solvers
+/// @{
+
+/*!
+ * \brief Finds the real root of each linear equation of a batch.
+ *
+ * \param [in] coeff the batch of 2 coefficients per equation
+ * \param [out] roots buffer of n entries, where the roots are stored
+ * \param [out] numRoots buffer of n entries, where the number of distinct,
+ *  real roots of each equation is stored, as set by solve_linear()
+ * \param [out] status optional buffer of n entries, where the return code of
+ *  solve_linear() for each equation is stored
+ * \param [in] n the number of equations in the batch
+ *
+ * \tparam ExecSpace the execution space where to run the kernel
+ *
+ * \pre coeff != nullptr
+ * \pre roots != nullptr
+ * \pre numRoots != nullptr
+ *
+ * \see solve_linear()
+ */
+template <typename ExecSpace = SEQ_EXEC>
+void batched_solve_linear(const double* coeff,
+                          double* roots,
+                          int* numRoots,
+                          int* status,
+                          IndexType n);
+
+/*!
+ * \brief Finds the real roots of each quadratic equation of a batch.
+ *
+ * \param [in] coeff the batch of 3 coefficients per equation
+ * \param [out] roots buffer of 2*n entries, where the roots are stored
+ * \param [out] numRoots buffer of n entries, where the number of distinct,
+ *  real roots of each equation is stored, as set by solve_quadratic()
+ * \param [out] status optional buffer of n entries, where the return code of
+ *  solve_quadratic() for each equation is stored
+ * \param [in] n the number of equations in the batch
+ *
+ * \tparam ExecSpace the execution space where to run the kernel
+ *
+ * \pre coeff != nullptr
+ * \pre roots != nullptr
+ * \pre numRoots != nullptr
+ *
+ * \see solve_quadratic()
+ */
+template <typename ExecSpace = SEQ_EXEC>
+void batched_solve_quadratic(const double* coeff,
+                             double* roots,
+                             int* numRoots,
+                             int* status,
+                             IndexType n);
+
+/*!
+ * \brief Finds the real roots of each cubic equation of a batch.
+ *
+ * \param [in] coeff the batch of 4 coefficients per equation
+ * \param [out] roots buffer of 3*n entries, where the roots are stored
+ * \param [out] numRoots buffer of n entries, where the number of distinct,
+ *  real roots of each equation is stored, as set by solve_cubic()
+ * \param [out] status optional buffer of n entries, where the return code of
+ *  solve_cubic() for each equation is stored
+ * \param [in] n the number of equations in the batch
+ *
+ * \tparam ExecSpace the execution space where to run the kernel
+ *
+ * \pre coeff != nullptr
+ * \pre roots != nullptr
+ * \pre numRoots != nullptr
+ *
+ * \see solve_cubic()
+ */
+template <typename ExecSpace = SEQ_EXEC>
+void batched_solve_cubic(const double* coeff,
+                         double* roots,
+                         int* numRoots,
+                         int* status,
+                         IndexType n);
+
+/// @}
+
+} /* end namespace numerics */
+} /* end namespace axom */
+
+//------------------------------------------------------------------------------
+// IMPLEMENTATION
+//------------------------------------------------------------------------------
+namespace axom
+{
+namespace numerics
+{
+namespace internal
+{
+/// Dispatches to the solver of a polynomial of the given degree
+template <int DEGREE>
+struct PolynomialSolver;
+
+template <>
+struct PolynomialSolver<1>
+{
+  AXOM_HOST_DEVICE static int solve(const double* coeff,
+                                    double* roots,
+                                    int& numRoots)
+  {
+    return solve_linear(coeff, roots, numRoots);
+  }
+};
+
+template <>
+struct PolynomialSolver<2>
+{
+  AXOM_HOST_DEVICE static int solve(const double* coeff,
+                                    double* roots,
+                                    int& numRoots)
+  {
+    return solve_quadratic(coeff, roots, numRoots);
+  }
+};
+
+template <>
+struct PolynomialSolver<3>
+{
+  AXOM_HOST_DEVICE static int solve(const double* coeff,
+                                    double* roots,
+                                    int& numRoots)
+  {
+    return solve_cubic(coeff, roots, numRoots);
+  }
+};
+
+/// Solves a batch of n polynomials of the given degree
+template <int DEGREE, typename ExecSpace>
+void batched_solve_polynomial(const double* coeff,
+                              double* roots,
+                              int* numRoots,
+                              int* status,
+                              IndexType n)
+{
+  assert("pre: coefficients buffer is null" && (coeff != nullptr));
+  assert("pre: roots buffer is null" && (roots != nullptr));
+  assert("pre: number of roots buffer is null" && (numRoots != nullptr));
+
+  for_all<ExecSpace>(
+    n,
+    AXOM_LAMBDA(IndexType k) {
+      double c[DEGREE + 1];
+      for(int i = 0; i <= DEGREE; ++i)
+      {
+        c[i] = coeff[i * n + k];
+      }
+
+      double r[DEGREE];
+      for(int j = 0; j < DEGREE; ++j)
+      {
+        r[j] = 0.;
+      }
+
+      int nr = 0;
+      const int rc = PolynomialSolver<DEGREE>::solve(c, r, nr);
+
+      for(int j = 0; j < DEGREE; ++j)
+      {
+        roots[j * n + k] = r[j];
+      }
+      numRoots[k] = nr;
+      if(status != nullptr)
+      {
+        status[k] = rc;
+      }
+    });
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void batched_solve_linear(const double* coeff,
+                          double* roots,
+                          int* numRoots,
+                          int* status,
+                          IndexType n)
+{
+  internal::batched_solve_polynomial<1, ExecSpace>(coeff,
+                                                   roots,
+                                                   numRoots,
+                                                   status,
+                                                   n);
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void batched_solve_quadratic(const double* coeff,
+                             double* roots,
+                             int* numRoots,
+                             int* status,
+                             IndexType n)
+{
+  internal::batched_solve_polynomial<2, ExecSpace>(coeff,
+                                                   roots,
+                                                   numRoots,
+                                                   status,
+                                                   n);
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void batched_solve_cubic(const double* coeff,
+                         double* roots,
+                         int* numRoots,
+                         int* status,
+                         IndexType n)
+{
+  internal::batched_solve_polynomial<3, ExecSpace>(coeff,
+                                                   roots,
+                                                   numRoots,
+                                                   status,
+                                                   n);
+}
+
+} /* end namespace numerics */
+} /* end namespace axom */
+
+#endif /* AXOM_NUMERICS_BATCHED_POLYNOMIAL_SOLVERS_HPP_ */
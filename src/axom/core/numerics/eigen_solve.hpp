@@ -10,11 +10,11 @@
 #include "axom/core/numerics/Determinants.hpp"  // for Determinants
 #include "axom/core/numerics/LU.hpp"            // for lu_decompose()/lu_solve()
 #include "axom/core/numerics/Matrix.hpp"        // for Matrix
+#include "axom/core/utilities/Philox.hpp"       // for utilities::Philox
 
 // C/C++ includes
 #include <cassert>  // for assert()
-#include <cmath>    // for sqrt() and rand()
-#include <ctime>    // for time(0)
+#include <cmath>    // for sqrt()
 
 namespace axom
 {
@@ -30,9 +30,9 @@ namespace numerics
  *    3. Run depth iterations of power method
  *    4. Store the result
  *
- * Because step 1 and step 3 require random numbers, this function requires
- * the caller to properly seed the randomizer (for example, by calling
- * srand()).
+ * The random vectors of step 1 are drawn from a counter-based generator,
+ * utilities::Philox, with a fixed seed, one stream per eigenvector. Hence,
+ * the result is reproducible, and this function is thread-safe.
  *
  * \param [in] A a square input matrix
  * \param [in] k number of eigenvalue-eigenvectors to find
@@ -47,7 +47,6 @@ namespace numerics
  * \pre lambdas != nullptr
  * \pre k <= A.getNumRows()
  * \pre T is a floating point type
- * \pre System randomizer has been initialized (for example, with srand())
  */
 template <typename T>
 int eigen_solve(Matrix<T>& A, int k, T* u, T* lambdas, int numIterations = 160);
@@ -62,19 +61,12 @@ namespace axom
 {
 namespace numerics
 {
-namespace
+namespace internal
 {
-/*!
- * \brief Returns a uniformly distributed random between 0 and 1.
- *
- * Caller must seed the random number generator (for example, with srand()).
- */
-template <typename T>
-T getRandom()
-{
-  return static_cast<T>(((double)rand()) / RAND_MAX);
-}
-} /* end anonymous namespace */
+/// Seed of the random vectors of the power method in eigen_solve()
+constexpr std::uint64_t EIGEN_SOLVE_SEED = 0x5eed;
+
+} /* end namespace internal */
 
 template <typename T>
 int eigen_solve(Matrix<T>& A, int k, T* u, T* lambdas, int numIterations)
@@ -105,9 +97,10 @@ int eigen_solve(Matrix<T>& A, int k, T* u, T* lambdas, int numIterations)
   {
     T* vec = &u[i * N];
     // 1: generate random vec
+    utilities::Philox rng(internal::EIGEN_SOLVE_SEED, i);
     for(int j = 0; j < N; j++)
     {
-      vec[j] = getRandom<T>();
+      vec[j] = static_cast<T>(rng.uniform());
     }
 
     // 2: make ortho to previous eigenvecs then normalize
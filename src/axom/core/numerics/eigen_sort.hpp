@@ -7,7 +7,9 @@
 #define AXOM_EIGEN_SORT_HPP_
 
 // Axom includes
-#include "axom/core/utilities/Utilities.hpp"  // for utilities::swap()
+#include "axom/core/numerics/Matrix.hpp"       // for numerics::Matrix
+#include "axom/core/numerics/StackMatrix.hpp"  // for numerics::StackMatrix
+#include "axom/core/utilities/Utilities.hpp"   // for utilities::swap()
 
 namespace axom
 {
@@ -36,11 +38,22 @@ namespace numerics
 template <typename T>
 bool eigen_sort(T* lamdas, Matrix<T>& eigen_vectors);
 
+/*!
+ * \brief Overload of eigen_sort() for a StackMatrix.
+ */
+template <typename T, int N>
+bool eigen_sort(T* lambdas, StackMatrix<T, N, N>& eigen_vectors);
+
 //------------------------------------------------------------------------------
 // IMPLEMENTATION
 //------------------------------------------------------------------------------
-template <typename T>
-bool eigen_sort(T* lambdas, Matrix<T>& eigen_vectors)
+namespace internal
+{
+/*!
+ * \brief Implements eigen_sort() for a Matrix or a StackMatrix.
+ */
+template <typename T, typename MatrixType>
+bool eigen_sort_impl(T* lambdas, MatrixType& eigen_vectors)
 {
   if(lambdas == nullptr || eigen_vectors.getNumRows() < 1 ||
      eigen_vectors.getNumColumns() < 1)
@@ -73,6 +86,22 @@ bool eigen_sort(T* lambdas, Matrix<T>& eigen_vectors)
   return true;
 }
 
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+template <typename T>
+bool eigen_sort(T* lambdas, Matrix<T>& eigen_vectors)
+{
+  return internal::eigen_sort_impl(lambdas, eigen_vectors);
+}
+
+//------------------------------------------------------------------------------
+template <typename T, int N>
+bool eigen_sort(T* lambdas, StackMatrix<T, N, N>& eigen_vectors)
+{
+  return internal::eigen_sort_impl(lambdas, eigen_vectors);
+}
+
 } /* end namespace numerics */
 } /* end namespace axom */
 
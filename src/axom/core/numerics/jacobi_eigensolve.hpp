@@ -8,9 +8,10 @@
 
 #include "axom/core/Macros.hpp"  // for AXOM_STATIC_ASSERT
 
-#include "axom/core/numerics/Matrix.hpp"      // for numerics::Matrix
-#include "axom/core/numerics/eigen_sort.hpp"  // for numerics::eigen_sort()
-#include "axom/core/utilities/Utilities.hpp"  // for abs(), isNearlyEqual()
+#include "axom/core/numerics/Matrix.hpp"       // for numerics::Matrix
+#include "axom/core/numerics/StackMatrix.hpp"  // for numerics::StackMatrix
+#include "axom/core/numerics/eigen_sort.hpp"   // for numerics::eigen_sort()
+#include "axom/core/utilities/Utilities.hpp"   // for abs(), isNearlyEqual()
 
 namespace axom
 {
@@ -68,16 +69,37 @@ int jacobi_eigensolve(Matrix<T> A,
                       int* numIterations = nullptr,
                       T TOL = JACOBI_DEFAULT_TOLERANCE);
 
+/*!
+ * \brief Overload of jacobi_eigensolve() for a StackMatrix.
+ *
+ * \note This overload does not allocate memory.
+ */
+template <typename T, int N>
+int jacobi_eigensolve(StackMatrix<T, N, N> A,
+                      StackMatrix<T, N, N>& V,
+                      T* lambdas,
+                      int maxIterations = JACOBI_DEFAULT_MAX_ITERATIONS,
+                      int* numIterations = nullptr,
+                      T TOL = JACOBI_DEFAULT_TOLERANCE);
+
 //------------------------------------------------------------------------------
 // IMPLEMENTATION
 //------------------------------------------------------------------------------
-template <typename T>
-int jacobi_eigensolve(Matrix<T> A,
-                      Matrix<T>& V,
-                      T* lambdas,
-                      int maxIterations,
-                      int* numIterations,
-                      T TOL)
+namespace internal
+{
+/*!
+ * \brief Implements jacobi_eigensolve() for a Matrix or a StackMatrix, given
+ *  two work buffers, bw and zw, of A.getNumRows() entries.
+ */
+template <typename T, typename MatrixType>
+int jacobi_eigensolve_impl(MatrixType& A,
+                           MatrixType& V,
+                           T* lambdas,
+                           int maxIterations,
+                           int* numIterations,
+                           T TOL,
+                           T* bw,
+                           T* zw)
 {
   bool converged = false;
   const int n = A.getNumRows();
@@ -93,9 +115,6 @@ int jacobi_eigensolve(Matrix<T> A,
     return JACOBI_EIGENSOLVE_FAILURE;
   }
 
-  T* bw = axom::allocate<T>(n);
-  T* zw = axom::allocate<T>(n);
-
   // initialize
   for(int i = 0; i < n; ++i)
   {
@@ -238,12 +257,59 @@ int jacobi_eigensolve(Matrix<T> A,
   }  // END for all iterations
 
   // sort eigenvalues in ascending order
-  eigen_sort(lambdas, V);
+  numerics::eigen_sort(lambdas, V);
+
+  return ((converged) ? JACOBI_EIGENSOLVE_SUCCESS : JACOBI_EIGENSOLVE_FAILURE);
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+template <typename T>
+int jacobi_eigensolve(Matrix<T> A,
+                      Matrix<T>& V,
+                      T* lambdas,
+                      int maxIterations,
+                      int* numIterations,
+                      T TOL)
+{
+  const int n = A.getNumRows();
+  T* bw = axom::allocate<T>(n);
+  T* zw = axom::allocate<T>(n);
+
+  const int rc = internal::jacobi_eigensolve_impl(A,
+                                                  V,
+                                                  lambdas,
+                                                  maxIterations,
+                                                  numIterations,
+                                                  TOL,
+                                                  bw,
+                                                  zw);
 
   axom::deallocate(bw);
   axom::deallocate(zw);
+  return rc;
+}
 
-  return ((converged) ? JACOBI_EIGENSOLVE_SUCCESS : JACOBI_EIGENSOLVE_FAILURE);
+//------------------------------------------------------------------------------
+template <typename T, int N>
+int jacobi_eigensolve(StackMatrix<T, N, N> A,
+                      StackMatrix<T, N, N>& V,
+                      T* lambdas,
+                      int maxIterations,
+                      int* numIterations,
+                      T TOL)
+{
+  T bw[N];
+  T zw[N];
+  return internal::jacobi_eigensolve_impl(A,
+                                          V,
+                                          lambdas,
+                                          maxIterations,
+                                          numIterations,
+                                          TOL,
+                                          bw,
+                                          zw);
 }
 
 } /* end namespace numerics */
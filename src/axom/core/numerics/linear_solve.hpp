@@ -9,6 +9,7 @@
 #include "axom/core/numerics/Determinants.hpp"  // for Determinants
 #include "axom/core/numerics/LU.hpp"            // for lu_decompose()/lu_solve()
 #include "axom/core/numerics/Matrix.hpp"        // for Matrix
+#include "axom/core/numerics/StackMatrix.hpp"   // for StackMatrix
 
 // C/C++ includes
 #include <cassert>  // for assert()
@@ -34,6 +35,14 @@ namespace numerics
 template <typename T>
 int linear_solve(Matrix<T>& A, const T* b, T* x);
 
+/*!
+ * \brief Overload of linear_solve() for a StackMatrix.
+ *
+ * \note This overload does not allocate memory.
+ */
+template <typename T, int N>
+int linear_solve(StackMatrix<T, N, N>& A, const T* b, T* x);
+
 } /* end namespace numerics */
 } /* end namespace axom */
 
@@ -44,8 +53,14 @@ namespace axom
 {
 namespace numerics
 {
-template <typename T>
-int linear_solve(Matrix<T>& A, const T* b, T* x)
+namespace internal
+{
+/*!
+ * \brief Implements linear_solve() for a Matrix or a StackMatrix, given a
+ *  buffer, pivots, of A.getNumRows() entries.
+ */
+template <typename T, typename MatrixType>
+int linear_solve_impl(MatrixType& A, const T* b, T* x, int* pivots)
 {
   assert("pre: input matrix must be square" && A.isSquare());
   assert("pre: solution vector is null" && (x != nullptr));
@@ -84,15 +99,12 @@ int linear_solve(Matrix<T>& A, const T* b, T* x)
   else
   {
     // non-trivial system, use LU
-    int* pivots = new int[N];
-
-    int rc = lu_decompose(A, pivots);
+    int rc = numerics::lu_decompose(A, pivots);
     if(rc == LU_SUCCESS)
     {
-      rc = lu_solve(A, pivots, b, x);
+      rc = numerics::lu_solve(A, pivots, b, x);
     }
 
-    delete[] pivots;
     if(rc != LU_SUCCESS)
     {
       return -1;
@@ -102,6 +114,26 @@ int linear_solve(Matrix<T>& A, const T* b, T* x)
   return 0;
 }
 
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+template <typename T>
+int linear_solve(Matrix<T>& A, const T* b, T* x)
+{
+  int* pivots = new int[A.getNumColumns()];
+  const int rc = internal::linear_solve_impl(A, b, x, pivots);
+  delete[] pivots;
+  return rc;
+}
+
+//------------------------------------------------------------------------------
+template <typename T, int N>
+int linear_solve(StackMatrix<T, N, N>& A, const T* b, T* x)
+{
+  int pivots[N];
+  return internal::linear_solve_impl(A, b, x, pivots);
+}
+
 } /* end namespace numerics */
 } /* end namespace axom */
 
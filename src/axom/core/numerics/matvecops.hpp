@@ -16,6 +16,7 @@
 
 #include "axom/core/numerics/Determinants.hpp"  // numerics::determinant()
 #include "axom/core/numerics/Matrix.hpp"        // for numerics::Matrix
+#include "axom/core/numerics/StackMatrix.hpp"   // for numerics::StackMatrix
 #include "axom/core/utilities/Utilities.hpp"    // for isNearlyEqual()
 #include "axom/core/numerics/internal/matrix_norms.hpp"  // matrix norm
                                                          // functions
@@ -325,6 +326,54 @@ inline T matrix_norm(const Matrix<T>& A, MatrixNorm normType);
 
 /// @}
 
+/// \name StackMatrix Operators
+/// @{
+
+/*!
+ * \brief Overloads of the matrix operators for a StackMatrix.
+ *
+ *  The operators have the same semantics as their Matrix counterparts, but,
+ *  the dimensions of the operands are checked at compile-time. Hence, the
+ *  operators that return a status always return true.
+ *
+ * \note These overloads do not allocate memory.
+ */
+/// @{
+template <typename T, int M, int N>
+inline AXOM_HOST_DEVICE bool matrix_add(const StackMatrix<T, M, N>& A,
+                                        const StackMatrix<T, M, N>& B,
+                                        StackMatrix<T, M, N>& C);
+
+template <typename T, int M, int N>
+inline AXOM_HOST_DEVICE bool matrix_subtract(const StackMatrix<T, M, N>& A,
+                                             const StackMatrix<T, M, N>& B,
+                                             StackMatrix<T, M, N>& C);
+
+template <typename T, int M, int K, int N>
+inline AXOM_HOST_DEVICE bool matrix_multiply(const StackMatrix<T, M, K>& A,
+                                             const StackMatrix<T, K, N>& B,
+                                             StackMatrix<T, M, N>& C);
+
+template <typename T, int M, int N>
+inline AXOM_HOST_DEVICE void matrix_scalar_multiply(StackMatrix<T, M, N>& A,
+                                                    const T& c);
+
+template <typename T, int M, int N>
+inline AXOM_HOST_DEVICE void matrix_vector_multiply(
+  const StackMatrix<T, M, N>& A,
+  const T* vec,
+  T* output);
+
+template <typename T, int M, int N>
+inline AXOM_HOST_DEVICE bool matrix_transpose(const StackMatrix<T, M, N>& A,
+                                              StackMatrix<T, N, M>& AT);
+
+template <typename T, int M, int N>
+inline T matrix_norm(const StackMatrix<T, M, N>& A, MatrixNorm normType);
+/// @}
+
+/// @}
+
 } /* end namespace numerics */
 } /* end namespace axom */
 
@@ -511,6 +560,108 @@ inline T matrix_norm(const Matrix<T>& A, MatrixNorm normType)
   return norm;
 }
 
+//------------------------------------------------------------------------------
+// IMPLEMENTATION OF STACKMATRIX OPERATIONS
+//------------------------------------------------------------------------------
+template <typename T, int M, int N>
+inline AXOM_HOST_DEVICE bool matrix_add(const StackMatrix<T, M, N>& A,
+                                        const StackMatrix<T, M, N>& B,
+                                        StackMatrix<T, M, N>& C)
+{
+  for(int i = 0; i < M * N; ++i)
+  {
+    C.m_data[i] = A.m_data[i] + B.m_data[i];
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+template <typename T, int M, int N>
+inline AXOM_HOST_DEVICE bool matrix_subtract(const StackMatrix<T, M, N>& A,
+                                             const StackMatrix<T, M, N>& B,
+                                             StackMatrix<T, M, N>& C)
+{
+  for(int i = 0; i < M * N; ++i)
+  {
+    C.m_data[i] = A.m_data[i] - B.m_data[i];
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+template <typename T, int M, int K, int N>
+inline AXOM_HOST_DEVICE bool matrix_multiply(const StackMatrix<T, M, K>& A,
+                                             const StackMatrix<T, K, N>& B,
+                                             StackMatrix<T, M, N>& C)
+{
+  for(int i = 0; i < M; ++i)
+  {
+    for(int j = 0; j < N; ++j)
+    {
+      T sum = static_cast<T>(0);
+      for(int k = 0; k < K; ++k)
+      {
+        sum += A(i, k) * B(k, j);
+      }
+      C(i, j) = sum;
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+template <typename T, int M, int N>
+inline AXOM_HOST_DEVICE void matrix_scalar_multiply(StackMatrix<T, M, N>& A,
+                                                    const T& c)
+{
+  for(int i = 0; i < M * N; ++i)
+  {
+    A.m_data[i] *= c;
+  }
+}
+
+//------------------------------------------------------------------------------
+template <typename T, int M, int N>
+inline AXOM_HOST_DEVICE void matrix_vector_multiply(
+  const StackMatrix<T, M, N>& A,
+  const T* x,
+  T* b)
+{
+  for(int i = 0; i < M; ++i)
+  {
+    T sum = static_cast<T>(0);
+    for(int j = 0; j < N; ++j)
+    {
+      sum += A(i, j) * x[j];
+    }
+    b[i] = sum;
+  }
+}
+
+//------------------------------------------------------------------------------
+template <typename T, int M, int N>
+inline AXOM_HOST_DEVICE bool matrix_transpose(const StackMatrix<T, M, N>& A,
+                                              StackMatrix<T, N, M>& AT)
+{
+  for(int i = 0; i < M; ++i)
+  {
+    for(int j = 0; j < N; ++j)
+    {
+      AT(j, i) = A(i, j);
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+template <typename T, int M, int N>
+inline T matrix_norm(const StackMatrix<T, M, N>& A, MatrixNorm normType)
+{
+  // NOTE: a Matrix that wraps the entries of A does not allocate memory
+  const Matrix<T> view(M, N, const_cast<T*>(A.data()), true);
+  return matrix_norm(view, normType);
+}
+
 //------------------------------------------------------------------------------
 // IMPLEMENTATION OF VECTOR OPERATIONS
 //------------------------------------------------------------------------------
@@ -19,6 +19,9 @@
  *
  * Note that coeff[i] = \f$ a_i \f$.  The constant term goes in coeff[0],
  * the linear in coeff[1], quadratic in coeff[2], and so forth.
+ *
+ * Batched variants, which solve many polynomials at once, are declared in
+ * batched_polynomial_solvers.hpp.
  */
 
 namespace axom
@@ -0,0 +1,187 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/config.hpp"
+#include "axom/core/AlignedAllocator.hpp"
+#include "axom/core/Array.hpp"
+#include "axom/core/memory_management.hpp"
+
+#include "gtest/gtest.h"
+
+// C/C++ includes
+#include <algorithm>  // for std::min
+
+//------------------------------------------------------------------------------
+// HELPER METHODS
+//------------------------------------------------------------------------------
+namespace
+{
+/*!
+ * \brief Allocates, grows and shrinks a buffer with the given allocator,
+ *  checking the alignment and the contents of the buffer along the way.
+ */
+void check_aligned_alloc_realloc_free(int allocID)
+{
+  using axom::AlignedAllocator;
+
+  // NOTE: older versions of Umpire fall back to the HOST allocator
+#ifndef AXOM_USE_UMPIRE
+  const bool checkAlignment = true;
+#else
+  const bool checkAlignment = false;
+#endif
+
+  for(std::size_t size : {0, 1, 3, 17, 1000, 100000})
+  {
+    double* buffer = axom::allocate<double>(size, allocID);
+    ASSERT_NE(buffer, nullptr);
+    if(checkAlignment)
+    {
+      EXPECT_TRUE(AlignedAllocator::isAligned(buffer));
+    }
+
+    for(std::size_t i = 0; i < size; ++i)
+    {
+      buffer[i] = static_cast<double>(i);
+    }
+
+    for(std::size_t newSize : {2 * size + 1, size + 5, size / 2})
+    {
+      buffer = axom::reallocate(buffer, newSize);
+      ASSERT_NE(buffer, nullptr);
+      if(checkAlignment)
+      {
+        EXPECT_TRUE(AlignedAllocator::isAligned(buffer));
+      }
+
+      size = std::min(size, newSize);
+      for(std::size_t i = 0; i < size; ++i)
+      {
+        EXPECT_EQ(buffer[i], static_cast<double>(i));
+      }
+    }
+
+    axom::deallocate(buffer);
+    EXPECT_EQ(buffer, nullptr);
+  }
+}
+
+}  // end anonymous namespace
+
+//------------------------------------------------------------------------------
+// UNIT TESTS
+//------------------------------------------------------------------------------
+TEST(core_aligned_allocator, allocate)
+{
+  using axom::AlignedAllocator;
+
+  for(std::size_t size : {std::size_t(0), std::size_t(1), std::size_t(100)})
+  {
+    void* p = AlignedAllocator::allocate(size);
+    ASSERT_NE(p, nullptr);
+    EXPECT_TRUE(AlignedAllocator::isAligned(p));
+    AlignedAllocator::deallocate(p);
+  }
+
+  // large allocations with huge pages are aligned to the huge pages
+  const std::size_t large = 2 * AlignedAllocator::HUGE_PAGE_SIZE + 100;
+  char* p = static_cast<char*>(AlignedAllocator::allocate(large, true));
+  ASSERT_NE(p, nullptr);
+  EXPECT_TRUE(AlignedAllocator::isAligned(p, AlignedAllocator::HUGE_PAGE_SIZE));
+  p[0] = p[large - 1] = 'a';
+  EXPECT_EQ(p[large - 1], 'a');
+  AlignedAllocator::deallocate(p);
+
+  // small allocations with huge pages are not
+  void* q = AlignedAllocator::allocate(1000, true);
+  ASSERT_NE(q, nullptr);
+  EXPECT_TRUE(AlignedAllocator::isAligned(q));
+  EXPECT_FALSE(AlignedAllocator::adviseHugePages(q, 1000));
+  AlignedAllocator::deallocate(q);
+
+  AlignedAllocator::deallocate(nullptr);
+}
+
+//------------------------------------------------------------------------------
+TEST(core_aligned_allocator, alloc_realloc_free)
+{
+  EXPECT_NE(axom::getAlignedAllocatorID(), axom::INVALID_ALLOCATOR_ID);
+  EXPECT_NE(axom::getHugePageAllocatorID(), axom::INVALID_ALLOCATOR_ID);
+  EXPECT_NE(axom::getAlignedAllocatorID(), axom::getHugePageAllocatorID());
+
+  check_aligned_alloc_realloc_free(axom::getAlignedAllocatorID());
+  check_aligned_alloc_realloc_free(axom::getHugePageAllocatorID());
+}
+
+//------------------------------------------------------------------------------
+TEST(core_aligned_allocator, huge_pages)
+{
+  using axom::AlignedAllocator;
+
+  const int hugePageID = axom::getHugePageAllocatorID();
+
+  // a few huge pages worth of doubles
+  const std::size_t size =
+    3 * AlignedAllocator::HUGE_PAGE_SIZE / sizeof(double);
+  double* buffer = axom::allocate<double>(size, hugePageID);
+  ASSERT_NE(buffer, nullptr);
+  for(std::size_t i = 0; i < size; ++i)
+  {
+    buffer[i] = 0.5 * i;
+  }
+
+  buffer = axom::reallocate(buffer, 2 * size);
+  ASSERT_NE(buffer, nullptr);
+  EXPECT_EQ(buffer[size - 1], 0.5 * (size - 1));
+
+  axom::deallocate(buffer);
+}
+
+//------------------------------------------------------------------------------
+TEST(core_aligned_allocator, array_with_aligned_allocator)
+{
+  const int alignedID = axom::getAlignedAllocatorID();
+
+  // NOTE: older versions of Umpire fall back to the HOST allocator
+#ifndef AXOM_USE_UMPIRE
+  const bool checkAlignment = true;
+#else
+  const bool checkAlignment = false;
+#endif
+
+  axom::Array<float> v(0, 3, 0, alignedID);
+  EXPECT_EQ(v.getAllocatorID(), alignedID);
+  for(int i = 0; i < 1000; ++i)
+  {
+    const float tuple[3] = {1.0f * i, 2.0f * i, 3.0f * i};
+    v.append(tuple, 1);
+    if(checkAlignment)
+    {
+      EXPECT_TRUE(axom::AlignedAllocator::isAligned(v.getData()));
+    }
+  }
+  EXPECT_EQ(v.size(), 1000);
+  EXPECT_EQ(v(999, 2), 2997.0f);
+}
+
+//------------------------------------------------------------------------------
+#ifndef AXOM_USE_UMPIRE
+TEST(core_aligned_allocator, set_default_allocator)
+{
+  const int defaultID = axom::getDefaultAllocatorID();
+
+  axom::setDefaultAllocator(axom::getAlignedAllocatorID());
+  EXPECT_EQ(axom::getDefaultAllocatorID(), axom::getAlignedAllocatorID());
+
+  int* buffer = axom::allocate<int>(10);
+  EXPECT_TRUE(axom::AlignedAllocator::isAligned(buffer));
+  buffer = axom::reallocate(buffer, 1000);
+  EXPECT_TRUE(axom::AlignedAllocator::isAligned(buffer));
+  axom::deallocate(buffer);
+
+  axom::setDefaultAllocator(defaultID);
+  EXPECT_EQ(axom::getDefaultAllocatorID(), defaultID);
+}
+#endif
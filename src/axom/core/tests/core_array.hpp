@@ -9,7 +9,13 @@
 #include "gtest/gtest.h" /* for TEST and EXPECT_* macros */
 
 // C/C++ includes
-#include <algorithm> /* for std::fill_n */
+#include <algorithm>   /* for std::fill_n */
+#include <cstdio>      /* for std::remove */
+#include <fstream>     /* for std::ofstream */
+#include <string>      /* for std::string */
+#include <type_traits> /* for std::is_trivially_copyable */
+#include <utility>     /* for std::move */
+#include <vector>      /* for std::vector */
 
 namespace axom
 {
@@ -867,6 +873,74 @@ void check_external(Array<T>& v)
   tuple = nullptr;
 }
 
+/*!
+ * \brief A non-trivial type that counts its live instances, used to check
+ *  that an Array constructs and destroys its elements.
+ */
+struct Counted
+{
+  static int num_alive;
+
+  Counted() : value(-1) { ++num_alive; }
+  Counted(int v) : value(v) { ++num_alive; }
+  Counted(const Counted& other) : value(other.value) { ++num_alive; }
+  Counted(Counted&& other) : value(other.value)
+  {
+    other.value = -1;
+    ++num_alive;
+  }
+  ~Counted() { --num_alive; }
+
+  Counted& operator=(const Counted& other) = default;
+  Counted& operator=(Counted&& other) = default;
+
+  int value;
+};
+
+int Counted::num_alive = 0;
+
+/*!
+ * \brief A trivially copyable type with a user-provided default constructor,
+ *  e.g., like primal::Point, which is relocated with a plain reallocation.
+ */
+struct Defaulted
+{
+  Defaulted() : value(-1) { }
+  Defaulted(int v) : value(v) { }
+
+  int value;
+};
+
+/*!
+ * \brief Creates an Array with the values 0 to n-1, to check that an Array
+ *  can be returned by value.
+ */
+inline Array<int> make_iota_array(IndexType n)
+{
+  Array<int> v(n);
+  for(IndexType i = 0; i < n; ++i)
+  {
+    v[i] = static_cast<int>(i);
+  }
+  return v;
+}
+
+/*!
+ * \brief Writes the given values to a binary file, after a header of the
+ *  given number of bytes.
+ */
+template <typename T>
+void write_binary_file(const std::string& path,
+                       const std::vector<T>& values,
+                       int header_bytes)
+{
+  std::ofstream file(path, std::ios::binary);
+  const std::string header(header_bytes, 'h');
+  file.write(header.data(), header_bytes);
+  file.write(reinterpret_cast<const char*>(values.data()),
+             values.size() * sizeof(T));
+}
+
 } /* end namespace internal */
 
 //------------------------------------------------------------------------------
@@ -1042,4 +1116,271 @@ TEST(core_array, deathtest_checkExternal)
   }
 }
 
+//------------------------------------------------------------------------------
+TEST(core_array, checkMove)
+{
+  constexpr IndexType SIZE = 100;
+
+  Array<int> v1 = internal::make_iota_array(SIZE);
+  EXPECT_EQ(v1.size(), SIZE);
+  EXPECT_EQ(v1.getAllocatorID(), getDefaultAllocatorID());
+
+  /* Move construction steals the buffer */
+  const int* data = v1.getData();
+  Array<int> v2(std::move(v1));
+  EXPECT_EQ(v2.getData(), data);
+  EXPECT_EQ(v2.size(), SIZE);
+  EXPECT_EQ(v1.getData(), nullptr);
+  EXPECT_EQ(v1.size(), 0);
+  EXPECT_EQ(v1.capacity(), 0);
+
+  /* A moved-from Array is empty but usable */
+  v1.append(42);
+  EXPECT_EQ(v1.size(), 1);
+  EXPECT_EQ(v1[0], 42);
+
+  /* Move assignment releases the old buffer and steals the new one */
+  v1 = std::move(v2);
+  EXPECT_EQ(v1.getData(), data);
+  EXPECT_EQ(v1.size(), SIZE);
+  EXPECT_EQ(v2.getData(), nullptr);
+  for(IndexType i = 0; i < SIZE; ++i)
+  {
+    EXPECT_EQ(v1[i], i);
+  }
+
+  /* Arrays can be stored in standard containers */
+  std::vector<Array<int>> arrays;
+  for(IndexType n = 1; n <= 16; ++n)
+  {
+    arrays.push_back(internal::make_iota_array(n));
+  }
+  for(IndexType n = 1; n <= 16; ++n)
+  {
+    const Array<int>& v = arrays[n - 1];
+    EXPECT_EQ(v.size(), n);
+    EXPECT_EQ(v[n - 1], n - 1);
+  }
+
+  /* Moving an external Array transfers the (non-owning) view */
+  int buffer[SIZE];
+  Array<int> v_external(buffer, SIZE);
+  Array<int> v3(std::move(v_external));
+  EXPECT_TRUE(v3.isExternal());
+  EXPECT_EQ(v3.getData(), buffer);
+  EXPECT_EQ(v3.getAllocatorID(), INVALID_ALLOCATOR_ID);
+  EXPECT_FALSE(v_external.isExternal());
+}
+
+//------------------------------------------------------------------------------
+TEST(core_array, deathtest_checkMapped)
+{
+  constexpr IndexType NUM_TUPLES = 1000;
+  constexpr IndexType NUM_COMPONENTS = 3;
+  constexpr int HEADER_BYTES = 80;
+  const std::string path = "core_array_mapped.bin";
+
+  std::vector<double> values(NUM_TUPLES * NUM_COMPONENTS);
+  for(IndexType i = 0; i < NUM_TUPLES * NUM_COMPONENTS; ++i)
+  {
+    values[i] = 0.5 * i;
+  }
+  internal::write_binary_file(path, values, HEADER_BYTES);
+
+  {
+    /* A read-only mapping of the values after the header */
+    const Array<double> v(path, HEADER_BYTES, NUM_TUPLES, NUM_COMPONENTS);
+    EXPECT_TRUE(v.isMapped());
+    EXPECT_TRUE(v.isExternal());
+    EXPECT_EQ(v.size(), NUM_TUPLES);
+    EXPECT_EQ(v.capacity(), NUM_TUPLES);
+    EXPECT_EQ(v.numComponents(), NUM_COMPONENTS);
+    EXPECT_EQ(v.getAllocatorID(), INVALID_ALLOCATOR_ID);
+    for(IndexType i = 0; i < NUM_TUPLES; ++i)
+    {
+      for(IndexType j = 0; j < NUM_COMPONENTS; ++j)
+      {
+        EXPECT_EQ(v(i, j), values[i * NUM_COMPONENTS + j]);
+      }
+    }
+
+    EXPECT_TRUE(v.advise(FileMapping::Advice::SEQUENTIAL));
+    EXPECT_TRUE(v.advise(FileMapping::Advice::WILL_NEED, 10, 100));
+    EXPECT_FALSE(v.advise(FileMapping::Advice::WILL_NEED, NUM_TUPLES));
+  }
+
+  {
+    /* A negative number of tuples maps the whole tuples of the file */
+    Array<double> v(path, HEADER_BYTES + 24 * sizeof(double), -1, 2);
+    EXPECT_EQ(v.size(), (NUM_TUPLES * NUM_COMPONENTS - 24) / 2);
+    EXPECT_EQ(v(0, 0), values[24]);
+    EXPECT_EQ(v(v.size() - 1, 1), values[24 + 2 * v.size() - 1]);
+
+    /* Moving a mapped Array transfers the mapping */
+    Array<double> moved(std::move(v));
+    EXPECT_TRUE(moved.isMapped());
+    EXPECT_FALSE(v.isMapped());
+    EXPECT_EQ(moved(0, 0), values[24]);
+  }
+
+  {
+    /* A copy-on-write mapping can be modified, but not reallocated */
+    Array<double> v(path,
+                    HEADER_BYTES,
+                    NUM_TUPLES,
+                    NUM_COMPONENTS,
+                    FileMapping::Mode::COPY_ON_WRITE);
+    internal::check_external(v);
+  }
+
+  /* The file is not modified */
+  {
+    Array<double> v(path, HEADER_BYTES, NUM_TUPLES, NUM_COMPONENTS);
+    for(IndexType i = 0; i < NUM_TUPLES * NUM_COMPONENTS; ++i)
+    {
+      EXPECT_EQ(v[i], values[i]);
+    }
+
+    Array<double> not_mapped(10);
+    EXPECT_FALSE(not_mapped.isMapped());
+    EXPECT_FALSE(not_mapped.advise(FileMapping::Advice::SEQUENTIAL));
+  }
+
+  /* Mapping more tuples than the file holds aborts */
+  EXPECT_DEATH_IF_SUPPORTED(
+    Array<double>(path, HEADER_BYTES, NUM_TUPLES + 1, NUM_COMPONENTS),
+    IGNORE_OUTPUT);
+  EXPECT_DEATH_IF_SUPPORTED(Array<double>("m_i_s_s_i_n_g.bin", 0, 1),
+                            IGNORE_OUTPUT);
+
+  std::remove(path.c_str());
+}
+
+//------------------------------------------------------------------------------
+TEST(core_array, checkAllocatorID)
+{
+  const int allocID = getDefaultAllocatorID();
+
+  Array<double> v(0, 2, 10, allocID);
+  EXPECT_EQ(v.getAllocatorID(), allocID);
+
+  /* Reallocations retain the allocator */
+  for(int i = 0; i < 100; ++i)
+  {
+    const double tuple[2] = {1.0 * i, 2.0 * i};
+    v.append(tuple, 1);
+  }
+  v.shrink();
+  EXPECT_EQ(v.getAllocatorID(), allocID);
+  EXPECT_EQ(v.size(), 100);
+  EXPECT_EQ(v(99, 1), 198.0);
+}
+
+//------------------------------------------------------------------------------
+TEST(core_array, checkNonTrivial)
+{
+  using internal::Counted;
+
+  {
+    Array<std::string> v(0);
+    for(int i = 0; i < 100; ++i)
+    {
+      v.append(std::to_string(i));
+    }
+    v.insert(std::string("front"), 0);
+    v.emplace(2, 50, std::string("middle"));
+    EXPECT_EQ(v.size(), 103);
+    EXPECT_EQ(v[0], "front");
+    EXPECT_EQ(v[1], "0");
+    EXPECT_EQ(v[50], "middle");
+    EXPECT_EQ(v[51], "middle");
+    EXPECT_EQ(v[52], "49");
+    EXPECT_EQ(v[102], "99");
+
+    const std::string tuples[2] = {"a", "b"};
+    v.set(tuples, 2, 1);
+    EXPECT_EQ(v[1], "a");
+    EXPECT_EQ(v[2], "b");
+
+    v.resize(10);
+    v.shrink();
+    EXPECT_EQ(v.capacity(), 10);
+    EXPECT_EQ(v[9], "8");
+
+    Array<std::string> moved(std::move(v));
+    EXPECT_EQ(moved[0], "front");
+  }
+
+  {
+    Array<Counted> v(10);
+    EXPECT_EQ(Counted::num_alive, 10);
+    EXPECT_EQ(v[0].value, -1);
+
+    for(int i = 0; i < 100; ++i)
+    {
+      v.append(Counted(i));
+    }
+    EXPECT_EQ(Counted::num_alive, 110);
+
+    const Counted tuples[3] = {Counted(1), Counted(2), Counted(3)};
+    v.insert(tuples, 3, 5);
+    v.append(tuples, 3);
+    v.emplace(4, 0);
+    EXPECT_EQ(Counted::num_alive, 120 + 3);
+    EXPECT_EQ(v[4].value, -1);
+    EXPECT_EQ(v[9].value, 1);
+    EXPECT_EQ(v[116].value, 99);
+
+    v.resize(50);
+    EXPECT_EQ(Counted::num_alive, 50 + 3);
+    v.resize(60);
+    EXPECT_EQ(Counted::num_alive, 60 + 3);
+    v.shrink();
+    EXPECT_EQ(Counted::num_alive, 60 + 3);
+
+    Array<Counted> other(5);
+    other = std::move(v);
+    EXPECT_EQ(Counted::num_alive, 60 + 3);
+    EXPECT_EQ(other.size(), 60);
+  }
+
+  EXPECT_EQ(Counted::num_alive, 0);
+}
+
+//------------------------------------------------------------------------------
+TEST(core_array, checkTriviallyCopyable)
+{
+  using internal::Defaulted;
+  static_assert(!std::is_trivial<Defaulted>::value &&
+                  std::is_trivially_copyable<Defaulted>::value,
+                "Defaulted must be trivially copyable, but not trivial");
+
+  Array<Defaulted> v(10);
+  EXPECT_EQ(v[0].value, -1);
+  EXPECT_EQ(v[9].value, -1);
+
+  for(int i = 0; i < 100; ++i)
+  {
+    v.append(Defaulted(i));
+  }
+  v.insert(Defaulted(1000), 0);
+  EXPECT_EQ(v.size(), 111);
+  EXPECT_EQ(v[0].value, 1000);
+  EXPECT_EQ(v[1].value, -1);
+  EXPECT_EQ(v[11].value, 0);
+  EXPECT_EQ(v[110].value, 99);
+
+  /* New elements are default constructed */
+  v.resize(20);
+  v.resize(30);
+  EXPECT_EQ(v[19].value, 8);
+  EXPECT_EQ(v[20].value, -1);
+  EXPECT_EQ(v[29].value, -1);
+
+  v.shrink();
+  EXPECT_EQ(v.capacity(), 30);
+  EXPECT_EQ(v[0].value, 1000);
+  EXPECT_EQ(v[19].value, 8);
+}
+
 } /* end namespace axom */
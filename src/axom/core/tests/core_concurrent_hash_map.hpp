@@ -0,0 +1,266 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/config.hpp"  // for compile time definitions
+
+#include "axom/core/ConcurrentHashMap.hpp"
+#include "axom/core/execution/execution_space.hpp"
+#include "axom/core/execution/for_all.hpp"
+
+// for gtest macros
+#include "gtest/gtest.h"
+
+// C/C++ includes
+#include <algorithm>  // for std::sort
+#include <cstdint>    // for std::uint64_t
+#include <vector>     // for std::vector
+
+//------------------------------------------------------------------------------
+//  HELPER METHODS
+//------------------------------------------------------------------------------
+namespace
+{
+/// A key that is not hashable by std::hash, e.g., the sorted nodes of a face
+struct QuadKey
+{
+  int nodes[4];
+};
+
+struct QuadKeyHash
+{
+  std::size_t operator()(const QuadKey& key) const
+  {
+    std::uint64_t h = 0;
+    for(int i = 0; i < 4; ++i)
+    {
+      h = h * 1000003 + static_cast<std::uint64_t>(key.nodes[i]);
+    }
+    return static_cast<std::size_t>(h);
+  }
+};
+
+struct QuadKeyEqual
+{
+  bool operator()(const QuadKey& a, const QuadKey& b) const
+  {
+    return a.nodes[0] == b.nodes[0] && a.nodes[1] == b.nodes[1] &&
+      a.nodes[2] == b.nodes[2] && a.nodes[3] == b.nodes[3];
+  }
+};
+
+template <typename ExecSpace>
+void check_bulk_insert()
+{
+  std::cout << "checking ConcurrentHashMap::bulk_insert with ["
+            << axom::execution_space<ExecSpace>::name() << "]\n";
+
+  // each key is repeated 4 times, with the same value
+  constexpr int NUM_UNIQUE = 5000;
+  constexpr int N = 4 * NUM_UNIQUE;
+  std::vector<std::uint64_t> keys(N);
+  std::vector<int> values(N);
+  for(int i = 0; i < N; ++i)
+  {
+    const int k = (i * 7919) % NUM_UNIQUE;
+    keys[i] = static_cast<std::uint64_t>(k) << 21;
+    values[i] = -k;
+  }
+
+  axom::ConcurrentHashMap<std::uint64_t, int> map;
+  EXPECT_EQ(map.bulk_insert<ExecSpace>(keys.data(), values.data(), N),
+            NUM_UNIQUE);
+  EXPECT_EQ(map.size(), NUM_UNIQUE);
+  EXPECT_LE(map.load_factor(), map.MAX_LOAD_FACTOR);
+
+  for(int k = 0; k < NUM_UNIQUE; ++k)
+  {
+    const int* value = map.find(static_cast<std::uint64_t>(k) << 21);
+    ASSERT_TRUE(value != nullptr);
+    EXPECT_EQ(*value, -k);
+  }
+  EXPECT_FALSE(map.contains(1));
+
+  // inserting the batch again does not add any key
+  EXPECT_EQ(map.bulk_insert<ExecSpace>(keys.data(), values.data(), N), 0);
+  EXPECT_EQ(map.size(), NUM_UNIQUE);
+
+  // concurrent insertions and lookups, without growing the table
+  axom::ConcurrentHashMap<std::uint64_t, int> map2(N);
+  const std::uint64_t* keys_ptr = keys.data();
+  auto* map2_ptr = &map2;
+  axom::for_all<ExecSpace>(
+    N,
+    AXOM_LAMBDA(axom::IndexType i) {
+      map2_ptr->concurrent_insert(keys_ptr[i], 1);
+      map2_ptr->find(keys_ptr[(i * 13) % N]);
+    });
+  EXPECT_EQ(map2.size(), NUM_UNIQUE);
+
+  int numEntries = 0;
+  for(const auto& entry : map2)
+  {
+    EXPECT_TRUE(map.contains(entry.first));
+    EXPECT_EQ(entry.second, 1);
+    ++numEntries;
+  }
+  EXPECT_EQ(numEntries, NUM_UNIQUE);
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+// UNIT TESTS
+//------------------------------------------------------------------------------
+TEST(core_concurrent_hash_map, insert_and_find)
+{
+  axom::ConcurrentHashMap<int, double> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.find(3), nullptr);
+  EXPECT_EQ(map.begin(), map.end());
+
+  constexpr int N = 1000;
+  for(int i = 0; i < N; ++i)
+  {
+    auto result = map.insert(i, 0.5 * i);
+    EXPECT_TRUE(result.second);
+    ASSERT_TRUE(result.first != nullptr);
+    EXPECT_EQ(*result.first, 0.5 * i);
+    EXPECT_LE(map.size(), map.capacity());
+  }
+  EXPECT_EQ(map.size(), N);
+
+  // existing keys keep their value
+  auto result = map.insert(10, -1.);
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(*result.first, 5.);
+
+  // values may be modified through the returned pointer
+  *map.find(10) = -1.;
+  EXPECT_EQ(*map.find(10), -1.);
+  *map.find(10) = 5.;
+
+  for(int i = 0; i < N; ++i)
+  {
+    ASSERT_TRUE(map.contains(i));
+    EXPECT_EQ(*map.find(i), 0.5 * i);
+  }
+  EXPECT_FALSE(map.contains(-1));
+  EXPECT_FALSE(map.contains(N));
+
+  // iteration visits each entry once
+  std::vector<int> keys;
+  for(const auto& entry : map)
+  {
+    EXPECT_EQ(entry.second, 0.5 * entry.first);
+    keys.push_back(entry.first);
+  }
+  std::sort(keys.begin(), keys.end());
+  ASSERT_EQ(static_cast<int>(keys.size()), N);
+  for(int i = 0; i < N; ++i)
+  {
+    EXPECT_EQ(keys[i], i);
+  }
+
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_FALSE(map.contains(0));
+  EXPECT_EQ(map.begin(), map.end());
+}
+
+//------------------------------------------------------------------------------
+TEST(core_concurrent_hash_map, reserve_and_move)
+{
+  axom::ConcurrentHashMap<std::uint64_t, int> map(100);
+  EXPECT_GE(map.capacity(), 100);
+  const axom::IndexType numBuckets = map.bucket_count();
+
+  // the number of buckets is a power of two
+  EXPECT_EQ(numBuckets & (numBuckets - 1), 0);
+
+  for(int i = 0; i < 100; ++i)
+  {
+    EXPECT_TRUE(map.concurrent_insert(i, i).second);
+  }
+  EXPECT_EQ(map.bucket_count(), numBuckets);
+
+  // rehashing keeps the entries
+  map.reserve(10000);
+  EXPECT_GE(map.capacity(), 10000);
+  EXPECT_EQ(map.size(), 100);
+  for(int i = 0; i < 100; ++i)
+  {
+    EXPECT_EQ(*map.find(i), i);
+  }
+
+  axom::ConcurrentHashMap<std::uint64_t, int> other(std::move(map));
+  EXPECT_EQ(other.size(), 100);
+  EXPECT_EQ(*other.find(42), 42);
+  EXPECT_TRUE(map.empty());
+  EXPECT_FALSE(map.contains(42));
+
+  // a moved-from map may be reused
+  map.insert(7, 8);
+  EXPECT_EQ(*map.find(7), 8);
+
+  map = std::move(other);
+  EXPECT_EQ(map.size(), 100);
+  EXPECT_FALSE(map.contains(100));
+}
+
+//------------------------------------------------------------------------------
+TEST(core_concurrent_hash_map, full_table)
+{
+  axom::ConcurrentHashMap<int, int> map;
+  const axom::IndexType numBuckets = map.bucket_count();
+
+  // concurrent_insert() fills every bucket, but does not grow the table
+  for(int i = 0; i < numBuckets; ++i)
+  {
+    EXPECT_TRUE(map.concurrent_insert(i, i).second);
+  }
+  auto result = map.concurrent_insert(-1, -1);
+  EXPECT_EQ(result.first, nullptr);
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(*map.concurrent_insert(3, -1).first, 3);
+  EXPECT_FALSE(map.contains(-1));
+
+  // insert() grows the table
+  EXPECT_TRUE(map.insert(-1, -1).second);
+  EXPECT_GT(map.bucket_count(), numBuckets);
+  EXPECT_EQ(map.size(), numBuckets + 1);
+}
+
+//------------------------------------------------------------------------------
+TEST(core_concurrent_hash_map, custom_key)
+{
+  axom::ConcurrentHashMap<QuadKey, int, QuadKeyHash, QuadKeyEqual> map;
+
+  // the faces of a row of hexahedra, shared faces are found once
+  constexpr int NUM_CELLS = 50;
+  int numFaces = 0;
+  for(int c = 0; c < NUM_CELLS; ++c)
+  {
+    const QuadKey left = {{4 * c, 4 * c + 1, 4 * c + 2, 4 * c + 3}};
+    const QuadKey right = {{4 * c + 4, 4 * c + 5, 4 * c + 6, 4 * c + 7}};
+    numFaces += map.insert(left, numFaces).second ? 1 : 0;
+    numFaces += map.insert(right, numFaces).second ? 1 : 0;
+  }
+  EXPECT_EQ(numFaces, NUM_CELLS + 1);
+  EXPECT_EQ(map.size(), NUM_CELLS + 1);
+
+  const QuadKey face = {{8, 9, 10, 11}};
+  ASSERT_TRUE(map.contains(face));
+  EXPECT_EQ(*map.find(face), 2);
+}
+
+//------------------------------------------------------------------------------
+TEST(core_concurrent_hash_map, bulk_insert)
+{
+  check_bulk_insert<axom::SEQ_EXEC>();
+  check_bulk_insert<axom::THREAD_EXEC<>>();
+#ifdef AXOM_USE_OPENMP
+  check_bulk_insert<axom::OMP_EXEC>();
+#endif
+}
@@ -10,10 +10,14 @@
 #include "axom/core/execution/for_all.hpp"         /* for_all() traversals */
 #include "axom/core/execution/synchronize.hpp"     /* synchronize() */
 #include "axom/core/memory_management.hpp"         /* allocate/deallocate */
+#include "axom/core/execution/ThreadPool.hpp"      /* ThreadPool */
 
 // gtest includes
 #include "gtest/gtest.h"
 
+// C/C++ includes
+#include <vector>  // for std::vector
+
 //------------------------------------------------------------------------------
 //  HELPER METHODS
 //------------------------------------------------------------------------------
@@ -78,18 +82,138 @@ void check_for_all()
   axom::setDefaultAllocator(currentAllocatorID);
 }
 
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void check_for_all_coverage()
+{
+  std::cout << "checking axom::for_all() coverage with ["
+            << axom::execution_space<ExecSpace>::name() << "]\n";
+
+  // odd sizes, so that the iteration space does not split evenly
+  constexpr int BEGIN = 7;
+  constexpr int END = 10007;
+
+  const int currentAllocatorID = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  int* visits = axom::allocate<int>(END);
+  for(int i = 0; i < END; ++i)
+  {
+    visits[i] = 0;
+  }
+
+  // each index in [BEGIN,END) must be visited exactly once
+  axom::for_all<ExecSpace>(
+    BEGIN,
+    END,
+    AXOM_LAMBDA(axom::IndexType idx) { visits[idx] += 1; });
+
+  // empty ranges should be no-ops
+  axom::for_all<ExecSpace>(
+    END,
+    BEGIN,
+    AXOM_LAMBDA(axom::IndexType idx) { visits[idx] += 1; });
+
+  if(axom::execution_space<ExecSpace>::async())
+  {
+    axom::synchronize<ExecSpace>();
+  }
+
+  for(int i = 0; i < END; ++i)
+  {
+    EXPECT_EQ(visits[i], (i < BEGIN) ? 0 : 1);
+  }
+
+  axom::deallocate(visits);
+  axom::setDefaultAllocator(currentAllocatorID);
+}
+
 } /* end anonymous namespace */
 
 //------------------------------------------------------------------------------
 //  UNIT TESTS
 //------------------------------------------------------------------------------
-TEST(core_execution_for_all, seq_exec) { check_for_all<axom::SEQ_EXEC>(); }
+TEST(core_execution_for_all, seq_exec)
+{
+  check_for_all<axom::SEQ_EXEC>();
+  check_for_all_coverage<axom::SEQ_EXEC>();
+}
+
+//------------------------------------------------------------------------------
+TEST(core_execution_for_all, thread_exec)
+{
+  check_for_all<axom::THREAD_EXEC<>>();
+  check_for_all_coverage<axom::THREAD_EXEC<>>();
+  check_for_all_coverage<axom::THREAD_EXEC<axom::SCHEDULE_STATIC, 16>>();
+  check_for_all_coverage<axom::THREAD_EXEC<axom::SCHEDULE_DYNAMIC>>();
+  check_for_all_coverage<axom::THREAD_EXEC<axom::SCHEDULE_DYNAMIC, 64>>();
+  check_for_all_coverage<axom::THREAD_EXEC<axom::SCHEDULE_GUIDED>>();
+  check_for_all_coverage<axom::THREAD_EXEC<axom::SCHEDULE_GUIDED, 8>>();
+}
+
+//------------------------------------------------------------------------------
+TEST(core_execution_for_all, thread_pool)
+{
+  axom::ThreadPool& pool = axom::ThreadPool::instance();
+  const int defaultNumThreads = pool.getNumThreads();
+  EXPECT_GE(defaultNumThreads, 1);
+
+  for(int numThreads : {1, 3, 4})
+  {
+    axom::setNumThreads(numThreads);
+    EXPECT_EQ(axom::getNumThreads(), numThreads);
+
+    // every thread in the pool runs the task exactly once
+    std::vector<int> ran(numThreads, 0);
+    pool.parallel([&](int tid, int nthreads) {
+      EXPECT_EQ(nthreads, numThreads);
+      EXPECT_TRUE(axom::ThreadPool::inParallelRegion());
+      ran[tid] += 1;
+
+      // nested regions are executed serially by the calling thread
+      int nested = 0;
+      pool.parallel([&](int ntid, int nnthreads) {
+        EXPECT_EQ(ntid, 0);
+        EXPECT_EQ(nnthreads, 1);
+        ++nested;
+      });
+      EXPECT_EQ(nested, 1);
+    });
+    EXPECT_FALSE(axom::ThreadPool::inParallelRegion());
+
+    for(int tid = 0; tid < numThreads; ++tid)
+    {
+      EXPECT_EQ(ran[tid], 1);
+    }
+
+    check_for_all_coverage<axom::THREAD_EXEC<axom::SCHEDULE_DYNAMIC, 3>>();
+  }
+
+  axom::setNumThreads(defaultNumThreads);
+}
 
 //------------------------------------------------------------------------------
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP)
+#if defined(AXOM_USE_OPENMP)
 
-TEST(core_execution_for_all, omp_exec) { check_for_all<axom::OMP_EXEC>(); }
+TEST(core_execution_for_all, omp_exec)
+{
+  check_for_all<axom::OMP_EXEC>();
+  check_for_all_coverage<axom::OMP_EXEC>();
+}
+
+//------------------------------------------------------------------------------
+TEST(core_execution_for_all, omp_scheduled_exec)
+{
+  using axom::OMP_SCHEDULED_EXEC;
+  check_for_all<OMP_SCHEDULED_EXEC<axom::SCHEDULE_STATIC>>();
+  check_for_all_coverage<OMP_SCHEDULED_EXEC<axom::SCHEDULE_STATIC>>();
+  check_for_all_coverage<OMP_SCHEDULED_EXEC<axom::SCHEDULE_STATIC, 32>>();
+  check_for_all_coverage<OMP_SCHEDULED_EXEC<axom::SCHEDULE_DYNAMIC>>();
+  check_for_all_coverage<OMP_SCHEDULED_EXEC<axom::SCHEDULE_DYNAMIC, 64>>();
+  check_for_all_coverage<OMP_SCHEDULED_EXEC<axom::SCHEDULE_GUIDED, 8>>();
+  check_for_all_coverage<OMP_SCHEDULED_EXEC<axom::SCHEDULE_RUNTIME>>();
+}
 
 #endif
 
@@ -0,0 +1,287 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+// Axom includes
+#include "axom/config.hpp"                         /* for compile time defs */
+#include "axom/core/execution/execution_space.hpp" /* execution_space traits */
+#include "axom/core/execution/operators.hpp"       /* for axom::maximum */
+#include "axom/core/execution/reduce.hpp"          /* reduce()/min_max() */
+#include "axom/core/execution/scan.hpp"            /* exclusive_scan() */
+#include "axom/core/execution/sort.hpp"            /* sort_pairs() */
+#include "axom/core/execution/ThreadPool.hpp"      /* setNumThreads() */
+#include "axom/core/memory_management.hpp"         /* allocate/deallocate */
+
+// gtest includes
+#include "gtest/gtest.h"
+
+// C/C++ includes
+#include <iostream>     // for std::cout
+#include <limits>       // for std::numeric_limits
+#include <type_traits>  // for std::is_unsigned
+
+//------------------------------------------------------------------------------
+//  HELPER METHODS
+//------------------------------------------------------------------------------
+namespace
+{
+// sizes that exercise the single-block and the multi-block code paths
+constexpr int PRIMITIVE_SIZES[] = {0, 1, 17, 4099, 100003};
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void check_reduce()
+{
+  std::cout << "checking axom::reduce() with ["
+            << axom::execution_space<ExecSpace>::name() << "]\n";
+
+  const int currentAllocatorID = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  for(int N : PRIMITIVE_SIZES)
+  {
+    int* a = axom::allocate<int>(N);
+    for(int i = 0; i < N; ++i)
+    {
+      a[i] = (i % 7) - 3 + ((i == N / 2) ? 1000 : 0);
+    }
+
+    long expected_sum = 0;
+    int expected_max = -1000;
+    for(int i = 0; i < N; ++i)
+    {
+      expected_sum += a[i];
+      expected_max = (a[i] > expected_max) ? a[i] : expected_max;
+    }
+
+    EXPECT_EQ(axom::reduce<ExecSpace>(a, N), expected_sum);
+    EXPECT_EQ(axom::reduce<ExecSpace>(a, N, 10), expected_sum + 10);
+    EXPECT_EQ(
+      axom::reduce<ExecSpace>(a, N, -1000, axom::maximum<int> {}),
+      expected_max);
+
+    axom::deallocate(a);
+  }
+
+  axom::setDefaultAllocator(currentAllocatorID);
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void check_exclusive_scan()
+{
+  std::cout << "checking axom::exclusive_scan() with ["
+            << axom::execution_space<ExecSpace>::name() << "]\n";
+
+  const int currentAllocatorID = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  for(int N : PRIMITIVE_SIZES)
+  {
+    axom::IndexType* counts = axom::allocate<axom::IndexType>(N);
+    axom::IndexType* offsets = axom::allocate<axom::IndexType>(N);
+    for(int i = 0; i < N; ++i)
+    {
+      counts[i] = i % 5;
+    }
+
+    // out-of-place
+    const axom::IndexType total =
+      axom::exclusive_scan<ExecSpace>(counts, N, offsets);
+
+    axom::IndexType expected = 0;
+    for(int i = 0; i < N; ++i)
+    {
+      EXPECT_EQ(offsets[i], expected);
+      expected += counts[i];
+    }
+    EXPECT_EQ(total, expected);
+
+    // in-place, with a non-zero initial value
+    const axom::IndexType INIT = 3;
+    const axom::IndexType total_inplace =
+      axom::exclusive_scan<ExecSpace>(counts, N, counts, INIT);
+    EXPECT_EQ(total_inplace, total + INIT);
+
+    for(int i = 0; i < N; ++i)
+    {
+      EXPECT_EQ(counts[i], offsets[i] + INIT);
+    }
+
+    axom::deallocate(counts);
+    axom::deallocate(offsets);
+  }
+
+  axom::setDefaultAllocator(currentAllocatorID);
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void check_min_max()
+{
+  std::cout << "checking axom::min_max() with ["
+            << axom::execution_space<ExecSpace>::name() << "]\n";
+
+  const int currentAllocatorID = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  for(int N : PRIMITIVE_SIZES)
+  {
+    double* a = axom::allocate<double>(N);
+    for(int i = 0; i < N; ++i)
+    {
+      a[i] = static_cast<double>((i * 7919) % 1009) - 500.;
+    }
+
+    double expected_min = std::numeric_limits<double>::max();
+    double expected_max = std::numeric_limits<double>::lowest();
+    for(int i = 0; i < N; ++i)
+    {
+      expected_min = (a[i] < expected_min) ? a[i] : expected_min;
+      expected_max = (a[i] > expected_max) ? a[i] : expected_max;
+    }
+
+    double min = 0.;
+    double max = 0.;
+    axom::min_max<ExecSpace>(a, N, min, max);
+    EXPECT_EQ(min, expected_min);
+    EXPECT_EQ(max, expected_max);
+
+    axom::deallocate(a);
+  }
+
+  axom::setDefaultAllocator(currentAllocatorID);
+}
+
+//------------------------------------------------------------------------------
+// Unsigned keys span both the lowest and the highest digits of a radix sort
+template <typename KeyType>
+KeyType make_sort_key(unsigned int hash, std::true_type)
+{
+  constexpr int SHIFT = sizeof(KeyType) * 8 - 8;
+  return (static_cast<KeyType>(hash) << SHIFT) | static_cast<KeyType>(hash);
+}
+
+// Other keys include negative values
+template <typename KeyType>
+KeyType make_sort_key(unsigned int hash, std::false_type)
+{
+  return static_cast<KeyType>(hash) - static_cast<KeyType>(48);
+}
+
+// Returns the i-th sort key. There are few distinct keys, so that there are
+// many ties to check stability.
+template <typename KeyType>
+KeyType make_sort_key(int i)
+{
+  const unsigned int hash = (i * 2654435761u) % 97;
+  return make_sort_key<KeyType>(hash, std::is_unsigned<KeyType> {});
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace, typename KeyType>
+void check_sort_pairs()
+{
+  std::cout << "checking axom::sort_pairs() with ["
+            << axom::execution_space<ExecSpace>::name() << "] and "
+            << sizeof(KeyType) << "-byte keys\n";
+
+  const int currentAllocatorID = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  for(int N : PRIMITIVE_SIZES)
+  {
+    KeyType* keys = axom::allocate<KeyType>(N);
+    axom::int32* values = axom::allocate<axom::int32>(N);
+    for(int i = 0; i < N; ++i)
+    {
+      keys[i] = make_sort_key<KeyType>(i);
+      values[i] = i;
+    }
+
+    axom::sort_pairs<ExecSpace>(keys, values, N);
+
+    for(int i = 0; i < N; ++i)
+    {
+      // values still map to their original key
+      EXPECT_EQ(keys[i], make_sort_key<KeyType>(values[i]));
+
+      if(i > 0)
+      {
+        EXPECT_LE(keys[i - 1], keys[i]);
+        if(keys[i - 1] == keys[i])
+        {
+          EXPECT_LT(values[i - 1], values[i]);
+        }
+      }
+    }
+
+    axom::deallocate(keys);
+    axom::deallocate(values);
+  }
+
+  axom::setDefaultAllocator(currentAllocatorID);
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void check_primitives()
+{
+  check_reduce<ExecSpace>();
+  check_exclusive_scan<ExecSpace>();
+  check_min_max<ExecSpace>();
+  check_sort_pairs<ExecSpace, axom::uint32>();
+  check_sort_pairs<ExecSpace, axom::uint64>();
+  check_sort_pairs<ExecSpace, axom::int32>();
+  check_sort_pairs<ExecSpace, double>();
+}
+
+} /* end anonymous namespace */
+
+//------------------------------------------------------------------------------
+//  UNIT TESTS
+//------------------------------------------------------------------------------
+TEST(core_execution_primitives, seq_exec)
+{
+  check_primitives<axom::SEQ_EXEC>();
+}
+
+//------------------------------------------------------------------------------
+TEST(core_execution_primitives, thread_exec)
+{
+  const int defaultNumThreads = axom::getNumThreads();
+
+  for(int numThreads : {1, 3, 4})
+  {
+    axom::setNumThreads(numThreads);
+    check_primitives<axom::THREAD_EXEC<>>();
+    check_primitives<axom::THREAD_EXEC<axom::SCHEDULE_DYNAMIC>>();
+  }
+
+  axom::setNumThreads(defaultNumThreads);
+}
+
+//------------------------------------------------------------------------------
+
+#if defined(AXOM_USE_OPENMP)
+
+TEST(core_execution_primitives, omp_exec)
+{
+  check_primitives<axom::OMP_EXEC>();
+  check_primitives<axom::OMP_SCHEDULED_EXEC<axom::SCHEDULE_DYNAMIC>>();
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_CUDA) && defined(AXOM_USE_UMPIRE)
+
+TEST(core_execution_primitives, cuda_exec)
+{
+  constexpr int BLOCK_SIZE = 256;
+  check_primitives<axom::CUDA_EXEC<BLOCK_SIZE>>();
+}
+
+#endif
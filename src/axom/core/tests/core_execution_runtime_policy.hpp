@@ -0,0 +1,219 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/config.hpp"  // for compile time definitions
+
+#include "axom/core/execution/execution_space.hpp"
+#include "axom/core/execution/for_all.hpp"
+#include "axom/core/execution/runtime_policy.hpp"
+#include "axom/core/memory_management.hpp"
+
+// for gtest macros
+#include "gtest/gtest.h"
+
+// C/C++ includes
+#include <cstring>  // for strcmp()
+#include <string>   // for std::string
+
+//------------------------------------------------------------------------------
+//  HELPER METHODS
+//------------------------------------------------------------------------------
+namespace
+{
+/// Records the name of the execution space it is called with
+struct NameKernel
+{
+  std::string* name;
+
+  template <typename ExecSpace>
+  void operator()(ExecSpace) const
+  {
+    *name = axom::execution_space<ExecSpace>::name();
+  }
+};
+
+/// Squares the entries of an array in the given execution space
+struct SquareKernel
+{
+  int* values;
+  int n;
+
+  template <typename ExecSpace>
+  void operator()(ExecSpace) const
+  {
+    const int currentAllocatorID = axom::getDefaultAllocatorID();
+    axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+    int* v = axom::allocate<int>(n);
+    axom::copy(v, values, n * sizeof(int));
+
+    axom::for_all<ExecSpace>(
+      n,
+      AXOM_LAMBDA(axom::IndexType i) { v[i] = v[i] * v[i]; });
+
+    axom::copy(values, v, n * sizeof(int));
+    axom::deallocate(v);
+
+    axom::setDefaultAllocator(currentAllocatorID);
+  }
+};
+
+/// Same as NameKernel, but does not opt in to THREAD_EXEC
+struct HostNameKernel
+{
+  std::string* name;
+
+  template <typename ExecSpace>
+  void operator()(ExecSpace) const
+  {
+    *name = axom::execution_space<ExecSpace>::name();
+  }
+};
+
+}  // namespace
+
+namespace axom
+{
+template <>
+struct supports_thread_exec<NameKernel> : std::true_type
+{ };
+
+template <>
+struct supports_thread_exec<SquareKernel> : std::true_type
+{ };
+}  // namespace axom
+
+//------------------------------------------------------------------------------
+// UNIT TESTS
+//------------------------------------------------------------------------------
+TEST(core_execution_runtime_policy, policy_names)
+{
+  for(int id = 0; id < axom::NUM_RUNTIME_POLICIES; ++id)
+  {
+    const auto policy = static_cast<axom::RuntimePolicy>(id);
+    const std::string name = axom::getRuntimePolicyName(policy);
+
+    axom::RuntimePolicy parsed = axom::POLICY_SEQ;
+    EXPECT_TRUE(axom::parseRuntimePolicy(name, parsed));
+    EXPECT_EQ(parsed, policy);
+  }
+
+  axom::RuntimePolicy policy = axom::POLICY_SEQ;
+  EXPECT_TRUE(axom::parseRuntimePolicy("Thread", policy));
+  EXPECT_EQ(policy, axom::POLICY_THREAD);
+  EXPECT_TRUE(axom::parseRuntimePolicy("OMP", policy));
+  EXPECT_EQ(policy, axom::POLICY_OMP);
+
+  // invalid names leave the policy unchanged
+  EXPECT_FALSE(axom::parseRuntimePolicy("openmpi", policy));
+  EXPECT_FALSE(axom::parseRuntimePolicy("", policy));
+  EXPECT_EQ(policy, axom::POLICY_OMP);
+
+  EXPECT_TRUE(axom::isRuntimePolicyEnabled(axom::POLICY_SEQ));
+  EXPECT_TRUE(axom::isRuntimePolicyEnabled(axom::POLICY_THREAD));
+#ifdef AXOM_USE_OPENMP
+  EXPECT_TRUE(axom::isRuntimePolicyEnabled(axom::POLICY_OMP));
+#else
+  EXPECT_FALSE(axom::isRuntimePolicyEnabled(axom::POLICY_OMP));
+#endif
+
+  const std::string enabled = axom::getEnabledRuntimePolicyNames();
+  EXPECT_EQ(enabled.find("seq, thread"), 0u);
+}
+
+//------------------------------------------------------------------------------
+TEST(core_execution_runtime_policy, dispatch)
+{
+  for(int id = 0; id < axom::NUM_RUNTIME_POLICIES; ++id)
+  {
+    const auto policy = static_cast<axom::RuntimePolicy>(id);
+    std::cout << "checking dispatch of policy ["
+              << axom::getRuntimePolicyName(policy) << "]\n";
+
+    std::string name;
+    const bool enabled = axom::isRuntimePolicyEnabled(policy);
+    EXPECT_EQ(axom::dispatch_runtime_policy(policy, NameKernel {&name}),
+              enabled);
+    if(!enabled)
+    {
+      EXPECT_TRUE(name.empty());
+      continue;
+    }
+
+    EXPECT_FALSE(name.empty());
+
+    constexpr int N = 100;
+    int values[N];
+    for(int i = 0; i < N; ++i)
+    {
+      values[i] = i;
+    }
+
+    EXPECT_TRUE(
+      axom::dispatch_runtime_policy(policy, SquareKernel {values, N}));
+    for(int i = 0; i < N; ++i)
+    {
+      EXPECT_EQ(values[i], i * i);
+    }
+  }
+
+  std::string name;
+  EXPECT_TRUE(
+    axom::dispatch_runtime_policy(axom::POLICY_SEQ, NameKernel {&name}));
+  EXPECT_EQ(name, axom::execution_space<axom::SEQ_EXEC>::name());
+  EXPECT_TRUE(
+    axom::dispatch_runtime_policy(axom::POLICY_THREAD, NameKernel {&name}));
+  EXPECT_EQ(name, axom::execution_space<axom::THREAD_EXEC<>>::name());
+}
+
+//------------------------------------------------------------------------------
+TEST(core_execution_runtime_policy, dispatch_host)
+{
+  // the host dispatch rejects the device policy, even when it is enabled
+  std::string name;
+  EXPECT_FALSE(
+    axom::dispatch_host_runtime_policy(axom::POLICY_CUDA, NameKernel {&name}));
+  EXPECT_TRUE(name.empty());
+
+  EXPECT_TRUE(
+    axom::dispatch_host_runtime_policy(axom::POLICY_SEQ, NameKernel {&name}));
+  EXPECT_EQ(name, axom::execution_space<axom::SEQ_EXEC>::name());
+}
+
+//------------------------------------------------------------------------------
+TEST(core_execution_runtime_policy, dispatch_thread_opt_in)
+{
+  // a kernel that does not support THREAD_EXEC is not dispatched with it
+  std::string name;
+  EXPECT_FALSE(axom::supports_thread_exec<HostNameKernel>::value);
+  EXPECT_FALSE(
+    axom::dispatch_runtime_policy(axom::POLICY_THREAD, HostNameKernel {&name}));
+  EXPECT_FALSE(axom::dispatch_host_runtime_policy(axom::POLICY_THREAD,
+                                                  HostNameKernel {&name}));
+  EXPECT_TRUE(name.empty());
+
+  EXPECT_TRUE(
+    axom::dispatch_runtime_policy(axom::POLICY_SEQ, HostNameKernel {&name}));
+  EXPECT_EQ(name, axom::execution_space<axom::SEQ_EXEC>::name());
+}
+
+//------------------------------------------------------------------------------
+TEST(core_execution_runtime_policy, num_threads)
+{
+  const int numThreads = axom::getNumThreads();
+
+  std::string name;
+  EXPECT_TRUE(
+    axom::dispatch_runtime_policy(axom::POLICY_THREAD, NameKernel {&name}, 3));
+  EXPECT_EQ(axom::getNumThreads(), 3);
+
+  // the sequential policy does not change the number of threads
+  EXPECT_TRUE(
+    axom::dispatch_runtime_policy(axom::POLICY_SEQ, NameKernel {&name}, 2));
+  EXPECT_EQ(axom::getNumThreads(), 3);
+
+  axom::setNumThreads(numThreads);
+  EXPECT_EQ(axom::getNumThreads(), numThreads);
+}
@@ -101,9 +101,12 @@ void check_execution_mappings(int expectedAllocatorID,
 TEST(core_execution_space, check_valid)
 {
   check_valid<axom::SEQ_EXEC>();
+  check_valid<axom::THREAD_EXEC<>>();
+  check_valid<axom::THREAD_EXEC<axom::SCHEDULE_DYNAMIC, 64>>();
 
-#if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
+#if defined(AXOM_USE_OPENMP)
   check_valid<axom::OMP_EXEC>();
+  check_valid<axom::OMP_SCHEDULED_EXEC<axom::SCHEDULE_GUIDED>>();
 #endif
 
 #if defined(AXOM_USE_CUDA) && defined(AXOM_USE_RAJA)
@@ -0,0 +1,176 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/core/FileMapping.hpp"
+
+#include "gtest/gtest.h"
+
+// C/C++ includes
+#include <cstdio>   // for std::remove
+#include <cstring>  // for std::memcmp
+#include <fstream>  // for std::ofstream
+#include <string>   // for std::string
+#include <utility>  // for std::move
+
+//------------------------------------------------------------------------------
+// HELPER METHODS
+//------------------------------------------------------------------------------
+namespace
+{
+/// Writes a file of the given number of bytes, byte i has the value i % 251
+std::string write_mapped_file(const std::string& path, int numbytes)
+{
+  std::string contents(numbytes, '\0');
+  for(int i = 0; i < numbytes; ++i)
+  {
+    contents[i] = static_cast<char>(i % 251);
+  }
+
+  std::ofstream file(path, std::ios::binary);
+  file.write(contents.data(), numbytes);
+  return contents;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+// UNIT TESTS
+//------------------------------------------------------------------------------
+TEST(core_file_mapping, map_ranges)
+{
+  // spans a few pages, so that the offsets are not page-aligned
+  constexpr int NUM_BYTES = 3 * 4096 + 123;
+  const std::string path = "core_file_mapping_ranges.bin";
+  const std::string contents = write_mapped_file(path, NUM_BYTES);
+
+  axom::FileMapping mapping;
+  EXPECT_FALSE(mapping.isMapped());
+  EXPECT_EQ(mapping.data(), nullptr);
+
+  // the whole file
+  ASSERT_TRUE(mapping.map(path, 0, axom::FileMapping::TO_END_OF_FILE));
+  EXPECT_TRUE(mapping.isMapped());
+  EXPECT_EQ(mapping.size(), static_cast<std::size_t>(NUM_BYTES));
+  EXPECT_EQ(mapping.getMode(), axom::FileMapping::Mode::READ_ONLY);
+  EXPECT_EQ(std::memcmp(mapping.data(), contents.data(), NUM_BYTES), 0);
+
+  // ranges at unaligned offsets
+  const std::size_t offsets[] = {1, 4095, 4096, 5000, NUM_BYTES - 10};
+  for(std::size_t offset : offsets)
+  {
+    ASSERT_TRUE(mapping.map(path, offset, 10));
+    EXPECT_EQ(mapping.size(), 10u);
+    EXPECT_EQ(std::memcmp(mapping.data(), contents.data() + offset, 10), 0);
+  }
+
+  // an empty range
+  EXPECT_TRUE(mapping.map(path, NUM_BYTES, axom::FileMapping::TO_END_OF_FILE));
+  EXPECT_TRUE(mapping.isMapped());
+  EXPECT_EQ(mapping.size(), 0u);
+  EXPECT_EQ(mapping.data(), nullptr);
+
+  mapping.unmap();
+  EXPECT_FALSE(mapping.isMapped());
+
+  std::remove(path.c_str());
+}
+
+//------------------------------------------------------------------------------
+TEST(core_file_mapping, errors)
+{
+  constexpr int NUM_BYTES = 1000;
+  const std::string path = "core_file_mapping_errors.bin";
+  write_mapped_file(path, NUM_BYTES);
+
+  axom::FileMapping mapping;
+  EXPECT_FALSE(mapping.map("m_i_s_s_i_n_g.bin", 0, 10));
+  EXPECT_FALSE(mapping.isMapped());
+  EXPECT_FALSE(mapping.getErrorMessage().empty());
+
+  // the range must be within the file
+  EXPECT_FALSE(mapping.map(path, 0, NUM_BYTES + 1));
+  EXPECT_FALSE(mapping.map(path, NUM_BYTES + 1, 0));
+  EXPECT_FALSE(mapping.map(path, 500, 501));
+  EXPECT_FALSE(mapping.isMapped());
+
+  EXPECT_TRUE(mapping.map(path, 500, 500));
+  EXPECT_TRUE(mapping.getErrorMessage().empty());
+
+  std::remove(path.c_str());
+}
+
+//------------------------------------------------------------------------------
+TEST(core_file_mapping, copy_on_write)
+{
+  constexpr int NUM_BYTES = 10000;
+  const std::string path = "core_file_mapping_cow.bin";
+  const std::string contents = write_mapped_file(path, NUM_BYTES);
+
+  {
+    axom::FileMapping mapping;
+    ASSERT_TRUE(mapping.map(path,
+                            100,
+                            axom::FileMapping::TO_END_OF_FILE,
+                            axom::FileMapping::Mode::COPY_ON_WRITE));
+
+    char* data = static_cast<char*>(mapping.data());
+    for(std::size_t i = 0; i < mapping.size(); ++i)
+    {
+      data[i] = 'x';
+    }
+
+    // the private pages are never dropped
+    EXPECT_FALSE(mapping.advise(axom::FileMapping::Advice::DONT_NEED));
+    EXPECT_EQ(data[0], 'x');
+    EXPECT_EQ(data[mapping.size() - 1], 'x');
+  }
+
+  // the file is not modified
+  axom::FileMapping mapping;
+  ASSERT_TRUE(mapping.map(path, 0, NUM_BYTES));
+  EXPECT_EQ(std::memcmp(mapping.data(), contents.data(), NUM_BYTES), 0);
+
+  std::remove(path.c_str());
+}
+
+//------------------------------------------------------------------------------
+TEST(core_file_mapping, advise_and_move)
+{
+  constexpr int NUM_BYTES = 20000;
+  const std::string path = "core_file_mapping_advise.bin";
+  const std::string contents = write_mapped_file(path, NUM_BYTES);
+
+  using Advice = axom::FileMapping::Advice;
+
+  axom::FileMapping mapping;
+  EXPECT_FALSE(mapping.advise(Advice::SEQUENTIAL));
+
+  ASSERT_TRUE(mapping.map(path, 33, NUM_BYTES - 33));
+  EXPECT_TRUE(mapping.advise(Advice::NORMAL));
+  EXPECT_TRUE(mapping.advise(Advice::SEQUENTIAL));
+  EXPECT_TRUE(mapping.advise(Advice::RANDOM, 5000));
+  EXPECT_TRUE(mapping.advise(Advice::WILL_NEED, 7, 9000));
+  EXPECT_FALSE(mapping.advise(Advice::WILL_NEED, NUM_BYTES));
+
+  // the dropped pages are read back from the file
+  EXPECT_TRUE(mapping.advise(Advice::DONT_NEED, 100, 10000));
+  EXPECT_EQ(std::memcmp(mapping.data(), contents.data() + 33, NUM_BYTES - 33),
+            0);
+
+  // moving transfers the mapping
+  const void* data = mapping.data();
+  axom::FileMapping moved(std::move(mapping));
+  EXPECT_FALSE(mapping.isMapped());
+  EXPECT_TRUE(moved.isMapped());
+  EXPECT_EQ(moved.data(), data);
+
+  mapping = std::move(moved);
+  EXPECT_TRUE(mapping.isMapped());
+  EXPECT_FALSE(moved.isMapped());
+  EXPECT_EQ(std::memcmp(mapping.data(), contents.data() + 33, NUM_BYTES - 33),
+            0);
+
+  std::remove(path.c_str());
+}
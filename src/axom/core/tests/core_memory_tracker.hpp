@@ -0,0 +1,222 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/config.hpp"
+#include "axom/core/MemoryTracker.hpp"
+#include "axom/core/memory_management.hpp"
+
+#include "gtest/gtest.h"
+
+// C/C++ includes
+#include <sstream>  // for std::ostringstream
+#include <string>   // for std::string
+#include <thread>   // for std::thread
+#include <vector>   // for std::vector
+
+//------------------------------------------------------------------------------
+// HELPER METHODS
+//------------------------------------------------------------------------------
+namespace
+{
+/*!
+ * \brief Enables the MemoryTracker for the lifetime of the object, and
+ *  restores its previous state afterwards.
+ */
+struct ScopedMemoryTracking
+{
+  ScopedMemoryTracking() : m_wasEnabled(axom::MemoryTracker::isEnabled())
+  {
+    axom::MemoryTracker::setEnabled(true);
+  }
+  ~ScopedMemoryTracking() { axom::MemoryTracker::setEnabled(m_wasEnabled); }
+
+  bool m_wasEnabled;
+};
+
+/*!
+ * \brief Returns the statistics of the given label.
+ */
+axom::MemoryStats get_label_stats(const std::string& label)
+{
+  const auto stats = axom::MemoryTracker::instance().getStatsByLabel();
+  auto it = stats.find(label);
+  return (it == stats.end()) ? axom::MemoryStats() : it->second;
+}
+
+}  // end anonymous namespace
+
+//------------------------------------------------------------------------------
+// UNIT TESTS
+//------------------------------------------------------------------------------
+TEST(core_memory_tracker, disabled)
+{
+  axom::MemoryTracker::setEnabled(false);
+  EXPECT_FALSE(axom::MemoryTracker::isEnabled());
+
+  {
+    axom::ScopedMemoryLabel label("test::disabled");
+    double* buffer = axom::allocate<double>(100);
+    buffer = axom::reallocate(buffer, 200);
+    axom::deallocate(buffer);
+  }
+
+  const axom::MemoryStats stats = get_label_stats("test::disabled");
+  EXPECT_EQ(stats.numAllocations, 0u);
+  EXPECT_EQ(stats.liveBytes, 0u);
+}
+
+//------------------------------------------------------------------------------
+TEST(core_memory_tracker, disabled_labels)
+{
+  axom::MemoryTracker::setEnabled(false);
+
+  axom::MemoryTracker& tracker = axom::MemoryTracker::instance();
+  const std::size_t numLabels = tracker.getNumLabels();
+
+  // a labeled scope does not record its label while the tracker is disabled
+  {
+    axom::ScopedMemoryLabel label("test::disabled_labels");
+    double* buffer = axom::allocate<double>(10);
+    axom::deallocate(buffer);
+  }
+  EXPECT_EQ(tracker.getNumLabels(), numLabels);
+
+  // the label is recorded once an allocation is made under it
+  {
+    ScopedMemoryTracking tracking;
+    axom::ScopedMemoryLabel label("test::disabled_labels");
+    EXPECT_EQ(tracker.getNumLabels(), numLabels);
+
+    double* buffer = axom::allocate<double>(10);
+    axom::deallocate(buffer);
+  }
+  EXPECT_EQ(tracker.getNumLabels(), numLabels + 1);
+  EXPECT_EQ(get_label_stats("test::disabled_labels").numAllocations, 1u);
+}
+
+//------------------------------------------------------------------------------
+TEST(core_memory_tracker, labels)
+{
+  ScopedMemoryTracking tracking;
+
+  int* outer = nullptr;
+  int* inner = nullptr;
+  {
+    axom::ScopedMemoryLabel label("test::outer");
+    outer = axom::allocate<int>(10);
+    {
+      axom::ScopedMemoryLabel label("test::inner");
+      inner = axom::allocate<int>(20);
+    }
+    // the enclosing label is restored
+    int* other = axom::allocate<int>(30);
+    axom::deallocate(other);
+  }
+
+  axom::MemoryStats outerStats = get_label_stats("test::outer");
+  axom::MemoryStats innerStats = get_label_stats("test::inner");
+  EXPECT_EQ(outerStats.liveBytes, 10 * sizeof(int));
+  EXPECT_EQ(outerStats.peakBytes, 40 * sizeof(int));
+  EXPECT_EQ(outerStats.numAllocations, 2u);
+  EXPECT_EQ(outerStats.numDeallocations, 1u);
+  EXPECT_EQ(innerStats.liveBytes, 20 * sizeof(int));
+
+  // reallocations retain the label of the original allocation
+  outer = axom::reallocate(outer, 100);
+  outerStats = get_label_stats("test::outer");
+  EXPECT_EQ(outerStats.liveBytes, 100 * sizeof(int));
+  EXPECT_EQ(outerStats.peakBytes, 100 * sizeof(int));
+
+  axom::deallocate(outer);
+  axom::deallocate(inner);
+  EXPECT_EQ(get_label_stats("test::outer").liveBytes, 0u);
+  EXPECT_EQ(get_label_stats("test::inner").liveBytes, 0u);
+
+  // resetting keeps the live bytes, but resets the peaks and the counts
+  axom::MemoryTracker::instance().resetStats();
+  outerStats = get_label_stats("test::outer");
+  EXPECT_EQ(outerStats.peakBytes, 0u);
+  EXPECT_EQ(outerStats.numAllocations, 0u);
+}
+
+//------------------------------------------------------------------------------
+TEST(core_memory_tracker, allocators)
+{
+  ScopedMemoryTracking tracking;
+
+  const int defaultID = axom::getDefaultAllocatorID();
+  const int poolID = axom::getPoolAllocatorID();
+
+  axom::MemoryTracker& tracker = axom::MemoryTracker::instance();
+  const auto before = tracker.getStatsByAllocator();
+  const axom::MemoryStats totalBefore = tracker.getTotalStats();
+
+  char* a = axom::allocate<char>(1000, defaultID);
+  char* b = axom::allocate<char>(500, poolID);
+
+  auto after = tracker.getStatsByAllocator();
+  const std::size_t defaultBefore =
+    before.count(defaultID) ? before.at(defaultID).liveBytes : 0;
+  const std::size_t poolBefore =
+    before.count(poolID) ? before.at(poolID).liveBytes : 0;
+  EXPECT_EQ(after[defaultID].liveBytes - defaultBefore, 1000u);
+  EXPECT_EQ(after[poolID].liveBytes - poolBefore, 500u);
+  EXPECT_EQ(tracker.getTotalStats().liveBytes - totalBefore.liveBytes, 1500u);
+
+  // a nullptr is reallocated with the default allocator
+  char* c = axom::reallocate<char>(nullptr, 100);
+  after = tracker.getStatsByAllocator();
+  EXPECT_EQ(after[defaultID].liveBytes - defaultBefore, 1100u);
+
+  axom::deallocate(a);
+  axom::deallocate(b);
+  axom::deallocate(c);
+  EXPECT_EQ(tracker.getTotalStats().liveBytes, totalBefore.liveBytes);
+
+  std::ostringstream oss;
+  tracker.print(oss);
+  EXPECT_NE(oss.str().find("allocator " + std::to_string(poolID)),
+            std::string::npos);
+}
+
+//------------------------------------------------------------------------------
+TEST(core_memory_tracker, concurrent)
+{
+  constexpr int NUM_THREADS = 8;
+  constexpr int NUM_ALLOCS = 500;
+
+  ScopedMemoryTracking tracking;
+
+  std::vector<std::thread> threads;
+  for(int t = 0; t < NUM_THREADS; ++t)
+  {
+    threads.emplace_back([=]() {
+      axom::ScopedMemoryLabel label(t % 2 ? "test::odd" : "test::even");
+      std::vector<double*> buffers;
+      for(int i = 0; i < NUM_ALLOCS; ++i)
+      {
+        buffers.push_back(axom::allocate<double>(8));
+        buffers.back() = axom::reallocate(buffers.back(), 16);
+      }
+      for(double* buffer : buffers)
+      {
+        axom::deallocate(buffer);
+      }
+    });
+  }
+  for(auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  for(const char* name : {"test::odd", "test::even"})
+  {
+    const axom::MemoryStats stats = get_label_stats(name);
+    EXPECT_EQ(stats.liveBytes, 0u);
+    EXPECT_EQ(stats.numAllocations, 2u * NUM_ALLOCS * NUM_THREADS / 2);
+    EXPECT_EQ(stats.numDeallocations, stats.numAllocations);
+    EXPECT_GE(stats.peakBytes, 16 * sizeof(double));
+  }
+}
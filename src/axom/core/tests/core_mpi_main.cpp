@@ -10,6 +10,7 @@
 #include "axom/config.hpp"  // for compile-time definitions
 
 #include "core_types.hpp"
+#include "utils_Profiler.hpp"
 
 int main(int argc, char* argv[])
 {
@@ -0,0 +1,224 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/config.hpp"
+#include "axom/core/Array.hpp"
+#include "axom/core/PoolAllocator.hpp"
+#include "axom/core/memory_management.hpp"
+
+#include "gtest/gtest.h"
+
+// C/C++ includes
+#include <cstdint>  // for std::uintptr_t
+#include <thread>   // for std::thread
+#include <vector>   // for std::vector
+
+//------------------------------------------------------------------------------
+// HELPER METHODS
+//------------------------------------------------------------------------------
+namespace
+{
+/*!
+ * \brief Allocates and frees blocks of many sizes through axom::allocate()
+ *  with the pool allocator, checking that the blocks do not overlap.
+ */
+void check_pool_alloc_free(int numIterations, int seed)
+{
+  const int poolID = axom::getPoolAllocatorID();
+
+  std::vector<int*> buffers;
+  std::vector<int> sizes;
+  for(int iter = 0; iter < numIterations; ++iter)
+  {
+    const int size = 1 + (iter * 7919 + seed * 104729) % 5000;
+    int* buffer = axom::allocate<int>(size, poolID);
+    ASSERT_NE(buffer, nullptr);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(buffer) % 16, 0u);
+
+    for(int i = 0; i < size; ++i)
+    {
+      buffer[i] = seed + iter;
+    }
+    buffers.push_back(buffer);
+    sizes.push_back(size);
+
+    // free every other buffer along the way, to recycle blocks
+    if(iter % 2 == 1)
+    {
+      int* old = buffers[buffers.size() - 2];
+      const int oldSize = sizes[sizes.size() - 2];
+      for(int i = 0; i < oldSize; ++i)
+      {
+        EXPECT_EQ(old[i], seed + iter - 1);
+      }
+      axom::deallocate(old);
+      buffers.erase(buffers.end() - 2);
+      sizes.erase(sizes.end() - 2);
+    }
+  }
+
+  for(std::size_t b = 0; b < buffers.size(); ++b)
+  {
+    EXPECT_EQ(buffers[b][sizes[b] - 1], buffers[b][0]);
+    axom::deallocate(buffers[b]);
+  }
+}
+
+}  // end anonymous namespace
+
+//------------------------------------------------------------------------------
+// UNIT TESTS
+//------------------------------------------------------------------------------
+TEST(core_pool_allocator, block_sizes)
+{
+  using axom::PoolAllocator;
+
+  EXPECT_EQ(PoolAllocator::getBlockSize(0), PoolAllocator::MIN_BLOCK_SIZE);
+  EXPECT_EQ(PoolAllocator::getBlockSize(1), PoolAllocator::MIN_BLOCK_SIZE);
+  EXPECT_EQ(PoolAllocator::getBlockSize(32), 32u);
+  EXPECT_EQ(PoolAllocator::getBlockSize(33), 64u);
+  EXPECT_EQ(PoolAllocator::getBlockSize(1000), 1024u);
+  EXPECT_EQ(PoolAllocator::getBlockSize(PoolAllocator::MAX_BLOCK_SIZE),
+            PoolAllocator::MAX_BLOCK_SIZE);
+
+  // larger requests are not rounded up
+  const std::size_t large = PoolAllocator::MAX_BLOCK_SIZE + 1;
+  EXPECT_EQ(PoolAllocator::getBlockSize(large), large);
+}
+
+//------------------------------------------------------------------------------
+TEST(core_pool_allocator, recycle_blocks)
+{
+  axom::PoolAllocator& pool = axom::PoolAllocator::instance();
+  const axom::PoolAllocatorStats before = pool.getStats();
+
+  void* p = pool.allocate(100);
+  ASSERT_NE(p, nullptr);
+  pool.deallocate(p, 100);
+
+  // a block of the same size class is served from the thread's cache
+  void* q = pool.allocate(128);
+  EXPECT_EQ(p, q);
+  pool.deallocate(q, 128);
+
+  void* large = pool.allocate(axom::PoolAllocator::MAX_BLOCK_SIZE + 1);
+  ASSERT_NE(large, nullptr);
+  pool.deallocate(large, axom::PoolAllocator::MAX_BLOCK_SIZE + 1);
+
+  const axom::PoolAllocatorStats after = pool.getStats();
+  EXPECT_EQ(after.numAllocations - before.numAllocations, 3u);
+  EXPECT_EQ(after.numDeallocations - before.numDeallocations, 3u);
+  EXPECT_GE(after.numCacheHits - before.numCacheHits, 1u);
+  EXPECT_EQ(after.numLargeAllocations - before.numLargeAllocations, 1u);
+  EXPECT_EQ(after.bytesInUse, before.bytesInUse);
+  EXPECT_GE(after.bytesReserved, axom::PoolAllocator::SLAB_SIZE);
+}
+
+//------------------------------------------------------------------------------
+TEST(core_pool_allocator, alloc_realloc_free)
+{
+  const int poolID = axom::getPoolAllocatorID();
+  EXPECT_NE(poolID, axom::INVALID_ALLOCATOR_ID);
+
+  check_pool_alloc_free(1000, 0);
+
+  // grow and shrink, in place and across size classes
+  int* buffer = axom::allocate<int>(4, poolID);
+  for(int i = 0; i < 4; ++i)
+  {
+    buffer[i] = i;
+  }
+
+  for(int size : {5, 6, 100, 1 << 17, 50, 4})
+  {
+    buffer = axom::reallocate(buffer, size);
+    ASSERT_NE(buffer, nullptr);
+    for(int i = 0; i < 4; ++i)
+    {
+      EXPECT_EQ(buffer[i], i);
+    }
+  }
+
+  buffer = axom::reallocate(buffer, 0);
+  EXPECT_NE(buffer, nullptr);
+  axom::deallocate(buffer);
+  EXPECT_EQ(buffer, nullptr);
+}
+
+//------------------------------------------------------------------------------
+TEST(core_pool_allocator, concurrent_alloc_free)
+{
+  constexpr int NUM_THREADS = 8;
+#ifndef AXOM_USE_UMPIRE
+  const axom::PoolAllocatorStats before =
+    axom::PoolAllocator::instance().getStats();
+#endif
+
+  std::vector<std::thread> threads;
+  for(int t = 0; t < NUM_THREADS; ++t)
+  {
+    threads.emplace_back(check_pool_alloc_free, 2000, t + 1);
+  }
+  for(auto& thread : threads)
+  {
+    thread.join();
+  }
+
+#ifndef AXOM_USE_UMPIRE
+  // with Umpire, axom::allocate() uses an Umpire pool instead
+  const axom::PoolAllocatorStats after =
+    axom::PoolAllocator::instance().getStats();
+  EXPECT_EQ(after.numAllocations - before.numAllocations,
+            std::size_t(NUM_THREADS * 2000));
+  EXPECT_EQ(after.numAllocations - before.numAllocations,
+            after.numDeallocations - before.numDeallocations);
+  EXPECT_EQ(after.bytesInUse, before.bytesInUse);
+#endif
+}
+
+//------------------------------------------------------------------------------
+TEST(core_pool_allocator, array_with_pool)
+{
+  const int poolID = axom::getPoolAllocatorID();
+
+  axom::Array<double> v(0, 3, 0, poolID);
+  EXPECT_EQ(v.getAllocatorID(), poolID);
+  for(int i = 0; i < 1000; ++i)
+  {
+    const double tuple[3] = {1.0 * i, 2.0 * i, 3.0 * i};
+    v.append(tuple, 1);
+  }
+  EXPECT_EQ(v.size(), 1000);
+  EXPECT_EQ(v(999, 2), 2997.0);
+}
+
+//------------------------------------------------------------------------------
+#ifndef AXOM_USE_UMPIRE
+TEST(core_pool_allocator, set_default_allocator)
+{
+  const int defaultID = axom::getDefaultAllocatorID();
+  const int poolID = axom::getPoolAllocatorID();
+  EXPECT_NE(defaultID, poolID);
+
+  axom::setDefaultAllocator(poolID);
+  EXPECT_EQ(axom::getDefaultAllocatorID(), poolID);
+
+  const axom::PoolAllocatorStats before =
+    axom::PoolAllocator::instance().getStats();
+  int* buffer = axom::allocate<int>(10);
+  buffer = axom::reallocate(buffer, 12);
+  axom::deallocate(buffer);
+  const axom::PoolAllocatorStats after =
+    axom::PoolAllocator::instance().getStats();
+  EXPECT_EQ(after.numAllocations - before.numAllocations, 1u);
+
+  // unknown allocator IDs are ignored
+  axom::setDefaultAllocator(42);
+  EXPECT_EQ(axom::getDefaultAllocatorID(), poolID);
+
+  axom::setDefaultAllocator(defaultID);
+  EXPECT_EQ(axom::getDefaultAllocatorID(), defaultID);
+}
+#endif
@@ -7,16 +7,26 @@
 
 #include "axom/config.hpp"  // for compile-time definitions
 
+#include "core_aligned_allocator.hpp"
 #include "core_array.hpp"
+#include "core_concurrent_hash_map.hpp"
 #include "core_execution_for_all.hpp"
+#include "core_execution_primitives.hpp"
+#include "core_execution_runtime_policy.hpp"
 #include "core_execution_space.hpp"
+#include "core_file_mapping.hpp"
 #include "core_memory_management.hpp"
+#include "core_memory_tracker.hpp"
+#include "core_pool_allocator.hpp"
 #include "core_stack_array.hpp"
+#include "core_tuple_array.hpp"
 
 #ifndef AXOM_USE_MPI
   #include "core_types.hpp"
 #endif
 
+#include "numerics_batched_linear_algebra.hpp"
+#include "numerics_batched_polynomial_solvers.hpp"
 #include "numerics_determinants.hpp"
 #include "numerics_eigen_solve.hpp"
 #include "numerics_eigen_sort.hpp"
@@ -27,7 +37,10 @@
 #include "numerics_matrix.hpp"
 #include "numerics_polynomial_solvers.hpp"
 #include "numerics_matvecops.hpp"
+#include "numerics_stack_matrix.hpp"
 
+#include "utils_Philox.hpp"
+#include "utils_Profiler.hpp"
 #include "utils_Timer.hpp"
 #include "utils_endianness.hpp"
 #include "utils_fileUtilities.hpp"
@@ -42,11 +55,5 @@ int main(int argc, char** argv)
   // add this line to avoid a warning in the output about thread safety
   ::testing::FLAGS_gtest_death_test_style = "threadsafe";
 
-#ifdef EIGEN_SOLVE_TESTER_SHOULD_SEED
-  std::srand(std::time(0));
-#else
-  std::srand(42);
-#endif
-
   return RUN_ALL_TESTS();
 }
@@ -0,0 +1,302 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/config.hpp"  // for compile time definitions
+
+#include "axom/core/Array.hpp"
+#include "axom/core/TupleArray.hpp"
+#include "axom/core/TupleView.hpp"
+#include "axom/core/execution/execution_space.hpp"
+#include "axom/core/execution/for_all.hpp"
+
+// for gtest macros
+#include "gtest/gtest.h"
+
+// C/C++ includes
+#include <cstdint>  // for std::uintptr_t
+#include <utility>  // for std::move
+
+//------------------------------------------------------------------------------
+//  HELPER METHODS
+//------------------------------------------------------------------------------
+namespace
+{
+/// The value of component c of tuple i
+double tuple_value(axom::IndexType i, int c) { return 10.0 * i + c; }
+
+/// Sets the tuples of a view with a kernel, which is oblivious to the layout
+template <typename ExecSpace, typename Layout>
+void set_tuples(axom::TupleView<double, 3, Layout> view)
+{
+  axom::for_all<ExecSpace>(
+    view.size(),
+    AXOM_LAMBDA(axom::IndexType i) {
+      for(int c = 0; c < 3; ++c)
+      {
+        view(i, c) = 10.0 * i + c;
+      }
+    });
+}
+
+/// Computes the sum of the components of each tuple, in any layout
+template <typename ExecSpace, typename Layout>
+void sum_tuples(axom::TupleView<const double, 3, Layout> view, double* sums)
+{
+  axom::for_all<ExecSpace>(
+    view.size(),
+    AXOM_LAMBDA(axom::IndexType i) {
+      double tuple[3];
+      view.load(i, tuple);
+      sums[i] = tuple[0] + tuple[1] + tuple[2];
+    });
+}
+
+template <typename Layout>
+void check_tuple_values(const axom::TupleArray<double, 3, Layout>& arr)
+{
+  for(axom::IndexType i = 0; i < arr.size(); ++i)
+  {
+    for(int c = 0; c < 3; ++c)
+    {
+      EXPECT_DOUBLE_EQ(arr(i, c), tuple_value(i, c));
+    }
+  }
+}
+
+template <typename ExecSpace, typename Layout>
+void check_tuple_array_layout()
+{
+  constexpr axom::IndexType N = 1000;
+  axom::TupleArray<double, 3, Layout> arr(N);
+  EXPECT_EQ(arr.size(), N);
+  EXPECT_GE(arr.capacity(), N);
+  EXPECT_EQ(arr.capacity() % Layout::CAPACITY_MULTIPLE, 0);
+
+  set_tuples<ExecSpace>(arr.view());
+  check_tuple_values(arr);
+
+  // every element is at a distinct address within the buffer
+  const double* begin = arr.getData();
+  const double* end = begin + 3 * arr.capacity();
+  for(axom::IndexType i = 0; i < N; ++i)
+  {
+    for(int c = 0; c < 3; ++c)
+    {
+      EXPECT_TRUE(&arr(i, c) >= begin && &arr(i, c) < end);
+    }
+  }
+
+  // the kernels compute the same results in all layouts
+  const axom::TupleArray<double, 3, Layout>& const_arr = arr;
+  double sums[N];
+  sum_tuples<ExecSpace>(const_arr.view(), sums);
+  for(axom::IndexType i = 0; i < N; ++i)
+  {
+    EXPECT_DOUBLE_EQ(sums[i], 30.0 * i + 3.0);
+  }
+
+  // growing and shrinking the buffer preserves the tuples
+  arr.reserve(3 * N + 1);
+  EXPECT_GE(arr.capacity(), 3 * N + 1);
+  check_tuple_values(arr);
+
+  arr.resize(N / 2);
+  arr.shrink();
+  EXPECT_EQ(arr.size(), N / 2);
+  EXPECT_LT(arr.capacity(), N);
+  check_tuple_values(arr);
+
+  arr.resize(N);
+  set_tuples<ExecSpace>(arr.view());
+  check_tuple_values(arr);
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+// UNIT TESTS
+//------------------------------------------------------------------------------
+TEST(core_tuple_array, layouts)
+{
+  using axom::layout::AoS;
+  using axom::layout::AoSoA;
+  using axom::layout::SoA;
+
+  // element (i,c) of each layout, for 3-component tuples
+  EXPECT_EQ(SoA::tupleOffset<3>(5), 5);
+  EXPECT_EQ(SoA::componentOffset<3>(2, 16), 32);
+
+  EXPECT_EQ(AoS::tupleOffset<3>(5), 15);
+  EXPECT_EQ(AoS::componentOffset<3>(2, 16), 2);
+
+  EXPECT_EQ(AoSoA<4>::tupleOffset<3>(5), 13);
+  EXPECT_EQ(AoSoA<4>::componentOffset<3>(2, 16), 8);
+}
+
+//------------------------------------------------------------------------------
+TEST(core_tuple_array, construct_and_access)
+{
+  axom::TupleArray<double, 3> empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(empty.size(), 0);
+  EXPECT_EQ(empty.view().size(), 0);
+
+  constexpr axom::IndexType N = 10;
+  axom::TupleArray<double, 3> arr(N, 100);
+  EXPECT_EQ(arr.size(), N);
+  EXPECT_GE(arr.capacity(), 100);
+  EXPECT_EQ(arr.numComponents(), 3);
+
+  for(axom::IndexType i = 0; i < N; ++i)
+  {
+    for(int c = 0; c < 3; ++c)
+    {
+      arr(i, c) = tuple_value(i, c);
+    }
+  }
+
+  // the components of the SoA layout are contiguous, and aligned
+  for(int c = 0; c < 3; ++c)
+  {
+    const double* component = arr.getComponent(c);
+    EXPECT_EQ(component, arr.getData() + c * arr.capacity());
+    const std::uintptr_t offset = reinterpret_cast<std::uintptr_t>(component) -
+      reinterpret_cast<std::uintptr_t>(arr.getData());
+    EXPECT_EQ(offset % arr.COMPONENT_ALIGNMENT, 0u);
+    for(axom::IndexType i = 0; i < N; ++i)
+    {
+      EXPECT_EQ(component[i], tuple_value(i, c));
+    }
+  }
+
+  arr.fill(-1.0);
+  for(axom::IndexType i = 0; i < N; ++i)
+  {
+    for(int c = 0; c < 3; ++c)
+    {
+      EXPECT_EQ(arr(i, c), -1.0);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(core_tuple_array, tuple_proxy)
+{
+  axom::TupleArray<int, 4, axom::layout::AoSoA<8>> arr(20);
+
+  const int tuple[4] = {1, 2, 3, 4};
+  arr[13].store(tuple);
+  EXPECT_EQ(arr(13, 0), 1);
+  EXPECT_EQ(arr(13, 3), 4);
+
+  arr[13][2] = 30;
+  EXPECT_EQ(arr(13, 2), 30);
+  EXPECT_EQ(arr[13].size(), 4);
+
+  const axom::TupleArray<int, 4, axom::layout::AoSoA<8>>& const_arr = arr;
+  axom::StackArray<int, 4> copy = const_arr[13];
+  EXPECT_EQ(copy[0], 1);
+  EXPECT_EQ(copy[1], 2);
+  EXPECT_EQ(copy[2], 30);
+  EXPECT_EQ(copy[3], 4);
+
+  int loaded[4];
+  const_arr.view().load(13, loaded);
+  EXPECT_EQ(loaded[2], 30);
+}
+
+//------------------------------------------------------------------------------
+TEST(core_tuple_array, append_and_move)
+{
+  axom::TupleArray<double, 3, axom::layout::AoSoA<4>> arr;
+  constexpr axom::IndexType N = 101;
+  for(axom::IndexType i = 0; i < N; ++i)
+  {
+    const double tuple[3] = {tuple_value(i, 0),
+                             tuple_value(i, 1),
+                             tuple_value(i, 2)};
+    arr.append(tuple);
+    EXPECT_EQ(arr.size(), i + 1);
+  }
+  EXPECT_GE(arr.capacity(), N);
+  check_tuple_values(arr);
+
+  const double* data = arr.getData();
+  axom::TupleArray<double, 3, axom::layout::AoSoA<4>> moved(std::move(arr));
+  EXPECT_EQ(moved.size(), N);
+  EXPECT_EQ(moved.getData(), data);
+  EXPECT_EQ(arr.size(), 0);
+  EXPECT_EQ(arr.getData(), nullptr);
+  check_tuple_values(moved);
+
+  arr = std::move(moved);
+  EXPECT_EQ(arr.size(), N);
+  EXPECT_EQ(arr.getData(), data);
+  check_tuple_values(arr);
+}
+
+//------------------------------------------------------------------------------
+TEST(core_tuple_array, all_layouts)
+{
+  check_tuple_array_layout<axom::SEQ_EXEC, axom::layout::SoA>();
+  check_tuple_array_layout<axom::SEQ_EXEC, axom::layout::AoS>();
+  check_tuple_array_layout<axom::SEQ_EXEC, axom::layout::AoSoA<8>>();
+#ifdef AXOM_USE_OPENMP
+  check_tuple_array_layout<axom::OMP_EXEC, axom::layout::SoA>();
+  check_tuple_array_layout<axom::OMP_EXEC, axom::layout::AoSoA<8>>();
+#endif
+}
+
+//------------------------------------------------------------------------------
+TEST(core_tuple_array, array_adaptor)
+{
+  // a view of the interleaved tuples of an Array, without copying them
+  constexpr axom::IndexType N = 50;
+  axom::Array<double> arr(N, 3);
+  set_tuples<axom::SEQ_EXEC>(axom::make_tuple_view<3>(arr));
+
+  for(axom::IndexType i = 0; i < N; ++i)
+  {
+    for(int c = 0; c < 3; ++c)
+    {
+      EXPECT_DOUBLE_EQ(arr(i, c), tuple_value(i, c));
+    }
+  }
+
+  const axom::Array<double>& const_arr = arr;
+  axom::TupleView<const double, 3, axom::layout::AoS> view =
+    axom::make_tuple_view<3>(const_arr);
+  EXPECT_EQ(view.size(), N);
+  EXPECT_EQ(&view(0, 0), arr.getData());
+
+  double sums[N];
+  sum_tuples<axom::SEQ_EXEC>(view, sums);
+  for(axom::IndexType i = 0; i < N; ++i)
+  {
+    EXPECT_DOUBLE_EQ(sums[i], 30.0 * i + 3.0);
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(core_tuple_array, soa_view_of_arrays)
+{
+  // a view of separate component arrays, e.g., mesh coordinates
+  constexpr axom::IndexType N = 8;
+  double x[N], y[N], z[N];
+  axom::TupleView<double, 3> view({{x, y, z}}, N);
+  set_tuples<axom::SEQ_EXEC>(view);
+
+  EXPECT_EQ(view.getComponent(1), y);
+  for(axom::IndexType i = 0; i < N; ++i)
+  {
+    EXPECT_DOUBLE_EQ(x[i], tuple_value(i, 0));
+    EXPECT_DOUBLE_EQ(y[i], tuple_value(i, 1));
+    EXPECT_DOUBLE_EQ(z[i], tuple_value(i, 2));
+  }
+
+  // a non-const view converts to a const view
+  axom::TupleView<const double, 3> const_view = view;
+  EXPECT_DOUBLE_EQ(const_view(3, 2), tuple_value(3, 2));
+}
@@ -0,0 +1,294 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "gtest/gtest.h"
+
+#include "axom/config.hpp"
+#include "axom/core/execution/execution_space.hpp"
+#include "axom/core/memory_management.hpp"
+#include "axom/core/numerics/Determinants.hpp"
+#include "axom/core/numerics/Matrix.hpp"
+#include "axom/core/numerics/batched_linear_algebra.hpp"
+#include "axom/core/numerics/jacobi_eigensolve.hpp"
+#include "axom/core/numerics/linear_solve.hpp"
+
+// C/C++ includes
+#include <random>  // for std::mt19937
+
+//------------------------------------------------------------------------------
+// HELPER METHODS
+//------------------------------------------------------------------------------
+namespace
+{
+constexpr int BATCH_SIZE = 257;
+
+// Fills a batch of n NxN random matrices, in structure-of-arrays layout. The
+// matrices are diagonally dominant, or symmetric, if requested.
+template <int N>
+void fill_random_batch(double* A, int n, bool symmetric)
+{
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(-1., 1.);
+
+  for(int k = 0; k < n; ++k)
+  {
+    for(int i = 0; i < N; ++i)
+    {
+      for(int j = 0; j < N; ++j)
+      {
+        A[(i * N + j) * n + k] = dist(gen);
+      }
+      if(!symmetric)
+      {
+        A[(i * N + i) * n + k] += (i % 2 == 0) ? N : -N;
+      }
+    }
+
+    if(symmetric)
+    {
+      for(int i = 0; i < N; ++i)
+      {
+        for(int j = 0; j < i; ++j)
+        {
+          A[(i * N + j) * n + k] = A[(j * N + i) * n + k];
+        }
+      }
+    }
+  }
+}
+
+// Returns matrix k of the batch, as a numerics::Matrix
+template <int N>
+axom::numerics::Matrix<double> get_batch_matrix(const double* A, int n, int k)
+{
+  axom::numerics::Matrix<double> M(N, N);
+  for(int i = 0; i < N; ++i)
+  {
+    for(int j = 0; j < N; ++j)
+    {
+      M(i, j) = A[(i * N + j) * n + k];
+    }
+  }
+  return M;
+}
+
+//------------------------------------------------------------------------------
+template <int N, typename ExecSpace>
+void check_batched_determinant()
+{
+  const int n = BATCH_SIZE;
+  double* A = axom::allocate<double>(N * N * n);
+  double* det = axom::allocate<double>(n);
+  fill_random_batch<N>(A, n, false);
+
+  axom::numerics::batched_determinant<N, ExecSpace>(A, det, n);
+
+  for(int k = 0; k < n; ++k)
+  {
+    const double expected =
+      axom::numerics::determinant(get_batch_matrix<N>(A, n, k));
+    EXPECT_NEAR(det[k], expected, 1.e-12 * std::abs(expected));
+  }
+
+  axom::deallocate(A);
+  axom::deallocate(det);
+}
+
+//------------------------------------------------------------------------------
+template <int N, typename ExecSpace>
+void check_batched_linear_solve()
+{
+  const int n = BATCH_SIZE;
+  double* A = axom::allocate<double>(N * N * n);
+  double* b = axom::allocate<double>(N * n);
+  double* x = axom::allocate<double>(N * n);
+  double* y = axom::allocate<double>(N * n);
+  int* pivots = axom::allocate<int>(N * n);
+  int* status = axom::allocate<int>(n);
+  fill_random_batch<N>(A, n, false);
+  for(int i = 0; i < N * n; ++i)
+  {
+    b[i] = static_cast<double>(i % 7) - 3.;
+  }
+
+  // make the last matrix singular
+  for(int j = 0; j < N; ++j)
+  {
+    A[(1 * N + j) * n + (n - 1)] = A[(0 * N + j) * n + (n - 1)];
+  }
+
+  axom::numerics::batched_linear_solve<N, ExecSpace>(A, b, x, status, n);
+
+  for(int k = 0; k < n - 1; ++k)
+  {
+    EXPECT_EQ(status[k], axom::numerics::LU_SUCCESS);
+
+    axom::numerics::Matrix<double> M = get_batch_matrix<N>(A, n, k);
+    double bk[N];
+    double xk[N];
+    for(int i = 0; i < N; ++i)
+    {
+      bk[i] = b[i * n + k];
+    }
+    EXPECT_EQ(axom::numerics::linear_solve(M, bk, xk), 0);
+
+    for(int i = 0; i < N; ++i)
+    {
+      EXPECT_NEAR(x[i * n + k], xk[i], 1.e-12);
+    }
+  }
+  EXPECT_EQ(status[n - 1], axom::numerics::LU_SINGULAR_MATRIX);
+
+  // decompose once and solve, which must agree with the linear solve
+  axom::numerics::batched_lu_decompose<N, ExecSpace>(A, pivots, status, n);
+  axom::numerics::batched_lu_solve<N, ExecSpace>(A, pivots, b, y, n);
+
+  for(int k = 0; k < n - 1; ++k)
+  {
+    EXPECT_EQ(status[k], axom::numerics::LU_SUCCESS);
+    for(int i = 0; i < N; ++i)
+    {
+      EXPECT_DOUBLE_EQ(y[i * n + k], x[i * n + k]);
+    }
+  }
+  EXPECT_EQ(status[n - 1], axom::numerics::LU_SINGULAR_MATRIX);
+
+  axom::deallocate(A);
+  axom::deallocate(b);
+  axom::deallocate(x);
+  axom::deallocate(y);
+  axom::deallocate(pivots);
+  axom::deallocate(status);
+}
+
+//------------------------------------------------------------------------------
+template <int N, typename ExecSpace>
+void check_batched_symmetric_eigensolve()
+{
+  const int n = BATCH_SIZE;
+  double* A = axom::allocate<double>(N * N * n);
+  double* V = axom::allocate<double>(N * N * n);
+  double* lambdas = axom::allocate<double>(N * n);
+  int* status = axom::allocate<int>(n);
+  fill_random_batch<N>(A, n, true);
+
+  axom::numerics::batched_symmetric_eigensolve<N, ExecSpace>(A,
+                                                            lambdas,
+                                                            V,
+                                                            status,
+                                                            n);
+
+  for(int k = 0; k < n; ++k)
+  {
+    EXPECT_EQ(status[k], axom::numerics::JACOBI_EIGENSOLVE_SUCCESS);
+
+    // compare the eigenvalues against the per-matrix Jacobi solver
+    axom::numerics::Matrix<double> M = get_batch_matrix<N>(A, n, k);
+    axom::numerics::Matrix<double> Vk(N, N);
+    double expected[N];
+    axom::numerics::jacobi_eigensolve(M, Vk, expected);
+
+    for(int i = 0; i < N; ++i)
+    {
+      EXPECT_NEAR(lambdas[i * n + k], expected[i], 1.e-10);
+      if(i > 0)
+      {
+        EXPECT_LE(lambdas[(i - 1) * n + k], lambdas[i * n + k]);
+      }
+    }
+
+    // check A v = lambda v for each eigenvector
+    for(int j = 0; j < N; ++j)
+    {
+      const double lambda = lambdas[j * n + k];
+      for(int i = 0; i < N; ++i)
+      {
+        double Av = 0.;
+        for(int l = 0; l < N; ++l)
+        {
+          Av += M(i, l) * V[(l * N + j) * n + k];
+        }
+        EXPECT_NEAR(Av, lambda * V[(i * N + j) * n + k], 1.e-10);
+      }
+    }
+  }
+
+  axom::deallocate(A);
+  axom::deallocate(V);
+  axom::deallocate(lambdas);
+  axom::deallocate(status);
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void check_batched_linear_algebra()
+{
+  std::cout << "checking batched linear algebra with ["
+            << axom::execution_space<ExecSpace>::name() << "]\n";
+
+  const int currentAllocatorID = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  check_batched_determinant<2, ExecSpace>();
+  check_batched_determinant<3, ExecSpace>();
+  check_batched_determinant<4, ExecSpace>();
+
+  check_batched_linear_solve<2, ExecSpace>();
+  check_batched_linear_solve<3, ExecSpace>();
+  check_batched_linear_solve<4, ExecSpace>();
+
+  check_batched_symmetric_eigensolve<2, ExecSpace>();
+  check_batched_symmetric_eigensolve<3, ExecSpace>();
+  check_batched_symmetric_eigensolve<4, ExecSpace>();
+
+  axom::setDefaultAllocator(currentAllocatorID);
+}
+
+} /* end anonymous namespace */
+
+//------------------------------------------------------------------------------
+// UNIT TESTS
+//------------------------------------------------------------------------------
+TEST(numerics_batched_linear_algebra, seq_exec)
+{
+  check_batched_linear_algebra<axom::SEQ_EXEC>();
+}
+
+//------------------------------------------------------------------------------
+TEST(numerics_batched_linear_algebra, thread_exec)
+{
+  check_batched_linear_algebra<axom::THREAD_EXEC<>>();
+}
+
+//------------------------------------------------------------------------------
+#ifdef AXOM_USE_OPENMP
+TEST(numerics_batched_linear_algebra, omp_exec)
+{
+  check_batched_linear_algebra<axom::OMP_EXEC>();
+}
+#endif
+
+//------------------------------------------------------------------------------
+TEST(numerics_batched_linear_algebra, diagonal_eigensolve)
+{
+  // a diagonal matrix converges immediately, with sorted eigenvalues
+  constexpr int N = 3;
+  const double A[N * N] = {3., 0., 0., 0., -1., 0., 0., 0., 2.};
+  double lambdas[N];
+  double V[N * N];
+  int status = -1;
+
+  axom::numerics::batched_symmetric_eigensolve<N>(A, lambdas, V, &status, 1);
+
+  EXPECT_EQ(status, axom::numerics::JACOBI_EIGENSOLVE_SUCCESS);
+  EXPECT_DOUBLE_EQ(lambdas[0], -1.);
+  EXPECT_DOUBLE_EQ(lambdas[1], 2.);
+  EXPECT_DOUBLE_EQ(lambdas[2], 3.);
+
+  // the eigenvector of -1 is e_1, i.e., the second column of the identity
+  EXPECT_DOUBLE_EQ(std::abs(V[1 * N + 0]), 1.);
+  EXPECT_DOUBLE_EQ(std::abs(V[2 * N + 1]), 1.);
+  EXPECT_DOUBLE_EQ(std::abs(V[0 * N + 2]), 1.);
+}
@@ -0,0 +1,179 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "gtest/gtest.h"
+
+#include "axom/config.hpp"
+#include "axom/core/execution/execution_space.hpp"
+#include "axom/core/memory_management.hpp"
+#include "axom/core/numerics/batched_polynomial_solvers.hpp"
+#include "axom/core/numerics/polynomial_solvers.hpp"
+
+// C/C++ includes
+#include <algorithm>  // for std::sort
+#include <random>     // for std::mt19937
+
+//------------------------------------------------------------------------------
+// HELPER METHODS
+//------------------------------------------------------------------------------
+namespace
+{
+constexpr int NUM_POLYNOMIALS = 513;
+
+using PointwiseSolver = int (*)(const double*, double*, int&);
+using BatchedSolver =
+  void (*)(const double*, double*, int*, int*, axom::IndexType);
+
+// Fills a batch of n polynomials of the given degree, in structure-of-arrays
+// layout. The first polynomials exercise the degenerate cases, i.e., vanishing
+// leading coefficients and repeated roots, the rest are random.
+template <int DEGREE>
+void fill_polynomial_batch(double* coeff, int n)
+{
+  // clang-format off
+  const double special[][4] = {
+    {0., 0., 0., 0.},     // all zero: infinitely many solutions
+    {1., 0., 0., 0.},     // inconsistent
+    {-2., 1., 0., 0.},    // linear
+    {1., -2., 1., 0.},    // quadratic, repeated root
+    {1., 0., 1., 0.},     // quadratic, no real roots
+    {-6., 11., -6., 1.},  // cubic, roots 1, 2, 3
+    {-4., 8., -5., 1.},   // cubic, roots 1, 2, 2
+    {-1., 3., -3., 1.},   // cubic, roots 1, 1, 1
+    {1., 1., 1., 1.}      // cubic, one real root
+  };
+  // clang-format on
+  const int numSpecial = sizeof(special) / sizeof(special[0]);
+
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(-10., 10.);
+
+  for(int k = 0; k < n; ++k)
+  {
+    for(int i = 0; i <= DEGREE; ++i)
+    {
+      coeff[i * n + k] = (k < numSpecial) ? special[k][i] : dist(gen);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+template <int DEGREE>
+void check_batched_polynomial_solver(BatchedSolver batched_solve,
+                                     PointwiseSolver pointwise_solve)
+{
+  const int n = NUM_POLYNOMIALS;
+  double* coeff = axom::allocate<double>((DEGREE + 1) * n);
+  double* roots = axom::allocate<double>(DEGREE * n);
+  int* numRoots = axom::allocate<int>(n);
+  int* status = axom::allocate<int>(n);
+  fill_polynomial_batch<DEGREE>(coeff, n);
+
+  batched_solve(coeff, roots, numRoots, status, n);
+
+  for(int k = 0; k < n; ++k)
+  {
+    double c[4] = {0., 0., 0., 0.};
+    for(int i = 0; i <= DEGREE; ++i)
+    {
+      c[i] = coeff[i * n + k];
+    }
+
+    double expected[3] = {0., 0., 0.};
+    int expectedNumRoots = 0;
+    const int rc = pointwise_solve(c, expected, expectedNumRoots);
+
+    // the batched solvers classify and compute the roots identically
+    EXPECT_EQ(status[k], rc);
+    EXPECT_EQ(numRoots[k], expectedNumRoots);
+    for(int j = 0; j < expectedNumRoots; ++j)
+    {
+      EXPECT_DOUBLE_EQ(roots[j * n + k], expected[j]);
+    }
+  }
+
+  // the status buffer is optional
+  batched_solve(coeff, roots, numRoots, nullptr, n);
+  EXPECT_EQ(numRoots[0], -1);
+
+  axom::deallocate(coeff);
+  axom::deallocate(roots);
+  axom::deallocate(numRoots);
+  axom::deallocate(status);
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void check_batched_polynomial_solvers()
+{
+  std::cout << "checking batched polynomial solvers with ["
+            << axom::execution_space<ExecSpace>::name() << "]\n";
+
+  const int currentAllocatorID = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  check_batched_polynomial_solver<1>(
+    axom::numerics::batched_solve_linear<ExecSpace>,
+    axom::numerics::solve_linear);
+  check_batched_polynomial_solver<2>(
+    axom::numerics::batched_solve_quadratic<ExecSpace>,
+    axom::numerics::solve_quadratic);
+  check_batched_polynomial_solver<3>(
+    axom::numerics::batched_solve_cubic<ExecSpace>,
+    axom::numerics::solve_cubic);
+
+  axom::setDefaultAllocator(currentAllocatorID);
+}
+
+} /* end anonymous namespace */
+
+//------------------------------------------------------------------------------
+// UNIT TESTS
+//------------------------------------------------------------------------------
+TEST(numerics_batched_polynomial_solvers, seq_exec)
+{
+  check_batched_polynomial_solvers<axom::SEQ_EXEC>();
+}
+
+//------------------------------------------------------------------------------
+TEST(numerics_batched_polynomial_solvers, thread_exec)
+{
+  check_batched_polynomial_solvers<axom::THREAD_EXEC<>>();
+}
+
+//------------------------------------------------------------------------------
+#ifdef AXOM_USE_OPENMP
+TEST(numerics_batched_polynomial_solvers, omp_exec)
+{
+  check_batched_polynomial_solvers<axom::OMP_EXEC>();
+}
+#endif
+
+//------------------------------------------------------------------------------
+TEST(numerics_batched_polynomial_solvers, cubic_roots)
+{
+  // (x-1)(x-2)(x-3) and (x+1)(x-2)(x-2), in structure-of-arrays layout
+  const int n = 2;
+  const double coeff[4 * n] = {-6., 4., 11., 0., -6., -3., 1., 1.};
+  double roots[3 * n];
+  int numRoots[n];
+  int status[n];
+
+  axom::numerics::batched_solve_cubic(coeff, roots, numRoots, status, n);
+
+  EXPECT_EQ(status[0], 0);
+  EXPECT_EQ(numRoots[0], 3);
+  EXPECT_EQ(status[1], 0);
+  EXPECT_EQ(numRoots[1], 2);
+
+  double found[3] = {roots[0], roots[n], roots[2 * n]};
+  std::sort(found, found + 3);
+  EXPECT_NEAR(found[0], 1., 1.e-12);
+  EXPECT_NEAR(found[1], 2., 1.e-12);
+  EXPECT_NEAR(found[2], 3., 1.e-12);
+
+  EXPECT_NEAR(roots[1], -1., 1.e-6);
+  EXPECT_NEAR(roots[n + 1], 2., 1.e-6);
+}
@@ -0,0 +1,273 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "gtest/gtest.h"
+
+#include "axom/core/numerics/Determinants.hpp"
+#include "axom/core/numerics/LU.hpp"
+#include "axom/core/numerics/Matrix.hpp"
+#include "axom/core/numerics/StackMatrix.hpp"
+#include "axom/core/numerics/jacobi_eigensolve.hpp"
+#include "axom/core/numerics/linear_solve.hpp"
+#include "axom/core/numerics/matvecops.hpp"
+
+// C/C++ includes
+#include <sstream>      // for std::ostringstream
+#include <type_traits>  // for std::is_trivially_copyable
+
+namespace numerics = axom::numerics;
+
+//-----------------------------------------------------------------------------
+// HELPER ROUTINES
+//-----------------------------------------------------------------------------
+namespace
+{
+// Returns a diagonally dominant N x N StackMatrix with distinct entries
+template <int N>
+numerics::StackMatrix<double, N> make_stack_matrix()
+{
+  numerics::StackMatrix<double, N> A;
+  for(int i = 0; i < N; ++i)
+  {
+    for(int j = 0; j < N; ++j)
+    {
+      A(i, j) = (i == j) ? 2. * N : 1. / (1. + i + 2. * j);
+    }
+  }
+  return A;
+}
+
+// Copies a StackMatrix into a Matrix
+template <int M, int N>
+numerics::Matrix<double> to_matrix(const numerics::StackMatrix<double, M, N>& A)
+{
+  numerics::Matrix<double> B(M, N);
+  for(int i = 0; i < M; ++i)
+  {
+    for(int j = 0; j < N; ++j)
+    {
+      B(i, j) = A(i, j);
+    }
+  }
+  return B;
+}
+
+template <int N>
+void check_stack_determinant()
+{
+  numerics::StackMatrix<double, N> A = make_stack_matrix<N>();
+  const double expected = numerics::determinant(to_matrix(A));
+  EXPECT_NEAR(numerics::determinant(A), expected, 1.e-12 * std::abs(expected));
+}
+
+template <int N>
+void check_stack_linear_solve()
+{
+  numerics::StackMatrix<double, N> A = make_stack_matrix<N>();
+  double b[N];
+  for(int i = 0; i < N; ++i)
+  {
+    b[i] = i + 1.;
+  }
+
+  numerics::Matrix<double> B = to_matrix(A);
+  double expected[N];
+  EXPECT_EQ(numerics::linear_solve(B, b, expected), 0);
+
+  double x[N];
+  EXPECT_EQ(numerics::linear_solve(A, b, x), 0);
+  for(int i = 0; i < N; ++i)
+  {
+    EXPECT_NEAR(x[i], expected[i], 1.e-12);
+  }
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+// UNIT TESTS
+//------------------------------------------------------------------------------
+TEST(numerics_stack_matrix, construction)
+{
+  using Matrix23 = numerics::StackMatrix<double, 2, 3>;
+
+  EXPECT_TRUE((std::is_trivially_copyable<Matrix23>::value));
+  EXPECT_EQ(sizeof(Matrix23), 6 * sizeof(double));
+  EXPECT_EQ(Matrix23::getNumRows(), 2);
+  EXPECT_EQ(Matrix23::getNumColumns(), 3);
+  EXPECT_FALSE(Matrix23::isSquare());
+  EXPECT_EQ(Matrix23::getDiagonalSize(), 2);
+
+  // the entries are initialized in column-major order
+  constexpr Matrix23 A {{1., 2., 3., 4., 5., 6.}};
+  static_assert(A(0, 1) == 3., "A(0,1) is a constant expression");
+  EXPECT_EQ(A(1, 0), 2.);
+  EXPECT_EQ(A(1, 2), 6.);
+  EXPECT_EQ(A.getColumn(1)[1], 4.);
+  EXPECT_EQ(A.data()[4], 5.);
+
+  const auto I = numerics::StackMatrix<double, 3>::identity();
+  const auto Z = Matrix23::zeros();
+  const auto O = Matrix23::ones();
+  for(int i = 0; i < 3; ++i)
+  {
+    for(int j = 0; j < 3; ++j)
+    {
+      EXPECT_EQ(I(i, j), (i == j) ? 1. : 0.);
+    }
+  }
+  for(int i = 0; i < 6; ++i)
+  {
+    EXPECT_EQ(Z.data()[i], 0.);
+    EXPECT_EQ(O.data()[i], 1.);
+  }
+
+  std::ostringstream oss;
+  oss << A;
+  EXPECT_EQ(oss.str(), "[ 1 3 5 ]\n[ 2 4 6 ]\n");
+}
+
+//------------------------------------------------------------------------------
+TEST(numerics_stack_matrix, swap_rows_and_columns)
+{
+  numerics::StackMatrix<int, 2, 3> A {{1, 2, 3, 4, 5, 6}};
+
+  A.swapRows(0, 1);
+  EXPECT_EQ(A(0, 0), 2);
+  EXPECT_EQ(A(1, 2), 5);
+
+  A.swapColumns(0, 2);
+  EXPECT_EQ(A(0, 0), 6);
+  EXPECT_EQ(A(1, 2), 1);
+
+  A.fillDiagonal(0);
+  EXPECT_EQ(A(0, 0), 0);
+  EXPECT_EQ(A(1, 1), 0);
+  EXPECT_EQ(A(0, 1), 4);
+}
+
+//------------------------------------------------------------------------------
+TEST(numerics_stack_matrix, matvecops)
+{
+  constexpr numerics::StackMatrix<double, 2, 3> A {{1., 2., 3., 4., 5., 6.}};
+  constexpr numerics::StackMatrix<double, 3, 2> B {{1., 0., 2., -1., 3., 1.}};
+
+  numerics::StackMatrix<double, 2, 2> C;
+  EXPECT_TRUE(numerics::matrix_multiply(A, B, C));
+
+  numerics::Matrix<double> expected(2, 2);
+  numerics::matrix_multiply(to_matrix(A), to_matrix(B), expected);
+  for(int i = 0; i < 2; ++i)
+  {
+    for(int j = 0; j < 2; ++j)
+    {
+      EXPECT_DOUBLE_EQ(C(i, j), expected(i, j));
+    }
+  }
+
+  numerics::StackMatrix<double, 3, 2> AT;
+  EXPECT_TRUE(numerics::matrix_transpose(A, AT));
+  numerics::StackMatrix<double, 3, 2> S;
+  EXPECT_TRUE(numerics::matrix_add(AT, B, S));
+  EXPECT_DOUBLE_EQ(S(2, 0), A(0, 2) + B(2, 0));
+  EXPECT_TRUE(numerics::matrix_subtract(S, B, S));
+  EXPECT_DOUBLE_EQ(S(2, 1), A(1, 2));
+
+  numerics::matrix_scalar_multiply(S, 2.);
+  EXPECT_DOUBLE_EQ(S(1, 0), 2. * A(0, 1));
+
+  const double x[3] = {1., -1., 2.};
+  double y[2];
+  numerics::matrix_vector_multiply(A, x, y);
+  EXPECT_DOUBLE_EQ(y[0], 1. - 3. + 10.);
+  EXPECT_DOUBLE_EQ(y[1], 2. - 4. + 12.);
+
+  const numerics::Matrix<double> Am = to_matrix(A);
+  EXPECT_DOUBLE_EQ(numerics::matrix_norm(A, numerics::P1_NORM),
+                   numerics::matrix_norm(Am, numerics::P1_NORM));
+  EXPECT_DOUBLE_EQ(numerics::matrix_norm(A, numerics::INF_NORM),
+                   numerics::matrix_norm(Am, numerics::INF_NORM));
+  EXPECT_DOUBLE_EQ(numerics::matrix_norm(A, numerics::FROBENIUS_NORM),
+                   numerics::matrix_norm(Am, numerics::FROBENIUS_NORM));
+}
+
+//------------------------------------------------------------------------------
+TEST(numerics_stack_matrix, determinant)
+{
+  check_stack_determinant<1>();
+  check_stack_determinant<2>();
+  check_stack_determinant<3>();
+  check_stack_determinant<4>();
+  check_stack_determinant<6>();
+
+  // singular matrix
+  EXPECT_EQ(numerics::determinant(numerics::StackMatrix<double, 5>::ones()),
+            0.);
+}
+
+//------------------------------------------------------------------------------
+TEST(numerics_stack_matrix, lu_and_linear_solve)
+{
+  check_stack_linear_solve<2>();
+  check_stack_linear_solve<3>();
+  check_stack_linear_solve<5>();
+
+  numerics::StackMatrix<double, 3> A = make_stack_matrix<3>();
+  numerics::StackMatrix<double, 3> LU = A;
+  int pivots[3];
+  EXPECT_EQ(numerics::lu_decompose(LU, pivots), numerics::LU_SUCCESS);
+
+  const double b[3] = {1., 2., 3.};
+  double x[3];
+  EXPECT_EQ(numerics::lu_solve(LU, pivots, b, x), numerics::LU_SUCCESS);
+
+  double Ax[3];
+  numerics::matrix_vector_multiply(A, x, Ax);
+  for(int i = 0; i < 3; ++i)
+  {
+    EXPECT_NEAR(Ax[i], b[i], 1.e-12);
+  }
+
+  auto Z = numerics::StackMatrix<double, 3>::zeros();
+  EXPECT_EQ(numerics::lu_decompose(Z, pivots), numerics::LU_SINGULAR_MATRIX);
+}
+
+//------------------------------------------------------------------------------
+TEST(numerics_stack_matrix, jacobi_eigensolve)
+{
+  constexpr int N = 3;
+  numerics::StackMatrix<double, N> A {{2., -1., 0., -1., 2., -1., 0., -1., 2.}};
+
+  numerics::StackMatrix<double, N> V;
+  double lambdas[N];
+  int numIterations = 0;
+  EXPECT_EQ(numerics::jacobi_eigensolve(A, V, lambdas, 20, &numIterations),
+            numerics::JACOBI_EIGENSOLVE_SUCCESS);
+  EXPECT_GT(numIterations, 0);
+
+  // compare against the Matrix implementation
+  numerics::Matrix<double> Vm(N, N);
+  double expected[N];
+  numerics::jacobi_eigensolve(to_matrix(A), Vm, expected);
+  for(int i = 0; i < N; ++i)
+  {
+    EXPECT_NEAR(lambdas[i], expected[i], 1.e-12);
+    for(int j = 0; j < N; ++j)
+    {
+      EXPECT_NEAR(V(i, j), Vm(i, j), 1.e-12);
+    }
+  }
+
+  // eigen_sort on a reversed order
+  double reversed[N] = {lambdas[2], lambdas[1], lambdas[0]};
+  numerics::StackMatrix<double, N> W = V;
+  W.swapColumns(0, 2);
+  EXPECT_TRUE(numerics::eigen_sort(reversed, W));
+  for(int i = 0; i < N; ++i)
+  {
+    EXPECT_DOUBLE_EQ(reversed[i], lambdas[i]);
+    EXPECT_DOUBLE_EQ(W(i, 0), V(i, 0));
+  }
+}
@@ -0,0 +1,236 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "gtest/gtest.h"
+
+#include "axom/config.hpp"
+#include "axom/core/execution/execution_space.hpp"
+#include "axom/core/execution/for_all.hpp"
+#include "axom/core/memory_management.hpp"
+#include "axom/core/utilities/Philox.hpp"
+
+// C/C++ includes
+#include <cmath>    // for std::sqrt()
+#include <cstdint>  // for std::uint32_t
+#include <vector>   // for std::vector
+
+//------------------------------------------------------------------------------
+// HELPER METHODS
+//------------------------------------------------------------------------------
+namespace
+{
+constexpr std::uint64_t PHILOX_SEED = 20201018;
+constexpr int NUM_SAMPLES = 1 << 16;
+
+// Fills x with numbers from per-index streams in the given execution space
+template <typename ExecSpace>
+void fill_per_index_streams(double* x, int n)
+{
+  axom::for_all<ExecSpace>(
+    n,
+    AXOM_LAMBDA(axom::IndexType i) {
+      axom::utilities::Philox rng(PHILOX_SEED, i);
+      const double u = rng.uniform();
+      const double z = rng.normal();
+      x[i] = u + z;
+    });
+}
+
+template <typename ExecSpace>
+void check_philox_reproducibility(const std::vector<double>& uniform,
+                                  const std::vector<double>& normal,
+                                  const std::vector<double>& streams)
+{
+  std::cout << "checking Philox reproducibility with ["
+            << axom::execution_space<ExecSpace>::name() << "]\n";
+
+  const int currentAllocatorID = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  const int n = static_cast<int>(uniform.size());
+  double* x = axom::allocate<double>(n);
+
+  // the results are bitwise identical to the sequential ones
+  axom::utilities::fill_uniform<ExecSpace>(x, n, PHILOX_SEED, -1., 3.);
+  for(int i = 0; i < n; ++i)
+  {
+    EXPECT_EQ(x[i], uniform[i]);
+  }
+
+  axom::utilities::fill_normal<ExecSpace>(x, n, PHILOX_SEED, 2., 0.5);
+  for(int i = 0; i < n; ++i)
+  {
+    EXPECT_EQ(x[i], normal[i]);
+  }
+
+  fill_per_index_streams<ExecSpace>(x, n);
+  for(int i = 0; i < n; ++i)
+  {
+    EXPECT_EQ(x[i], streams[i]);
+  }
+
+  axom::deallocate(x);
+  axom::setDefaultAllocator(currentAllocatorID);
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+// UNIT TESTS
+//------------------------------------------------------------------------------
+TEST(utils_Philox, known_answers)
+{
+  // known answer tests of Philox4x32-10 from the Random123 library
+  using Philox = axom::utilities::Philox;
+  std::uint32_t block[4];
+
+  {
+    const std::uint32_t counter[4] = {0, 0, 0, 0};
+    const std::uint32_t key[2] = {0, 0};
+    Philox::generateBlock(counter, key, block);
+    EXPECT_EQ(block[0], 0x6627e8d5u);
+    EXPECT_EQ(block[1], 0xe169c58du);
+    EXPECT_EQ(block[2], 0xbc57ac4cu);
+    EXPECT_EQ(block[3], 0x9b00dbd8u);
+  }
+
+  {
+    const std::uint32_t counter[4] = {0xffffffff,
+                                      0xffffffff,
+                                      0xffffffff,
+                                      0xffffffff};
+    const std::uint32_t key[2] = {0xffffffff, 0xffffffff};
+    Philox::generateBlock(counter, key, block);
+    EXPECT_EQ(block[0], 0x408f276du);
+    EXPECT_EQ(block[1], 0x41c83b0eu);
+    EXPECT_EQ(block[2], 0xa20bc7c6u);
+    EXPECT_EQ(block[3], 0x6d5451fdu);
+  }
+
+  {
+    const std::uint32_t counter[4] = {0x243f6a88,
+                                      0x85a308d3,
+                                      0x13198a2e,
+                                      0x03707344};
+    const std::uint32_t key[2] = {0xa4093822, 0x299f31d0};
+    Philox::generateBlock(counter, key, block);
+    EXPECT_EQ(block[0], 0xd16cfe09u);
+    EXPECT_EQ(block[1], 0x94fdccebu);
+    EXPECT_EQ(block[2], 0x5001e420u);
+    EXPECT_EQ(block[3], 0x24126ea1u);
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(utils_Philox, streams)
+{
+  using Philox = axom::utilities::Philox;
+
+  // the stream is given by the seed and the stream id
+  Philox a(PHILOX_SEED, 7);
+  Philox b(PHILOX_SEED, 7);
+  Philox c(PHILOX_SEED, 8);
+  Philox d(PHILOX_SEED + 1, 7);
+
+  int numDifferentC = 0;
+  int numDifferentD = 0;
+  for(int i = 0; i < 100; ++i)
+  {
+    const std::uint32_t x = a.nextUInt32();
+    EXPECT_EQ(x, b.nextUInt32());
+    numDifferentC += (x != c.nextUInt32()) ? 1 : 0;
+    numDifferentD += (x != d.nextUInt32()) ? 1 : 0;
+  }
+  EXPECT_GT(numDifferentC, 90);
+  EXPECT_GT(numDifferentD, 90);
+
+  // the words of a stream are the blocks of consecutive counters
+  Philox e(PHILOX_SEED, 0x0000000500000003);
+  const std::uint32_t key[2] = {static_cast<std::uint32_t>(PHILOX_SEED),
+                                static_cast<std::uint32_t>(PHILOX_SEED >> 32)};
+  std::uint32_t block[4];
+  for(std::uint32_t n = 0; n < 3; ++n)
+  {
+    const std::uint32_t counter[4] = {n, 0, 3, 5};
+    Philox::generateBlock(counter, key, block);
+    for(int j = 0; j < 4; ++j)
+    {
+      EXPECT_EQ(e.nextUInt32(), block[j]);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(utils_Philox, distributions)
+{
+  axom::utilities::Philox rng(PHILOX_SEED);
+
+  double sum = 0.;
+  double sumSquares = 0.;
+  for(int i = 0; i < NUM_SAMPLES; ++i)
+  {
+    const double u = rng.uniform(-2., 6.);
+    EXPECT_GE(u, -2.);
+    EXPECT_LT(u, 6.);
+    sum += u;
+    sumSquares += u * u;
+  }
+
+  // a uniform distribution in [-2,6) has mean 2 and variance 64/12
+  double mean = sum / NUM_SAMPLES;
+  double variance = sumSquares / NUM_SAMPLES - mean * mean;
+  EXPECT_NEAR(mean, 2., 0.05);
+  EXPECT_NEAR(variance, 64. / 12., 0.1);
+
+  sum = 0.;
+  sumSquares = 0.;
+  for(int i = 0; i < NUM_SAMPLES; ++i)
+  {
+    const double z = rng.normal(1., 3.);
+    EXPECT_TRUE(std::isfinite(z));
+    sum += z;
+    sumSquares += z * z;
+  }
+
+  mean = sum / NUM_SAMPLES;
+  variance = sumSquares / NUM_SAMPLES - mean * mean;
+  EXPECT_NEAR(mean, 1., 0.05);
+  EXPECT_NEAR(std::sqrt(variance), 3., 0.05);
+
+  // the extreme values of the underlying bits
+  EXPECT_EQ(axom::utilities::Philox::toUniform(0), 0.);
+  EXPECT_LT(axom::utilities::Philox::toUniform(~std::uint64_t(0)), 1.);
+  EXPECT_TRUE(std::isfinite(axom::utilities::Philox::boxMullerRadius(
+    axom::utilities::Philox::toUniform(~std::uint64_t(0)))));
+}
+
+//------------------------------------------------------------------------------
+TEST(utils_Philox, bulk_fill)
+{
+  using Philox = axom::utilities::Philox;
+  const int n = 1000;
+
+  // entry i is the first number of stream i
+  std::vector<double> uniform(n);
+  std::vector<double> normal(n);
+  std::vector<double> streams(n);
+  axom::utilities::fill_uniform(uniform.data(), n, PHILOX_SEED, -1., 3.);
+  axom::utilities::fill_normal(normal.data(), n, PHILOX_SEED, 2., 0.5);
+  fill_per_index_streams<axom::SEQ_EXEC>(streams.data(), n);
+
+  for(int i = 0; i < n; ++i)
+  {
+    EXPECT_EQ(uniform[i], Philox(PHILOX_SEED, i).uniform(-1., 3.));
+    EXPECT_EQ(normal[i], Philox(PHILOX_SEED, i).normal(2., 0.5));
+  }
+
+  check_philox_reproducibility<axom::SEQ_EXEC>(uniform, normal, streams);
+  check_philox_reproducibility<axom::THREAD_EXEC<>>(uniform, normal, streams);
+#ifdef AXOM_USE_OPENMP
+  check_philox_reproducibility<axom::OMP_EXEC>(uniform, normal, streams);
+  using DynamicExec = axom::OMP_SCHEDULED_EXEC<axom::SCHEDULE_DYNAMIC, 7>;
+  check_philox_reproducibility<DynamicExec>(uniform, normal, streams);
+#endif
+}
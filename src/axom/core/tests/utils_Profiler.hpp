@@ -0,0 +1,372 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "gtest/gtest.h"
+
+#include "axom/config.hpp"
+#include "axom/core/utilities/AnnotationMacros.hpp"
+#include "axom/core/utilities/PerfCounters.hpp"
+#include "axom/core/utilities/Profiler.hpp"
+
+// C/C++ includes
+#include <chrono>   // for std::chrono
+#include <sstream>  // for std::ostringstream
+#include <string>   // for std::string
+#include <thread>   // for std::thread
+#include <vector>   // for std::vector
+
+//------------------------------------------------------------------------------
+// HELPER METHODS
+//------------------------------------------------------------------------------
+namespace
+{
+using axom::utilities::ProfileRegion;
+using axom::utilities::ProfileStats;
+using axom::utilities::Profiler;
+
+/*!
+ * \brief Enables the Profiler, with reset statistics, for the lifetime of the
+ *  object, and disables it afterwards.
+ */
+struct ScopedProfiling
+{
+  ScopedProfiling()
+  {
+    Profiler::instance().reset();
+    Profiler::setEnabled(true);
+  }
+  ~ScopedProfiling() { Profiler::setEnabled(false); }
+};
+
+/*!
+ * \brief Returns the statistics of the region with the given path, or a
+ *  nullptr if there is no such region.
+ */
+const ProfileStats* find_region(const std::vector<ProfileStats>& stats,
+                                const std::string& path)
+{
+  for(const ProfileStats& s : stats)
+  {
+    if(s.path == path)
+    {
+      return &s;
+    }
+  }
+  return nullptr;
+}
+
+void wait_for(int microseconds)
+{
+  std::this_thread::sleep_for(std::chrono::microseconds(microseconds));
+}
+
+void annotated_function(int& value)
+{
+  AXOM_PERF_MARK_FUNCTION("utils_Profiler_function");
+
+  AXOM_PERF_MARK_SECTION("section_A", value += 1;);
+  AXOM_PERF_MARK_SECTION("section_B", value += 2; wait_for(100););
+}
+
+}  // end anonymous namespace
+
+//------------------------------------------------------------------------------
+// UNIT TESTS
+//------------------------------------------------------------------------------
+TEST(utils_Profiler, disabled)
+{
+  Profiler::setEnabled(false);
+  EXPECT_FALSE(Profiler::isEnabled());
+
+  {
+    ProfileRegion region("utils_Profiler_disabled");
+  }
+
+  const std::vector<ProfileStats> stats = Profiler::instance().getStats();
+  EXPECT_EQ(find_region(stats, "utils_Profiler_disabled"), nullptr);
+}
+
+//------------------------------------------------------------------------------
+TEST(utils_Profiler, nested_regions)
+{
+  ScopedProfiling profiling;
+
+  for(int i = 0; i < 3; ++i)
+  {
+    ProfileRegion outer("outer");
+    {
+      ProfileRegion inner("inner");
+      wait_for(1000);
+    }
+    {
+      ProfileRegion other("other");
+    }
+  }
+
+  const std::vector<ProfileStats> stats = Profiler::instance().getStats();
+  const ProfileStats* outer = find_region(stats, "outer");
+  const ProfileStats* inner = find_region(stats, "outer/inner");
+  const ProfileStats* other = find_region(stats, "outer/other");
+  ASSERT_NE(outer, nullptr);
+  ASSERT_NE(inner, nullptr);
+  ASSERT_NE(other, nullptr);
+
+  // depth-first order
+  EXPECT_LT(outer, inner);
+  EXPECT_LT(inner, other);
+
+  EXPECT_EQ(outer->name, "outer");
+  EXPECT_EQ(outer->depth, 0);
+  EXPECT_EQ(inner->name, "inner");
+  EXPECT_EQ(inner->depth, 1);
+
+  EXPECT_EQ(outer->numCalls, 3u);
+  EXPECT_EQ(inner->numCalls, 3u);
+  EXPECT_EQ(other->numCalls, 3u);
+  EXPECT_EQ(outer->numSamples, 1);
+
+  EXPECT_GE(inner->inclusiveTime, 3e-3);
+  EXPECT_GE(outer->inclusiveTime,
+            inner->inclusiveTime + other->inclusiveTime);
+  EXPECT_NEAR(outer->exclusiveTime,
+              outer->inclusiveTime - inner->inclusiveTime -
+                other->inclusiveTime,
+              1e-9);
+  EXPECT_DOUBLE_EQ(inner->exclusiveTime, inner->inclusiveTime);
+  EXPECT_DOUBLE_EQ(outer->minTime, outer->inclusiveTime);
+  EXPECT_DOUBLE_EQ(outer->avgTime, outer->inclusiveTime);
+
+  // resetting clears the calls and the times
+  Profiler::instance().reset();
+  EXPECT_EQ(find_region(Profiler::instance().getStats(), "outer"), nullptr);
+}
+
+//------------------------------------------------------------------------------
+TEST(utils_Profiler, annotation_macros)
+{
+  ScopedProfiling profiling;
+
+  int value = 0;
+  annotated_function(value);
+  annotated_function(value);
+  EXPECT_EQ(value, 6);
+
+  const std::vector<ProfileStats> stats = Profiler::instance().getStats();
+  const ProfileStats* function = find_region(stats, "utils_Profiler_function");
+  ASSERT_NE(function, nullptr);
+  EXPECT_EQ(function->numCalls, 2u);
+
+  for(const char* section : {"section_A", "section_B"})
+  {
+    const ProfileStats* s =
+      find_region(stats, std::string("utils_Profiler_function/") + section);
+    ASSERT_NE(s, nullptr);
+    EXPECT_EQ(s->numCalls, 2u);
+    EXPECT_EQ(s->depth, 1);
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(utils_Profiler, threads)
+{
+  constexpr int NUM_THREADS = 4;
+  constexpr int NUM_CALLS = 10;
+
+  ScopedProfiling profiling;
+
+  std::vector<std::thread> threads;
+  for(int t = 0; t < NUM_THREADS; ++t)
+  {
+    threads.emplace_back([=]() {
+      for(int i = 0; i < NUM_CALLS; ++i)
+      {
+        ProfileRegion region("thread_region");
+        wait_for(100 * (t + 1));
+      }
+    });
+  }
+  for(auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  // the call trees of the threads are merged by path
+  const std::vector<ProfileStats> stats = Profiler::instance().getStats();
+  const ProfileStats* region = find_region(stats, "thread_region");
+  ASSERT_NE(region, nullptr);
+  EXPECT_EQ(region->numCalls, std::uint64_t(NUM_THREADS * NUM_CALLS));
+  EXPECT_EQ(region->numSamples, NUM_THREADS);
+  EXPECT_LE(region->minTime, region->avgTime);
+  EXPECT_LE(region->avgTime, region->maxTime);
+  EXPECT_GE(region->maxTime, NUM_CALLS * 100e-6 * NUM_THREADS);
+  EXPECT_NEAR(region->avgTime * NUM_THREADS, region->inclusiveTime, 1e-9);
+}
+
+//------------------------------------------------------------------------------
+TEST(utils_Profiler, print_and_write_json)
+{
+  ScopedProfiling profiling;
+
+  {
+    ProfileRegion outer("utils_Profiler_report");
+    ProfileRegion inner("a \"quoted\" region");
+  }
+
+  std::ostringstream report;
+  Profiler::instance().print(report);
+  EXPECT_NE(report.str().find("utils_Profiler_report"), std::string::npos);
+  EXPECT_NE(report.str().find("  a \"quoted\" region"), std::string::npos);
+
+  std::ostringstream json;
+  Profiler::instance().writeJSON(json);
+  const std::string str = json.str();
+  EXPECT_EQ(str.front(), '[');
+  EXPECT_NE(str.find("\"path\": \"utils_Profiler_report\""),
+            std::string::npos);
+  EXPECT_NE(
+    str.find("\"path\": \"utils_Profiler_report/a \\\"quoted\\\" region\""),
+    std::string::npos);
+  EXPECT_NE(str.find("\"calls\": 1"), std::string::npos);
+}
+
+//------------------------------------------------------------------------------
+TEST(utils_Profiler, counter_values)
+{
+  axom::utilities::PerfCounterValues zero;
+  EXPECT_EQ(zero.getIPC(), 0.);
+  EXPECT_EQ(zero.getLLCMissesPerKiloInstruction(), 0.);
+  EXPECT_EQ(zero.getBranchMissesPerKiloInstruction(), 0.);
+
+  axom::utilities::PerfCounterValues values;
+  values.cycles = 1000;
+  values.instructions = 2000;
+  values.llcMisses = 4;
+  values.branchMisses = 10;
+  EXPECT_DOUBLE_EQ(values.getIPC(), 2.);
+  EXPECT_DOUBLE_EQ(values.getLLCMissesPerKiloInstruction(), 2.);
+  EXPECT_DOUBLE_EQ(values.getBranchMissesPerKiloInstruction(), 5.);
+
+  axom::utilities::PerfCounterValues sum = values;
+  sum += values;
+  EXPECT_EQ(sum.instructions, 4000u);
+  EXPECT_EQ((sum - values).cycles, values.cycles);
+  EXPECT_EQ((sum - values).branchMisses, values.branchMisses);
+}
+
+//------------------------------------------------------------------------------
+TEST(utils_Profiler, perf_counters)
+{
+  axom::utilities::PerfCounters counters;
+
+  const axom::utilities::PerfCounterValues before = counters.read();
+  volatile double sum = 0.;
+  for(int i = 0; i < 100000; ++i)
+  {
+    sum = sum + i;
+  }
+  const axom::utilities::PerfCounterValues after = counters.read();
+
+  if(!counters.isAvailable())
+  {
+    SUCCEED() << "Hardware counters are unavailable, skipping";
+    EXPECT_EQ(after.cycles, 0u);
+    EXPECT_EQ(after.instructions, 0u);
+    return;
+  }
+
+  EXPECT_GE(after.cycles, before.cycles);
+  EXPECT_GE(after.instructions, before.instructions);
+  EXPECT_GE(after.llcMisses, before.llcMisses);
+  EXPECT_GE(after.branchMisses, before.branchMisses);
+}
+
+//------------------------------------------------------------------------------
+TEST(utils_Profiler, counters_in_regions)
+{
+  ScopedProfiling profiling;
+  Profiler::setCountersEnabled(true);
+
+  {
+    ProfileRegion region("utils_Profiler_counters");
+    volatile double sum = 0.;
+    for(int i = 0; i < 100000; ++i)
+    {
+      sum = sum + i;
+    }
+  }
+
+  Profiler::setCountersEnabled(false);
+
+  const std::vector<ProfileStats> stats = Profiler::instance().getStats();
+  const ProfileStats* region = find_region(stats, "utils_Profiler_counters");
+  ASSERT_NE(region, nullptr);
+  EXPECT_EQ(region->numCalls, 1u);
+
+  // NOTE: the counters are zero if unavailable on this platform
+  axom::utilities::PerfCounters counters;
+  if(counters.isAvailable())
+  {
+    EXPECT_GT(region->counters.cycles + region->counters.instructions, 0u);
+  }
+  else
+  {
+    EXPECT_EQ(region->counters.cycles, 0u);
+    EXPECT_EQ(region->counters.instructions, 0u);
+  }
+
+  std::ostringstream json;
+  Profiler::instance().writeJSON(json);
+  EXPECT_NE(json.str().find("\"ipc\": "), std::string::npos);
+}
+
+//------------------------------------------------------------------------------
+#ifdef AXOM_USE_MPI
+TEST(utils_Profiler, mpi_stats)
+{
+  int initialized = 0;
+  MPI_Initialized(&initialized);
+  if(!initialized)
+  {
+    return;
+  }
+
+  int rank = 0;
+  int numRanks = 1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &numRanks);
+
+  ScopedProfiling profiling;
+
+  // NOTE: region names may contain the separators of the serialized stats
+  const std::string escaped = "mpi\tname\nwith \\escapes";
+  for(int i = 0; i <= rank; ++i)
+  {
+    ProfileRegion outer("mpi_outer");
+    ProfileRegion inner("mpi_inner");
+    ProfileRegion innermost(escaped.c_str());
+  }
+
+  const std::vector<ProfileStats> stats =
+    Profiler::instance().getStats(MPI_COMM_WORLD);
+
+  if(rank != 0)
+  {
+    EXPECT_TRUE(stats.empty());
+    return;
+  }
+
+  const ProfileStats* inner = find_region(stats, "mpi_outer/mpi_inner");
+  ASSERT_NE(inner, nullptr);
+  EXPECT_EQ(inner->numSamples, numRanks);
+  EXPECT_EQ(inner->numCalls, std::uint64_t(numRanks * (numRanks + 1) / 2));
+  EXPECT_LE(inner->minTime, inner->maxTime);
+
+  const ProfileStats* innermost =
+    find_region(stats, "mpi_outer/mpi_inner/" + escaped);
+  ASSERT_NE(innermost, nullptr);
+  EXPECT_EQ(innermost->name, escaped);
+  EXPECT_EQ(innermost->numSamples, numRanks);
+}
+#endif
@@ -7,6 +7,7 @@
 #define AXOM_ANNOTATION_MACROS_HPP_
 
 #include "axom/config.hpp"
+#include "axom/core/utilities/Profiler.hpp"
 
 #ifndef AXOM_USE_CALIPER
   #include "axom/core/utilities/nvtx/interface.hpp"
@@ -21,6 +22,10 @@
  * 
  * \note Typically, the AXOM_PERF_MARK_FUNCTION is placed in the beginning of
  *  the function to annotate.
+ *
+ * \note The function is timed as a region of the axom::utilities::Profiler,
+ *  when profiling is enabled at runtime, and, in addition, is annotated with
+ *  NVTX when Axom is built with annotations and CUDA.
  * 
  * 
  * \warning The AXOM_PERF_MARK_FUNCTION can only be called once within a given
@@ -40,9 +45,11 @@
   #error "Support for Caliper has not yet been implemented in Axom!"
 #elif defined(AXOM_USE_ANNOTATIONS)
   #define AXOM_PERF_MARK_FUNCTION(__func_name__) \
-    AXOM_NVTX_FUNCTION(__func_name__)
+    AXOM_NVTX_FUNCTION(__func_name__);           \
+    axom::utilities::ProfileRegion __func_profile_region(__func_name__)
 #else
-  #define AXOM_PERF_MARK_FUNCTION(__func_name__)
+  #define AXOM_PERF_MARK_FUNCTION(__func_name__) \
+    axom::utilities::ProfileRegion __func_profile_region(__func_name__)
 #endif
 
 /*!
@@ -54,6 +61,9 @@
  *  macro is used to annotate sections of code at a much finer granularity
  *  within a given function and it may be use in conjunction with the 
  *  AXOM_PERF_MARK_FUNCTION macro.
+ *
+ * \note Sections are timed as regions of the axom::utilities::Profiler, as
+ *  children of the region of the enclosing AXOM_PERF_MARK_FUNCTION, if any.
  * 
  * \warning Variables declared within an AXOM_PERF_MARK_SECTION are only defined
  *  within the scope of the annotated section.
@@ -88,13 +98,18 @@
 #if defined(AXOM_USE_ANNOTATIONS) && defined(AXOM_USE_CALIPER)
   #error "Support for Caliper has not yet been implemented in Axom!"
 #elif defined(AXOM_USE_ANNOTATIONS)
-  #define AXOM_PERF_MARK_SECTION(__name__, ...) \
-    AXOM_NVTX_SECTION(__name__, __VA_ARGS__)
+  #define AXOM_PERF_MARK_SECTION(__name__, ...)                  \
+    do                                                           \
+    {                                                            \
+      axom::utilities::ProfileRegion __section_region(__name__); \
+      AXOM_NVTX_SECTION(__name__, __VA_ARGS__);                  \
+    } while(false)
 #else
-  #define AXOM_PERF_MARK_SECTION(__name__, ...) \
-    do                                          \
-    {                                           \
-      __VA_ARGS__                               \
+  #define AXOM_PERF_MARK_SECTION(__name__, ...)                  \
+    do                                                           \
+    {                                                            \
+      axom::utilities::ProfileRegion __section_region(__name__); \
+      __VA_ARGS__                                                \
     } while(false)
 #endif
 
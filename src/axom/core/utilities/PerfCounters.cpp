@@ -0,0 +1,130 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/core/utilities/PerfCounters.hpp"
+
+#ifdef __linux__
+  #include <linux/perf_event.h>  // for perf_event_attr
+  #include <sys/syscall.h>       // for SYS_perf_event_open
+  #include <unistd.h>            // for syscall, read, close
+#endif
+
+// C/C++ includes
+#include <cstring>  // for std::memset
+
+namespace axom
+{
+namespace utilities
+{
+namespace
+{
+#ifdef __linux__
+/// The events of the counters, in the order of the PerfCounterValues fields
+constexpr std::uint64_t EVENTS[] = {PERF_COUNT_HW_CPU_CYCLES,
+                                    PERF_COUNT_HW_INSTRUCTIONS,
+                                    PERF_COUNT_HW_CACHE_MISSES,
+                                    PERF_COUNT_HW_BRANCH_MISSES};
+
+/// Opens a counter of the calling thread, in the group of the given leader
+int openCounter(std::uint64_t event, int leader)
+{
+  perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.config = event;
+  attr.read_format = PERF_FORMAT_GROUP;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+
+  // NOTE: pid == 0 and cpu == -1 count the calling thread on any CPU
+  return static_cast<int>(
+    syscall(SYS_perf_event_open, &attr, 0, -1, leader, PERF_FLAG_FD_CLOEXEC));
+}
+#endif
+
+}  // end anonymous namespace
+
+constexpr int PerfCounters::NUM_COUNTERS;
+
+//------------------------------------------------------------------------------
+PerfCounters::PerfCounters() : m_leader(-1), m_numOpen(0)
+{
+  for(int i = 0; i < NUM_COUNTERS; ++i)
+  {
+    m_fds[i] = -1;
+    m_slots[i] = -1;
+  }
+
+#ifdef __linux__
+  // NOTE: the first counter that opens leads the group
+  for(int i = 0; i < NUM_COUNTERS; ++i)
+  {
+    m_fds[i] = openCounter(EVENTS[i], m_leader);
+    if(m_fds[i] >= 0)
+    {
+      m_slots[i] = m_numOpen++;
+      if(m_leader < 0)
+      {
+        m_leader = m_fds[i];
+      }
+    }
+  }
+#endif
+}
+
+//------------------------------------------------------------------------------
+PerfCounters::~PerfCounters()
+{
+#ifdef __linux__
+  for(int i = 0; i < NUM_COUNTERS; ++i)
+  {
+    if(m_fds[i] >= 0)
+    {
+      close(m_fds[i]);
+    }
+  }
+#endif
+}
+
+//------------------------------------------------------------------------------
+PerfCounterValues PerfCounters::read() const
+{
+  PerfCounterValues values;
+
+#ifdef __linux__
+  if(m_leader < 0)
+  {
+    return values;
+  }
+
+  // NOTE: with PERF_FORMAT_GROUP, the leader reads the number of counters
+  // followed by the value of each counter of the group
+  std::uint64_t buffer[1 + NUM_COUNTERS];
+  const ssize_t expected = (1 + m_numOpen) * sizeof(std::uint64_t);
+  if(::read(m_leader, buffer, sizeof(buffer)) != expected)
+  {
+    return values;
+  }
+
+  std::uint64_t* fields[NUM_COUNTERS] = {&values.cycles,
+                                         &values.instructions,
+                                         &values.llcMisses,
+                                         &values.branchMisses};
+  for(int i = 0; i < NUM_COUNTERS; ++i)
+  {
+    if(m_slots[i] >= 0)
+    {
+      *fields[i] = buffer[1 + m_slots[i]];
+    }
+  }
+#endif
+
+  return values;
+}
+
+} /* namespace utilities */
+
+} /* namespace axom */
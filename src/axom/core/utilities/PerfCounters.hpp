@@ -0,0 +1,135 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_PERFCOUNTERS_HPP_
+#define AXOM_PERFCOUNTERS_HPP_
+
+#include "axom/config.hpp"       // for compile-time definitions
+#include "axom/core/Macros.hpp"  // for DISABLE_COPY_AND_ASSIGNMENT
+
+// C/C++ includes
+#include <cstdint>  // for std::uint64_t
+
+namespace axom
+{
+namespace utilities
+{
+/*!
+ * \brief Values of the hardware performance counters, e.g., the difference
+ *  of two readings of the counters around a region.
+ */
+struct PerfCounterValues
+{
+  std::uint64_t cycles {0};       /*!< CPU cycles */
+  std::uint64_t instructions {0}; /*!< retired instructions */
+  std::uint64_t llcMisses {0};    /*!< last-level cache misses */
+  std::uint64_t branchMisses {0}; /*!< mispredicted branches */
+
+  /// Returns the instructions per cycle, or 0 if no cycles were counted
+  double getIPC() const
+  {
+    return (cycles > 0) ? static_cast<double>(instructions) / cycles : 0.;
+  }
+
+  /// Returns the LLC misses per thousand instructions
+  double getLLCMissesPerKiloInstruction() const
+  {
+    return perKiloInstruction(llcMisses);
+  }
+
+  /// Returns the branch misses per thousand instructions
+  double getBranchMissesPerKiloInstruction() const
+  {
+    return perKiloInstruction(branchMisses);
+  }
+
+  PerfCounterValues& operator+=(const PerfCounterValues& other)
+  {
+    cycles += other.cycles;
+    instructions += other.instructions;
+    llcMisses += other.llcMisses;
+    branchMisses += other.branchMisses;
+    return *this;
+  }
+
+  PerfCounterValues operator-(const PerfCounterValues& other) const
+  {
+    PerfCounterValues diff;
+    diff.cycles = cycles - other.cycles;
+    diff.instructions = instructions - other.instructions;
+    diff.llcMisses = llcMisses - other.llcMisses;
+    diff.branchMisses = branchMisses - other.branchMisses;
+    return diff;
+  }
+
+private:
+  double perKiloInstruction(std::uint64_t count) const
+  {
+    return (instructions > 0) ? 1000. * count / instructions : 0.;
+  }
+};
+
+/*!
+ * \class PerfCounters
+ *
+ * \brief The hardware performance counters of the calling thread.
+ *
+ *  The counters are opened as a single group with the Linux perf_event_open
+ *  system call, hence, they are scheduled together and are read with a single
+ *  read(). Only user-space events of the thread that constructs the object
+ *  are counted.
+ *
+ *  The counters are unavailable on platforms other than Linux, and when
+ *  the kernel does not allow them, e.g., when kernel.perf_event_paranoid is
+ *  too restrictive or in virtual machines without a virtual PMU. Counters
+ *  that the CPU does not support read as 0.
+ *
+ * \note Each reading is a system call, i.e., about a microsecond, hence, the
+ *  counters are meant for regions that are much longer than that.
+ *
+ * \see Profiler::setCountersEnabled()
+ */
+class PerfCounters
+{
+public:
+  /*!
+   * \brief Opens the counters of the calling thread.
+   */
+  PerfCounters();
+
+  /*!
+   * \brief Closes the counters.
+   */
+  ~PerfCounters();
+
+  /*!
+   * \brief Returns true iff at least one of the counters could be opened.
+   */
+  bool isAvailable() const { return m_leader >= 0; }
+
+  /*!
+   * \brief Returns the current values of the counters, which only increase.
+   *
+   * \note Returns zeros if the counters are unavailable.
+   */
+  PerfCounterValues read() const;
+
+private:
+  static constexpr int NUM_COUNTERS = 4;
+
+  int m_leader;               // the file descriptor of the group leader
+  int m_fds[NUM_COUNTERS];    // -1 for the counters that are unavailable
+  int m_slots[NUM_COUNTERS];  // position of each counter in the group
+  int m_numOpen;
+
+  DISABLE_COPY_AND_ASSIGNMENT(PerfCounters);
+  DISABLE_MOVE_AND_ASSIGNMENT(PerfCounters);
+};
+
+} /* namespace utilities */
+
+} /* namespace axom */
+
+#endif /* AXOM_PERFCOUNTERS_HPP_ */
@@ -0,0 +1,322 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_PHILOX_HPP_
+#define AXOM_PHILOX_HPP_
+
+#include "axom/config.hpp"                          // compile-time defs
+#include "axom/core/Macros.hpp"                     // for AXOM_HOST_DEVICE
+#include "axom/core/Types.hpp"                      // for IndexType
+#include "axom/core/execution/execution_space.hpp"  // execution spaces
+#include "axom/core/execution/for_all.hpp"          // for for_all()
+
+// C/C++ includes
+#include <cassert>  // for assert()
+#include <cmath>    // for sqrt(), log(), cos(), sin()
+#include <cstdint>  // for std::uint32_t, std::uint64_t
+
+namespace axom
+{
+namespace utilities
+{
+/*!
+ * \class Philox
+ *
+ * \brief A counter-based pseudo-random number generator, implementing the
+ *  Philox4x32-10 generator of Salmon et al., "Parallel random numbers: as
+ *  easy as 1, 2, 3", SC'11.
+ *
+ *  Philox is a keyed bijection that maps a 128-bit counter to 128 random bits,
+ *  i.e., four 32-bit words. There is no sequential state to advance: the nth
+ *  block of random bits of a stream is computed directly from the seed, the
+ *  stream id and n. Hence, giving each index of a parallel loop its own
+ *  stream, e.g., in axom::for_all(), yields the same numbers regardless of
+ *  the execution space, the number of threads, or the order of the indices.
+ *
+ *  The 64-bit seed is the key of the bijection. The counter is split into a
+ *  64-bit stream id, and a 64-bit block index within the stream.
+ *
+ *  A Philox instance is a small, trivially copyable object, which can be
+ *  created and used in device code.
+ *
+ *  Example Usage:
+ *  \code
+ *
+ *    // jitter n points, reproducibly, in parallel
+ *    axom::for_all< axom::OMP_EXEC >( n, AXOM_LAMBDA( axom::IndexType i )
+ *    {
+ *      axom::utilities::Philox rng( seed, i );
+ *      x[ i ] += h * rng.uniform( -0.5, 0.5 );
+ *      y[ i ] += h * rng.uniform( -0.5, 0.5 );
+ *    } );
+ *
+ *  \endcode
+ *
+ * \see fill_uniform(), fill_normal()
+ */
+class Philox
+{
+public:
+  /*!
+   * \brief Creates a generator for the given stream.
+   *
+   * \param [in] seed the seed, i.e., the key of the generator.
+   * \param [in] stream the id of the stream, e.g., the index of a loop.
+   */
+  AXOM_HOST_DEVICE explicit Philox(std::uint64_t seed, std::uint64_t stream = 0)
+    : m_key {lo(seed), hi(seed)}
+    , m_counter {0, 0, lo(stream), hi(stream)}
+  { }
+
+  /*!
+   * \brief Returns 32 random bits.
+   */
+  AXOM_HOST_DEVICE std::uint32_t nextUInt32()
+  {
+    if(m_position == 4)
+    {
+      generateBlock(m_counter, m_key, m_block);
+      incrementCounter();
+      m_position = 0;
+    }
+    return m_block[m_position++];
+  }
+
+  /*!
+   * \brief Returns 64 random bits.
+   */
+  AXOM_HOST_DEVICE std::uint64_t nextUInt64()
+  {
+    const std::uint64_t low = nextUInt32();
+    const std::uint64_t high = nextUInt32();
+    return (high << 32) | low;
+  }
+
+  /*!
+   * \brief Returns a uniformly distributed random number in [0,1), with 53
+   *  random bits.
+   */
+  AXOM_HOST_DEVICE double uniform() { return toUniform(nextUInt64()); }
+
+  /*!
+   * \brief Returns a uniformly distributed random number in [a,b).
+   *
+   * \param [in] a the interval's lower bound
+   * \param [in] b the interval's upper bound
+   *
+   * \pre a < b
+   */
+  AXOM_HOST_DEVICE double uniform(double a, double b)
+  {
+    return a + (b - a) * uniform();
+  }
+
+  /*!
+   * \brief Returns a normally distributed random number, with zero mean and
+   *  unit standard deviation.
+   *
+   * \note The numbers are generated in pairs, with the Box-Muller transform.
+   *  The second number of a pair is returned by the next call.
+   */
+  AXOM_HOST_DEVICE double normal()
+  {
+    if(m_hasNormal)
+    {
+      m_hasNormal = false;
+      return m_normal;
+    }
+
+    const double u1 = uniform();
+    const double u2 = uniform();
+    const double r = boxMullerRadius(u1);
+    const double theta = TWO_PI * u2;
+
+    m_normal = r * sin(theta);
+    m_hasNormal = true;
+    return r * cos(theta);
+  }
+
+  /*!
+   * \brief Returns a normally distributed random number, with the given mean
+   *  and standard deviation.
+   *
+   * \param [in] mean the mean of the distribution
+   * \param [in] stddev the standard deviation of the distribution
+   */
+  AXOM_HOST_DEVICE double normal(double mean, double stddev)
+  {
+    return mean + stddev * normal();
+  }
+
+  /*!
+   * \brief Computes the Philox4x32-10 bijection of the given counter.
+   *
+   * \param [in] counter the 128-bit counter, as four 32-bit words
+   * \param [in] key the 64-bit key, as two 32-bit words
+   * \param [out] block the 128 random bits, as four 32-bit words
+   */
+  AXOM_HOST_DEVICE static void generateBlock(const std::uint32_t (&counter)[4],
+                                             const std::uint32_t (&key)[2],
+                                             std::uint32_t (&block)[4])
+  {
+    std::uint32_t c0 = counter[0];
+    std::uint32_t c1 = counter[1];
+    std::uint32_t c2 = counter[2];
+    std::uint32_t c3 = counter[3];
+    std::uint32_t k0 = key[0];
+    std::uint32_t k1 = key[1];
+
+    for(int round = 0; round < NUM_ROUNDS; ++round)
+    {
+      const std::uint64_t p0 = static_cast<std::uint64_t>(MULTIPLIER_0) * c0;
+      const std::uint64_t p1 = static_cast<std::uint64_t>(MULTIPLIER_1) * c2;
+
+      c0 = hi(p1) ^ c1 ^ k0;
+      c1 = lo(p1);
+      c2 = hi(p0) ^ c3 ^ k1;
+      c3 = lo(p0);
+
+      k0 += WEYL_0;
+      k1 += WEYL_1;
+    }
+
+    block[0] = c0;
+    block[1] = c1;
+    block[2] = c2;
+    block[3] = c3;
+  }
+
+  /*!
+   * \brief Maps 64 random bits to a uniformly distributed number in [0,1).
+   */
+  AXOM_HOST_DEVICE static double toUniform(std::uint64_t bits)
+  {
+    // keep the 53 most significant bits, i.e., the precision of a double
+    return static_cast<double>(bits >> 11) * (1. / 9007199254740992.);
+  }
+
+  /*!
+   * \brief Returns the radius of the Box-Muller transform of u in [0,1).
+   */
+  AXOM_HOST_DEVICE static double boxMullerRadius(double u)
+  {
+    // 1 - u is in (0,1], hence, the log is finite
+    return sqrt(-2. * log(1. - u));
+  }
+
+private:
+  static constexpr int NUM_ROUNDS = 10;
+  static constexpr std::uint32_t MULTIPLIER_0 = 0xD2511F53;
+  static constexpr std::uint32_t MULTIPLIER_1 = 0xCD9E8D57;
+  static constexpr std::uint32_t WEYL_0 = 0x9E3779B9;
+  static constexpr std::uint32_t WEYL_1 = 0xBB67AE85;
+  static constexpr double TWO_PI = 6.283185307179586476925286766559;
+
+  AXOM_HOST_DEVICE static std::uint32_t lo(std::uint64_t x)
+  {
+    return static_cast<std::uint32_t>(x);
+  }
+
+  AXOM_HOST_DEVICE static std::uint32_t hi(std::uint64_t x)
+  {
+    return static_cast<std::uint32_t>(x >> 32);
+  }
+
+  /// Advances the block index, i.e., the low 64 bits of the counter
+  AXOM_HOST_DEVICE void incrementCounter()
+  {
+    if(++m_counter[0] == 0)
+    {
+      ++m_counter[1];
+    }
+  }
+
+  std::uint32_t m_key[2];
+  std::uint32_t m_counter[4];
+  std::uint32_t m_block[4] {0, 0, 0, 0};
+  int m_position {4};
+  bool m_hasNormal {false};
+  double m_normal {0.};
+};
+
+/// \name Bulk Random Number Generation
+/// @{
+
+/*!
+ * \brief Fills a buffer with uniformly distributed random numbers in [a,b).
+ *
+ *  Entry i is the first number of stream i of a Philox generator with the
+ *  given seed, i.e., Philox( seed, i ).uniform( a, b ). Hence, the contents
+ *  of the buffer do not depend on the execution space.
+ *
+ * \param [out] x buffer of n entries, where the numbers are stored
+ * \param [in] n the number of entries
+ * \param [in] seed the seed of the generator
+ * \param [in] a the interval's lower bound, defaults to 0
+ * \param [in] b the interval's upper bound, defaults to 1
+ *
+ * \tparam ExecSpace the execution space where to run the kernel
+ *
+ * \pre x != nullptr
+ * \pre a < b
+ */
+template <typename ExecSpace = SEQ_EXEC>
+void fill_uniform(double* x,
+                  IndexType n,
+                  std::uint64_t seed,
+                  double a = 0.,
+                  double b = 1.)
+{
+  assert("pre: buffer is null" && (x != nullptr || n == 0));
+  assert("pre: invalid bounds, a < b" && (a < b));
+
+  for_all<ExecSpace>(
+    n,
+    AXOM_LAMBDA(IndexType i) {
+      Philox rng(seed, static_cast<std::uint64_t>(i));
+      x[i] = rng.uniform(a, b);
+    });
+}
+
+/*!
+ * \brief Fills a buffer with normally distributed random numbers.
+ *
+ *  Entry i is the first number of stream i of a Philox generator with the
+ *  given seed, i.e., Philox( seed, i ).normal( mean, stddev ). Hence, the
+ *  contents of the buffer do not depend on the execution space.
+ *
+ * \param [out] x buffer of n entries, where the numbers are stored
+ * \param [in] n the number of entries
+ * \param [in] seed the seed of the generator
+ * \param [in] mean the mean of the distribution, defaults to 0
+ * \param [in] stddev the standard deviation of the distribution, defaults to 1
+ *
+ * \tparam ExecSpace the execution space where to run the kernel
+ *
+ * \pre x != nullptr
+ */
+template <typename ExecSpace = SEQ_EXEC>
+void fill_normal(double* x,
+                 IndexType n,
+                 std::uint64_t seed,
+                 double mean = 0.,
+                 double stddev = 1.)
+{
+  assert("pre: buffer is null" && (x != nullptr || n == 0));
+
+  for_all<ExecSpace>(
+    n,
+    AXOM_LAMBDA(IndexType i) {
+      Philox rng(seed, static_cast<std::uint64_t>(i));
+      x[i] = rng.normal(mean, stddev);
+    });
+}
+
+/// @}
+
+} /* end namespace utilities */
+} /* end namespace axom */
+
+#endif /* AXOM_PHILOX_HPP_ */
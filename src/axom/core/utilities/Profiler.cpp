@@ -0,0 +1,585 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/core/utilities/Profiler.hpp"
+
+// C/C++ includes
+#include <algorithm>  // for std::min, std::max
+#include <chrono>     // for std::chrono
+#include <cstdlib>    // for std::getenv, std::atoi
+#include <cstring>    // for std::strcmp
+#include <iomanip>    // for std::setw, std::setprecision
+#include <memory>     // for std::unique_ptr
+#include <sstream>    // for std::ostringstream, std::istringstream
+
+namespace axom
+{
+namespace utilities
+{
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+/// Returns true iff the given environment variable is set to a non-zero value
+bool requestedByEnvironment(const char* variable)
+{
+  const char* env = std::getenv(variable);
+  return env != nullptr && std::atoi(env) != 0;
+}
+
+/// The timings of a region of a single call tree, in depth-first order
+struct Record
+{
+  int depth;
+  std::string name;
+  std::uint64_t numCalls;
+  double inclusiveTime;
+  double exclusiveTime;
+  PerfCounterValues counters;
+};
+
+/*!
+ * \brief A region of the merged call tree, which accumulates the records of
+ *  the threads, or of the ranks, with the same path.
+ */
+struct MergedNode
+{
+  std::string name;
+  std::vector<std::unique_ptr<MergedNode>> children;
+  ProfileStats stats;
+
+  MergedNode* getChild(const std::string& childName)
+  {
+    for(auto& child : children)
+    {
+      if(child->name == childName)
+      {
+        return child.get();
+      }
+    }
+    children.emplace_back(new MergedNode);
+    children.back()->name = childName;
+    return children.back().get();
+  }
+
+  void addSample(const Record& record)
+  {
+    if(record.numCalls == 0)
+    {
+      return;
+    }
+
+    const double t = record.inclusiveTime;
+    stats.minTime = (stats.numSamples == 0) ? t : std::min(stats.minTime, t);
+    stats.maxTime = (stats.numSamples == 0) ? t : std::max(stats.maxTime, t);
+    stats.numCalls += record.numCalls;
+    stats.inclusiveTime += t;
+    stats.exclusiveTime += record.exclusiveTime;
+    stats.counters += record.counters;
+    ++stats.numSamples;
+  }
+
+  /// Appends the regions of the subtree with calls, in depth-first order.
+  /// Returns true iff a region was appended
+  bool flatten(const std::string& parentPath,
+               int depth,
+               std::vector<ProfileStats>& out) const
+  {
+    const std::size_t index = out.size();
+    const std::string path =
+      parentPath.empty() ? name : parentPath + "/" + name;
+
+    out.push_back(stats);
+    bool hasCalls = stats.numSamples > 0;
+    for(const auto& child : children)
+    {
+      hasCalls = child->flatten(path, depth + 1, out) || hasCalls;
+    }
+
+    if(!hasCalls)
+    {
+      out.pop_back();
+      return false;
+    }
+
+    ProfileStats& s = out[index];
+    s.name = name;
+    s.path = path;
+    s.depth = depth;
+    s.avgTime = (s.numSamples > 0) ? s.inclusiveTime / s.numSamples : 0.;
+    return true;
+  }
+};
+
+/// Merges the records of a call tree, in depth-first order, into root
+void merge(MergedNode& root, const std::vector<Record>& records)
+{
+  std::vector<MergedNode*> stack {&root};
+  for(const Record& record : records)
+  {
+    stack.resize(record.depth + 1);
+    MergedNode* node = stack.back()->getChild(record.name);
+    node->addSample(record);
+    stack.push_back(node);
+  }
+}
+
+/// Returns the regions of the merged call tree, in depth-first order
+std::vector<ProfileStats> flatten(const MergedNode& root)
+{
+  std::vector<ProfileStats> stats;
+  for(const auto& child : root.children)
+  {
+    child->flatten(std::string(), 0, stats);
+  }
+  return stats;
+}
+
+/// Returns the string, with its quotes, backslashes, newlines and tabs escaped
+std::string escape(const std::string& str)
+{
+  std::string escaped;
+  escaped.reserve(str.size());
+  for(const char c : str)
+  {
+    switch(c)
+    {
+    case '"':
+      escaped += "\\\"";
+      break;
+    case '\\':
+      escaped += "\\\\";
+      break;
+    case '\n':
+      escaped += "\\n";
+      break;
+    case '\t':
+      escaped += "\\t";
+      break;
+    default:
+      escaped += c;
+    }
+  }
+  return escaped;
+}
+
+/// Returns the string that was escaped with escape()
+std::string unescape(const std::string& str)
+{
+  std::string unescaped;
+  unescaped.reserve(str.size());
+  for(std::size_t i = 0; i < str.size(); ++i)
+  {
+    if(str[i] != '\\' || i + 1 == str.size())
+    {
+      unescaped += str[i];
+      continue;
+    }
+
+    const char c = str[++i];
+    unescaped += (c == 'n') ? '\n' : (c == 't') ? '\t' : c;
+  }
+  return unescaped;
+}
+
+/// Returns the string, quoted and escaped for JSON
+std::string quote(const std::string& str) { return '"' + escape(str) + '"'; }
+
+}  // end anonymous namespace
+
+//------------------------------------------------------------------------------
+struct Profiler::Node
+{
+  std::string name;
+  Node* parent {nullptr};
+  std::vector<std::unique_ptr<Node>> children;
+
+  std::uint64_t numCalls {0};
+  Clock::duration inclusiveTime {0};
+  Clock::time_point start;
+
+  PerfCounterValues counters;
+  PerfCounterValues startCounters;
+  bool sampleCounters {false};  // true iff the open call samples counters
+
+  /// Appends the records of the subtree, in depth-first order
+  void collect(int depth, std::vector<Record>& records) const
+  {
+    Clock::duration childrenTime {0};
+    for(const auto& child : children)
+    {
+      childrenTime += child->inclusiveTime;
+    }
+
+    using Seconds = std::chrono::duration<double>;
+    const double inclusive = Seconds(inclusiveTime).count();
+    const double exclusive =
+      std::max(0., inclusive - Seconds(childrenTime).count());
+    records.push_back(
+      Record {depth, name, numCalls, inclusive, exclusive, counters});
+
+    for(const auto& child : children)
+    {
+      child->collect(depth + 1, records);
+    }
+  }
+
+  void reset()
+  {
+    numCalls = 0;
+    inclusiveTime = Clock::duration {0};
+    counters = PerfCounterValues();
+    for(auto& child : children)
+    {
+      child->reset();
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+struct Profiler::ThreadProfile
+{
+  // NOTE: only contended while the statistics are queried
+  mutable std::mutex mutex;
+  Node root;
+  Node* current {&root};
+
+  // NOTE: opened by the owning thread, on first use
+  std::unique_ptr<PerfCounters> counters;
+};
+
+std::atomic<bool> Profiler::s_enabled(requestedByEnvironment("AXOM_PROFILE"));
+std::atomic<bool> Profiler::s_countersEnabled(
+  requestedByEnvironment("AXOM_PROFILE_COUNTERS"));
+thread_local Profiler::ThreadProfile* Profiler::s_threadProfile = nullptr;
+
+//------------------------------------------------------------------------------
+Profiler& Profiler::instance()
+{
+  // NOTE: intentionally leaked, so that regions may be closed from the
+  // destructors of other static objects
+  static Profiler* profiler = new Profiler;
+  return *profiler;
+}
+
+//------------------------------------------------------------------------------
+Profiler::Profiler() { }
+
+//------------------------------------------------------------------------------
+void Profiler::setEnabled(bool enabled)
+{
+  s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+void Profiler::setCountersEnabled(bool enabled)
+{
+  s_countersEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+Profiler::ThreadProfile& Profiler::getThreadProfile()
+{
+  // NOTE: the call trees outlive their threads, so that the statistics of
+  // the threads that have exited are still reported
+  if(s_threadProfile == nullptr)
+  {
+    ThreadProfile* profile = new ThreadProfile;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_threads.push_back(profile);
+    s_threadProfile = profile;
+  }
+  return *s_threadProfile;
+}
+
+//------------------------------------------------------------------------------
+void Profiler::begin(const char* name)
+{
+  ThreadProfile& profile = getThreadProfile();
+  std::lock_guard<std::mutex> lock(profile.mutex);
+
+  Node* parent = profile.current;
+  Node* node = nullptr;
+  for(auto& child : parent->children)
+  {
+    if(std::strcmp(child->name.c_str(), name) == 0)
+    {
+      node = child.get();
+      break;
+    }
+  }
+
+  if(node == nullptr)
+  {
+    parent->children.emplace_back(new Node);
+    node = parent->children.back().get();
+    node->name = name;
+    node->parent = parent;
+  }
+
+  profile.current = node;
+
+  node->sampleCounters = areCountersEnabled();
+  if(node->sampleCounters)
+  {
+    if(!profile.counters)
+    {
+      profile.counters.reset(new PerfCounters);
+    }
+    node->startCounters = profile.counters->read();
+  }
+
+  node->start = Clock::now();
+}
+
+//------------------------------------------------------------------------------
+void Profiler::end()
+{
+  const Clock::time_point stop = Clock::now();
+
+  ThreadProfile& profile = getThreadProfile();
+  std::lock_guard<std::mutex> lock(profile.mutex);
+
+  Node* node = profile.current;
+  if(node == &profile.root)
+  {
+    return;
+  }
+
+  node->inclusiveTime += stop - node->start;
+  ++node->numCalls;
+
+  if(node->sampleCounters)
+  {
+    node->counters += profile.counters->read() - node->startCounters;
+  }
+  profile.current = node->parent;
+}
+
+//------------------------------------------------------------------------------
+void Profiler::reset()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for(ThreadProfile* profile : m_threads)
+  {
+    std::lock_guard<std::mutex> threadLock(profile->mutex);
+    profile->root.reset();
+  }
+}
+
+//------------------------------------------------------------------------------
+std::vector<ProfileStats> Profiler::getStats() const
+{
+  MergedNode root;
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for(const ThreadProfile* profile : m_threads)
+  {
+    std::vector<Record> records;
+    {
+      std::lock_guard<std::mutex> threadLock(profile->mutex);
+      for(const auto& child : profile->root.children)
+      {
+        child->collect(0, records);
+      }
+    }
+    merge(root, records);
+  }
+
+  return flatten(root);
+}
+
+//------------------------------------------------------------------------------
+void Profiler::print(std::ostream& os) const { print(os, getStats()); }
+
+//------------------------------------------------------------------------------
+void Profiler::writeJSON(std::ostream& os) const { writeJSON(os, getStats()); }
+
+//------------------------------------------------------------------------------
+void Profiler::print(std::ostream& os, const std::vector<ProfileStats>& stats)
+{
+  constexpr int NAME_WIDTH = 40;
+
+  // NOTE: the derived counter metrics are only reported if counters were
+  // sampled, and are available
+  bool hasCounters = false;
+  for(const ProfileStats& s : stats)
+  {
+    hasCounters = hasCounters || s.counters.cycles > 0;
+  }
+
+  std::ostringstream oss;
+  oss << "Profile" << (isEnabled() ? "" : " (profiling disabled)") << ":\n"
+      << "  " << std::left << std::setw(NAME_WIDTH) << "region" << std::right
+      << std::setw(10) << "calls" << std::setw(13) << "incl (s)"
+      << std::setw(13) << "excl (s)" << std::setw(13) << "min (s)"
+      << std::setw(13) << "max (s)" << std::setw(13) << "avg (s)"
+      << std::setw(9) << "samples";
+  if(hasCounters)
+  {
+    oss << std::setw(8) << "IPC" << std::setw(12) << "LLC MPKI"
+        << std::setw(12) << "br MPKI";
+  }
+  oss << "\n";
+
+  oss << std::scientific << std::setprecision(4);
+  for(const ProfileStats& s : stats)
+  {
+    const std::string name = std::string(2 * s.depth, ' ') + s.name;
+    oss << "  " << std::left << std::setw(NAME_WIDTH) << name << std::right
+        << std::setw(10) << s.numCalls << std::setw(13) << s.inclusiveTime
+        << std::setw(13) << s.exclusiveTime << std::setw(13) << s.minTime
+        << std::setw(13) << s.maxTime << std::setw(13) << s.avgTime
+        << std::setw(9) << s.numSamples;
+    if(hasCounters)
+    {
+      const PerfCounterValues& c = s.counters;
+      oss << std::fixed << std::setprecision(2) << std::setw(8) << c.getIPC()
+          << std::setw(12) << c.getLLCMissesPerKiloInstruction()
+          << std::setw(12) << c.getBranchMissesPerKiloInstruction()
+          << std::scientific << std::setprecision(4);
+    }
+    oss << "\n";
+  }
+
+  os << oss.str();
+}
+
+//------------------------------------------------------------------------------
+void Profiler::writeJSON(std::ostream& os,
+                         const std::vector<ProfileStats>& stats)
+{
+  std::ostringstream oss;
+  oss << std::setprecision(9) << "[";
+  for(std::size_t i = 0; i < stats.size(); ++i)
+  {
+    const ProfileStats& s = stats[i];
+    oss << (i == 0 ? "\n" : ",\n") << "  {\"name\": " << quote(s.name)
+        << ", \"path\": " << quote(s.path) << ", \"depth\": " << s.depth
+        << ", \"calls\": " << s.numCalls
+        << ", \"inclusive\": " << s.inclusiveTime
+        << ", \"exclusive\": " << s.exclusiveTime
+        << ", \"min\": " << s.minTime << ", \"max\": " << s.maxTime
+        << ", \"avg\": " << s.avgTime << ", \"samples\": " << s.numSamples
+        << ", \"cycles\": " << s.counters.cycles
+        << ", \"instructions\": " << s.counters.instructions
+        << ", \"llc_misses\": " << s.counters.llcMisses
+        << ", \"branch_misses\": " << s.counters.branchMisses
+        << ", \"ipc\": " << s.counters.getIPC() << "}";
+  }
+  oss << "\n]\n";
+
+  os << oss.str();
+}
+
+#ifdef AXOM_USE_MPI
+
+//------------------------------------------------------------------------------
+std::vector<ProfileStats> Profiler::getStats(MPI_Comm comm) const
+{
+  int rank = 0;
+  int numRanks = 1;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &numRanks);
+
+  // NOTE: each rank sends its regions, merged over its threads, as lines of
+  // tab-separated values, in depth-first order. The names are escaped, since
+  // they may contain tabs and newlines
+  std::ostringstream oss;
+  oss << std::setprecision(17);
+  for(const ProfileStats& s : getStats())
+  {
+    oss << s.depth << '\t' << escape(s.name) << '\t' << s.numCalls << '\t'
+        << s.inclusiveTime << '\t' << s.exclusiveTime << '\t'
+        << s.counters.cycles << '\t' << s.counters.instructions << '\t'
+        << s.counters.llcMisses << '\t' << s.counters.branchMisses << '\n';
+  }
+  const std::string local = oss.str();
+
+  int localSize = static_cast<int>(local.size());
+  std::vector<int> sizes(numRanks, 0);
+  MPI_Gather(&localSize, 1, MPI_INT, sizes.data(), 1, MPI_INT, 0, comm);
+
+  std::vector<int> offsets(numRanks, 0);
+  for(int r = 1; r < numRanks; ++r)
+  {
+    offsets[r] = offsets[r - 1] + sizes[r - 1];
+  }
+  std::vector<char> buffer(
+    (rank == 0) ? offsets[numRanks - 1] + sizes[numRanks - 1] : 0);
+
+  MPI_Gatherv(const_cast<char*>(local.data()),
+              localSize,
+              MPI_CHAR,
+              buffer.data(),
+              sizes.data(),
+              offsets.data(),
+              MPI_CHAR,
+              0,
+              comm);
+
+  if(rank != 0)
+  {
+    return std::vector<ProfileStats>();
+  }
+
+  MergedNode root;
+  for(int r = 0; r < numRanks; ++r)
+  {
+    std::istringstream iss(std::string(buffer.data() + offsets[r], sizes[r]));
+
+    std::vector<Record> records;
+    std::string line;
+    while(std::getline(iss, line))
+    {
+      std::istringstream fields(line);
+      Record record;
+      fields >> record.depth;
+      fields.ignore(1);
+      std::getline(fields, record.name, '\t');
+      record.name = unescape(record.name);
+      fields >> record.numCalls >> record.inclusiveTime >> record.exclusiveTime;
+      fields >> record.counters.cycles >> record.counters.instructions >>
+        record.counters.llcMisses >> record.counters.branchMisses;
+      records.push_back(record);
+    }
+    merge(root, records);
+  }
+
+  return flatten(root);
+}
+
+//------------------------------------------------------------------------------
+void Profiler::print(std::ostream& os, MPI_Comm comm) const
+{
+  const std::vector<ProfileStats> stats = getStats(comm);
+
+  int rank = 0;
+  MPI_Comm_rank(comm, &rank);
+  if(rank == 0)
+  {
+    print(os, stats);
+  }
+}
+
+//------------------------------------------------------------------------------
+void Profiler::writeJSON(std::ostream& os, MPI_Comm comm) const
+{
+  const std::vector<ProfileStats> stats = getStats(comm);
+
+  int rank = 0;
+  MPI_Comm_rank(comm, &rank);
+  if(rank == 0)
+  {
+    writeJSON(os, stats);
+  }
+}
+
+#endif /* AXOM_USE_MPI */
+
+} /* namespace utilities */
+
+} /* namespace axom */
@@ -0,0 +1,290 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_PROFILER_HPP_
+#define AXOM_PROFILER_HPP_
+
+#include "axom/config.hpp"                       // for compile-time definitions
+#include "axom/core/Macros.hpp"                  // for axom macros
+#include "axom/core/utilities/PerfCounters.hpp"  // for PerfCounterValues
+
+// C/C++ includes
+#include <atomic>   // for std::atomic
+#include <cstdint>  // for std::uint64_t
+#include <mutex>    // for std::mutex
+#include <ostream>  // for std::ostream
+#include <string>   // for std::string
+#include <vector>   // for std::vector
+
+#ifdef AXOM_USE_MPI
+  #include <mpi.h>  // for MPI_Comm
+#endif
+
+namespace axom
+{
+namespace utilities
+{
+/*!
+ * \brief Timings of a region of the call tree, aggregated over the threads,
+ *  or over the ranks, that entered the region.
+ */
+struct ProfileStats
+{
+  std::string name;           /*!< name of the region */
+  std::string path;           /*!< names from the root, separated by '/' */
+  int depth {0};              /*!< depth in the call tree, 0 for the roots */
+  std::uint64_t numCalls {0}; /*!< number of calls, summed */
+  double inclusiveTime {0.};  /*!< time in the region, in seconds, summed */
+  double exclusiveTime {0.};  /*!< inclusiveTime minus that of the children */
+  double minTime {0.};        /*!< min inclusive time of a thread, or rank */
+  double maxTime {0.};        /*!< max inclusive time of a thread, or rank */
+  double avgTime {0.};        /*!< avg inclusive time of a thread, or rank */
+  int numSamples {0};         /*!< number of threads, or ranks */
+  PerfCounterValues counters; /*!< hardware counters, summed */
+};
+
+/*!
+ * \class Profiler
+ *
+ * \brief A low-overhead, thread-aware, hierarchical timer.
+ *
+ *  The profiler records a call tree of named regions for each thread, with
+ *  the number of calls and the time spent in each region. Regions are opened
+ *  and closed with a ProfileRegion, which is what the AXOM_PERF_MARK_FUNCTION
+ *  and AXOM_PERF_MARK_SECTION annotation macros expand to. Regions nest,
+ *  i.e., a region opened within another region is a child of that region.
+ *
+ *  The call trees of the threads are merged by path when the statistics are
+ *  queried with getStats(), print() or writeJSON(). The overloads that take
+ *  an MPI communicator merge the statistics of all the ranks on rank 0, and
+ *  report the min, max and average time of the ranks.
+ *
+ * \note The profiler does not report anything by itself, e.g., at exit or
+ *  when slic is finalized. The application must call print() or writeJSON()
+ *  once the profiled work is done, and, with MPI, before MPI_Finalize().
+ *
+ *  The profiler is disabled by default, in which case opening a region only
+ *  costs a check of an atomic flag. Profiling is enabled with setEnabled(), or
+ *  by setting the AXOM_PROFILE environment variable to a non-zero value.
+ *
+ *  In addition, the profiler can sample the hardware performance counters of
+ *  the threads, i.e., cycles, instructions, last-level cache misses and branch
+ *  misses, around each region, and report the instructions per cycle and the
+ *  misses per thousand instructions. A low IPC with many LLC misses points
+ *  to a memory-bound region. Counters are enabled with setCountersEnabled(),
+ *  or by setting the AXOM_PROFILE_COUNTERS environment variable to a non-zero
+ *  value, and are only available on Linux. See PerfCounters.
+ *
+ *  The profiler is a process-wide singleton, accessed via
+ *  Profiler::instance().
+ *
+ *  Example Usage:
+ *  \code
+ *
+ *     axom::utilities::Profiler::setEnabled(true);
+ *
+ *     bvh.build();  // annotated with AXOM_PERF_MARK_FUNCTION
+ *     {
+ *       axom::utilities::ProfileRegion region("my_kernel");
+ *       ...
+ *     }
+ *
+ *     axom::utilities::Profiler::instance().print(std::cout);
+ *
+ *  \endcode
+ *
+ * \see ProfileRegion
+ */
+class Profiler
+{
+public:
+  /*!
+   * \brief Returns the process-wide Profiler instance.
+   */
+  static Profiler& instance();
+
+  /*!
+   * \brief Returns true iff profiling is enabled.
+   */
+  static bool isEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+  /*!
+   * \brief Enables or disables profiling.
+   *
+   * \note Regions that are open when the profiler is disabled are still
+   *  closed, and timed, when they go out of scope.
+   */
+  static void setEnabled(bool enabled);
+
+  /*!
+   * \brief Returns true iff the hardware counters are sampled in the regions.
+   */
+  static bool areCountersEnabled()
+  {
+    return s_countersEnabled.load(std::memory_order_relaxed);
+  }
+
+  /*!
+   * \brief Enables or disables the sampling of the hardware counters in the
+   *  regions that are opened afterwards.
+   *
+   * \note Sampling the counters costs two system calls per region. Regions
+   *  report zero counts if the counters are unavailable on the platform.
+   */
+  static void setCountersEnabled(bool enabled);
+
+  /*!
+   * \brief Opens a region with the given name, as a child of the innermost
+   *  open region of the calling thread.
+   *
+   * \note Prefer a ProfileRegion, which closes the region when it goes out of
+   *  scope.
+   *
+   * \pre name != nullptr
+   */
+  void begin(const char* name);
+
+  /*!
+   * \brief Closes the innermost open region of the calling thread.
+   */
+  void end();
+
+  /*!
+   * \brief Resets the calls and the times of all the regions of all the
+   *  threads. Open regions remain open.
+   */
+  void reset();
+
+  /*!
+   * \brief Returns the statistics of the regions, merged over all threads,
+   *  in depth-first order of the call tree.
+   *
+   * \note The statistics are a snapshot. Regions that are open are reported
+   *  with the time of their completed calls.
+   */
+  std::vector<ProfileStats> getStats() const;
+
+  /*!
+   * \brief Prints a report of the call tree to the given stream.
+   */
+  void print(std::ostream& os) const;
+
+  /*!
+   * \brief Writes the statistics, as a JSON array of regions, to the given
+   *  stream.
+   */
+  void writeJSON(std::ostream& os) const;
+
+#ifdef AXOM_USE_MPI
+  /*!
+   * \brief Returns the statistics merged over all the ranks of comm.
+   *
+   *  The min, max and average times are over the ranks, with the time of a
+   *  rank summed over its threads.
+   *
+   * \note This is a collective operation. The statistics are returned on
+   *  rank 0 only, and other ranks get an empty vector.
+   */
+  std::vector<ProfileStats> getStats(MPI_Comm comm) const;
+
+  /*!
+   * \brief Prints a report of the call tree, merged over all the ranks of
+   *  comm, on rank 0.
+   *
+   * \note This is a collective operation.
+   */
+  void print(std::ostream& os, MPI_Comm comm) const;
+
+  /*!
+   * \brief Writes the statistics, merged over all the ranks of comm, as
+   *  JSON, on rank 0.
+   *
+   * \note This is a collective operation.
+   */
+  void writeJSON(std::ostream& os, MPI_Comm comm) const;
+#endif
+
+  /*!
+   * \brief Prints the given statistics as a report of the call tree.
+   */
+  static void print(std::ostream& os, const std::vector<ProfileStats>& stats);
+
+  /*!
+   * \brief Writes the given statistics as a JSON array of regions.
+   */
+  static void writeJSON(std::ostream& os,
+                        const std::vector<ProfileStats>& stats);
+
+private:
+  /// A region of the call tree of a thread
+  struct Node;
+
+  /// The call tree of a thread
+  struct ThreadProfile;
+
+  Profiler();
+
+  /// Returns the call tree of the calling thread, which is created on first use
+  ThreadProfile& getThreadProfile();
+
+  static std::atomic<bool> s_enabled;
+  static std::atomic<bool> s_countersEnabled;
+  static thread_local ThreadProfile* s_threadProfile;
+
+  mutable std::mutex m_mutex;  // protects the list of threads
+  std::vector<ThreadProfile*> m_threads;
+
+  DISABLE_COPY_AND_ASSIGNMENT(Profiler);
+  DISABLE_MOVE_AND_ASSIGNMENT(Profiler);
+};
+
+/*!
+ * \class ProfileRegion
+ *
+ * \brief Times the enclosing scope as a region of the Profiler.
+ *
+ *  The region is opened at construction if the profiler is enabled, and is
+ *  closed when the ProfileRegion goes out of scope.
+ *
+ * \see Profiler, AXOM_PERF_MARK_FUNCTION, AXOM_PERF_MARK_SECTION
+ */
+class ProfileRegion
+{
+public:
+  /*!
+   * \brief Opens a region with the given name.
+   * \param [in] name the name of the region, e.g., the name of the function.
+   */
+  explicit ProfileRegion(const char* name) : m_active(Profiler::isEnabled())
+  {
+    if(m_active)
+    {
+      Profiler::instance().begin(name);
+    }
+  }
+
+  /*!
+   * \brief Closes the region.
+   */
+  ~ProfileRegion()
+  {
+    if(m_active)
+    {
+      Profiler::instance().end();
+    }
+  }
+
+private:
+  bool m_active;
+
+  DISABLE_COPY_AND_ASSIGNMENT(ProfileRegion);
+  DISABLE_MOVE_AND_ASSIGNMENT(ProfileRegion);
+};
+
+} /* namespace utilities */
+
+} /* namespace axom */
+
+#endif /* AXOM_PROFILER_HPP_ */
@@ -82,18 +82,16 @@ inline void for_all_cells_impl(xargs::ij,
 
 #else
 
-  constexpr bool is_serial = std::is_same<ExecPolicy, axom::SEQ_EXEC>::value;
-  AXOM_STATIC_ASSERT(is_serial);
-
-  for(IndexType j = 0; j < Nj; ++j)
-  {
-    const IndexType j_offset = j * jp;
-    for(IndexType i = 0; i < Ni; ++i)
-    {
-      const IndexType cellID = i + j_offset;
-      kernel(cellID, i, j);
-    }  // END for all i
-  }    // END for all j
+  axom::for_all<ExecPolicy>(
+    Nj,
+    AXOM_LAMBDA(IndexType j) {
+      const IndexType j_offset = j * jp;
+      for(IndexType i = 0; i < Ni; ++i)
+      {
+        const IndexType cellID = i + j_offset;
+        kernel(cellID, i, j);
+      }  // END for all i
+    });
 
 #endif
 }
@@ -141,22 +139,20 @@ inline void for_all_cells_impl(xargs::ijk,
 
 #else
 
-  constexpr bool is_serial = std::is_same<ExecPolicy, axom::SEQ_EXEC>::value;
-  AXOM_STATIC_ASSERT(is_serial);
-
-  for(IndexType k = 0; k < Nk; ++k)
-  {
-    const IndexType k_offset = k * kp;
-    for(IndexType j = 0; j < Nj; ++j)
-    {
-      const IndexType j_offset = j * jp;
-      for(IndexType i = 0; i < Ni; ++i)
+  axom::for_all<ExecPolicy>(
+    Nk,
+    AXOM_LAMBDA(IndexType k) {
+      const IndexType k_offset = k * kp;
+      for(IndexType j = 0; j < Nj; ++j)
       {
-        const IndexType cellID = i + j_offset + k_offset;
-        kernel(cellID, i, j, k);
-      }  // END for all i
-    }    // END for all j
-  }      // END for all k
+        const IndexType j_offset = j * jp;
+        for(IndexType i = 0; i < Ni; ++i)
+        {
+          const IndexType cellID = i + j_offset + k_offset;
+          kernel(cellID, i, j, k);
+        }  // END for all i
+      }    // END for all j
+    });
 
 #endif
 }
@@ -61,18 +61,16 @@ inline void for_all_I_faces(xargs::ij, const StructuredMesh& m, KernelType&& ker
 
 #else
 
-  constexpr bool is_serial = std::is_same<ExecPolicy, axom::SEQ_EXEC>::value;
-  AXOM_STATIC_ASSERT(is_serial);
-
-  for(IndexType j = 0; j < Nj; ++j)
-  {
-    const IndexType offset = j * INodeResolution;
-    for(IndexType i = 0; i < Ni; ++i)
-    {
-      const IndexType faceID = i + offset;
-      kernel(faceID, i, j);
-    }
-  }
+  axom::for_all<ExecPolicy>(
+    Nj,
+    AXOM_LAMBDA(IndexType j) {
+      const IndexType offset = j * INodeResolution;
+      for(IndexType i = 0; i < Ni; ++i)
+      {
+        const IndexType faceID = i + offset;
+        kernel(faceID, i, j);
+      }
+    });
 
 #endif
 }
@@ -106,22 +104,20 @@ inline void for_all_I_faces(xargs::ijk, const StructuredMesh& m, KernelType&& ke
 
 #else
 
-  constexpr bool is_serial = std::is_same<ExecPolicy, axom::SEQ_EXEC>::value;
-  AXOM_STATIC_ASSERT(is_serial);
-
-  for(IndexType k = 0; k < Nk; ++k)
-  {
-    const IndexType k_offset = k * numIFacesInKSlice;
-    for(IndexType j = 0; j < Nj; ++j)
-    {
-      const IndexType offset = j * INodeResolution + k_offset;
-      for(IndexType i = 0; i < Ni; ++i)
+  axom::for_all<ExecPolicy>(
+    Nk,
+    AXOM_LAMBDA(IndexType k) {
+      const IndexType k_offset = k * numIFacesInKSlice;
+      for(IndexType j = 0; j < Nj; ++j)
       {
-        const IndexType faceID = i + offset;
-        kernel(faceID, i, j, k);
+        const IndexType offset = j * INodeResolution + k_offset;
+        for(IndexType i = 0; i < Ni; ++i)
+        {
+          const IndexType faceID = i + offset;
+          kernel(faceID, i, j, k);
+        }
       }
-    }
-  }
+    });
 
 #endif
 }
@@ -152,18 +148,16 @@ inline void for_all_J_faces(xargs::ij, const StructuredMesh& m, KernelType&& ker
 
 #else
 
-  constexpr bool is_serial = std::is_same<ExecPolicy, axom::SEQ_EXEC>::value;
-  AXOM_STATIC_ASSERT(is_serial);
-
-  for(IndexType j = 0; j < Nj; ++j)
-  {
-    const IndexType offset = numIFaces + j * ICellResolution;
-    for(IndexType i = 0; i < Ni; ++i)
-    {
-      const IndexType faceID = i + offset;
-      kernel(faceID, i, j);
-    }
-  }
+  axom::for_all<ExecPolicy>(
+    Nj,
+    AXOM_LAMBDA(IndexType j) {
+      const IndexType offset = numIFaces + j * ICellResolution;
+      for(IndexType i = 0; i < Ni; ++i)
+      {
+        const IndexType faceID = i + offset;
+        kernel(faceID, i, j);
+      }
+    });
 
 #endif
 }
@@ -200,22 +194,20 @@ inline void for_all_J_faces(xargs::ijk, const StructuredMesh& m, KernelType&& ke
 
 #else
 
-  constexpr bool is_serial = std::is_same<ExecPolicy, axom::SEQ_EXEC>::value;
-  AXOM_STATIC_ASSERT(is_serial);
-
-  for(IndexType k = 0; k < Nk; ++k)
-  {
-    const IndexType k_offset = k * numJFacesInKSlice + numIFaces;
-    for(IndexType j = 0; j < Nj; ++j)
-    {
-      const IndexType offset = j * ICellResolution + k_offset;
-      for(IndexType i = 0; i < Ni; ++i)
+  axom::for_all<ExecPolicy>(
+    Nk,
+    AXOM_LAMBDA(IndexType k) {
+      const IndexType k_offset = k * numJFacesInKSlice + numIFaces;
+      for(IndexType j = 0; j < Nj; ++j)
       {
-        const IndexType faceID = i + offset;
-        kernel(faceID, i, j, k);
+        const IndexType offset = j * ICellResolution + k_offset;
+        for(IndexType i = 0; i < Ni; ++i)
+        {
+          const IndexType faceID = i + offset;
+          kernel(faceID, i, j, k);
+        }
       }
-    }
-  }
+    });
 
 #endif
 }
@@ -252,22 +244,20 @@ inline void for_all_K_faces(xargs::ijk, const StructuredMesh& m, KernelType&& ke
 
 #else
 
-  constexpr bool is_serial = std::is_same<ExecPolicy, axom::SEQ_EXEC>::value;
-  AXOM_STATIC_ASSERT(is_serial);
-
-  for(IndexType k = 0; k < Nk; ++k)
-  {
-    const IndexType k_offset = k * cellKp + numIJFaces;
-    for(IndexType j = 0; j < Nj; ++j)
-    {
-      const IndexType offset = j * ICellResolution + k_offset;
-      for(IndexType i = 0; i < Ni; ++i)
+  axom::for_all<ExecPolicy>(
+    Nk,
+    AXOM_LAMBDA(IndexType k) {
+      const IndexType k_offset = k * cellKp + numIJFaces;
+      for(IndexType j = 0; j < Nj; ++j)
       {
-        const IndexType faceID = i + offset;
-        kernel(faceID, i, j, k);
+        const IndexType offset = j * ICellResolution + k_offset;
+        for(IndexType i = 0; i < Ni; ++i)
+        {
+          const IndexType faceID = i + offset;
+          kernel(faceID, i, j, k);
+        }
       }
-    }
-  }
+    });
 
 #endif
 }
@@ -6,8 +6,9 @@
 #ifndef MINT_MESHCOORDINATES_HPP_
 #define MINT_MESHCOORDINATES_HPP_
 
-#include "axom/core/Macros.hpp"  // for Axom macros and definitions
-#include "axom/core/Array.hpp"   // for axom::Array
+#include "axom/core/Macros.hpp"     // for Axom macros and definitions
+#include "axom/core/Array.hpp"      // for axom::Array
+#include "axom/core/TupleView.hpp"  // for axom::TupleView
 
 #ifdef AXOM_MINT_USE_SIDRE
   #include "axom/sidre/core/Array.hpp"  // for sidre::Array
@@ -539,6 +540,54 @@ public:
 
   /// @}
 
+  /*!
+   * \brief Returns a view of the coordinates, which aliases the coordinate
+   *  arrays without copying them, e.g., for use in kernels.
+   *
+   * \tparam NDIMS the dimension of the coordinates.
+   *
+   * \return view a view in the SoA layout, of size numNodes().
+   *
+   * \note The view is invalidated when the coordinate arrays are reallocated.
+   *
+   * \pre NDIMS == dimension()
+   */
+  /// @{
+
+  template <int NDIMS>
+  axom::TupleView<double, NDIMS> getTupleView()
+  {
+    SLIC_ERROR_IF(NDIMS != m_ndims,
+                  "invalid request for a view of dimension ["
+                    << NDIMS << "]"
+                    << "ndims=" << m_ndims);
+
+    axom::StackArray<double*, NDIMS> components;
+    for(int dim = 0; dim < NDIMS; ++dim)
+    {
+      components[dim] = m_coordinates[dim]->getData();
+    }
+    return axom::TupleView<double, NDIMS>(components, numNodes());
+  }
+
+  template <int NDIMS>
+  axom::TupleView<const double, NDIMS> getTupleView() const
+  {
+    SLIC_ERROR_IF(NDIMS != m_ndims,
+                  "invalid request for a view of dimension ["
+                    << NDIMS << "]"
+                    << "ndims=" << m_ndims);
+
+    axom::StackArray<const double*, NDIMS> components;
+    for(int dim = 0; dim < NDIMS; ++dim)
+    {
+      components[dim] = m_coordinates[dim]->getData();
+    }
+    return axom::TupleView<const double, NDIMS>(components, numNodes());
+  }
+
+  /// @}
+
   /// @}
 
 private:
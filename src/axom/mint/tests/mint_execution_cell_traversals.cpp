@@ -361,8 +361,7 @@ AXOM_CUDA_TEST(mint_execution_cell_traversals, for_all_cells_nodeids)
     check_for_all_cell_nodes<seq_exec, UNSTRUCTURED_MESH, SINGLE_SHAPE>(i);
     check_for_all_cell_nodes<seq_exec, UNSTRUCTURED_MESH, MIXED_SHAPE>(i);
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
+#if defined(AXOM_USE_OPENMP)
 
     using omp_exec = axom::OMP_EXEC;
     check_for_all_cell_nodes<omp_exec, STRUCTURED_UNIFORM_MESH>(i);
@@ -406,8 +405,7 @@ AXOM_CUDA_TEST(mint_execution_cell_traversals, for_all_cells_coords)
     check_for_all_cell_coords<seq_exec, UNSTRUCTURED_MESH, SINGLE_SHAPE>(i);
     check_for_all_cell_coords<seq_exec, UNSTRUCTURED_MESH, MIXED_SHAPE>(i);
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
+#if defined(AXOM_USE_OPENMP)
 
     using omp_exec = axom::OMP_EXEC;
     check_for_all_cell_coords<omp_exec, STRUCTURED_UNIFORM_MESH>(i);
@@ -451,8 +449,7 @@ AXOM_CUDA_TEST(mint_execution_cell_traversals, for_all_cells_faceids)
     check_for_all_cell_faces<seq_exec, UNSTRUCTURED_MESH, SINGLE_SHAPE>(i);
     check_for_all_cell_faces<seq_exec, UNSTRUCTURED_MESH, MIXED_SHAPE>(i);
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
+#if defined(AXOM_USE_OPENMP)
 
     using omp_exec = axom::OMP_EXEC;
     check_for_all_cell_faces<omp_exec, STRUCTURED_UNIFORM_MESH>(i);
@@ -492,8 +489,7 @@ AXOM_CUDA_TEST(mint_execution_cell_traversals, for_all_cells_ij)
   check_for_all_cells_ij<seq_exec, STRUCTURED_CURVILINEAR_MESH>();
   check_for_all_cells_ij<seq_exec, STRUCTURED_RECTILINEAR_MESH>();
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
+#if defined(AXOM_USE_OPENMP)
 
   using omp_exec = axom::OMP_EXEC;
   check_for_all_cells_ij<omp_exec, STRUCTURED_UNIFORM_MESH>();
@@ -527,8 +523,7 @@ AXOM_CUDA_TEST(mint_execution_cell_traversals, for_all_cells_ijk)
   check_for_all_cells_ijk<seq_exec, STRUCTURED_CURVILINEAR_MESH>();
   check_for_all_cells_ijk<seq_exec, STRUCTURED_RECTILINEAR_MESH>();
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
+#if defined(AXOM_USE_OPENMP)
 
   using omp_exec = axom::OMP_EXEC;
   check_for_all_cells_ijk<omp_exec, STRUCTURED_UNIFORM_MESH>();
@@ -567,8 +562,7 @@ AXOM_CUDA_TEST(mint_execution_cell_traversals, for_all_cells_index)
     check_for_all_cells_idx<seq_exec, UNSTRUCTURED_MESH, SINGLE_SHAPE>(i);
     check_for_all_cells_idx<seq_exec, UNSTRUCTURED_MESH, MIXED_SHAPE>(i);
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
+#if defined(AXOM_USE_OPENMP)
 
     using omp_exec = axom::OMP_EXEC;
     check_for_all_cells_idx<omp_exec, STRUCTURED_UNIFORM_MESH>(i);
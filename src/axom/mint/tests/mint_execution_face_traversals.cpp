@@ -256,8 +256,7 @@ AXOM_CUDA_TEST(mint_execution_face_traversals, for_all_face_nodeids)
     check_for_all_face_nodes<seq_exec, UNSTRUCTURED_MESH, SINGLE_SHAPE>(dim);
     check_for_all_face_nodes<seq_exec, UNSTRUCTURED_MESH, MIXED_SHAPE>(dim);
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
+#if defined(AXOM_USE_OPENMP)
 
     using omp_exec = axom::OMP_EXEC;
     check_for_all_face_nodes<omp_exec, STRUCTURED_UNIFORM_MESH>(dim);
@@ -300,8 +299,7 @@ AXOM_CUDA_TEST(mint_execution_face_traversals, for_all_face_coords)
     check_for_all_face_coords<seq_exec, UNSTRUCTURED_MESH, SINGLE_SHAPE>(dim);
     check_for_all_face_coords<seq_exec, UNSTRUCTURED_MESH, MIXED_SHAPE>(dim);
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
+#if defined(AXOM_USE_OPENMP)
 
     using omp_exec = axom::OMP_EXEC;
     check_for_all_face_coords<omp_exec, STRUCTURED_UNIFORM_MESH>(dim);
@@ -344,8 +342,7 @@ AXOM_CUDA_TEST(mint_execution_face_traversals, for_all_face_cellids)
     check_for_all_face_nodes<seq_exec, UNSTRUCTURED_MESH, SINGLE_SHAPE>(dim);
     check_for_all_face_nodes<seq_exec, UNSTRUCTURED_MESH, MIXED_SHAPE>(dim);
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
+#if defined(AXOM_USE_OPENMP)
 
     using omp_exec = axom::OMP_EXEC;
     check_for_all_face_cells<omp_exec, STRUCTURED_UNIFORM_MESH>(dim);
@@ -389,8 +386,7 @@ AXOM_CUDA_TEST(mint_execution_face_traversals, for_all_faces_index)
     check_for_all_faces<seq_exec, UNSTRUCTURED_MESH, SINGLE_SHAPE>(dim);
     check_for_all_faces<seq_exec, UNSTRUCTURED_MESH, MIXED_SHAPE>(dim);
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
+#if defined(AXOM_USE_OPENMP)
 
     using omp_exec = axom::OMP_EXEC;
     check_for_all_faces<omp_exec, STRUCTURED_UNIFORM_MESH>(dim);
@@ -332,8 +332,7 @@ AXOM_CUDA_TEST(mint_execution_node_traversals, for_all_nodes_xyz)
   check_for_all_nodes_xyz<seq_exec, UNSTRUCTURED_MESH, SINGLE_SHAPE>();
   check_for_all_nodes_xyz<seq_exec, UNSTRUCTURED_MESH, MIXED_SHAPE>();
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
+#if defined(AXOM_USE_OPENMP)
 
   using openmp_exec = axom::OMP_EXEC;
   check_for_all_nodes_xyz<openmp_exec, STRUCTURED_UNIFORM_MESH>();
@@ -376,8 +375,7 @@ AXOM_CUDA_TEST(mint_execution_node_traversals, for_all_nodes_xy)
   check_for_all_nodes_xy<seq_exec, UNSTRUCTURED_MESH, SINGLE_SHAPE>();
   check_for_all_nodes_xy<seq_exec, UNSTRUCTURED_MESH, MIXED_SHAPE>();
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
+#if defined(AXOM_USE_OPENMP)
 
   using openmp_exec = axom::OMP_EXEC;
   check_for_all_nodes_xy<openmp_exec, STRUCTURED_UNIFORM_MESH>();
@@ -420,8 +418,7 @@ AXOM_CUDA_TEST(mint_execution_node_traversals, for_all_nodes_x)
   check_for_all_nodes_x<seq_exec, UNSTRUCTURED_MESH, SINGLE_SHAPE>();
   check_for_all_nodes_x<seq_exec, UNSTRUCTURED_MESH, MIXED_SHAPE>();
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
+#if defined(AXOM_USE_OPENMP)
 
   using openmp_exec = axom::OMP_EXEC;
   check_for_all_nodes_x<openmp_exec, STRUCTURED_UNIFORM_MESH>();
@@ -461,8 +458,7 @@ AXOM_CUDA_TEST(mint_execution_node_traversals, for_all_nodes_ijk)
   check_for_all_nodes_ijk<seq_exec, STRUCTURED_CURVILINEAR_MESH>();
   check_for_all_nodes_ijk<seq_exec, STRUCTURED_RECTILINEAR_MESH>();
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
+#if defined(AXOM_USE_OPENMP)
 
   using openmp_exec = axom::OMP_EXEC;
   check_for_all_nodes_ijk<openmp_exec, STRUCTURED_UNIFORM_MESH>();
@@ -496,8 +492,7 @@ AXOM_CUDA_TEST(mint_execution_node_traversals, for_all_nodes_ij)
   check_for_all_nodes_ij<seq_exec, STRUCTURED_CURVILINEAR_MESH>();
   check_for_all_nodes_ij<seq_exec, STRUCTURED_RECTILINEAR_MESH>();
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
+#if defined(AXOM_USE_OPENMP)
 
   using openmp_exec = axom::OMP_EXEC;
   check_for_all_nodes_ij<openmp_exec, STRUCTURED_UNIFORM_MESH>();
@@ -537,8 +532,7 @@ AXOM_CUDA_TEST(mint_execution_node_traversals, for_all_nodes_index)
     check_for_all_nodes_idx<seq_exec, UNSTRUCTURED_MESH, SINGLE_SHAPE>(i);
     check_for_all_nodes_idx<seq_exec, UNSTRUCTURED_MESH, MIXED_SHAPE>(i);
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
+#if defined(AXOM_USE_OPENMP)
 
     using omp_exec = axom::OMP_EXEC;
     check_for_all_nodes_idx<omp_exec, STRUCTURED_UNIFORM_MESH>(i);
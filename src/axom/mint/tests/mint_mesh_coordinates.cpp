@@ -1150,6 +1150,58 @@ TEST(mint_mesh_coordinates, external_constructor)
   }
 }
 
+//------------------------------------------------------------------------------
+TEST(mint_mesh_coordinates, tuple_view)
+{
+  double x[SMALL_NUM_NODES] = {1.0, 2.0, 3.0, 4.0};
+  double y[SMALL_NUM_NODES] = {5.0, 6.0, 7.0, 8.0};
+  double z[SMALL_NUM_NODES] = {9.0, 10.0, 11.0, 12.0};
+
+  MeshCoordinates coords(SMALL_NUM_NODES, SMALL_NUM_NODES, x, y, z);
+
+  // the view aliases the external coordinate arrays
+  axom::TupleView<double, 3> view = coords.getTupleView<3>();
+  EXPECT_EQ(view.size(), SMALL_NUM_NODES);
+  EXPECT_EQ(view.getComponent(X_COORDINATE), x);
+  EXPECT_EQ(view.getComponent(Y_COORDINATE), y);
+  EXPECT_EQ(view.getComponent(Z_COORDINATE), z);
+
+  double node[3];
+  for(IndexType i = 0; i < SMALL_NUM_NODES; ++i)
+  {
+    coords.getCoordinates(i, node);
+    EXPECT_DOUBLE_EQ(view(i, X_COORDINATE), node[0]);
+    EXPECT_DOUBLE_EQ(view(i, Y_COORDINATE), node[1]);
+    EXPECT_DOUBLE_EQ(view(i, Z_COORDINATE), node[2]);
+
+    view[i][Z_COORDINATE] = -node[2];
+  }
+
+  const MeshCoordinates& const_coords = coords;
+  axom::TupleView<const double, 3> const_view =
+    const_coords.getTupleView<3>();
+  for(IndexType i = 0; i < SMALL_NUM_NODES; ++i)
+  {
+    EXPECT_DOUBLE_EQ(z[i], -(9.0 + i));
+    EXPECT_DOUBLE_EQ(const_view(i, Z_COORDINATE), z[i]);
+  }
+
+  // native storage
+  MeshCoordinates native(2, 0, SMALL_NUM_NODES);
+  for(IndexType i = 0; i < SMALL_NUM_NODES; ++i)
+  {
+    native.append(x[i], y[i]);
+  }
+
+  axom::TupleView<double, 2> native_view = native.getTupleView<2>();
+  EXPECT_EQ(native_view.size(), native.numNodes());
+  for(IndexType i = 0; i < SMALL_NUM_NODES; ++i)
+  {
+    EXPECT_DOUBLE_EQ(native_view(i, X_COORDINATE), x[i]);
+    EXPECT_DOUBLE_EQ(native_view(i, Y_COORDINATE), y[i]);
+  }
+}
+
 //------------------------------------------------------------------------------
 #ifdef AXOM_MINT_USE_SIDRE
 
@@ -67,14 +67,73 @@ GeometricBoundingBox compute_bounds(mint::Mesh* mesh)
   return meshBB;
 }
 
+/**
+ * \brief Queries the containment of all the nodes of a uniform mesh in a
+ * single batch, in the execution space it is called with.
+ *
+ * \note With RAJA, mint::for_all_nodes() does not support THREAD_EXEC, see
+ *  axom::supports_thread_exec.
+ *
+ * \see axom::dispatch_host_runtime_policy()
+ */
+struct BatchedContainmentQuery
+{
+  const Octree3D& inOutOctree;
+  const mint::UniformMesh& umesh;
+  int* containment;
+
+  template <typename ExecSpace>
+  void operator()(ExecSpace) const
+  {
+    const int nnodes = umesh.getNumberOfNodes();
+
+    // Allocate space for the coordinate arrays
+    double* x = axom::allocate<double>(nnodes);
+    double* y = axom::allocate<double>(nnodes);
+    double* z = axom::allocate<double>(nnodes);
+
+    // Fill the coordinate arrays
+    mint::for_all_nodes<ExecSpace, mint::xargs::xyz>(
+      &umesh,
+      AXOM_LAMBDA(axom::IndexType idx, double xx, double yy, double zz) {
+        x[idx] = xx;
+        y[idx] = yy;
+        z[idx] = zz;
+      });
+
+    // Loop through the points using ExecSpace
+    axom::for_all<ExecSpace>(0, nnodes, [&](axom::IndexType idx) {
+      const bool inside = inOutOctree.within(SpacePt {x[idx], y[idx], z[idx]});
+      containment[idx] = inside ? 1 : 0;
+    });
+
+    // Deallocate the coordinate arrays
+    axom::deallocate(x);
+    axom::deallocate(y);
+    axom::deallocate(z);
+  }
+};
+
+#ifndef AXOM_USE_RAJA
+namespace axom
+{
+template <>
+struct supports_thread_exec<BatchedContainmentQuery> : std::true_type
+{ };
+}  // namespace axom
+#endif
+
 /**
  * Query the inOutOctree using uniform grid of resolution \a gridRes
- * in region defined by bounding box \a queryBounds
+ * in region defined by bounding box \a queryBounds. Batched queries run
+ * with the runtime execution \a policy, on \a numThreads threads.
  */
 void testContainmentOnRegularGrid(const Octree3D& inOutOctree,
                                   const GeometricBoundingBox& queryBounds,
                                   const GridPt& gridRes,
-                                  bool isBatched)
+                                  bool isBatched,
+                                  axom::RuntimePolicy policy,
+                                  int numThreads)
 {
   const double* low = queryBounds.getMin().data();
   const double* high = queryBounds.getMax().data();
@@ -103,38 +162,13 @@ void testContainmentOnRegularGrid(const Octree3D& inOutOctree,
   {
     timer.start();
 
-    // Allocate space for the coordinate arrays
-    double* x = axom::allocate<double>(nnodes);
-    double* y = axom::allocate<double>(nnodes);
-    double* z = axom::allocate<double>(nnodes);
-
-// Determine an appropriate execution policy
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
-    using ExecPolicy = axom::OMP_EXEC;
-#else
-    using ExecPolicy = axom::SEQ_EXEC;
-#endif
-
-    // Fill the coordinate arrays
-    mint::for_all_nodes<ExecPolicy, mint::xargs::xyz>(
-      umesh,
-      AXOM_LAMBDA(axom::IndexType idx, double xx, double yy, double zz) {
-        x[idx] = xx;
-        y[idx] = yy;
-        z[idx] = zz;
-      });
-
-    // Loop through the points using ExecPolicy
-    axom::for_all<ExecPolicy>(0, nnodes, [&](axom::IndexType idx) {
-      const bool inside = inOutOctree.within(SpacePt {x[idx], y[idx], z[idx]});
-      containment[idx] = inside ? 1 : 0;
-    });
-
-    // Deallocate the coordinate arrays
-    axom::deallocate(x);
-    axom::deallocate(y);
-    axom::deallocate(z);
+    const bool dispatched = axom::dispatch_host_runtime_policy(
+      policy,
+      BatchedContainmentQuery {inOutOctree, *umesh, containment},
+      numThreads);
+    SLIC_ERROR_IF(!dispatched,
+                  "Execution policy '" << axom::getRuntimePolicyName(policy)
+                                       << "' is not available");
 
     timer.stop();
   }
@@ -367,6 +401,10 @@ private:
   bool m_verboseOutput {false};
   bool m_hasUserQueryBox {false};
   bool m_use_batched_query {false};
+  std::string m_policyName {
+    axom::isRuntimePolicyEnabled(axom::POLICY_OMP) ? "omp" : "seq"};
+  axom::RuntimePolicy m_policy {axom::POLICY_SEQ};
+  int m_numThreads {0};
 
 public:
   Input()
@@ -390,6 +428,10 @@ public:
 
   bool useBatchedQuery() const { return m_use_batched_query; }
 
+  axom::RuntimePolicy getPolicy() const { return m_policy; }
+
+  int getNumThreads() const { return m_numThreads; }
+
   bool hasUserQueryBox() const { return m_hasUserQueryBox; }
 
   void parse(int argc, char** argv, CLI::App& app)
@@ -426,6 +468,30 @@ public:
                 "individual queries")
       ->capture_default_str();
 
+    app
+      .add_option("-p,--policy",
+                  m_policyName,
+                  "execution policy of the batched query, one of: " +
+                    axom::getEnabledRuntimePolicyNames())
+      ->capture_default_str()
+      ->check(CLI::Validator(
+        [](std::string& name) -> std::string {
+          axom::RuntimePolicy policy;
+          return axom::parseRuntimePolicy(name, policy) &&
+              axom::isRuntimePolicyEnabled(policy) &&
+              (policy != axom::POLICY_THREAD ||
+               axom::supports_thread_exec<BatchedContainmentQuery>::value)
+            ? ""
+            : "unavailable execution policy '" + name + "'";
+        },
+        "POLICY"));
+
+    app
+      .add_option("-t,--threads",
+                  m_numThreads,
+                  "number of threads of the batched query (default: all)")
+      ->check(CLI::PositiveNumber);
+
     app.get_formatter()->column_width(35);
 
     // could throw an exception
@@ -435,6 +501,8 @@ public:
                                              : slic::message::Info);
 
     m_hasUserQueryBox = app.count("--min") == 3 && app.count("--max") == 3;
+
+    axom::parseRuntimePolicy(m_policyName, m_policy);
   }
 };
 
@@ -514,7 +582,9 @@ int main(int argc, char** argv)
     testContainmentOnRegularGrid(octree,
                                  queryBB,
                                  GridPt::make_point(res, res, res),
-                                 params.useBatchedQuery());
+                                 params.useBatchedQuery(),
+                                 params.getPolicy(),
+                                 params.getNumThreads());
   }
 
   if(!params.isVerbose())
@@ -402,6 +402,7 @@ void Buffer::detachFromAllViews()
 void* Buffer::allocateBytes(IndexType num_bytes, int allocID)
 {
   allocID = getValidAllocatorID(allocID);
+  axom::ScopedMemoryLabel memoryLabel("sidre::Buffer");
   return axom::allocate<axom::int8>(num_bytes, allocID);
 }
 
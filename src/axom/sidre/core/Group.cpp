@@ -6,6 +6,8 @@
 // Associated header file
 #include "Group.hpp"
 
+#include "axom/core/utilities/AnnotationMacros.hpp"
+
 #include "conduit_relay.hpp"
 
 #ifdef AXOM_USE_HDF5
@@ -1387,6 +1389,8 @@ void Group::save(const std::string& path,
                  const std::string& protocol,
                  const Attribute* attr) const
 {
+  AXOM_PERF_MARK_FUNCTION("sidre::Group::save");
+
   const DataStore* ds = getDataStore();
 
   if(protocol == "sidre_hdf5")
@@ -1460,6 +1464,8 @@ void Group::load(const std::string& path,
                  bool preserve_contents,
                  std::string& name_from_file)
 {
+  AXOM_PERF_MARK_FUNCTION("sidre::Group::load");
+
   if(protocol == "sidre_hdf5")
   {
     Node n;
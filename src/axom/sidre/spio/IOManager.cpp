@@ -7,6 +7,7 @@
 #include "IOManager.hpp"
 
 // Other axom headers
+#include "axom/core/utilities/AnnotationMacros.hpp"
 #include "axom/core/utilities/FileUtilities.hpp"
 
 // SiDRe project headers
@@ -153,6 +154,8 @@ void IOManager::write(sidre::Group* datagroup,
                       const std::string& protocol,
                       const std::string& tree_pattern)
 {
+  AXOM_PERF_MARK_FUNCTION("sidre::IOManager::write");
+
   if(m_baton)
   {
     if(m_baton->getNumFiles() != num_files)
@@ -275,6 +278,8 @@ void IOManager::read(sidre::Group* datagroup,
                      const std::string& protocol,
                      bool preserve_contents)
 {
+  AXOM_PERF_MARK_FUNCTION("sidre::IOManager::read");
+
   MPI_Barrier(m_mpi_comm);
 
   if(protocol == "sidre_hdf5")
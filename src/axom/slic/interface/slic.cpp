@@ -6,6 +6,8 @@
 #include "axom/slic/interface/slic.hpp"
 #include "axom/slic/internal/stacktrace.hpp"
 
+#include "axom/core/MemoryTracker.hpp"  // for axom::MemoryTracker
+
 #include <sstream>  // for std::ostringstream
 
 namespace axom
@@ -256,6 +258,15 @@ void logWarningMessage(const std::string& message,
   slic::logMessage(message::Warning, message, fileName, line);
 }
 
+//------------------------------------------------------------------------------
+void logMemoryStats(message::Level level)
+{
+  std::ostringstream oss;
+  axom::MemoryTracker::instance().print(oss);
+
+  slic::logMessage(level, oss.str());
+}
+
 //------------------------------------------------------------------------------
 void flushStreams()
 {
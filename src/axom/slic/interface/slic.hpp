@@ -231,6 +231,14 @@ void logWarningMessage(const std::string& message,
                        const std::string& fileName,
                        int line);
 
+/*!
+ * \brief Logs a summary of the memory allocated through axom::allocate(), per
+ *  allocator and per label, as recorded by the axom::MemoryTracker.
+ * \param [in] level the level of the message being logged (optional).
+ * \see axom::MemoryTracker
+ */
+void logMemoryStats(message::Level level = message::Info);
+
 /*!
  * \brief Flushes all streams.
  * \see Logger::flushStreams.
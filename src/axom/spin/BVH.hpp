@@ -13,6 +13,9 @@
 
 #include "axom/core/execution/execution_space.hpp"  // for execution spaces
 
+// axom primal includes
+#include "axom/primal/geometry/Point.hpp"  // for primal::Point
+
 // C/C++ includes
 #include <type_traits>  // for std::is_floating_point(), std::is_same()
 
@@ -31,6 +34,9 @@ namespace linear_bvh
 {
 template <typename FloatType, int NDIMS>
 struct BVHData;
+
+template <typename FloatType, int NDIMS>
+struct WideBVHData;
 }
 }  // namespace internal
 
@@ -43,6 +49,15 @@ enum BVHReturnCodes
   BVH_BUILD_OK,           //!< indicates that the BVH was generated successfully
 };
 
+/*!
+ * \brief Enumerates the strategies to build a BVH.
+ */
+enum BVHBuildStrategy
+{
+  BVH_MORTON_BUILD,  //!< linear BVH from the Morton codes of the boxes
+  BVH_SAH_BUILD      //!< top-down binned surface area heuristic (SAH) build
+};
+
 /*!
  * \class BVH
  *
@@ -126,6 +141,23 @@ private:
     "A valid execution space must be supplied to the BVH.");
 
 public:
+  /*!
+   * \brief The type of the query points passed to the distance functors of
+   *  the nearest neighbor queries.
+   */
+  using PointType = primal::Point<FloatType, NDIMS>;
+
+  /*!
+   * \brief Quality metrics of the BVH, see getQuality().
+   */
+  struct Quality
+  {
+    FloatType sahCost;       //!< the SAH cost, see getSurfaceAreaCost()
+    FloatType overlap;       //!< the average relative overlap of sibling bins
+    int maxDepth;            //!< the depth of the deepest leaf
+    FloatType averageDepth;  //!< the average depth of the leaves
+  };
+
   /*!
    * \brief Default constructor. Disabled.
    */
@@ -211,12 +243,211 @@ public:
    */
   FloatType getTolerance() const { return m_Tolernace; };
 
+  /*!
+   * \brief Sets whether the BVH is constructed using 64-bit Morton codes.
+   * \param [in] use64Bit flag that indicates whether to use 64-bit codes.
+   *
+   * \note By default, the BVH uses 30-bit Morton codes, i.e., 10 bits per
+   *  dimension. 64-bit Morton codes use 21 bits per dimension, which yields a
+   *  better spatial ordering of the boxes for large or highly clustered
+   *  inputs, at the expense of a slower build.
+   */
+  void setUse64BitMortonCodes(bool use64Bit)
+  {
+    m_use64BitMortonCodes = use64Bit;
+  };
+
+  /*!
+   * \brief Returns whether the BVH is constructed using 64-bit Morton codes.
+   * \return status true if 64-bit Morton codes are used, else, false.
+   */
+  bool getUse64BitMortonCodes() const { return m_use64BitMortonCodes; };
+
+  /*!
+   * \brief Sets the strategy used by build() to construct the BVH.
+   * \param [in] strategy the build strategy, see BVHBuildStrategy.
+   *
+   * \note By default, the BVH is built from the Morton codes of the boxes, in
+   *  parallel, in the execution space of the BVH. With BVH_SAH_BUILD, each
+   *  node is instead split where the surface area heuristic (SAH) cost of its
+   *  children is minimal, which yields tighter bins, e.g., for the elongated
+   *  triangles of CAD surfaces, hence faster queries. The SAH build runs
+   *  serially on the host and is typically an order of magnitude slower, it
+   *  pays off when the BVH is queried many times. Use getQuality() to compare
+   *  the strategies for a given input.
+   *
+   * \note The strategy takes effect on the next call to build().
+   */
+  void setBuildStrategy(BVHBuildStrategy strategy)
+  {
+    m_buildStrategy = strategy;
+  };
+
+  /*!
+   * \brief Returns the strategy used by build() to construct the BVH.
+   * \return strategy the build strategy, see BVHBuildStrategy.
+   */
+  BVHBuildStrategy getBuildStrategy() const { return m_buildStrategy; };
+
+  /*!
+   * \brief Sets the number of candidates buffered for each query by
+   *  findPoints(), findRays() and findBoundingBoxes().
+   * \param [in] capacity the number of candidates per query, or 0.
+   *
+   * \note By default, the capacity is 0 and the find methods traverse the BVH
+   *  twice, first to count the candidates of each query, then to store them.
+   *  With a positive capacity, the BVH is traversed once, into a temporary
+   *  buffer of capacity candidates per query. The queries that overflow their
+   *  buffer are flagged and traversed again, hence, the results are the same
+   *  for any capacity. A capacity that bounds the number of candidates of
+   *  most queries, e.g., from a previous call, pays off when the traversal
+   *  dominates the cost of the queries.
+   *
+   * \pre capacity >= 0
+   */
+  void setQueryCapacity(IndexType capacity);
+
+  /*!
+   * \brief Returns the number of candidates buffered for each query.
+   * \return capacity the capacity, 0 if the BVH is traversed twice.
+   */
+  IndexType getQueryCapacity() const { return m_queryCapacity; };
+
+  /*!
+   * \brief Sets the number of children of the inner nodes of the BVH that is
+   *  traversed by the queries.
+   * \param [in] width the number of children per node, i.e., 2, 4 or 8.
+   *
+   * \note By default, the width is 2, i.e., the queries traverse the binary
+   *  BVH. With a width of 4 or 8, build() collapses the binary BVH into a wide
+   *  BVH, whose nodes store the bins of their children contiguously, so that a
+   *  query is tested against all the children of a node at once, with vector
+   *  instructions, and the traversal visits fewer nodes. The results of the
+   *  queries are the same for any width.
+   *
+   * \note The wide BVH is only used on the host, i.e., with the SEQ_EXEC and
+   *  OMP_EXEC execution spaces. The device execution spaces, as well as the
+   *  nearest neighbor queries, traverse the binary BVH.
+   *
+   * \note The width takes effect on the next call to build().
+   *
+   * \pre width == 2 || width == 4 || width == 8
+   */
+  void setNodeWidth(int width) { m_nodeWidth = width; };
+
+  /*!
+   * \brief Returns the number of children of the inner nodes of the BVH.
+   * \return width the node width, see setNodeWidth().
+   */
+  int getNodeWidth() const { return m_nodeWidth; };
+
+  /*!
+   * \brief Sets whether the queries are processed in the Morton order of
+   *  their positions, rather than in the order in which they are supplied.
+   * \param [in] sortQueries flag that indicates whether to sort the queries.
+   *
+   * \note By default, the queries are processed in the order in which they
+   *  are supplied, e.g., in the order of the mesh, which may be spatially
+   *  incoherent, such that consecutive queries traverse unrelated subtrees of
+   *  the BVH. When set, the query points, the sources of the rays and the
+   *  centers of the query boxes are sorted by their Morton codes within the
+   *  bounds of the BVH, and the queries are processed in that order, such
+   *  that consecutive queries share the nodes they traverse in cache.
+   *
+   * \note The results are stored in the order in which the queries are
+   *  supplied, i.e., they are the same whether the queries are sorted or not,
+   *  and the candidateAction of the visit methods is called with the IDs of
+   *  the supplied queries. Sorting costs O(n) memory and a sort of n keys per
+   *  call, for n queries, it pays off for large incoherent batches.
+   */
+  void setSortQueries(bool sortQueries) { m_sortQueries = sortQueries; };
+
+  /*!
+   * \brief Returns whether the queries are processed in Morton order.
+   * \return status true if the queries are sorted, else, false.
+   */
+  bool getSortQueries() const { return m_sortQueries; };
+
   /*!
    * \brief Generates the BVH
    * \return status set to BVH_BUILD_OK on success.
    */
   int build();
 
+  /*!
+   * \brief Updates the BVH to enclose the supplied bounding boxes, without
+   *  rebuilding it.
+   *
+   * \param [in] boxes buffer consisting of the new bounding box of each item.
+   * \return status set to BVH_BUILD_OK on success, or to BVH_BUILD_FAILED if
+   *  the BVH was not built.
+   *
+   * \note The boxes array has the same layout and the same number of items as
+   *  the array supplied to the constructor, e.g., the boxes of a deforming
+   *  surface whose topology does not change. The topology of the BVH, which is
+   *  derived from the boxes supplied to the last call to build(), is kept,
+   *  and the bounds of its bins are recomputed bottom-up in
+   *  parallel. This is much cheaper than build(), but the quality of the BVH
+   *  degrades as the items move away from their positions at the time of the
+   *  build.
+   *
+   * \note The boxes supplied to refit() replace the boxes supplied to the
+   *  constructor, i.e., a subsequent call to build() uses them.
+   *
+   * \see getRefitCostRatio()
+   *
+   * \pre boxes != nullptr
+   */
+  int refit(const FloatType* boxes);
+
+  /*!
+   * \brief Returns the surface area heuristic (SAH) cost of the BVH.
+   *
+   * \return cost the sum of the surface areas of the bins of the BVH, relative
+   *  to the surface area of its bounds. In 2D, the perimeters are used.
+   *
+   * \note The SAH cost estimates the number of bins that a random query
+   *  visits, hence, the lower the cost the better the BVH. The cost is
+   *  computed on each call, in the execution space of the BVH.
+   *
+   * \pre The BVH was built.
+   */
+  FloatType getSurfaceAreaCost() const;
+
+  /*!
+   * \brief Returns the ratio of the SAH cost of the BVH after the last call
+   *  to refit(), to the SAH cost after the last call to build().
+   *
+   * \return ratio the SAH cost ratio, which is 1 if refit() was not called
+   *  since the last build().
+   *
+   * \note The ratio measures how much the BVH degraded due to refit(), e.g.,
+   *  a caller that refits a BVH on each cycle of a simulation may rebuild it
+   *  when the ratio exceeds a given threshold, so as to balance the cost of
+   *  build() with the cost of the queries. The current SAH cost is computed on
+   *  each call, hence, refit() does not pay for the metric unless it is used.
+   *
+   * \see getSurfaceAreaCost()
+   */
+  FloatType getRefitCostRatio() const;
+
+  /*!
+   * \brief Returns metrics of the quality of the BVH.
+   *
+   * \return quality the SAH cost of the BVH, the average overlap of the two
+   *  bins of its inner nodes, relative to the surface area of the node, and
+   *  the maximum and average depths of its leaves.
+   *
+   * \note The lower the metrics, the fewer nodes a query visits. The overlap
+   *  is the fraction of a node in which a query traverses both of its bins.
+   *  The metrics are computed on each call, in the execution space of the BVH.
+   *
+   * \see setBuildStrategy(), getSurfaceAreaCost()
+   *
+   * \pre The BVH was built.
+   */
+  Quality getQuality() const;
+
   /*!
    * \brief Returns the bounds of the BVH, given by the the root bounding box.
    *
@@ -253,6 +484,9 @@ public:
    *  * Stored in the candidates array in the following range:
    *    [ offsets[ i ], offsets[ i ]+counts[ i ] ]
    *
+   * \note The BVH is traversed once or twice per point, depending on the
+   *  query capacity, see setQueryCapacity().
+   *
    * \pre offsets != nullptr
    * \pre counts  != nullptr
    * \pre candidates == nullptr
@@ -354,6 +588,216 @@ public:
                          const FloatType* zmin = nullptr,
                          const FloatType* zmax = nullptr) const;
 
+  /*!
+   * \brief Calls the supplied functor on the candidate bins that contain each
+   *  of the query points, as they are found.
+   *
+   * \param [in]  numPts the total number of query points supplied
+   * \param [in]  candidateAction functor called on each candidate
+   * \param [in]  x array of x-coordinates
+   * \param [in]  y array of y-coordinates
+   * \param [in]  z array of z-coordinates, may be nullptr if 2D
+   *
+   * \note The BVH is traversed once for each point, in parallel over the
+   *  points, and the candidates are consumed during the traversal instead of
+   *  being stored, e.g., to test the items against the point right away. The
+   *  candidateAction functor has the following signature:
+   *  \code
+   *    AXOM_HOST_DEVICE void candidateAction( IndexType queryID,
+   *                                           IndexType itemID );
+   *  \endcode
+   *  and is called concurrently for different queries, in the order of the
+   *  traversal for a given query.
+   *
+   * \see findPoints()
+   *
+   * \pre x != nullptr
+   * \pre y != nullptr if dimension==2 || dimension==3
+   * \pre z != nullptr if dimension==3
+   */
+  template <typename CandidateFunctor>
+  void visitPoints(IndexType numPts,
+                   CandidateFunctor&& candidateAction,
+                   const FloatType* x,
+                   const FloatType* y,
+                   const FloatType* z = nullptr) const;
+
+  /*!
+   * \brief Calls the supplied functor on the candidate bins that intersect
+   *  each of the given rays, as they are found.
+   *
+   * \param [in] numRays the total number of rays
+   * \param [in] candidateAction functor called on each candidate
+   * \param [in] x0 array consisting the ray source point x-coordinates.
+   * \param [in] nx array consisting the ray normal x-components.
+   * \param [in] y0 array consisting the ray source point y-coordinates
+   * \param [in] ny array consisting the ray normal y-components
+   * \param [in] z0 array consisting the ray source point z-coorindates (in 3D)
+   * \param [in] nz array consisting the ray normal z-components (in 3D)
+   *
+   * \see visitPoints() for the signature of candidateAction, findRays()
+   */
+  template <typename CandidateFunctor>
+  void visitRays(IndexType numRays,
+                 CandidateFunctor&& candidateAction,
+                 const FloatType* x0,
+                 const FloatType* nx,
+                 const FloatType* y0,
+                 const FloatType* ny,
+                 const FloatType* z0 = nullptr,
+                 const FloatType* nz = nullptr) const;
+
+  /*!
+   * \brief Calls the supplied functor on the candidate bins that intersect
+   *  each of the given bounding boxes, as they are found.
+   *
+   * \param [in]  numBoxes the total number of bounding boxes
+   * \param [in]  candidateAction functor called on each candidate
+   * \param [in]  xmin array of x-coordinates of lower bounding box corner
+   * \param [in]  xmax array of x-coordinates of upper bounding box corner
+   * \param [in]  ymin array of y-coordinates of lower bounding box corner
+   * \param [in]  ymax array of y-coordinates of upper bounding box corner
+   * \param [in]  zmin array of z-coordinates of lower bounding box corner,
+   *              may be nullptr if 2D
+   * \param [in]  zmax array of z-coordinates of upper bounding box corner,
+   *              may be nullptr if 2D
+   *
+   * \see visitPoints() for the signature of candidateAction,
+   *  findBoundingBoxes()
+   */
+  template <typename CandidateFunctor>
+  void visitBoundingBoxes(IndexType numBoxes,
+                          CandidateFunctor&& candidateAction,
+                          const FloatType* xmin,
+                          const FloatType* xmax,
+                          const FloatType* ymin,
+                          const FloatType* ymax,
+                          const FloatType* zmin = nullptr,
+                          const FloatType* zmax = nullptr) const;
+
+  /*!
+   * \brief Finds the nearest item to each of the query points.
+   *
+   * \param [out] nearest array of the ID of the nearest item of each point
+   * \param [out] sqDistances array of the squared distance from each point to
+   *  its nearest item
+   * \param [in]  numPts the total number of query points supplied
+   * \param [in]  sqDistance functor that computes the exact squared distance
+   *  from a query point to an item
+   * \param [in]  x array of x-coordinates
+   * \param [in]  y array of y-coordinates
+   * \param [in]  z array of z-coordinates, may be nullptr if 2D
+   *
+   * \note Equivalent to findKNearest() with k=1.
+   *
+   * \see findKNearest()
+   */
+  template <typename DistanceFunctor>
+  void findNearest(IndexType* nearest,
+                   FloatType* sqDistances,
+                   IndexType numPts,
+                   DistanceFunctor&& sqDistance,
+                   const FloatType* x,
+                   const FloatType* y,
+                   const FloatType* z = nullptr) const;
+
+  /*!
+   * \brief Finds the k nearest items to each of the query points.
+   *
+   * \param [in]  k the number of nearest items to find for each point
+   * \param [out] nearest array of the IDs of the k nearest items of each point
+   * \param [out] sqDistances array of the squared distances from each point to
+   *  its k nearest items
+   * \param [in]  numPts the total number of query points supplied
+   * \param [in]  sqDistance functor that computes the exact squared distance
+   *  from a query point to an item
+   * \param [in]  x array of x-coordinates
+   * \param [in]  y array of y-coordinates
+   * \param [in]  z array of z-coordinates, may be nullptr if 2D
+   *
+   * \note The BVH is traversed best-first for each query point, in parallel
+   *  over the query points. Bins are visited in order of their distance to
+   *  the point, and the bins that are farther than the k-th nearest item found
+   *  so far are pruned. The sqDistance functor is only called on the items of
+   *  the leaves that are reached, and has the following signature:
+   *  \code
+   *    AXOM_HOST_DEVICE FloatType sqDistance( IndexType itemID,
+   *                                          const PointType& point );
+   *  \endcode
+   *  e.g., a device lambda that computes the squared distance from the point
+   *  to the triangle with the given ID. The squared distance to an item must
+   *  not be less than the squared distance to its bounding box, which holds
+   *  for any item that is contained in its bounding box.
+   *
+   * \note nearest and sqDistances are arrays of size k*numPts that are
+   *  pre-allocated by the caller. Upon completion, the k nearest items of the
+   *  ith query point are stored in increasing order of distance in the range
+   *  [ i*k, (i+1)*k ). If the BVH has fewer than k items, the remaining
+   *  entries are set to -1, with a squared distance of
+   *  floating_point_limits< FloatType >::max().
+   *
+   * \pre k > 0
+   * \pre nearest != nullptr
+   * \pre sqDistances != nullptr
+   * \pre x != nullptr
+   * \pre y != nullptr if dimension==2 || dimension==3
+   * \pre z != nullptr if dimension==3
+   */
+  template <typename DistanceFunctor>
+  void findKNearest(IndexType k,
+                    IndexType* nearest,
+                    FloatType* sqDistances,
+                    IndexType numPts,
+                    DistanceFunctor&& sqDistance,
+                    const FloatType* x,
+                    const FloatType* y,
+                    const FloatType* z = nullptr) const;
+
+  /*!
+   * \brief Writes the BVH to the specified binary file, to be reloaded with
+   *  readBinaryFile() instead of being rebuilt.
+   *
+   * \param [in] fileName the name of the binary file.
+   * \return status set to BVH_BUILD_OK on success, or to BVH_BUILD_FAILED if
+   *  the BVH was not built or the file could not be written.
+   *
+   * \note The file stores the binary BVH, its bounds, and a hash of the boxes
+   *  it was built over. The file is only portable across machines with the
+   *  same byte order.
+   *
+   * \see readBinaryFile()
+   */
+  int writeBinaryFile(const std::string& fileName) const;
+
+  /*!
+   * \brief Loads the BVH from the specified binary file, which was written by
+   *  writeBinaryFile(), in lieu of build().
+   *
+   * \param [in] fileName the name of the binary file.
+   * \return status set to BVH_BUILD_OK on success, or to BVH_BUILD_FAILED if
+   *  the file does not exist, is not a BVH file of this dimension and
+   *  precision, or was written by a BVH over other boxes.
+   *
+   * \note The boxes supplied to the constructor are hashed, in O(n) time, and
+   *  the BVH is only loaded if the hash, the number of items and the scale
+   *  factor match those stored in the file. Otherwise, the BVH is not
+   *  modified, and the caller is expected to call build(), e.g.:
+   *  \code
+   *    if( bvh.readBinaryFile( fileName ) != spin::BVH_BUILD_OK )
+   *    {
+   *      bvh.build();
+   *      bvh.writeBinaryFile( fileName );
+   *    }
+   *  \endcode
+   *
+   * \note The loaded BVH has the topology of the BVH that was written, i.e.,
+   *  the build strategy is ignored, and is collapsed to the current node
+   *  width, see setNodeWidth().
+   *
+   * \see writeBinaryFile()
+   */
+  int readBinaryFile(const std::string& fileName);
+
   /*!
    * \brief Writes the BVH to the specified VTK file for visualization.
    * \param [in] fileName the name of VTK file.
@@ -368,9 +812,16 @@ private:
   int m_AllocatorID;
   FloatType m_Tolernace;
   FloatType m_scaleFactor;
+  bool m_use64BitMortonCodes;
+  BVHBuildStrategy m_buildStrategy;
+  IndexType m_queryCapacity;
+  int m_nodeWidth;
+  bool m_sortQueries;
   IndexType m_numItems;
   const FloatType* m_boxes;
   internal::linear_bvh::BVHData<FloatType, NDIMS> m_bvh;
+  internal::linear_bvh::WideBVHData<FloatType, NDIMS> m_wideBvh;
+  FloatType m_buildCost;
 
   static constexpr FloatType DEFAULT_SCALE_FACTOR = 1.001;
   /// @}
@@ -0,0 +1,301 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+
+#include "axom/core/execution/execution_space.hpp"
+#include "axom/core/execution/sort.hpp"
+#include "axom/core/memory_management.hpp"
+#include "axom/core/Types.hpp"
+#include "axom/slic.hpp"
+#include "axom/spin/BVH.hpp"
+
+/*!
+ * \file
+ *
+ * \brief Measures the construction time of the linear BVH as a function of
+ *  the number of primitives, for 30-bit and 63-bit Morton codes, along with
+ *  the time to sort the Morton codes, which dominates the build on the CPU,
+ *  the time to refit an existing BVH to moved primitives, the time of the
+ *  SAH build, along with the quality of the resulting BVH, and the time to
+ *  reload a BVH from a binary file.
+ */
+
+//------------------------------------------------------------------------------
+namespace
+{
+constexpr int NDIMS = 3;
+constexpr unsigned int SEED = 42;
+
+// Generates N random boxes in the unit cube, sized such that neighboring
+// boxes overlap, using the BVH layout, i.e., xmin,ymin,zmin,xmax,ymax,zmax.
+// NOTE: Caller must deallocate the array
+double* generateRandomBoxes(int N)
+{
+  std::mt19937 gen(SEED);
+  std::uniform_real_distribution<double> dist(0., 1.);
+  const double h = 2. / std::cbrt(static_cast<double>(N));
+
+  double* boxes = axom::allocate<double>(2 * NDIMS * N);
+  for(int i = 0; i < N; ++i)
+  {
+    double* box = &boxes[2 * NDIMS * i];
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      box[d] = dist(gen);
+      box[NDIMS + d] = box[d] + h * dist(gen);
+    }
+  }
+
+  return boxes;
+}
+
+// Generates N random Morton codes that span the bits used by the BVH, i.e.,
+// 30 bits for uint32 codes and 63 bits for uint64 codes.
+template <typename MortonCodeType>
+std::vector<MortonCodeType> generateRandomCodes(int N)
+{
+  constexpr int NBITS = (sizeof(MortonCodeType) == 4) ? 30 : 63;
+  constexpr MortonCodeType MAX_CODE = (MortonCodeType(1) << NBITS) - 1;
+
+  std::mt19937_64 gen(SEED);
+  std::uniform_int_distribution<MortonCodeType> dist(0, MAX_CODE);
+
+  std::vector<MortonCodeType> codes(N);
+  for(auto& code : codes)
+  {
+    code = dist(gen);
+  }
+  return codes;
+}
+
+// From 1K to 4M primitives
+void CustomArgs(benchmark::internal::Benchmark* b)
+{
+  for(int N = 1 << 10; N <= 1 << 22; N <<= 2)
+  {
+    b->Arg(N);
+  }
+}
+
+// From 1K to 1M primitives, with the Morton and the SAH build strategies
+void StrategyArgs(benchmark::internal::Benchmark* b)
+{
+  for(int N = 1 << 10; N <= 1 << 20; N <<= 2)
+  {
+    b->ArgPair(N, axom::spin::BVH_MORTON_BUILD);
+    b->ArgPair(N, axom::spin::BVH_SAH_BUILD);
+  }
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace, typename MortonCodeType>
+void bvh_build(benchmark::State& state)
+{
+  const int N = state.range_x();
+  double* boxes = generateRandomBoxes(N);
+
+  while(state.KeepRunning())
+  {
+    axom::spin::BVH<NDIMS, ExecSpace, double> bvh(boxes, N);
+    bvh.setUse64BitMortonCodes(sizeof(MortonCodeType) == 8);
+    bvh.build();
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+
+  axom::deallocate(boxes);
+}
+BENCHMARK_TEMPLATE2(bvh_build, axom::SEQ_EXEC, axom::uint32)->Apply(CustomArgs);
+BENCHMARK_TEMPLATE2(bvh_build, axom::SEQ_EXEC, axom::uint64)->Apply(CustomArgs);
+#ifdef AXOM_USE_OPENMP
+BENCHMARK_TEMPLATE2(bvh_build, axom::OMP_EXEC, axom::uint32)->Apply(CustomArgs);
+BENCHMARK_TEMPLATE2(bvh_build, axom::OMP_EXEC, axom::uint64)->Apply(CustomArgs);
+#endif
+
+//------------------------------------------------------------------------------
+// Reports the quality of the BVH in the label, to trade the build time for
+// the query time
+template <typename ExecSpace>
+void bvh_build_strategy(benchmark::State& state)
+{
+  using BVHType = axom::spin::BVH<NDIMS, ExecSpace, double>;
+
+  const int N = state.range_x();
+  const auto strategy =
+    static_cast<axom::spin::BVHBuildStrategy>(state.range_y());
+  double* boxes = generateRandomBoxes(N);
+
+  while(state.KeepRunning())
+  {
+    BVHType bvh(boxes, N);
+    bvh.setBuildStrategy(strategy);
+    bvh.build();
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+
+  BVHType bvh(boxes, N);
+  bvh.setBuildStrategy(strategy);
+  bvh.build();
+  const typename BVHType::Quality quality = bvh.getQuality();
+
+  std::ostringstream label;
+  label << "sah=" << quality.sahCost << " overlap=" << quality.overlap
+        << " depth=" << quality.averageDepth << "/" << quality.maxDepth;
+  state.SetLabel(label.str());
+
+  axom::deallocate(boxes);
+}
+BENCHMARK_TEMPLATE(bvh_build_strategy, axom::SEQ_EXEC)->Apply(StrategyArgs);
+#ifdef AXOM_USE_OPENMP
+BENCHMARK_TEMPLATE(bvh_build_strategy, axom::OMP_EXEC)->Apply(StrategyArgs);
+#endif
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void bvh_refit(benchmark::State& state)
+{
+  const int N = state.range_x();
+  double* boxes = generateRandomBoxes(N);
+
+  axom::spin::BVH<NDIMS, ExecSpace, double> bvh(boxes, N);
+  bvh.build();
+
+  // moves the boxes back and forth, i.e., as a deforming geometry
+  double* moved = axom::allocate<double>(2 * NDIMS * N);
+  for(int i = 0; i < 2 * NDIMS * N; ++i)
+  {
+    moved[i] = boxes[i] + 1.e-3;
+  }
+
+  // NOTE: the first refit also records the SAH cost of the BVH as built
+  bvh.refit(moved);
+
+  int cycle = 0;
+  while(state.KeepRunning())
+  {
+    bvh.refit((++cycle % 2) ? moved : boxes);
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+
+  axom::deallocate(moved);
+  axom::deallocate(boxes);
+}
+BENCHMARK_TEMPLATE(bvh_refit, axom::SEQ_EXEC)->Apply(CustomArgs);
+#ifdef AXOM_USE_OPENMP
+BENCHMARK_TEMPLATE(bvh_refit, axom::OMP_EXEC)->Apply(CustomArgs);
+#endif
+
+//------------------------------------------------------------------------------
+// Reloads a BVH in lieu of a build, including the hash of the boxes
+template <typename ExecSpace>
+void bvh_read_binary_file(benchmark::State& state)
+{
+  const int N = state.range_x();
+  const std::string fileName = "spin_bvh_build_benchmark.bvh";
+  double* boxes = generateRandomBoxes(N);
+
+  axom::spin::BVH<NDIMS, ExecSpace, double> built(boxes, N);
+  built.build();
+  built.writeBinaryFile(fileName);
+
+  while(state.KeepRunning())
+  {
+    axom::spin::BVH<NDIMS, ExecSpace, double> bvh(boxes, N);
+    bvh.readBinaryFile(fileName);
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+
+  std::remove(fileName.c_str());
+  axom::deallocate(boxes);
+}
+BENCHMARK_TEMPLATE(bvh_read_binary_file, axom::SEQ_EXEC)->Apply(CustomArgs);
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace, typename MortonCodeType>
+void sort_mcodes_radix(benchmark::State& state)
+{
+  const int N = state.range_x();
+  const std::vector<MortonCodeType> codes =
+    generateRandomCodes<MortonCodeType>(N);
+
+  std::vector<MortonCodeType> keys(N);
+  std::vector<axom::int32> ids(N);
+  while(state.KeepRunning())
+  {
+    state.PauseTiming();
+    keys = codes;
+    state.ResumeTiming();
+
+    axom::sort_pairs<ExecSpace>(keys.data(), ids.data(), N);
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+BENCHMARK_TEMPLATE2(sort_mcodes_radix, axom::SEQ_EXEC, axom::uint32)
+  ->Apply(CustomArgs);
+BENCHMARK_TEMPLATE2(sort_mcodes_radix, axom::SEQ_EXEC, axom::uint64)
+  ->Apply(CustomArgs);
+BENCHMARK_TEMPLATE2(sort_mcodes_radix, axom::THREAD_EXEC<>, axom::uint32)
+  ->Apply(CustomArgs);
+BENCHMARK_TEMPLATE2(sort_mcodes_radix, axom::THREAD_EXEC<>, axom::uint64)
+  ->Apply(CustomArgs);
+#ifdef AXOM_USE_OPENMP
+BENCHMARK_TEMPLATE2(sort_mcodes_radix, axom::OMP_EXEC, axom::uint32)
+  ->Apply(CustomArgs);
+BENCHMARK_TEMPLATE2(sort_mcodes_radix, axom::OMP_EXEC, axom::uint64)
+  ->Apply(CustomArgs);
+#endif
+
+//------------------------------------------------------------------------------
+// Baseline: the comparison-based merge sort, used for non-integral keys
+template <typename ExecSpace, typename MortonCodeType>
+void sort_mcodes_merge(benchmark::State& state)
+{
+  const int N = state.range_x();
+  const std::vector<MortonCodeType> codes =
+    generateRandomCodes<MortonCodeType>(N);
+
+  std::vector<MortonCodeType> keys(N);
+  std::vector<axom::int32> ids(N);
+  while(state.KeepRunning())
+  {
+    state.PauseTiming();
+    keys = codes;
+    state.ResumeTiming();
+
+    axom::internal::cpu_sort_pairs<ExecSpace>(keys.data(), ids.data(), N);
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+BENCHMARK_TEMPLATE2(sort_mcodes_merge, axom::SEQ_EXEC, axom::uint32)
+  ->Apply(CustomArgs);
+BENCHMARK_TEMPLATE2(sort_mcodes_merge, axom::SEQ_EXEC, axom::uint64)
+  ->Apply(CustomArgs);
+#ifdef AXOM_USE_OPENMP
+BENCHMARK_TEMPLATE2(sort_mcodes_merge, axom::OMP_EXEC, axom::uint32)
+  ->Apply(CustomArgs);
+BENCHMARK_TEMPLATE2(sort_mcodes_merge, axom::OMP_EXEC, axom::uint64)
+  ->Apply(CustomArgs);
+#endif
+
+/// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+  ::benchmark::Initialize(&argc, argv);
+
+  axom::slic::UnitTestLogger logger;  // create & initialize test logger,
+
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
@@ -0,0 +1,253 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <cmath>
+#include <random>
+
+#include "benchmark/benchmark_api.h"
+
+#include "axom/core/execution/execution_space.hpp"
+#include "axom/core/memory_management.hpp"
+#include "axom/core/Types.hpp"
+#include "axom/slic.hpp"
+#include "axom/spin/BVH.hpp"
+
+/*!
+ * \file
+ *
+ * \brief Measures the point queries of the linear BVH as a function of the
+ *  number of primitives, with as many query points as primitives, when the
+ *  candidates are stored by traversing the BVH twice, or once with a bounded
+ *  buffer per query, when they are consumed during the traversal of the
+ *  binary BVH or of a wide BVH, and when the query points are processed in
+ *  the order in which they are supplied or in Morton order.
+ */
+
+//------------------------------------------------------------------------------
+namespace
+{
+constexpr int NDIMS = 3;
+constexpr unsigned int SEED = 42;
+
+// Generates N random boxes in the unit cube, sized such that neighboring
+// boxes overlap, using the BVH layout, i.e., xmin,ymin,zmin,xmax,ymax,zmax.
+// NOTE: Caller must deallocate the array
+double* generateRandomBoxes(int N)
+{
+  std::mt19937 gen(SEED);
+  std::uniform_real_distribution<double> dist(0., 1.);
+  const double h = 2. / std::cbrt(static_cast<double>(N));
+
+  double* boxes = axom::allocate<double>(2 * NDIMS * N);
+  for(int i = 0; i < N; ++i)
+  {
+    double* box = &boxes[2 * NDIMS * i];
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      box[d] = dist(gen);
+      box[NDIMS + d] = box[d] + h * dist(gen);
+    }
+  }
+
+  return boxes;
+}
+
+/// Random query points in the unit cube, allocated in the execution space
+struct QueryPoints
+{
+  explicit QueryPoints(int N)
+  {
+    std::mt19937 gen(SEED + 1);
+    std::uniform_real_distribution<double> dist(0., 1.);
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      coords[d] = axom::allocate<double>(N);
+      for(int i = 0; i < N; ++i)
+      {
+        coords[d][i] = dist(gen);
+      }
+    }
+  }
+
+  ~QueryPoints()
+  {
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      axom::deallocate(coords[d]);
+    }
+  }
+
+  double* coords[NDIMS];
+};
+
+// From 16K to 1M primitives, and query capacities of 0, i.e., two
+// traversals, 8 and 32 candidates per query
+void CapacityArgs(benchmark::internal::Benchmark* b)
+{
+  for(int N = 1 << 14; N <= 1 << 20; N <<= 2)
+  {
+    for(int capacity : {0, 8, 32})
+    {
+      b->ArgPair(N, capacity);
+    }
+  }
+}
+
+// From 16K to 1M primitives, and node widths of 2, i.e., the binary BVH,
+// 4 and 8
+void WidthArgs(benchmark::internal::Benchmark* b)
+{
+  for(int N = 1 << 14; N <= 1 << 20; N <<= 2)
+  {
+    for(int width : {2, 4, 8})
+    {
+      b->ArgPair(N, width);
+    }
+  }
+}
+
+// From 16K to 1M primitives, with the query points processed in the order in
+// which they are supplied, i.e., a random order, or in Morton order
+void OrderArgs(benchmark::internal::Benchmark* b)
+{
+  for(int N = 1 << 14; N <= 1 << 20; N <<= 2)
+  {
+    b->ArgPair(N, 0);
+    b->ArgPair(N, 1);
+  }
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void bvh_find_points(benchmark::State& state)
+{
+  const int N = state.range_x();
+  const int capacity = state.range_y();
+  double* boxes = generateRandomBoxes(N);
+  QueryPoints points(N);
+
+  axom::spin::BVH<NDIMS, ExecSpace, double> bvh(boxes, N);
+  bvh.build();
+  bvh.setQueryCapacity(capacity);
+
+  axom::IndexType* offsets = axom::allocate<axom::IndexType>(N);
+  axom::IndexType* counts = axom::allocate<axom::IndexType>(N);
+  while(state.KeepRunning())
+  {
+    axom::IndexType* candidates = nullptr;
+    bvh.findPoints(offsets,
+                   counts,
+                   candidates,
+                   N,
+                   points.coords[0],
+                   points.coords[1],
+                   points.coords[2]);
+    axom::deallocate(candidates);
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+
+  axom::deallocate(offsets);
+  axom::deallocate(counts);
+  axom::deallocate(boxes);
+}
+BENCHMARK_TEMPLATE(bvh_find_points, axom::SEQ_EXEC)->Apply(CapacityArgs);
+#ifdef AXOM_USE_OPENMP
+BENCHMARK_TEMPLATE(bvh_find_points, axom::OMP_EXEC)->Apply(CapacityArgs);
+#endif
+
+//------------------------------------------------------------------------------
+// Consumes the candidates during the traversal, e.g., to count them
+template <typename ExecSpace>
+void bvh_visit_points(benchmark::State& state)
+{
+  const int N = state.range_x();
+  const int width = state.range_y();
+  double* boxes = generateRandomBoxes(N);
+  QueryPoints points(N);
+
+  axom::spin::BVH<NDIMS, ExecSpace, double> bvh(boxes, N);
+  bvh.setNodeWidth(width);
+  bvh.build();
+
+  axom::IndexType* counts = axom::allocate<axom::IndexType>(N);
+  while(state.KeepRunning())
+  {
+    for(int i = 0; i < N; ++i)
+    {
+      counts[i] = 0;
+    }
+
+    bvh.visitPoints(
+      N,
+      AXOM_LAMBDA(axom::IndexType q, axom::IndexType AXOM_NOT_USED(item)) {
+        counts[q]++;
+      },
+      points.coords[0],
+      points.coords[1],
+      points.coords[2]);
+    benchmark::DoNotOptimize(counts);
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+
+  axom::deallocate(counts);
+  axom::deallocate(boxes);
+}
+BENCHMARK_TEMPLATE(bvh_visit_points, axom::SEQ_EXEC)->Apply(WidthArgs);
+#ifdef AXOM_USE_OPENMP
+BENCHMARK_TEMPLATE(bvh_visit_points, axom::OMP_EXEC)->Apply(WidthArgs);
+#endif
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void bvh_find_points_sorted(benchmark::State& state)
+{
+  const int N = state.range_x();
+  const bool sortQueries = (state.range_y() != 0);
+  double* boxes = generateRandomBoxes(N);
+  QueryPoints points(N);
+
+  axom::spin::BVH<NDIMS, ExecSpace, double> bvh(boxes, N);
+  bvh.setSortQueries(sortQueries);
+  bvh.build();
+
+  axom::IndexType* offsets = axom::allocate<axom::IndexType>(N);
+  axom::IndexType* counts = axom::allocate<axom::IndexType>(N);
+  while(state.KeepRunning())
+  {
+    axom::IndexType* candidates = nullptr;
+    bvh.findPoints(offsets,
+                   counts,
+                   candidates,
+                   N,
+                   points.coords[0],
+                   points.coords[1],
+                   points.coords[2]);
+    axom::deallocate(candidates);
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+
+  axom::deallocate(offsets);
+  axom::deallocate(counts);
+  axom::deallocate(boxes);
+}
+BENCHMARK_TEMPLATE(bvh_find_points_sorted, axom::SEQ_EXEC)->Apply(OrderArgs);
+#ifdef AXOM_USE_OPENMP
+BENCHMARK_TEMPLATE(bvh_find_points_sorted, axom::OMP_EXEC)->Apply(OrderArgs);
+#endif
+
+/// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+  ::benchmark::Initialize(&argc, argv);
+
+  axom::slic::UnitTestLogger logger;  // create & initialize test logger,
+
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
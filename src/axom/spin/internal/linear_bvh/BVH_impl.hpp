@@ -8,6 +8,7 @@
 
 #include "axom/core/Types.hpp"              // fixed bitwidth types
 #include "axom/core/execution/for_all.hpp"  // for generic for_all()
+#include "axom/core/execution/scan.hpp"     // for exclusive_scan()
 #include "axom/core/memory_management.hpp"  // for memory functions
 #include "axom/core/numerics/floating_point_limits.hpp"  // floating_point_limits
 #include "axom/core/utilities/AnnotationMacros.hpp"      // for annotations
@@ -18,13 +19,20 @@
 // linear bvh includes
 #include "axom/spin/internal/linear_bvh/aabb.hpp"
 #include "axom/spin/internal/linear_bvh/build_radix_tree.hpp"
+#include "axom/spin/internal/linear_bvh/build_sah_tree.hpp"
+#include "axom/spin/internal/linear_bvh/bvh_binaryio.hpp"
 #include "axom/spin/internal/linear_bvh/bvh_traverse.hpp"
 #include "axom/spin/internal/linear_bvh/bvh_vtkio.hpp"
 #include "axom/spin/internal/linear_bvh/BVHData.hpp"
+#include "axom/spin/internal/linear_bvh/collapse_bvh.hpp"
 #include "axom/spin/internal/linear_bvh/emit_bvh.hpp"
 #include "axom/spin/internal/linear_bvh/QueryAccessor.hpp"
+#include "axom/spin/internal/linear_bvh/refit_bvh.hpp"
+#include "axom/spin/internal/linear_bvh/sort_queries.hpp"
 #include "axom/spin/internal/linear_bvh/TraversalPredicates.hpp"
 #include "axom/spin/internal/linear_bvh/vec.hpp"
+#include "axom/spin/internal/linear_bvh/WideBVHData.hpp"
+#include "axom/spin/internal/linear_bvh/WideTraversalPredicates.hpp"
 
 // RAJA includes
 #include "RAJA/RAJA.hpp"
@@ -34,6 +42,7 @@
 #include <sstream>  // for std::ostringstream
 #include <string>   // for std::string
 #include <cstring>  // for memcpy
+#include <utility>  // for std::forward
 
 namespace axom
 {
@@ -93,39 +102,191 @@ using bounding_box_t = internal::linear_bvh::Vec<FloatType, NDIMS * 2>;
 #define BVH_LEAF_ACTION(_funcName, _node, _leafNodes) \
   auto _funcName = [&](_node, _leafNodes) -> void
 
+/*!
+ * \def BVH_DISTANCE
+ *
+ * \brief Macro that defines a functor that computes the distance to a bin,
+ *  for a best-first traversal.
+ *
+ * \param _distanceName the name of the functor, e.g., `leftDistance`
+ * \param _p the primitive type
+ * \param _s1 the 1st BVH segment consisting of the BVH bin information
+ * \param _s2 the 2nd BVH segment consisting of the BVH bin information
+ *
+ * \note The BVH_DISTANCE macro must be called where FloatType is defined.
+ *
+ * \note This macro is intended to be used internally by the BVH implementation.
+ */
+#define BVH_DISTANCE(_distanceName, _p, _s1, _s2) \
+  auto _distanceName = [=] AXOM_HOST_DEVICE(_p, _s1, _s2) -> FloatType
+
 namespace
 {
 /*!
- * \brief Performs a traversal to count the candidates for each query point.
+ * \brief Calls the supplied kernel on each of the N queries, in the supplied
+ *  order, or in the order of their IDs if the order is nullptr.
  *
+ * \note The kernel is called with the ID of a query, i.e., it stores the
+ *  results of the query in the caller's order, whatever the order in which
+ *  the queries are processed.
+ *
+ * \see bvh_query_order()
+ */
+template <typename ExecSpace, typename KernelType>
+void for_all_queries(IndexType N, const int32* order, KernelType&& kernel)
+{
+  if(order == nullptr)
+  {
+    for_all<ExecSpace>(N, std::forward<KernelType>(kernel));
+    return;
+  }
+
+  for_all<ExecSpace>(
+    N,
+    AXOM_LAMBDA(IndexType i) { kernel(static_cast<IndexType>(order[i])); });
+}
+
+/*!
+ * \brief Returns the order in which to process the queries, i.e., the Morton
+ *  order of their positions if requested, else, nullptr.
+ *
+ * \param [in] sortQueries indicates if the queries are sorted.
+ * \param [in] getPosition functor that returns the position of the ith query.
+ * \param [in] N the number of user-supplied queries
+ * \param [in] bvh_data the internal BVH data-structure.
+ * \param [in] allocatorID ID of the allocator used for all allocations.
+ *
+ * \note The caller must deallocate the order.
+ *
+ * \see for_all_queries(), BVH::setSortQueries()
+ */
+template <typename ExecSpace, typename PositionFunctor, typename FloatType, int NDIMS>
+int32* bvh_query_order(bool sortQueries,
+                       PositionFunctor&& getPosition,
+                       IndexType N,
+                       const lbvh::BVHData<FloatType, NDIMS>& bvh_data,
+                       int allocatorID)
+{
+  if(!sortQueries || N < 2)
+  {
+    return nullptr;
+  }
+
+  return lbvh::sort_queries<ExecSpace>(getPosition,
+                                       N,
+                                       bvh_data.m_bounds,
+                                       allocatorID);
+}
+
+/*!
+ * \brief Traverses the BVH with the given predicates, i.e., the wide BVH if
+ *  one was collapsed from the binary BVH, else, the binary BVH.
+ *
+ * \tparam ENABLE_WIDE indicates if the wide BVH may be traversed. It is false
+ *  for the device execution spaces, for which the wide BVH is not collapsed.
+ *
+ * \see make_traversal()
+ */
+template <typename FloatType, int NDIMS, bool ENABLE_WIDE, typename LeftPredicate, typename RightPredicate, typename WidePredicate>
+struct BVHTraversal
+{
+  using Wide4NodeType = lbvh::WideNode<FloatType, NDIMS, 4>;
+  using Wide8NodeType = lbvh::WideNode<FloatType, NDIMS, 8>;
+
+  const internal::vec4_t<FloatType>* inner_nodes;
+  const int32* leaf_nodes;
+  const Wide4NodeType* wide4_nodes;  // nullptr, unless the BVH is 4-wide
+  const Wide8NodeType* wide8_nodes;  // nullptr, unless the BVH is 8-wide
+  LeftPredicate leftCheck;
+  RightPredicate rightCheck;
+  WidePredicate wideCheck;
+
+  template <typename PrimitiveType, typename LeafAction>
+  AXOM_HOST_DEVICE inline void operator()(const PrimitiveType& p,
+                                          LeafAction&& leafAction) const
+  {
+    if(ENABLE_WIDE && wide4_nodes != nullptr)
+    {
+      lbvh::wide_bvh_traverse(wide4_nodes,
+                              leaf_nodes,
+                              p,
+                              wideCheck,
+                              leafAction);
+    }
+    else if(ENABLE_WIDE && wide8_nodes != nullptr)
+    {
+      lbvh::wide_bvh_traverse(wide8_nodes,
+                              leaf_nodes,
+                              p,
+                              wideCheck,
+                              leafAction);
+    }
+    else
+    {
+      lbvh::bvh_traverse(inner_nodes,
+                         leaf_nodes,
+                         p,
+                         leftCheck,
+                         rightCheck,
+                         leafAction);
+    }
+  }
+};
+
+/*!
+ * \brief Returns the traversal of the given BVH, with the given predicates.
+ *
+ * \param [in] bvh_data the internal binary BVH data-structure.
+ * \param [in] wide_data the internal wide BVH data-structure, if any.
  * \param [in] leftCheck functor for left bin predicate check.
  * \param [in] rightCheck functor for right bin predicate check.
- * \param [in] inner_nodes array of vec4s for the BVH inner nodes.
- * \param [in] leaf_nodes array of BVH leaf node indices
+ * \param [in] wideCheck functor for the predicate check of a wide node.
+ */
+template <typename ExecSpace, typename FloatType, int NDIMS, typename LeftPredicate, typename RightPredicate, typename WidePredicate>
+BVHTraversal<FloatType,
+             NDIMS,
+             !execution_space<ExecSpace>::onDevice(),
+             LeftPredicate,
+             RightPredicate,
+             WidePredicate>
+make_traversal(const lbvh::BVHData<FloatType, NDIMS>& bvh_data,
+               const lbvh::WideBVHData<FloatType, NDIMS>& wide_data,
+               LeftPredicate leftCheck,
+               RightPredicate rightCheck,
+               WidePredicate wideCheck)
+{
+  return {bvh_data.m_inner_nodes,
+          bvh_data.m_leaf_nodes,
+          (wide_data.m_width == 4) ? wide_data.template getNodes<4>() : nullptr,
+          (wide_data.m_width == 8) ? wide_data.template getNodes<8>() : nullptr,
+          leftCheck,
+          rightCheck,
+          wideCheck};
+}
+
+/*!
+ * \brief Performs a traversal to count the candidates for each query point.
+ *
+ * \param [in] traverse functor that traverses the BVH, see BVHTraversal.
  * \param [in] N the number of user-supplied query points
+ * \param [in] order the order of the query points, see for_all_queries().
  * \param [out] counts array of candidate counts for each query point.
  * \param [in] x user-supplied array of x-coordinates
  * \param [in] y user-supplied array of y-coordinates
  * \param [in] z user-supplied array of z-coordinates
- *
- * \return total_count the total count of candidates for all query points.
  */
-template <int NDIMS, typename ExecSpace, typename LeftPredicate, typename RightPredicate, typename FloatType>
-IndexType bvh_get_counts(LeftPredicate&& leftCheck,
-                         RightPredicate&& rightCheck,
-                         const internal::vec4_t<FloatType>* inner_nodes,
-                         const int32* leaf_nodes,
-                         IndexType N,
-                         IndexType* counts,
-                         const FloatType* x,
-                         const FloatType* y,
-                         const FloatType* z) noexcept
+template <int NDIMS, typename ExecSpace, typename TraversalFunctor, typename FloatType>
+void bvh_get_counts(TraversalFunctor&& traverse,
+                    IndexType N,
+                    const int32* order,
+                    IndexType* counts,
+                    const FloatType* x,
+                    const FloatType* y,
+                    const FloatType* z) noexcept
 {
   AXOM_PERF_MARK_FUNCTION("bvh_get_pointcounts");
 
   // sanity checks
-  SLIC_ASSERT(inner_nodes != nullptr);
-  SLIC_ASSERT(leaf_nodes != nullptr);
   SLIC_ERROR_IF(counts == nullptr, "supplied null pointer for counts!");
   SLIC_ERROR_IF(x == nullptr, "supplied null pointer for x-coordinates!");
   SLIC_ERROR_IF(y == nullptr, "supplied null pointer for y-coordinates!");
@@ -133,12 +294,10 @@ IndexType bvh_get_counts(LeftPredicate&& leftCheck,
                 "supplied null pointer for z-coordinates!");
 
   // STEP 1: count number of candidates for each query point
-  using reduce_pol = typename axom::execution_space<ExecSpace>::reduce_policy;
-  RAJA::ReduceSum<reduce_pol, IndexType> total_count(0);
-
   using QueryAccessor = lbvh::QueryAccessor<NDIMS, FloatType>;
-  for_all<ExecSpace>(
+  for_all_queries<ExecSpace>(
     N,
+    order,
     AXOM_LAMBDA(IndexType i) {
       int32 count = 0;
       point_t<FloatType, NDIMS> point;
@@ -151,28 +310,18 @@ IndexType bvh_get_counts(LeftPredicate&& leftCheck,
         count++;
       };
 
-      lbvh::bvh_traverse(inner_nodes,
-                         leaf_nodes,
-                         point,
-                         leftCheck,
-                         rightCheck,
-                         leafAction);
+      traverse(point, leafAction);
 
       counts[i] = count;
-      total_count += count;
     });
-
-  return (total_count.get());
 }
 
 /*!
  * \brief Performs a traversal to count the number of candidates for each ray.
  *
- * \param [in] leftCheck traversal predicate functor for left bin check.
- * \param [in] rightCheck traversal predicate functor for right bin check.
- * \param [in] inner_nodes array of vec4s for the BVH inner nodes.
- * \param [in] leaf_nodes array of BVH leaf node indices
+ * \param [in] traverse functor that traverses the BVH, see BVHTraversal.
  * \param [in] N the number of user-supplied rays in query.
+ * \param [in] order the order of the rays, see for_all_queries().
  * \param [out] counts array of length N with candidate counts for each ray.
  * \param [in] x0 array of length N with ray source point x-coordinates.
  * \param [in] nx array of length N with ray normal x-components.
@@ -180,28 +329,22 @@ IndexType bvh_get_counts(LeftPredicate&& leftCheck,
  * \param [in] ny array of length N with ray normal y-components.
  * \param [in] z0 array of length N with ray source point z-coordinates.
  * \param [in] nz array of length N with ray normal z-components.
- *
- * \return total_count the aggregate number of candidates for all rays.
  */
-template <int NDIMS, typename ExecSpace, typename LeftPredicate, typename RightPredicate, typename FloatType>
-IndexType bvh_get_raycounts(LeftPredicate&& leftCheck,
-                            RightPredicate&& rightCheck,
-                            const internal::vec4_t<FloatType>* inner_nodes,
-                            const int32* leaf_nodes,
-                            IndexType N,
-                            IndexType* counts,
-                            const FloatType* x0,
-                            const FloatType* nx,
-                            const FloatType* y0,
-                            const FloatType* ny,
-                            const FloatType* z0,
-                            const FloatType* nz) noexcept
+template <int NDIMS, typename ExecSpace, typename TraversalFunctor, typename FloatType>
+void bvh_get_raycounts(TraversalFunctor&& traverse,
+                       IndexType N,
+                       const int32* order,
+                       IndexType* counts,
+                       const FloatType* x0,
+                       const FloatType* nx,
+                       const FloatType* y0,
+                       const FloatType* ny,
+                       const FloatType* z0,
+                       const FloatType* nz) noexcept
 {
   AXOM_PERF_MARK_FUNCTION("bvh_get_raycounts");
 
   // sanity checks
-  SLIC_ASSERT(inner_nodes != nullptr);
-  SLIC_ASSERT(leaf_nodes != nullptr);
   SLIC_ERROR_IF(counts == nullptr, "supplied null pointer for counts!");
   SLIC_ERROR_IF(x0 == nullptr, "ray source x-coordinates array is null!");
   SLIC_ERROR_IF(nx == nullptr, "ray normal x-components array is null!");
@@ -213,12 +356,10 @@ IndexType bvh_get_raycounts(LeftPredicate&& leftCheck,
                 "ray normal z-components is null!");
 
   // STEP 1: count number of candidates for each query point
-  using reduce_pol = typename axom::execution_space<ExecSpace>::reduce_policy;
-  RAJA::ReduceSum<reduce_pol, IndexType> total_count(0);
-
   using QueryAccessor = lbvh::QueryAccessor<NDIMS, FloatType>;
-  for_all<ExecSpace>(
+  for_all_queries<ExecSpace>(
     N,
+    order,
     AXOM_LAMBDA(IndexType i) {
       int32 count = 0;
       ray_t<FloatType, NDIMS> ray;
@@ -231,29 +372,19 @@ IndexType bvh_get_raycounts(LeftPredicate&& leftCheck,
         count++;
       };
 
-      lbvh::bvh_traverse(inner_nodes,
-                         leaf_nodes,
-                         ray,
-                         leftCheck,
-                         rightCheck,
-                         leafAction);
+      traverse(ray, leafAction);
 
       counts[i] = count;
-      total_count += count;
     });
-
-  return (total_count.get());
 }
 
 /*!
  * \brief Performs a traversal to count the number of candidates for each
  *  bounding box.
  *
- * \param [in] leftCheck traversal predicate functor for left bin check.
- * \param [in] rightCheck traversal predicate functor for right bin check.
- * \param [in] inner_nodes array of vec4s for the BVH inner nodes.
- * \param [in] leaf_nodes array of BVH leaf node indices
+ * \param [in] traverse functor that traverses the BVH, see BVHTraversal.
  * \param [in] N the number of user-supplied bounding boxes in query.
+ * \param [in] order the order of the boxes, see for_all_queries().
  * \param [out] counts array of length N with candidate counts for each box.
  * \param [in] xmin array of x-coordinate of the lower bounding box corner
  * \param [in] xmax array of x-coordinate of the upper bounding box corner
@@ -261,29 +392,22 @@ IndexType bvh_get_raycounts(LeftPredicate&& leftCheck,
  * \param [in] ymax array of y-coordinate of the upper bounding box corner
  * \param [in] zmin array of z-coordinate of the lower bounding box corner
  * \param [in] zmax array of z-coordinate of the upper bounding box corner
- *
- * \return total_count the aggregate number of candidates for all bounding
- *  boxes.
  */
-template <int NDIMS, typename ExecSpace, typename LeftPredicate, typename RightPredicate, typename FloatType>
-IndexType bvh_get_boxcounts(LeftPredicate&& leftCheck,
-                            RightPredicate&& rightCheck,
-                            const internal::vec4_t<FloatType>* inner_nodes,
-                            const int32* leaf_nodes,
-                            IndexType N,
-                            IndexType* counts,
-                            const FloatType* xmin,
-                            const FloatType* xmax,
-                            const FloatType* ymin,
-                            const FloatType* ymax,
-                            const FloatType* zmin,
-                            const FloatType* zmax) noexcept
+template <int NDIMS, typename ExecSpace, typename TraversalFunctor, typename FloatType>
+void bvh_get_boxcounts(TraversalFunctor&& traverse,
+                       IndexType N,
+                       const int32* order,
+                       IndexType* counts,
+                       const FloatType* xmin,
+                       const FloatType* xmax,
+                       const FloatType* ymin,
+                       const FloatType* ymax,
+                       const FloatType* zmin,
+                       const FloatType* zmax) noexcept
 {
   AXOM_PERF_MARK_FUNCTION("bvh_get_boxcounts");
 
   // sanity checks
-  SLIC_ASSERT(inner_nodes != nullptr);
-  SLIC_ASSERT(leaf_nodes != nullptr);
   SLIC_ERROR_IF(counts == nullptr, "supplied null pointer for counts!");
   SLIC_ERROR_IF(xmin == nullptr,
                 "bounding box lower x-coordinates array is null!");
@@ -299,12 +423,10 @@ IndexType bvh_get_boxcounts(LeftPredicate&& leftCheck,
                 "bounding box upper z-coordinates array is null!");
 
   // STEP 1: count number of candidates for each query point
-  using reduce_pol = typename axom::execution_space<ExecSpace>::reduce_policy;
-  RAJA::ReduceSum<reduce_pol, IndexType> total_count(0);
-
   using QueryAccessor = lbvh::QueryAccessor<NDIMS, FloatType>;
-  for_all<ExecSpace>(
+  for_all_queries<ExecSpace>(
     N,
+    order,
     AXOM_LAMBDA(IndexType i) {
       int32 count = 0;
       bounding_box_t<FloatType, NDIMS> box;
@@ -317,18 +439,260 @@ IndexType bvh_get_boxcounts(LeftPredicate&& leftCheck,
         count++;
       };
 
-      lbvh::bvh_traverse(inner_nodes,
-                         leaf_nodes,
-                         box,
-                         leftCheck,
-                         rightCheck,
-                         leafAction);
+      traverse(box, leafAction);
 
       counts[i] = count;
-      total_count += count;
     });
+}
+
+/*!
+ * \brief Finds the candidates of each query with a single traversal, into a
+ *  buffer of bounded capacity per query.
+ *
+ * \param [in] getQuery functor that returns the ith query primitive.
+ * \param [in] traverse functor that traverses the BVH, see BVHTraversal.
+ * \param [in] N the number of user-supplied queries
+ * \param [in] order the order of the queries, see for_all_queries().
+ * \param [in] capacity the number of candidates buffered for each query.
+ * \param [out] offsets array of length N with the offset of each query.
+ * \param [out] counts array of length N with candidate counts for each query.
+ * \param [in] allocatorID ID of the allocator used for all allocations.
+ *
+ * \return candidates the array of the candidates of all queries.
+ *
+ * \note The traversal buffers the first capacity candidates of each query,
+ *  and counts all of them. A query with more candidates than the capacity
+ *  overflows, and is traversed again once its offset is known, directly into
+ *  the candidates array. Hence, the queries are traversed only once if the
+ *  capacity is large enough, at the expense of a buffer of N*capacity IDs.
+ */
+template <int NDIMS, typename ExecSpace, typename QueryFunctor, typename TraversalFunctor>
+IndexType* bvh_find_bounded(QueryFunctor&& getQuery,
+                            TraversalFunctor&& traverse,
+                            IndexType N,
+                            const int32* order,
+                            IndexType capacity,
+                            IndexType* offsets,
+                            IndexType* counts,
+                            int allocatorID)
+{
+  AXOM_PERF_MARK_FUNCTION("bvh_find_bounded");
+
+  SLIC_ASSERT(capacity > 0);
+  SLIC_ERROR_IF(offsets == nullptr, "supplied null pointer for offsets!");
+  SLIC_ERROR_IF(counts == nullptr, "supplied null pointer for counts!");
+
+  IndexType* buffer = axom::allocate<IndexType>(
+    static_cast<std::size_t>(N) * capacity,
+    allocatorID);
+
+  // STEP 1: buffer the first candidates of each query, and count all of them
+  AXOM_PERF_MARK_SECTION(
+    "PASS[1]:buffered_traversal",
+    for_all_queries<ExecSpace>(
+      N,
+      order,
+      AXOM_LAMBDA(IndexType i) {
+        IndexType* query_buffer =
+          buffer + static_cast<std::size_t>(i) * capacity;
+        IndexType count = 0;
+        const auto query = getQuery(i);
+
+        BVH_LEAF_ACTION(leafAction, int32 current_node, const int32* leaf_nodes)
+        {
+          if(count < capacity)
+          {
+            query_buffer[count] = leaf_nodes[current_node];
+          }
+          count++;
+        };
+
+        traverse(query, leafAction);
+
+        counts[i] = count;
+      }););
+
+  IndexType total_candidates = 0;
+  AXOM_PERF_MARK_SECTION(
+    "exclusive_scan",
+    total_candidates = axom::exclusive_scan<ExecSpace>(counts, N, offsets););
+
+  IndexType* candidates = nullptr;
+  AXOM_PERF_MARK_SECTION(
+    "allocate_candidates",
+    candidates = axom::allocate<IndexType>(total_candidates, allocatorID););
+
+  // STEP 2: compact the buffers, and traverse again for the queries that
+  // overflowed their buffer
+  AXOM_PERF_MARK_SECTION(
+    "PASS[2]:compact_or_retry",
+    for_all_queries<ExecSpace>(
+      N,
+      order,
+      AXOM_LAMBDA(IndexType i) {
+        IndexType offset = offsets[i];
+
+        if(counts[i] <= capacity)
+        {
+          const IndexType* query_buffer =
+            buffer + static_cast<std::size_t>(i) * capacity;
+          for(IndexType j = 0; j < counts[i]; ++j)
+          {
+            candidates[offset + j] = query_buffer[j];
+          }
+          return;
+        }
+
+        const auto query = getQuery(i);
+
+        BVH_LEAF_ACTION(leafAction, int32 current_node, const int32* leaf_nodes)
+        {
+          candidates[offset] = leaf_nodes[current_node];
+          offset++;
+        };
+
+        traverse(query, leafAction);
+      }););
+
+  axom::deallocate(buffer);
+  return candidates;
+}
+
+/*!
+ * \brief Traverses the BVH for each query, and calls the supplied functor on
+ *  each candidate as it is found.
+ *
+ * \param [in] getQuery functor that returns the ith query primitive.
+ * \param [in] traverse functor that traverses the BVH, see BVHTraversal.
+ * \param [in] N the number of user-supplied queries
+ * \param [in] order the order of the queries, see for_all_queries().
+ * \param [in] candidateAction functor called with the query and item IDs.
+ */
+template <int NDIMS, typename ExecSpace, typename QueryFunctor, typename TraversalFunctor, typename CandidateFunctor>
+void bvh_visit_candidates(QueryFunctor&& getQuery,
+                          TraversalFunctor&& traverse,
+                          IndexType N,
+                          const int32* order,
+                          CandidateFunctor&& candidateAction)
+{
+  AXOM_PERF_MARK_FUNCTION("bvh_visit_candidates");
+
+  for_all_queries<ExecSpace>(
+    N,
+    order,
+    AXOM_LAMBDA(IndexType i) {
+      const auto query = getQuery(i);
+
+      BVH_LEAF_ACTION(leafAction, int32 current_node, const int32* leaf_nodes)
+      {
+        candidateAction(i, static_cast<IndexType>(leaf_nodes[current_node]));
+      };
+
+      traverse(query, leafAction);
+    });
+}
 
-  return (total_count.get());
+/*!
+ * \brief Builds a radix tree over the given boxes, using Morton codes of the
+ *  given type, or a tree that minimizes the SAH cost, and emits the
+ *  corresponding BVH.
+ *
+ * \param [in] boxes array of the bounding boxes, 2*NDIMS entries per box.
+ * \param [in] numBoxes the number of boxes.
+ * \param [in] strategy the strategy used to build the tree.
+ * \param [in] scaleFactor scale factor applied to each box.
+ * \param [in] allocatorID ID of the allocator used for all allocations.
+ * \param [out] bvh_data the internal BVH data-structure to populate.
+ *
+ * \tparam MortonCodeType uint32 or uint64. Using 64-bit codes yields a finer
+ *  spatial ordering for large or highly clustered inputs, at the expense of
+ *  more expensive sorting.
+ */
+template <typename ExecSpace, typename MortonCodeType, typename FloatType, int NDIMS>
+void bvh_build(const FloatType* boxes,
+               int numBoxes,
+               BVHBuildStrategy strategy,
+               FloatType scaleFactor,
+               int allocatorID,
+               lbvh::BVHData<FloatType, NDIMS>& bvh_data)
+{
+  // Build a RadixTree consisting of the bounding boxes, sorted
+  // by their corresponding morton code, or split where the SAH cost is minimal
+  lbvh::RadixTree<FloatType, NDIMS, MortonCodeType> radix_tree;
+  lbvh::AABB<FloatType, NDIMS> global_bounds;
+  if(strategy == BVH_SAH_BUILD)
+  {
+    lbvh::build_sah_tree<ExecSpace>(boxes,
+                                    numBoxes,
+                                    global_bounds,
+                                    radix_tree,
+                                    scaleFactor,
+                                    allocatorID);
+  }
+  else
+  {
+    lbvh::build_radix_tree<ExecSpace>(boxes,
+                                      numBoxes,
+                                      global_bounds,
+                                      radix_tree,
+                                      scaleFactor,
+                                      allocatorID);
+  }
+
+  // emit the BVH data-structure from the radix tree
+  bvh_data.m_bounds = global_bounds;
+  bvh_data.allocate(numBoxes, allocatorID);
+
+  lbvh::emit_bvh<ExecSpace>(radix_tree, bvh_data);
+
+  radix_tree.deallocate();
+}
+
+/*!
+ * \brief Collapses the given BVH into a wide BVH with the given node width,
+ *  if the width is 4 or 8 and the BVH is on the host.
+ *
+ * \param [in] width the number of children per node of the wide BVH.
+ * \param [in] allocatorID ID of the allocator used for the wide BVH.
+ * \param [in] bvh_data the internal binary BVH data-structure.
+ * \param [out] wide_data the internal wide BVH data-structure to populate.
+ *
+ * \note The previous wide BVH, if any, is deallocated. The wide BVH is not
+ *  populated if the width is 2, in which case the queries traverse the binary
+ *  BVH.
+ */
+template <typename ExecSpace, typename FloatType, int NDIMS>
+void bvh_collapse(int width,
+                  int allocatorID,
+                  const lbvh::BVHData<FloatType, NDIMS>& bvh_data,
+                  lbvh::WideBVHData<FloatType, NDIMS>& wide_data)
+{
+  wide_data.deallocate();
+
+  if(width == 2)
+  {
+    return;
+  }
+
+  if(execution_space<ExecSpace>::onDevice())
+  {
+    SLIC_WARNING("A wide BVH is only supported on the host, "
+                 "traversing the binary BVH instead!");
+    return;
+  }
+
+  switch(width)
+  {
+  case 4:
+    lbvh::collapse_bvh<4>(bvh_data, allocatorID, wide_data);
+    break;
+  case 8:
+    lbvh::collapse_bvh<8>(bvh_data, allocatorID, wide_data);
+    break;
+  default:
+    SLIC_WARNING("Unsupported BVH node width [" << width
+                                                << "], expected 2, 4 or 8!");
+  }
 }
 
 } /* end anonymous namespace */
@@ -343,8 +707,14 @@ BVH<NDIMS, ExecSpace, FloatType>::BVH(const FloatType* boxes,
   : m_AllocatorID(allocatorID)
   , m_Tolernace(floating_point_limits<FloatType>::epsilon())
   , m_scaleFactor(DEFAULT_SCALE_FACTOR)
+  , m_use64BitMortonCodes(false)
+  , m_buildStrategy(BVH_MORTON_BUILD)
+  , m_queryCapacity(0)
+  , m_nodeWidth(2)
+  , m_sortQueries(false)
   , m_numItems(numItems)
   , m_boxes(boxes)
+  , m_buildCost(0)
 { }
 
 //------------------------------------------------------------------------------
@@ -352,6 +722,15 @@ template <int NDIMS, typename ExecSpace, typename FloatType>
 BVH<NDIMS, ExecSpace, FloatType>::~BVH()
 {
   m_bvh.deallocate();
+  m_wideBvh.deallocate();
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType>
+void BVH<NDIMS, ExecSpace, FloatType>::setQueryCapacity(IndexType capacity)
+{
+  SLIC_ASSERT(capacity >= 0);
+  m_queryCapacity = capacity;
 }
 
 //------------------------------------------------------------------------------
@@ -359,6 +738,7 @@ template <int NDIMS, typename ExecSpace, typename FloatType>
 int BVH<NDIMS, ExecSpace, FloatType>::build()
 {
   AXOM_PERF_MARK_FUNCTION("BVH::build");
+  axom::ScopedMemoryLabel memoryLabel("spin::BVH");
 
   // STEP 1: Handle case when user supplied a single bounding box
   int numBoxes = m_numItems;
@@ -384,26 +764,33 @@ int BVH<NDIMS, ExecSpace, FloatType>::build()
   }
 
   // STEP 2: Build a RadixTree consisting of the bounding boxes, sorted
-  // by their corresponding morton code.
-  lbvh::RadixTree<FloatType, NDIMS> radix_tree;
-  lbvh::AABB<FloatType, NDIMS> global_bounds;
-  lbvh::build_radix_tree<ExecSpace>(boxesptr,
-                                    numBoxes,
-                                    global_bounds,
-                                    radix_tree,
-                                    m_scaleFactor,
-                                    m_AllocatorID);
-
-  // STEP 3: emit the BVH data-structure from the radix tree
-  m_bvh.m_bounds = global_bounds;
-  m_bvh.allocate(numBoxes, m_AllocatorID);
-
-  // STEP 4: emit the BVH
-  lbvh::emit_bvh<ExecSpace>(radix_tree, m_bvh);
+  // by their corresponding morton code, and emit the BVH from it.
+  // NOTE: the SAH build does not use the Morton codes
+  m_bvh.deallocate();
+  m_buildCost = 0;
+  if(m_use64BitMortonCodes && m_buildStrategy == BVH_MORTON_BUILD)
+  {
+    bvh_build<ExecSpace, axom::uint64>(boxesptr,
+                                       numBoxes,
+                                       m_buildStrategy,
+                                       m_scaleFactor,
+                                       m_AllocatorID,
+                                       m_bvh);
+  }
+  else
+  {
+    bvh_build<ExecSpace, axom::uint32>(boxesptr,
+                                       numBoxes,
+                                       m_buildStrategy,
+                                       m_scaleFactor,
+                                       m_AllocatorID,
+                                       m_bvh);
+  }
 
-  radix_tree.deallocate();
+  // STEP 3: collapse the BVH into a wide BVH, if requested
+  bvh_collapse<ExecSpace>(m_nodeWidth, m_AllocatorID, m_bvh, m_wideBvh);
 
-  // STEP 5: deallocate boxesptr if user supplied a single box
+  // STEP 4: deallocate boxesptr if user supplied a single box
   if(m_numItems == 1)
   {
     SLIC_ASSERT(boxesptr != m_boxes);
@@ -413,6 +800,89 @@ int BVH<NDIMS, ExecSpace, FloatType>::build()
   return BVH_BUILD_OK;
 }
 
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType>
+int BVH<NDIMS, ExecSpace, FloatType>::refit(const FloatType* boxes)
+{
+  AXOM_PERF_MARK_FUNCTION("BVH::refit");
+  axom::ScopedMemoryLabel memoryLabel("spin::BVH");
+
+  SLIC_ASSERT(boxes != nullptr);
+
+  if(m_bvh.m_inner_nodes == nullptr)
+  {
+    SLIC_WARNING("BVH::refit() requires a BVH that was built!");
+    return BVH_BUILD_FAILED;
+  }
+
+  // NOTE: a single item is stored along with a fake box, see build()
+  const int32 numBoxes = m_numItems;
+  const int32 size = (m_numItems == 1) ? 2 : numBoxes;
+
+  // STEP 1: record the cost of the BVH as built, before the first refit
+  if(m_buildCost == 0)
+  {
+    m_buildCost = lbvh::sah_cost<ExecSpace>(m_bvh, size);
+  }
+
+  // STEP 2: update the bins and the bounds, keeping the topology
+  m_boxes = boxes;
+  lbvh::refit_bvh<ExecSpace>(boxes,
+                             numBoxes,
+                             size,
+                             m_scaleFactor,
+                             m_AllocatorID,
+                             m_bvh);
+
+  // STEP 3: collapse the refitted BVH, since the wide BVH shares its bins
+  bvh_collapse<ExecSpace>(m_nodeWidth, m_AllocatorID, m_bvh, m_wideBvh);
+
+  return BVH_BUILD_OK;
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType>
+FloatType BVH<NDIMS, ExecSpace, FloatType>::getSurfaceAreaCost() const
+{
+  SLIC_ASSERT(m_bvh.m_inner_nodes != nullptr);
+
+  const int32 size = (m_numItems == 1) ? 2 : m_numItems;
+  return lbvh::sah_cost<ExecSpace>(m_bvh, size);
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType>
+FloatType BVH<NDIMS, ExecSpace, FloatType>::getRefitCostRatio() const
+{
+  // NOTE: the build cost is only recorded by refit()
+  return (m_buildCost > 0) ? getSurfaceAreaCost() / m_buildCost : 1;
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType>
+typename BVH<NDIMS, ExecSpace, FloatType>::Quality
+BVH<NDIMS, ExecSpace, FloatType>::getQuality() const
+{
+  AXOM_PERF_MARK_FUNCTION("BVH::getQuality");
+
+  SLIC_ASSERT(m_bvh.m_inner_nodes != nullptr);
+
+  const int32 size = (m_numItems == 1) ? 2 : m_numItems;
+
+  Quality quality;
+  int32 max_depth = 0;
+  quality.sahCost = lbvh::sah_cost<ExecSpace>(m_bvh, size);
+  lbvh::tree_quality<ExecSpace>(m_bvh,
+                                size,
+                                m_AllocatorID,
+                                quality.overlap,
+                                max_depth,
+                                quality.averageDepth);
+  quality.maxDepth = max_depth;
+
+  return quality;
+}
+
 //------------------------------------------------------------------------------
 template <int NDIMS, typename ExecSpace, typename FloatType>
 void BVH<NDIMS, ExecSpace, FloatType>::getBounds(FloatType* min,
@@ -435,6 +905,7 @@ void BVH<NDIMS, ExecSpace, FloatType>::findPoints(IndexType* offsets,
                                                   const FloatType* z) const
 {
   AXOM_PERF_MARK_FUNCTION("BVH::findPoints");
+  axom::ScopedMemoryLabel memoryLabel("spin::BVH");
 
   SLIC_ASSERT(offsets != nullptr);
   SLIC_ASSERT(counts != nullptr);
@@ -444,13 +915,12 @@ void BVH<NDIMS, ExecSpace, FloatType>::findPoints(IndexType* offsets,
 
   using PointType = point_t<FloatType, NDIMS>;
   using TraversalPredicates = lbvh::TraversalPredicates<NDIMS, FloatType>;
+  using WidePredicate = lbvh::WidePointPredicate<NDIMS, FloatType>;
   using QueryAccessor = lbvh::QueryAccessor<NDIMS, FloatType>;
 
-  // STEP 1: Grab BVH pointers
-  const internal::vec4_t<FloatType>* inner_nodes = m_bvh.m_inner_nodes;
-  const int32* leaf_nodes = m_bvh.m_leaf_nodes;
-  SLIC_ASSERT(inner_nodes != nullptr);
-  SLIC_ASSERT(leaf_nodes != nullptr);
+  // STEP 1: check that the BVH was built
+  SLIC_ASSERT(m_bvh.m_inner_nodes != nullptr);
+  SLIC_ASSERT(m_bvh.m_leaf_nodes != nullptr);
 
   // STEP 2: define traversal predicates
   BVH_PREDICATE(leftPredicate,
@@ -469,38 +939,69 @@ void BVH<NDIMS, ExecSpace, FloatType>::findPoints(IndexType* offsets,
     return TraversalPredicates::pointInRightBin(p, s2, s3);
   };
 
-  // STEP 3: get counts
-  int total_count = 0;
+  // NOTE: the wide BVH is traversed instead, if it was collapsed on the host
+  const auto traverse = make_traversal<ExecSpace>(m_bvh,
+                                                  m_wideBvh,
+                                                  leftPredicate,
+                                                  rightPredicate,
+                                                  WidePredicate {});
+
+  auto getPoint = AXOM_LAMBDA(IndexType i)->PointType
+  {
+    PointType point;
+    QueryAccessor::getPoint(point, i, x, y, z);
+    return point;
+  };
+
+  // STEP 3: process the points in Morton order, if requested
+  int32* order = bvh_query_order<ExecSpace>(m_sortQueries,
+                                            getPoint,
+                                            numPts,
+                                            m_bvh,
+                                            m_AllocatorID);
+
+  // STEP 4: single traversal with a bounded buffer per point, if requested
+  if(m_queryCapacity > 0)
+  {
+    candidates = bvh_find_bounded<NDIMS, ExecSpace>(getPoint,
+                                                    traverse,
+                                                    numPts,
+                                                    order,
+                                                    m_queryCapacity,
+                                                    offsets,
+                                                    counts,
+                                                    m_AllocatorID);
+    axom::deallocate(order);
+    return;
+  }
+
+  // STEP 5: get counts
   AXOM_PERF_MARK_SECTION(
     "PASS[1]:count_traversal",
-    total_count = bvh_get_counts<NDIMS, ExecSpace>(leftPredicate,
-                                                   rightPredicate,
-                                                   inner_nodes,
-                                                   leaf_nodes,
-                                                   numPts,
-                                                   counts,
-                                                   x,
-                                                   y,
-                                                   z););
-
-  using exec_policy = typename axom::execution_space<ExecSpace>::loop_policy;
+    bvh_get_counts<NDIMS, ExecSpace>(traverse,
+                                     numPts,
+                                     order,
+                                     counts,
+                                     x,
+                                     y,
+                                     z););
+
+  IndexType total_candidates = 0;
   AXOM_PERF_MARK_SECTION(
     "exclusive_scan",
-    RAJA::exclusive_scan<exec_policy>(counts,
-                                      counts + numPts,
-                                      offsets,
-                                      RAJA::operators::plus<IndexType> {}););
+    total_candidates =
+      axom::exclusive_scan<ExecSpace>(counts, numPts, offsets););
 
   AXOM_PERF_MARK_SECTION(
     "allocate_candidates",
-    IndexType total_candidates = static_cast<IndexType>(total_count);
     candidates = axom::allocate<IndexType>(total_candidates, m_AllocatorID););
 
-  // STEP 4: fill in candidates for each point
+  // STEP 6: fill in candidates for each point
   AXOM_PERF_MARK_SECTION(
     "PASS[2]:fill_traversal",
-    for_all<ExecSpace>(
+    for_all_queries<ExecSpace>(
       numPts,
+      order,
       AXOM_LAMBDA(IndexType i) {
         int32 offset = offsets[i];
 
@@ -513,13 +1014,10 @@ void BVH<NDIMS, ExecSpace, FloatType>::findPoints(IndexType* offsets,
           offset++;
         };
 
-        lbvh::bvh_traverse(inner_nodes,
-                           leaf_nodes,
-                           point,
-                           leftPredicate,
-                           rightPredicate,
-                           leafAction);
+        traverse(point, leafAction);
       }););
+
+  axom::deallocate(order);
 }
 
 //------------------------------------------------------------------------------
@@ -536,6 +1034,7 @@ void BVH<NDIMS, ExecSpace, FloatType>::findRays(IndexType* offsets,
                                                 const FloatType* nz) const
 {
   AXOM_PERF_MARK_FUNCTION("BVH::findRays");
+  axom::ScopedMemoryLabel memoryLabel("spin::BVH");
 
   SLIC_ASSERT(offsets != nullptr);
   SLIC_ASSERT(counts != nullptr);
@@ -547,15 +1046,15 @@ void BVH<NDIMS, ExecSpace, FloatType>::findRays(IndexType* offsets,
 
   const FloatType TOL = m_Tolernace;
 
+  using PointType = point_t<FloatType, NDIMS>;
   using RayType = ray_t<FloatType, NDIMS>;
   using TraversalPredicates = lbvh::TraversalPredicates<NDIMS, FloatType>;
+  using WidePredicate = lbvh::WideRayPredicate<NDIMS, FloatType>;
   using QueryAccessor = lbvh::QueryAccessor<NDIMS, FloatType>;
 
-  // STEP 1: Grab BVH pointers
-  const internal::vec4_t<FloatType>* inner_nodes = m_bvh.m_inner_nodes;
-  const int32* leaf_nodes = m_bvh.m_leaf_nodes;
-  SLIC_ASSERT(inner_nodes != nullptr);
-  SLIC_ASSERT(leaf_nodes != nullptr);
+  // STEP 1: check that the BVH was built
+  SLIC_ASSERT(m_bvh.m_inner_nodes != nullptr);
+  SLIC_ASSERT(m_bvh.m_leaf_nodes != nullptr);
 
   // STEP 2: define traversal predicates
   BVH_PREDICATE(leftPredicate,
@@ -574,41 +1073,80 @@ void BVH<NDIMS, ExecSpace, FloatType>::findRays(IndexType* offsets,
     return TraversalPredicates::rayIntersectsRightBin(r, s2, s3, TOL);
   };
 
-  // STEP 3: get counts
-  int total_count = 0;
+  // NOTE: the wide BVH is traversed instead, if it was collapsed on the host
+  const auto traverse = make_traversal<ExecSpace>(m_bvh,
+                                                  m_wideBvh,
+                                                  leftPredicate,
+                                                  rightPredicate,
+                                                  WidePredicate {TOL});
+
+  auto getSource = AXOM_LAMBDA(IndexType i)->PointType
+  {
+    PointType source;
+    QueryAccessor::getPoint(source, i, x0, y0, z0);
+    return source;
+  };
+
+  // STEP 3: process the rays in the Morton order of their sources, if
+  // requested
+  int32* order = bvh_query_order<ExecSpace>(m_sortQueries,
+                                            getSource,
+                                            numRays,
+                                            m_bvh,
+                                            m_AllocatorID);
+
+  // STEP 4: single traversal with a bounded buffer per ray, if requested
+  if(m_queryCapacity > 0)
+  {
+    auto getRay = AXOM_LAMBDA(IndexType i)->RayType
+    {
+      RayType ray;
+      QueryAccessor::getRay(ray, i, x0, nx, y0, ny, z0, nz);
+      return ray;
+    };
+
+    candidates = bvh_find_bounded<NDIMS, ExecSpace>(getRay,
+                                                    traverse,
+                                                    numRays,
+                                                    order,
+                                                    m_queryCapacity,
+                                                    offsets,
+                                                    counts,
+                                                    m_AllocatorID);
+    axom::deallocate(order);
+    return;
+  }
+
+  // STEP 5: get counts
   AXOM_PERF_MARK_SECTION(
     "PASS[1]:count_traversal",
-    total_count = bvh_get_raycounts<NDIMS, ExecSpace>(leftPredicate,
-                                                      rightPredicate,
-                                                      inner_nodes,
-                                                      leaf_nodes,
-                                                      numRays,
-                                                      counts,
-                                                      x0,
-                                                      nx,
-                                                      y0,
-                                                      ny,
-                                                      z0,
-                                                      nz););
-
-  using exec_policy = typename axom::execution_space<ExecSpace>::loop_policy;
+    bvh_get_raycounts<NDIMS, ExecSpace>(traverse,
+                                        numRays,
+                                        order,
+                                        counts,
+                                        x0,
+                                        nx,
+                                        y0,
+                                        ny,
+                                        z0,
+                                        nz););
+
+  IndexType total_candidates = 0;
   AXOM_PERF_MARK_SECTION(
     "exclusive_scan",
-    RAJA::exclusive_scan<exec_policy>(counts,
-                                      counts + numRays,
-                                      offsets,
-                                      RAJA::operators::plus<IndexType> {}););
+    total_candidates =
+      axom::exclusive_scan<ExecSpace>(counts, numRays, offsets););
 
   AXOM_PERF_MARK_SECTION(
     "allocate_candidates",
-    IndexType total_candidates = static_cast<IndexType>(total_count);
     candidates = axom::allocate<IndexType>(total_candidates, m_AllocatorID););
 
-  // STEP 4: fill in candidates for each point
+  // STEP 6: fill in candidates for each point
   AXOM_PERF_MARK_SECTION(
     "PASS[2}:fill_traversal",
-    for_all<ExecSpace>(
+    for_all_queries<ExecSpace>(
       numRays,
+      order,
       AXOM_LAMBDA(IndexType i) {
         int32 offset = offsets[i];
 
@@ -621,13 +1159,10 @@ void BVH<NDIMS, ExecSpace, FloatType>::findRays(IndexType* offsets,
           offset++;
         };
 
-        lbvh::bvh_traverse(inner_nodes,
-                           leaf_nodes,
-                           ray,
-                           leftPredicate,
-                           rightPredicate,
-                           leafAction);
+        traverse(ray, leafAction);
       }););
+
+  axom::deallocate(order);
 }
 
 //------------------------------------------------------------------------------
@@ -644,6 +1179,7 @@ void BVH<NDIMS, ExecSpace, FloatType>::findBoundingBoxes(IndexType* offsets,
                                                          const FloatType* zmax) const
 {
   AXOM_PERF_MARK_FUNCTION("BVH::findBoundingBoxes");
+  axom::ScopedMemoryLabel memoryLabel("spin::BVH");
 
   SLIC_ASSERT(offsets != nullptr);
   SLIC_ASSERT(counts != nullptr);
@@ -653,15 +1189,15 @@ void BVH<NDIMS, ExecSpace, FloatType>::findBoundingBoxes(IndexType* offsets,
   SLIC_ASSERT(ymin != nullptr);
   SLIC_ASSERT(ymax != nullptr);
 
+  using PointType = point_t<FloatType, NDIMS>;
   using BoundingBoxType = bounding_box_t<FloatType, NDIMS>;
   using TraversalPredicates = lbvh::TraversalPredicates<NDIMS, FloatType>;
+  using WidePredicate = lbvh::WideBoundingBoxPredicate<NDIMS, FloatType>;
   using QueryAccessor = lbvh::QueryAccessor<NDIMS, FloatType>;
 
-  // STEP 1: Grab BVH pointers
-  const internal::vec4_t<FloatType>* inner_nodes = m_bvh.m_inner_nodes;
-  const int32* leaf_nodes = m_bvh.m_leaf_nodes;
-  SLIC_ASSERT(inner_nodes != nullptr);
-  SLIC_ASSERT(leaf_nodes != nullptr);
+  // STEP 1: check that the BVH was built
+  SLIC_ASSERT(m_bvh.m_inner_nodes != nullptr);
+  SLIC_ASSERT(m_bvh.m_leaf_nodes != nullptr);
 
   // STEP 2: define traversal predicates
   BVH_PREDICATE(leftPredicate,
@@ -680,41 +1216,84 @@ void BVH<NDIMS, ExecSpace, FloatType>::findBoundingBoxes(IndexType* offsets,
     return TraversalPredicates::boundingBoxIntersectsRightBin(b, s2, s3);
   };
 
-  // STEP 3: get counts
-  int total_count = 0;
+  // NOTE: the wide BVH is traversed instead, if it was collapsed on the host
+  const auto traverse = make_traversal<ExecSpace>(m_bvh,
+                                                  m_wideBvh,
+                                                  leftPredicate,
+                                                  rightPredicate,
+                                                  WidePredicate {});
+
+  auto getBoundingBox = AXOM_LAMBDA(IndexType i)->BoundingBoxType
+  {
+    BoundingBoxType box;
+    QueryAccessor::getBoundingBox(box, i, xmin, xmax, ymin, ymax, zmin, zmax);
+    return box;
+  };
+
+  auto getCenter = AXOM_LAMBDA(IndexType i)->PointType
+  {
+    const BoundingBoxType box = getBoundingBox(i);
+    PointType center;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      center[d] = 0.5 * (box[d] + box[NDIMS + d]);
+    }
+    return center;
+  };
+
+  // STEP 3: process the boxes in the Morton order of their centers, if
+  // requested
+  int32* order = bvh_query_order<ExecSpace>(m_sortQueries,
+                                            getCenter,
+                                            numBoxes,
+                                            m_bvh,
+                                            m_AllocatorID);
+
+  // STEP 4: single traversal with a bounded buffer per box, if requested
+  if(m_queryCapacity > 0)
+  {
+    candidates = bvh_find_bounded<NDIMS, ExecSpace>(getBoundingBox,
+                                                    traverse,
+                                                    numBoxes,
+                                                    order,
+                                                    m_queryCapacity,
+                                                    offsets,
+                                                    counts,
+                                                    m_AllocatorID);
+    axom::deallocate(order);
+    return;
+  }
+
+  // STEP 5: get counts
   AXOM_PERF_MARK_SECTION(
     "PASS[1]:count_traversal",
-    total_count = bvh_get_boxcounts<NDIMS, ExecSpace>(leftPredicate,
-                                                      rightPredicate,
-                                                      inner_nodes,
-                                                      leaf_nodes,
-                                                      numBoxes,
-                                                      counts,
-                                                      xmin,
-                                                      xmax,
-                                                      ymin,
-                                                      ymax,
-                                                      zmin,
-                                                      zmax););
-
-  using exec_policy = typename axom::execution_space<ExecSpace>::loop_policy;
+    bvh_get_boxcounts<NDIMS, ExecSpace>(traverse,
+                                        numBoxes,
+                                        order,
+                                        counts,
+                                        xmin,
+                                        xmax,
+                                        ymin,
+                                        ymax,
+                                        zmin,
+                                        zmax););
+
+  IndexType total_candidates = 0;
   AXOM_PERF_MARK_SECTION(
     "exclusive_scan",
-    RAJA::exclusive_scan<exec_policy>(counts,
-                                      counts + numBoxes,
-                                      offsets,
-                                      RAJA::operators::plus<IndexType> {}););
+    total_candidates =
+      axom::exclusive_scan<ExecSpace>(counts, numBoxes, offsets););
 
   AXOM_PERF_MARK_SECTION(
     "allocate_candidates",
-    IndexType total_candidates = static_cast<IndexType>(total_count);
     candidates = axom::allocate<IndexType>(total_candidates, m_AllocatorID););
 
-  // STEP 4: fill in candidates for each bounding box
+  // STEP 6: fill in candidates for each bounding box
   AXOM_PERF_MARK_SECTION(
     "PASS[2}:fill_traversal",
-    for_all<ExecSpace>(
+    for_all_queries<ExecSpace>(
       numBoxes,
+      order,
       AXOM_LAMBDA(IndexType i) {
         int32 offset = offsets[i];
 
@@ -727,13 +1306,457 @@ void BVH<NDIMS, ExecSpace, FloatType>::findBoundingBoxes(IndexType* offsets,
           offset++;
         };
 
-        lbvh::bvh_traverse(inner_nodes,
-                           leaf_nodes,
-                           box,
-                           leftPredicate,
-                           rightPredicate,
-                           leafAction);
+        traverse(box, leafAction);
       }););
+
+  axom::deallocate(order);
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType>
+template <typename CandidateFunctor>
+void BVH<NDIMS, ExecSpace, FloatType>::visitPoints(
+  IndexType numPts,
+  CandidateFunctor&& candidateAction,
+  const FloatType* x,
+  const FloatType* y,
+  const FloatType* z) const
+{
+  AXOM_PERF_MARK_FUNCTION("BVH::visitPoints");
+
+  SLIC_ASSERT(x != nullptr);
+  SLIC_ASSERT(y != nullptr);
+  SLIC_ASSERT(z != nullptr || NDIMS == 2);
+
+  using PointType = point_t<FloatType, NDIMS>;
+  using TraversalPredicates = lbvh::TraversalPredicates<NDIMS, FloatType>;
+  using WidePredicate = lbvh::WidePointPredicate<NDIMS, FloatType>;
+  using QueryAccessor = lbvh::QueryAccessor<NDIMS, FloatType>;
+
+  // STEP 1: check that the BVH was built
+  SLIC_ASSERT(m_bvh.m_inner_nodes != nullptr);
+  SLIC_ASSERT(m_bvh.m_leaf_nodes != nullptr);
+
+  // STEP 2: define traversal predicates
+  BVH_PREDICATE(leftPredicate,
+                const PointType& p,
+                const internal::vec4_t<FloatType>& s1,
+                const internal::vec4_t<FloatType>& s2)
+  {
+    return TraversalPredicates::pointInLeftBin(p, s1, s2);
+  };
+
+  BVH_PREDICATE(rightPredicate,
+                const PointType& p,
+                const internal::vec4_t<FloatType>& s2,
+                const internal::vec4_t<FloatType>& s3)
+  {
+    return TraversalPredicates::pointInRightBin(p, s2, s3);
+  };
+
+  // NOTE: the wide BVH is traversed instead, if it was collapsed on the host
+  const auto traverse = make_traversal<ExecSpace>(m_bvh,
+                                                  m_wideBvh,
+                                                  leftPredicate,
+                                                  rightPredicate,
+                                                  WidePredicate {});
+
+  auto getPoint = AXOM_LAMBDA(IndexType i)->PointType
+  {
+    PointType point;
+    QueryAccessor::getPoint(point, i, x, y, z);
+    return point;
+  };
+
+  // STEP 3: process the points in Morton order, if requested
+  int32* order = bvh_query_order<ExecSpace>(m_sortQueries,
+                                            getPoint,
+                                            numPts,
+                                            m_bvh,
+                                            m_AllocatorID);
+
+  // STEP 4: traverse the BVH for each point, candidates are not stored
+  bvh_visit_candidates<NDIMS, ExecSpace>(getPoint,
+                                         traverse,
+                                         numPts,
+                                         order,
+                                         candidateAction);
+
+  axom::deallocate(order);
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType>
+template <typename CandidateFunctor>
+void BVH<NDIMS, ExecSpace, FloatType>::visitRays(
+  IndexType numRays,
+  CandidateFunctor&& candidateAction,
+  const FloatType* x0,
+  const FloatType* nx,
+  const FloatType* y0,
+  const FloatType* ny,
+  const FloatType* z0,
+  const FloatType* nz) const
+{
+  AXOM_PERF_MARK_FUNCTION("BVH::visitRays");
+
+  SLIC_ASSERT(x0 != nullptr);
+  SLIC_ASSERT(nx != nullptr);
+  SLIC_ASSERT(y0 != nullptr);
+  SLIC_ASSERT(ny != nullptr);
+
+  const FloatType TOL = m_Tolernace;
+
+  using PointType = point_t<FloatType, NDIMS>;
+  using RayType = ray_t<FloatType, NDIMS>;
+  using TraversalPredicates = lbvh::TraversalPredicates<NDIMS, FloatType>;
+  using WidePredicate = lbvh::WideRayPredicate<NDIMS, FloatType>;
+  using QueryAccessor = lbvh::QueryAccessor<NDIMS, FloatType>;
+
+  // STEP 1: check that the BVH was built
+  SLIC_ASSERT(m_bvh.m_inner_nodes != nullptr);
+  SLIC_ASSERT(m_bvh.m_leaf_nodes != nullptr);
+
+  // STEP 2: define traversal predicates
+  BVH_PREDICATE(leftPredicate,
+                const RayType& r,
+                const internal::vec4_t<FloatType>& s1,
+                const internal::vec4_t<FloatType>& s2)
+  {
+    return TraversalPredicates::rayIntersectsLeftBin(r, s1, s2, TOL);
+  };
+
+  BVH_PREDICATE(rightPredicate,
+                const RayType& r,
+                const internal::vec4_t<FloatType>& s2,
+                const internal::vec4_t<FloatType>& s3)
+  {
+    return TraversalPredicates::rayIntersectsRightBin(r, s2, s3, TOL);
+  };
+
+  // NOTE: the wide BVH is traversed instead, if it was collapsed on the host
+  const auto traverse = make_traversal<ExecSpace>(m_bvh,
+                                                  m_wideBvh,
+                                                  leftPredicate,
+                                                  rightPredicate,
+                                                  WidePredicate {TOL});
+
+  auto getRay = AXOM_LAMBDA(IndexType i)->RayType
+  {
+    RayType ray;
+    QueryAccessor::getRay(ray, i, x0, nx, y0, ny, z0, nz);
+    return ray;
+  };
+
+  auto getSource = AXOM_LAMBDA(IndexType i)->PointType
+  {
+    PointType source;
+    QueryAccessor::getPoint(source, i, x0, y0, z0);
+    return source;
+  };
+
+  // STEP 3: process the rays in the Morton order of their sources, if
+  // requested
+  int32* order = bvh_query_order<ExecSpace>(m_sortQueries,
+                                            getSource,
+                                            numRays,
+                                            m_bvh,
+                                            m_AllocatorID);
+
+  // STEP 4: traverse the BVH for each ray, candidates are not stored
+  bvh_visit_candidates<NDIMS, ExecSpace>(getRay,
+                                         traverse,
+                                         numRays,
+                                         order,
+                                         candidateAction);
+
+  axom::deallocate(order);
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType>
+template <typename CandidateFunctor>
+void BVH<NDIMS, ExecSpace, FloatType>::visitBoundingBoxes(
+  IndexType numBoxes,
+  CandidateFunctor&& candidateAction,
+  const FloatType* xmin,
+  const FloatType* xmax,
+  const FloatType* ymin,
+  const FloatType* ymax,
+  const FloatType* zmin,
+  const FloatType* zmax) const
+{
+  AXOM_PERF_MARK_FUNCTION("BVH::visitBoundingBoxes");
+
+  SLIC_ASSERT(xmin != nullptr);
+  SLIC_ASSERT(xmax != nullptr);
+  SLIC_ASSERT(ymin != nullptr);
+  SLIC_ASSERT(ymax != nullptr);
+
+  using PointType = point_t<FloatType, NDIMS>;
+  using BoundingBoxType = bounding_box_t<FloatType, NDIMS>;
+  using TraversalPredicates = lbvh::TraversalPredicates<NDIMS, FloatType>;
+  using WidePredicate = lbvh::WideBoundingBoxPredicate<NDIMS, FloatType>;
+  using QueryAccessor = lbvh::QueryAccessor<NDIMS, FloatType>;
+
+  // STEP 1: check that the BVH was built
+  SLIC_ASSERT(m_bvh.m_inner_nodes != nullptr);
+  SLIC_ASSERT(m_bvh.m_leaf_nodes != nullptr);
+
+  // STEP 2: define traversal predicates
+  BVH_PREDICATE(leftPredicate,
+                const BoundingBoxType& b,
+                const internal::vec4_t<FloatType>& s1,
+                const internal::vec4_t<FloatType>& s2)
+  {
+    return TraversalPredicates::boundingBoxIntersectsLeftBin(b, s1, s2);
+  };
+
+  BVH_PREDICATE(rightPredicate,
+                const BoundingBoxType& b,
+                const internal::vec4_t<FloatType>& s2,
+                const internal::vec4_t<FloatType>& s3)
+  {
+    return TraversalPredicates::boundingBoxIntersectsRightBin(b, s2, s3);
+  };
+
+  // NOTE: the wide BVH is traversed instead, if it was collapsed on the host
+  const auto traverse = make_traversal<ExecSpace>(m_bvh,
+                                                  m_wideBvh,
+                                                  leftPredicate,
+                                                  rightPredicate,
+                                                  WidePredicate {});
+
+  auto getBoundingBox = AXOM_LAMBDA(IndexType i)->BoundingBoxType
+  {
+    BoundingBoxType box;
+    QueryAccessor::getBoundingBox(box, i, xmin, xmax, ymin, ymax, zmin, zmax);
+    return box;
+  };
+
+  auto getCenter = AXOM_LAMBDA(IndexType i)->PointType
+  {
+    const BoundingBoxType box = getBoundingBox(i);
+    PointType center;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      center[d] = 0.5 * (box[d] + box[NDIMS + d]);
+    }
+    return center;
+  };
+
+  // STEP 3: process the boxes in the Morton order of their centers, if
+  // requested
+  int32* order = bvh_query_order<ExecSpace>(m_sortQueries,
+                                            getCenter,
+                                            numBoxes,
+                                            m_bvh,
+                                            m_AllocatorID);
+
+  // STEP 4: traverse the BVH for each box, candidates are not stored
+  bvh_visit_candidates<NDIMS, ExecSpace>(getBoundingBox,
+                                         traverse,
+                                         numBoxes,
+                                         order,
+                                         candidateAction);
+
+  axom::deallocate(order);
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType>
+template <typename DistanceFunctor>
+void BVH<NDIMS, ExecSpace, FloatType>::findNearest(IndexType* nearest,
+                                                   FloatType* sqDistances,
+                                                   IndexType numPts,
+                                                   DistanceFunctor&& sqDistance,
+                                                   const FloatType* x,
+                                                   const FloatType* y,
+                                                   const FloatType* z) const
+{
+  findKNearest(1,
+               nearest,
+               sqDistances,
+               numPts,
+               std::forward<DistanceFunctor>(sqDistance),
+               x,
+               y,
+               z);
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType>
+template <typename DistanceFunctor>
+void BVH<NDIMS, ExecSpace, FloatType>::findKNearest(
+  IndexType k,
+  IndexType* nearest,
+  FloatType* sqDistances,
+  IndexType numPts,
+  DistanceFunctor&& sqDistance,
+  const FloatType* x,
+  const FloatType* y,
+  const FloatType* z) const
+{
+  AXOM_PERF_MARK_FUNCTION("BVH::findKNearest");
+  axom::ScopedMemoryLabel memoryLabel("spin::BVH");
+
+  SLIC_ASSERT(k > 0);
+  SLIC_ASSERT(nearest != nullptr);
+  SLIC_ASSERT(sqDistances != nullptr);
+  SLIC_ASSERT(x != nullptr);
+  SLIC_ASSERT(y != nullptr);
+  SLIC_ASSERT(z != nullptr || NDIMS == 2);
+
+  using TraversalPredicates = lbvh::TraversalPredicates<NDIMS, FloatType>;
+  using QueryAccessor = lbvh::QueryAccessor<NDIMS, FloatType>;
+
+  // STEP 1: Grab BVH pointers
+  const internal::vec4_t<FloatType>* inner_nodes = m_bvh.m_inner_nodes;
+  const int32* leaf_nodes = m_bvh.m_leaf_nodes;
+  SLIC_ASSERT(inner_nodes != nullptr);
+  SLIC_ASSERT(leaf_nodes != nullptr);
+
+  // NOTE: excludes the fake box added by build() for a single item
+  const IndexType numItems = m_numItems;
+  const FloatType MAX_DIST = floating_point_limits<FloatType>::max();
+
+  // STEP 2: define the lower bound of the distance to the bins
+  BVH_DISTANCE(leftDistance,
+               const PointType& p,
+               const internal::vec4_t<FloatType>& s1,
+               const internal::vec4_t<FloatType>& s2)
+  {
+    return TraversalPredicates::sqDistanceToLeftBin(p, s1, s2);
+  };
+
+  BVH_DISTANCE(rightDistance,
+               const PointType& p,
+               const internal::vec4_t<FloatType>& s2,
+               const internal::vec4_t<FloatType>& s3)
+  {
+    return TraversalPredicates::sqDistanceToRightBin(p, s2, s3);
+  };
+
+  // STEP 3: process the points in Morton order, if requested
+  auto getPoint = AXOM_LAMBDA(IndexType i)->point_t<FloatType, NDIMS>
+  {
+    point_t<FloatType, NDIMS> point;
+    QueryAccessor::getPoint(point, i, x, y, z);
+    return point;
+  };
+
+  int32* order = bvh_query_order<ExecSpace>(m_sortQueries,
+                                            getPoint,
+                                            numPts,
+                                            m_bvh,
+                                            m_AllocatorID);
+
+  // STEP 4: best-first traversal for each point, the k nearest items found
+  // so far are kept sorted by distance directly in the output arrays
+  AXOM_PERF_MARK_SECTION(
+    "nearest_traversal",
+    for_all_queries<ExecSpace>(
+      numPts,
+      order,
+      AXOM_LAMBDA(IndexType i) {
+        IndexType* knn = nearest + i * k;
+        FloatType* kdist = sqDistances + i * k;
+        for(IndexType j = 0; j < k; ++j)
+        {
+          knn[j] = -1;
+          kdist[j] = MAX_DIST;
+        }
+
+        PointType point;
+        QueryAccessor::getPoint(point, i, x, y, z);
+
+        auto leafAction = [&](int32 current_node,
+                              const int32* leaf_nodes) -> FloatType {
+          const IndexType item = leaf_nodes[current_node];
+          if(item < numItems)
+          {
+            const FloatType d = sqDistance(item, point);
+            if(d < kdist[k - 1])
+            {
+              // insertion into the sorted list of the k nearest items
+              IndexType j = k - 1;
+              for(; j > 0 && kdist[j - 1] > d; --j)
+              {
+                kdist[j] = kdist[j - 1];
+                knn[j] = knn[j - 1];
+              }
+              kdist[j] = d;
+              knn[j] = item;
+            }
+          }
+
+          return kdist[k - 1];
+        };
+
+        lbvh::bvh_traverse_nearest(inner_nodes,
+                                   leaf_nodes,
+                                   point,
+                                   leftDistance,
+                                   rightDistance,
+                                   leafAction,
+                                   MAX_DIST);
+      }););
+
+  axom::deallocate(order);
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType>
+int BVH<NDIMS, ExecSpace, FloatType>::writeBinaryFile(
+  const std::string& fileName) const
+{
+  AXOM_PERF_MARK_FUNCTION("BVH::writeBinaryFile");
+
+  if(m_bvh.m_inner_nodes == nullptr)
+  {
+    SLIC_WARNING("BVH::writeBinaryFile() requires a BVH that was built!");
+    return BVH_BUILD_FAILED;
+  }
+
+  // NOTE: a single item is stored along with a fake box, see build()
+  const int32 size = (m_numItems == 1) ? 2 : m_numItems;
+  const uint64 hash = lbvh::hash_boxes<ExecSpace, NDIMS>(m_boxes, m_numItems);
+  const lbvh::BVHFileHeader header =
+    lbvh::make_header<FloatType, NDIMS>(size, m_numItems, hash, m_scaleFactor);
+
+  if(!lbvh::write_bvh<ExecSpace>(fileName, m_bvh, size, header))
+  {
+    SLIC_WARNING("Could not write BVH file [" << fileName << "]!");
+    return BVH_BUILD_FAILED;
+  }
+
+  return BVH_BUILD_OK;
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType>
+int BVH<NDIMS, ExecSpace, FloatType>::readBinaryFile(
+  const std::string& fileName)
+{
+  AXOM_PERF_MARK_FUNCTION("BVH::readBinaryFile");
+  axom::ScopedMemoryLabel memoryLabel("spin::BVH");
+
+  // STEP 1: read the BVH, if it was written over the same boxes
+  const int32 size = (m_numItems == 1) ? 2 : m_numItems;
+  const uint64 hash = lbvh::hash_boxes<ExecSpace, NDIMS>(m_boxes, m_numItems);
+  const lbvh::BVHFileHeader header =
+    lbvh::make_header<FloatType, NDIMS>(size, m_numItems, hash, m_scaleFactor);
+
+  if(!lbvh::read_bvh<ExecSpace>(fileName, header, m_AllocatorID, m_bvh))
+  {
+    return BVH_BUILD_FAILED;
+  }
+  m_buildCost = 0;
+
+  // STEP 2: collapse the BVH into a wide BVH, if requested
+  bvh_collapse<ExecSpace>(m_nodeWidth, m_AllocatorID, m_bvh, m_wideBvh);
+
+  return BVH_BUILD_OK;
 }
 
 //------------------------------------------------------------------------------
@@ -798,6 +1821,7 @@ void BVH<NDIMS, ExecSpace, FloatType>::writeVtkFile(const std::string& fileName)
 
 #undef BVH_PREDICATE
 #undef BVH_LEAF_ACTION
+#undef BVH_DISTANCE
 
 } /* namespace spin */
 } /* namespace axom */
@@ -23,10 +23,13 @@ namespace linear_bvh
  * \brief RadixTree provides a binary radix tree representation that stores a
  *  list of axis-aligned bounding boxes sorted according to their Morton code.
  *
+ * \tparam MortonCodeType the unsigned integral type of the Morton codes, i.e.,
+ *  uint32 (30-bit codes) or uint64 (63-bit codes).
+ *
  * \note This data-structure provides an intermediate representation that serves
  *  as the building-block to construct a BVH in parallel.
  */
-template <typename FloatType, int NDIMS>
+template <typename FloatType, int NDIMS, typename MortonCodeType = uint32>
 struct RadixTree
 {
   int32 m_size;
@@ -38,7 +41,7 @@ struct RadixTree
   AABB<FloatType, NDIMS>* m_inner_aabbs;
 
   int32* m_leafs;
-  uint32* m_mcodes;
+  MortonCodeType* m_mcodes;
   AABB<FloatType, NDIMS>* m_leaf_aabbs;
 
   void allocate(int32 size, int allocID)
@@ -54,7 +57,7 @@ struct RadixTree
     m_inner_aabbs = axom::allocate<AABB<FloatType, NDIMS>>(m_inner_size, allocID);
 
     m_leafs = axom::allocate<int32>(m_size, allocID);
-    m_mcodes = axom::allocate<uint32>(m_size, allocID);
+    m_mcodes = axom::allocate<MortonCodeType>(m_size, allocID);
     m_leaf_aabbs = axom::allocate<AABB<FloatType, NDIMS>>(m_size, allocID);
   }
 
@@ -151,11 +151,60 @@ public:
     const vec4_t<FloatType>& s3) noexcept;
 
   /// @}
+
+  ///\name Distances for Nearest Neighbor Queries
+  /// @{
+
+  /*!
+   * \brief Computes the squared distance from the supplied point to the left
+   *  bin, which is zero if the point is inside the bin.
+   *
+   * \param [in] point the coordinates of the point in query.
+   * \param [in] s1 the 1st segment of the BVH that stores the left bin.
+   * \param [in] s2 the 2nd segment of the BVH that stores the left bin.
+   *
+   * \return sqDist the squared distance from the point to the left bin.
+   */
+  template <typename PointType>
+  AXOM_HOST_DEVICE static inline FloatType sqDistanceToLeftBin(
+    const PointType& point,
+    const vec4_t<FloatType>& s1,
+    const vec4_t<FloatType>& s2) noexcept;
+
+  /*!
+   * \brief Computes the squared distance from the supplied point to the right
+   *  bin, which is zero if the point is inside the bin.
+   *
+   * \param [in] point the coordinates of the point in query.
+   * \param [in] s2 the 2nd segment of the BVH that stores the right bin.
+   * \param [in] s3 the 3rd segment of the BVH that stores the right bin.
+   *
+   * \return sqDist the squared distance from the point to the right bin.
+   */
+  template <typename PointType>
+  AXOM_HOST_DEVICE static inline FloatType sqDistanceToRightBin(
+    const PointType& point,
+    const vec4_t<FloatType>& s2,
+    const vec4_t<FloatType>& s3) noexcept;
+
+  /// @}
 };
 
 constexpr int DIMENSION_2 = 2;
 constexpr int DIMENSION_3 = 3;
 
+/*!
+ * \brief Returns the squared distance from x to the interval [lo, hi].
+ */
+template <typename FloatType>
+AXOM_HOST_DEVICE inline FloatType sq_distance_to_interval(FloatType x,
+                                                          FloatType lo,
+                                                          FloatType hi) noexcept
+{
+  const FloatType d = (x < lo) ? (lo - x) : ((x > hi) ? (x - hi) : 0);
+  return d * d;
+}
+
 //------------------------------------------------------------------------------
 // 2D Specialization
 //------------------------------------------------------------------------------
@@ -299,6 +348,27 @@ public:
                                                   bin_ymin,
                                                   bin_ymax);
   }
+  template <typename PointType>
+  AXOM_HOST_DEVICE static inline FloatType sqDistanceToLeftBin(
+    const PointType& point,
+    const vec4_t<FloatType>& s1,
+    const vec4_t<FloatType>& s2) noexcept
+  {
+    // extract left bin, see BVHData.hpp for the internal BVH layout
+    return sq_distance_to_interval<FloatType>(point[0], s1[0], s1[3]) +
+      sq_distance_to_interval<FloatType>(point[1], s1[1], s2[0]);
+  }
+
+  template <typename PointType>
+  AXOM_HOST_DEVICE static inline FloatType sqDistanceToRightBin(
+    const PointType& point,
+    const vec4_t<FloatType>& s2,
+    const vec4_t<FloatType>& s3) noexcept
+  {
+    // extract right bin, see BVHData.hpp for the internal BVH layout
+    return sq_distance_to_interval<FloatType>(point[0], s2[2], s3[1]) +
+      sq_distance_to_interval<FloatType>(point[1], s2[3], s3[2]);
+  }
 };
 
 //------------------------------------------------------------------------------
@@ -498,6 +568,29 @@ public:
                                                   bin_zmin,
                                                   bin_zmax);
   }
+  template <typename PointType>
+  AXOM_HOST_DEVICE static inline FloatType sqDistanceToLeftBin(
+    const PointType& point,
+    const vec4_t<FloatType>& s1,
+    const vec4_t<FloatType>& s2) noexcept
+  {
+    // extract left bin, see BVHData.hpp for the internal BVH layout
+    return sq_distance_to_interval<FloatType>(point[0], s1[0], s1[3]) +
+      sq_distance_to_interval<FloatType>(point[1], s1[1], s2[0]) +
+      sq_distance_to_interval<FloatType>(point[2], s1[2], s2[1]);
+  }
+
+  template <typename PointType>
+  AXOM_HOST_DEVICE static inline FloatType sqDistanceToRightBin(
+    const PointType& point,
+    const vec4_t<FloatType>& s2,
+    const vec4_t<FloatType>& s3) noexcept
+  {
+    // extract right bin, see BVHData.hpp for the internal BVH layout
+    return sq_distance_to_interval<FloatType>(point[0], s2[2], s3[1]) +
+      sq_distance_to_interval<FloatType>(point[1], s2[3], s3[2]) +
+      sq_distance_to_interval<FloatType>(point[2], s3[0], s3[3]);
+  }
 };
 
 } /* namespace linear_bvh */
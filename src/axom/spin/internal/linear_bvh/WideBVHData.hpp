@@ -0,0 +1,104 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_SPIN_WIDEBVHDATA_HPP_
+#define AXOM_SPIN_WIDEBVHDATA_HPP_
+
+// axom core includes
+#include "axom/core/Types.hpp"              // for fixed bitwidth types
+#include "axom/core/memory_management.hpp"  // for alloc()/free()
+
+#include "axom/core/utilities/AnnotationMacros.hpp"  // for annotations
+
+namespace axom
+{
+namespace spin
+{
+namespace internal
+{
+namespace linear_bvh
+{
+/*!
+ * \brief A node of a wide BVH, which stores the bins of its WIDTH children in
+ *  a structure of arrays, such that a query is tested against all the bins of
+ *  a node with vector instructions.
+ *
+ * \note <b> Internal Data Layout </b>
+ * \verbatim
+ *
+ *   lo[ d ][ c ] lower coordinate of the bin of child c along dimension d
+ *   hi[ d ][ c ] upper coordinate of the bin of child c along dimension d
+ *   children[ c ] the ID of child c:
+ *      * >= 0, the index of a wide inner node
+ *      * < 0, -(j+1) for the jth leaf, as in BVHData
+ *
+ * \endverbatim
+ *
+ * \note A node may have fewer than WIDTH children, the bins of the unused
+ *  slots are inverted, i.e., lo > hi, and no traversal predicate intersects
+ *  them.
+ *
+ * \see BVHData
+ */
+template <typename FloatType, int NDIMS, int WIDTH>
+struct WideNode
+{
+  FloatType lo[NDIMS][WIDTH];
+  FloatType hi[NDIMS][WIDTH];
+  int32 children[WIDTH];
+};
+
+/*!
+ * \brief WideBVHData stores a BVH whose inner nodes have 4 or 8 children,
+ *  which is collapsed from the binary BVH for the traversal on the CPU.
+ *
+ * \note The nodes are stored in breadth-first order, starting at the root,
+ *  and the leaves are stored by the leaf nodes of the binary BVH.
+ *
+ * \see collapse_bvh(), WideNode
+ */
+template <typename FloatType, int NDIMS>
+struct WideBVHData
+{
+  int8* m_nodes;     // WideNode< FloatType, NDIMS, m_width > nodes
+  int32 m_width;     // the number of children per node, 0 if not built
+  int32 m_numNodes;  // the number of nodes
+
+  WideBVHData() : m_nodes(nullptr), m_width(0), m_numNodes(0) { }
+
+  template <int WIDTH>
+  void allocate(int32 numNodes, int allocID)
+  {
+    AXOM_PERF_MARK_FUNCTION("WideBVHData::allocate");
+    m_nodes = axom::allocate<int8>(
+      numNodes * sizeof(WideNode<FloatType, NDIMS, WIDTH>),
+      allocID);
+    m_width = WIDTH;
+    m_numNodes = numNodes;
+  }
+
+  void deallocate()
+  {
+    AXOM_PERF_MARK_FUNCTION("WideBVHData::deallocate");
+    axom::deallocate(m_nodes);
+    m_width = 0;
+    m_numNodes = 0;
+  }
+
+  /// Returns the nodes, which were allocated with the given width
+  template <int WIDTH>
+  AXOM_HOST_DEVICE WideNode<FloatType, NDIMS, WIDTH>* getNodes() const
+  {
+    return reinterpret_cast<WideNode<FloatType, NDIMS, WIDTH>*>(m_nodes);
+  }
+
+  ~WideBVHData() { }
+};
+
+} /* namespace linear_bvh */
+} /* namespace internal */
+} /* namespace spin */
+} /* namespace axom */
+#endif /* AXOM_SPIN_WIDEBVHDATA_HPP_ */
@@ -0,0 +1,182 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_SPIN_BVH_WIDETRAVERSALPREDICATES_HPP_
+#define AXOM_SPIN_BVH_WIDETRAVERSALPREDICATES_HPP_
+
+#include "axom/core/Macros.hpp"  // for AXOM_HOST_DEVICE
+#include "axom/core/Types.hpp"   // for axom types
+#include "axom/core/numerics/floating_point_limits.hpp"
+#include "axom/core/utilities/Utilities.hpp"  // for utilities::abs()
+
+#include "axom/spin/internal/linear_bvh/WideBVHData.hpp"
+
+/*!
+ * \file WideTraversalPredicates
+ *
+ * \brief Traversal predicates of a wide BVH, which test a query against all
+ *  the bins of a node at once.
+ *
+ *  Each predicate is a functor that returns a bitmask, whose bit c is set iff
+ *  the query satisfies the predicate for the bin of child c. The loops over
+ *  the children of a node are free of branches, such that the compiler maps
+ *  them to vector instructions, e.g., one AVX2 comparison for the 4 lower
+ *  coordinates of the bins of a 4-wide node in double precision.
+ *
+ *  The predicates are consistent with the corresponding TraversalPredicates,
+ *  i.e., a wide BVH yields the same candidates as the binary BVH.
+ *
+ *  \see TraversalPredicates, WideNode
+ */
+
+namespace axom
+{
+namespace spin
+{
+namespace internal
+{
+namespace linear_bvh
+{
+/*!
+ * \brief Checks if the supplied point is within the bins of a node.
+ */
+template <int NDIMS, typename FloatType>
+struct WidePointPredicate
+{
+  template <typename PointType, int WIDTH>
+  AXOM_HOST_DEVICE inline int32 operator()(
+    const PointType& point,
+    const WideNode<FloatType, NDIMS, WIDTH>& node) const noexcept
+  {
+    bool in[WIDTH];
+    for(int32 c = 0; c < WIDTH; ++c)
+    {
+      in[c] = true;
+    }
+
+    for(int32 d = 0; d < NDIMS; ++d)
+    {
+      const FloatType p = point[d];
+      for(int32 c = 0; c < WIDTH; ++c)
+      {
+        in[c] = in[c] & (node.lo[d][c] <= p) & (p <= node.hi[d][c]);
+      }
+    }
+
+    int32 mask = 0;
+    for(int32 c = 0; c < WIDTH; ++c)
+    {
+      mask |= static_cast<int32>(in[c]) << c;
+    }
+    return mask;
+  }
+};
+
+/*!
+ * \brief Checks if the supplied ray intersects the bins of a node.
+ *
+ * \note The slabs are tested as in primal::detail::intersect_ray(), with the
+ *  same tolerance on the components of the ray normal.
+ */
+template <int NDIMS, typename FloatType>
+struct WideRayPredicate
+{
+  FloatType TOL;
+
+  template <typename RayType, int WIDTH>
+  AXOM_HOST_DEVICE inline int32 operator()(
+    const RayType& ray,
+    const WideNode<FloatType, NDIMS, WIDTH>& node) const noexcept
+  {
+    bool in[WIDTH];
+    FloatType tmin[WIDTH];
+    FloatType tmax[WIDTH];
+    for(int32 c = 0; c < WIDTH; ++c)
+    {
+      // NOTE: the unused slots of a node have an inverted bin
+      in[c] = (node.lo[0][c] <= node.hi[0][c]);
+      tmin[c] = 0;
+      tmax[c] = numerics::floating_point_limits<FloatType>::max();
+    }
+
+    for(int32 d = 0; d < NDIMS; ++d)
+    {
+      const FloatType x0 = ray[d];
+      const FloatType n = ray[NDIMS + d];
+
+      if(utilities::abs(n) <= TOL)
+      {
+        // the ray is parallel to the slab
+        for(int32 c = 0; c < WIDTH; ++c)
+        {
+          in[c] = in[c] & (node.lo[d][c] <= x0) & (x0 <= node.hi[d][c]);
+        }
+      }
+      else
+      {
+        const FloatType invn = static_cast<FloatType>(1.0) / n;
+        for(int32 c = 0; c < WIDTH; ++c)
+        {
+          const FloatType t1 = (node.lo[d][c] - x0) * invn;
+          const FloatType t2 = (node.hi[d][c] - x0) * invn;
+          const FloatType tnear = (t1 > t2) ? t2 : t1;
+          const FloatType tfar = (t1 > t2) ? t1 : t2;
+          tmin[c] = (tnear < tmin[c]) ? tmin[c] : tnear;
+          tmax[c] = (tfar < tmax[c]) ? tfar : tmax[c];
+        }
+      }
+    }
+
+    int32 mask = 0;
+    for(int32 c = 0; c < WIDTH; ++c)
+    {
+      mask |= static_cast<int32>(in[c] & !(tmin[c] > tmax[c])) << c;
+    }
+    return mask;
+  }
+};
+
+/*!
+ * \brief Checks if the supplied bounding box intersects the bins of a node.
+ */
+template <int NDIMS, typename FloatType>
+struct WideBoundingBoxPredicate
+{
+  template <typename BoundingBoxType, int WIDTH>
+  AXOM_HOST_DEVICE inline int32 operator()(
+    const BoundingBoxType& box,
+    const WideNode<FloatType, NDIMS, WIDTH>& node) const noexcept
+  {
+    bool in[WIDTH];
+    for(int32 c = 0; c < WIDTH; ++c)
+    {
+      in[c] = true;
+    }
+
+    for(int32 d = 0; d < NDIMS; ++d)
+    {
+      const FloatType box_min = box[d];
+      const FloatType box_max = box[NDIMS + d];
+      for(int32 c = 0; c < WIDTH; ++c)
+      {
+        in[c] = in[c] & (node.lo[d][c] <= box_max) &
+          (box_min <= node.hi[d][c]);
+      }
+    }
+
+    int32 mask = 0;
+    for(int32 c = 0; c < WIDTH; ++c)
+    {
+      mask |= static_cast<int32>(in[c]) << c;
+    }
+    return mask;
+  }
+};
+
+} /* namespace linear_bvh */
+} /* namespace internal */
+} /* namespace spin */
+} /* namespace axom */
+#endif /* AXOM_SPIN_BVH_WIDETRAVERSALPREDICATES_HPP_ */
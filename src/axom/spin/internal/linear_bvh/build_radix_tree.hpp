@@ -10,6 +10,7 @@
 
 #include "axom/core/execution/execution_space.hpp"
 #include "axom/core/execution/for_all.hpp"
+#include "axom/core/execution/sort.hpp"
 
 #include "axom/core/utilities/AnnotationMacros.hpp"  // for annotations
 
@@ -21,6 +22,9 @@
 #include "axom/core/utilities/Utilities.hpp"  // for isNearlyEqual()
 #include "axom/slic/interface/slic.hpp"       // for slic
 
+// C/C++ includes
+#include <type_traits>  // for std::make_signed
+
 // RAJA includes
 #include "RAJA/RAJA.hpp"
 
@@ -101,6 +105,29 @@ static inline AXOM_HOST_DEVICE axom::int64 morton64_encode(axom::float32 x,
   return (zz << 2 | yy << 1 | xx);
 }
 
+//------------------------------------------------------------------------------
+// Returns the morton code for coordinates in the unit cube, encoded with
+// either 30 bits (uint32) or 63 bits (uint64)
+template <typename MortonCodeType>
+inline AXOM_HOST_DEVICE MortonCodeType morton_encode(axom::float32 x,
+                                                     axom::float32 y,
+                                                     axom::float32 z = 0.0);
+
+template <>
+inline AXOM_HOST_DEVICE axom::uint32
+morton_encode<axom::uint32>(axom::float32 x, axom::float32 y, axom::float32 z)
+{
+  return static_cast<axom::uint32>(morton32_encode(x, y, z));
+}
+
+template <>
+inline AXOM_HOST_DEVICE axom::uint64
+morton_encode<axom::uint64>(axom::float32 x, axom::float32 y, axom::float32 z)
+{
+  return static_cast<axom::uint64>(morton64_encode(x, y, z));
+}
+
+//------------------------------------------------------------------------------
 template <typename ExecSpace, typename FloatType>
 void transform_boxes(const FloatType* boxes,
                      AABB<FloatType, 3>* aabbs,
@@ -248,11 +275,11 @@ AABB<FloatType, 2> reduce(AABB<FloatType, 2>* aabbs, int32 size)
 }
 
 //------------------------------------------------------------------------------
-template <typename ExecSpace, typename FloatType>
+template <typename ExecSpace, typename FloatType, typename MortonCodeType>
 void get_mcodes(AABB<FloatType, 2>* aabbs,
                 int32 size,
                 const AABB<FloatType, 2>& bounds,
-                uint32* mcodes)
+                MortonCodeType* mcodes)
 {
   AXOM_PERF_MARK_FUNCTION("get_mcodes2D");
 
@@ -282,16 +309,16 @@ void get_mcodes(AABB<FloatType, 2>* aabbs,
       FloatType dy = aabb.m_y.center() - min_coord[1];
       float32 centroid_x = static_cast<float32>(dx * inv_extent[0]);
       float32 centroid_y = static_cast<float32>(dy * inv_extent[1]);
-      mcodes[i] = morton32_encode(centroid_x, centroid_y);
+      mcodes[i] = morton_encode<MortonCodeType>(centroid_x, centroid_y);
     });
 }
 
 //------------------------------------------------------------------------------
-template <typename ExecSpace, typename FloatType>
+template <typename ExecSpace, typename FloatType, typename MortonCodeType>
 void get_mcodes(AABB<FloatType, 3>* aabbs,
                 int32 size,
                 const AABB<FloatType, 3>& bounds,
-                uint32* mcodes)
+                MortonCodeType* mcodes)
 {
   AXOM_PERF_MARK_FUNCTION("get_mcodes3D");
 
@@ -325,7 +352,8 @@ void get_mcodes(AABB<FloatType, 3>* aabbs,
       float32 centroid_x = static_cast<float32>(dx * inv_extent[0]);
       float32 centroid_y = static_cast<float32>(dy * inv_extent[1]);
       float32 centroid_z = static_cast<float32>(dz * inv_extent[2]);
-      mcodes[i] = morton32_encode(centroid_x, centroid_y, centroid_z);
+      mcodes[i] =
+        morton_encode<MortonCodeType>(centroid_x, centroid_y, centroid_z);
     });
 }
 
@@ -369,47 +397,17 @@ void reorder(int32* indices, T*& array, int32 size, int allocatorID)
 }
 
 //------------------------------------------------------------------------------
-#if(RAJA_VERSION_MAJOR > 0) || \
-  ((RAJA_VERSION_MAJOR == 0) && (RAJA_VERSION_MINOR >= 12))
-
-template <typename ExecSpace>
-void sort_mcodes(uint32*& mcodes, int32 size, int32* iter)
+template <typename ExecSpace, typename MortonCodeType>
+void sort_mcodes(MortonCodeType*& mcodes, int32 size, int32* iter)
 {
   AXOM_PERF_MARK_FUNCTION("sort_mcodes");
 
   array_counting<ExecSpace>(iter, size, 0, 1);
 
-  AXOM_PERF_MARK_SECTION(
-    "raja_stable_sort",
-    using EXEC_POL = typename axom::execution_space<ExecSpace>::loop_policy;
-    RAJA::stable_sort_pairs<EXEC_POL>(mcodes, mcodes + size, iter););
+  AXOM_PERF_MARK_SECTION("sort_pairs",
+                         axom::sort_pairs<ExecSpace>(mcodes, iter, size););
 }
 
-#else
-
-// fall back to std::stable_sort
-template <typename ExecSpace>
-void sort_mcodes(uint32*& mcodes, int32 size, int32* iter)
-{
-  AXOM_PERF_MARK_FUNCTION("sort_mcodes");
-
-  array_counting<ExecSpace>(iter, size, 0, 1);
-
-  AXOM_PERF_MARK_SECTION(
-    "cpu_sort",
-
-    std::stable_sort(iter,
-                     iter + size,
-                     [=](int32 i1, int32 i2) { return mcodes[i1] < mcodes[i2]; });
-
-  );
-
-  const int allocID = axom::execution_space<ExecSpace>::allocatorID();
-  reorder<ExecSpace>(iter, mcodes, size, allocID);
-}
-
-#endif /* RAJA version 0.12.0 and above */
-
 //------------------------------------------------------------------------------
 template <typename IntType, typename MCType>
 AXOM_HOST_DEVICE IntType delta(const IntType& a,
@@ -421,22 +419,23 @@ AXOM_HOST_DEVICE IntType delta(const IntType& a,
   bool out_of_range = (b < 0 || b > inner_size);
   //still make the call but with a valid adderss
   const int32 bb = (out_of_range) ? 0 : b;
-  const uint32 acode = mcodes[a];
-  const uint32 bcode = mcodes[bb];
+  const MCType acode = mcodes[a];
+  const MCType bcode = mcodes[bb];
   //use xor to find where they differ
-  uint32 exor = acode ^ bcode;
+  MCType exor = acode ^ bcode;
   tie = (exor == 0);
   //break the tie, a and b must always differ
-  exor = tie ? uint32(a) ^ uint32(bb) : exor;
-  int32 count = clz(exor);
-  if(tie) count += 32;
+  exor = tie ? MCType(a) ^ MCType(bb) : exor;
+  using SignedMCType = typename std::make_signed<MCType>::type;
+  int32 count = clz(static_cast<SignedMCType>(exor));
+  if(tie) count += static_cast<int32>(sizeof(MCType) * 8);
   count = (out_of_range) ? -1 : count;
   return count;
 }
 
 //------------------------------------------------------------------------------
-template <typename ExecSpace, typename FloatType, int NDIMS>
-void build_tree(RadixTree<FloatType, NDIMS>& data)
+template <typename ExecSpace, typename FloatType, int NDIMS, typename MortonCodeType>
+void build_tree(RadixTree<FloatType, NDIMS, MortonCodeType>& data)
 {
   AXOM_PERF_MARK_FUNCTION("build_tree");
 
@@ -450,7 +449,7 @@ void build_tree(RadixTree<FloatType, NDIMS>& data)
   int32* lchildren_ptr = data.m_left_children;
   int32* rchildren_ptr = data.m_right_children;
   int32* parent_ptr = data.m_parents;
-  const uint32* mcodes_ptr = data.m_mcodes;
+  const MortonCodeType* mcodes_ptr = data.m_mcodes;
 
   for_all<ExecSpace>(
     inner_size,
@@ -555,8 +554,9 @@ static void array_memset(T* array, const int32 size, const T val)
 #endif
 
 //------------------------------------------------------------------------------
-template <typename ExecSpace, typename FloatType, int NDIMS>
-void propagate_aabbs(RadixTree<FloatType, NDIMS>& data, int allocatorID)
+template <typename ExecSpace, typename FloatType, int NDIMS, typename MortonCodeType>
+void propagate_aabbs(RadixTree<FloatType, NDIMS, MortonCodeType>& data,
+                     int allocatorID)
 {
   AXOM_PERF_MARK_FUNCTION("propagate_abbs");
 
@@ -642,11 +642,11 @@ void propagate_aabbs(RadixTree<FloatType, NDIMS>& data, int allocatorID)
 #undef SPIN_BVH_THREAD_FENCE_SYSTEM
 
 //------------------------------------------------------------------------------
-template <typename ExecSpace, typename FloatType, int NDIMS>
+template <typename ExecSpace, typename FloatType, int NDIMS, typename MortonCodeType>
 void build_radix_tree(const FloatType* boxes,
                       int size,
                       AABB<FloatType, NDIMS>& bounds,
-                      RadixTree<FloatType, NDIMS>& radix_tree,
+                      RadixTree<FloatType, NDIMS, MortonCodeType>& radix_tree,
                       FloatType scale_factor,
                       int allocatorID)
 {
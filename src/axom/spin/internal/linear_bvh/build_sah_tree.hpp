@@ -0,0 +1,314 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_SPIN_BUILD_SAH_TREE_H_
+#define AXOM_SPIN_BUILD_SAH_TREE_H_
+
+// axom core includes
+#include "axom/core/Types.hpp"                       // for fixed bitwidth types
+#include "axom/core/memory_management.hpp"           // for alloc()/free()
+#include "axom/core/numerics/floating_point_limits.hpp"
+#include "axom/core/utilities/AnnotationMacros.hpp"  // for annotations
+#include "axom/slic/interface/slic_macros.hpp"       // for SLIC_ASSERT()
+
+#include "axom/spin/internal/linear_bvh/aabb.hpp"
+#include "axom/spin/internal/linear_bvh/build_radix_tree.hpp"
+#include "axom/spin/internal/linear_bvh/bvh_traverse.hpp"
+#include "axom/spin/internal/linear_bvh/RadixTree.hpp"
+#include "axom/spin/internal/linear_bvh/refit_bvh.hpp"  // for surface_area()
+
+// C/C++ includes
+#include <algorithm>  // for std::partition(), std::nth_element()
+#include <numeric>    // for std::iota()
+#include <vector>     // for std::vector
+
+namespace axom
+{
+namespace spin
+{
+namespace internal
+{
+namespace linear_bvh
+{
+/*!
+ * \brief Builds a binary tree over the supplied boxes, top-down, by splitting
+ *  each node where the surface area heuristic (SAH) cost is minimal.
+ *
+ * \param [in] boxes array of the bounding boxes, 2*NDIMS entries per box.
+ * \param [in] size the number of boxes.
+ * \param [out] bounds the bounds of all the boxes.
+ * \param [out] radix_tree the tree to populate.
+ * \param [in] scale_factor scale factor applied to each box.
+ * \param [in] allocatorID ID of the allocator used for the tree.
+ *
+ * \note The tree is stored in a RadixTree, with one box per leaf, such that
+ *  the BVH is emitted from it as from the tree built by build_radix_tree().
+ *  The Morton codes and the parents of the tree are not populated.
+ *
+ * \note The centroids of the boxes of a node are binned into NUM_BINS bins
+ *  along each dimension, and the node is split at the boundary between two
+ *  bins that minimizes the SAH cost of its children. The tree is built on the
+ *  host, in O(n log n) time for n boxes, which is much slower than the build
+ *  of the radix tree, but yields tighter trees for anisotropic inputs.
+ *
+ * \note The SAH may peel off a few boxes at each split, e.g., for boxes whose
+ *  sizes grow geometrically, which yields a tree as deep as the number of
+ *  boxes. Hence, the nodes deeper than BVH_STACK_SIZE / 2 are split at the
+ *  median of their centroids, such that the leaves are at a depth less than
+ *  BVH_STACK_SIZE, as required by the traversal.
+ *
+ * \see build_radix_tree(), emit_bvh()
+ */
+template <typename ExecSpace, typename FloatType, int NDIMS, typename MortonCodeType>
+void build_sah_tree(const FloatType* boxes,
+                    int size,
+                    AABB<FloatType, NDIMS>& bounds,
+                    RadixTree<FloatType, NDIMS, MortonCodeType>& radix_tree,
+                    FloatType scale_factor,
+                    int allocatorID);
+
+//------------------------------------------------------------------------------
+//                        IMPLEMENTATION
+//------------------------------------------------------------------------------
+template <typename ExecSpace, typename FloatType, int NDIMS, typename MortonCodeType>
+void build_sah_tree(const FloatType* boxes,
+                    int size,
+                    AABB<FloatType, NDIMS>& bounds,
+                    RadixTree<FloatType, NDIMS, MortonCodeType>& radix_tree,
+                    FloatType scale_factor,
+                    int allocatorID)
+{
+  AXOM_PERF_MARK_FUNCTION("build_sah_tree");
+
+  // sanity checks
+  SLIC_ASSERT(boxes != nullptr);
+  SLIC_ASSERT(size > 1);
+
+  using BoxType = AABB<FloatType, NDIMS>;
+  constexpr int32 NUM_BINS = 16;
+
+  // NOTE: past MAX_SAH_DEPTH, the nodes are split at their median, which adds
+  // at most 31 levels for 2^31 boxes, see the note above
+  constexpr int32 MAX_SAH_DEPTH = BVH_STACK_SIZE / 2;
+
+  radix_tree.allocate(size, allocatorID);
+  const int32 inner_size = radix_tree.m_inner_size;
+
+  // STEP 1: scale the boxes and evaluate the global bounds, as for the radix
+  // tree, then copy the boxes to the host
+  transform_boxes<ExecSpace>(boxes,
+                             radix_tree.m_leaf_aabbs,
+                             size,
+                             scale_factor);
+  bounds = reduce<ExecSpace>(radix_tree.m_leaf_aabbs, size);
+
+  std::vector<BoxType> aabbs(size);
+  axom::copy(aabbs.data(), radix_tree.m_leaf_aabbs, size * sizeof(BoxType));
+
+  std::vector<FloatType> centroids(size * NDIMS);
+  for(int32 i = 0; i < size; ++i)
+  {
+    FloatType lo[NDIMS];
+    FloatType hi[NDIMS];
+    aabbs[i].min(lo);
+    aabbs[i].max(hi);
+    for(int32 d = 0; d < NDIMS; ++d)
+    {
+      centroids[i * NDIMS + d] = static_cast<FloatType>(0.5) * (lo[d] + hi[d]);
+    }
+  }
+
+  // STEP 2: split the nodes top-down, the items of a node are the range
+  // [begin, end) of the items array, which is partitioned in place. Hence,
+  // the leaves are stored in the order of the items array.
+  struct Task
+  {
+    int32 node;
+    int32 begin;
+    int32 end;
+    int32 depth;
+  };
+
+  std::vector<int32> items(size);
+  std::iota(items.begin(), items.end(), 0);
+
+  std::vector<int32> left_children(inner_size);
+  std::vector<int32> right_children(inner_size);
+  std::vector<BoxType> inner_aabbs(inner_size);
+
+  std::vector<Task> tasks(1, Task {0, 0, size, 0});
+  int32 num_nodes = 1;
+  int32 max_depth = 0;
+
+  while(!tasks.empty())
+  {
+    const Task task = tasks.back();
+    tasks.pop_back();
+
+    // the box of the node, and the bounds of the centroids of its items
+    BoxType node_aabb;
+    FloatType cmin[NDIMS];
+    FloatType cmax[NDIMS];
+    for(int32 d = 0; d < NDIMS; ++d)
+    {
+      cmin[d] = numerics::floating_point_limits<FloatType>::max();
+      cmax[d] = numerics::floating_point_limits<FloatType>::lowest();
+    }
+
+    for(int32 i = task.begin; i < task.end; ++i)
+    {
+      node_aabb.include(aabbs[items[i]]);
+      for(int32 d = 0; d < NDIMS; ++d)
+      {
+        const FloatType c = centroids[items[i] * NDIMS + d];
+        cmin[d] = (c < cmin[d]) ? c : cmin[d];
+        cmax[d] = (c > cmax[d]) ? c : cmax[d];
+      }
+    }
+    inner_aabbs[task.node] = node_aabb;
+
+    auto bin_of = [&](int32 item, int32 d) -> int32 {
+      const FloatType c = centroids[item * NDIMS + d];
+      const int32 bin =
+        static_cast<int32>(NUM_BINS * (c - cmin[d]) / (cmax[d] - cmin[d]));
+      return (bin < NUM_BINS) ? bin : NUM_BINS - 1;
+    };
+
+    // find the split with the minimal SAH cost, i.e., the sum over the two
+    // children of the surface area times the number of items
+    FloatType best_cost = numerics::floating_point_limits<FloatType>::max();
+    int32 best_dim = -1;
+    int32 best_bin = -1;
+
+    for(int32 d = 0; d < NDIMS && task.depth < MAX_SAH_DEPTH; ++d)
+    {
+      if(!(cmax[d] > cmin[d]))
+      {
+        continue;
+      }
+
+      BoxType bin_aabbs[NUM_BINS];
+      int32 bin_counts[NUM_BINS] = {0};
+      for(int32 i = task.begin; i < task.end; ++i)
+      {
+        const int32 bin = bin_of(items[i], d);
+        bin_aabbs[bin].include(aabbs[items[i]]);
+        bin_counts[bin]++;
+      }
+
+      // sweep from the right, then from the left
+      FloatType right_costs[NUM_BINS];
+      BoxType right_aabb;
+      int32 right_count = 0;
+      for(int32 b = NUM_BINS - 1; b > 0; --b)
+      {
+        right_aabb.include(bin_aabbs[b]);
+        right_count += bin_counts[b];
+        right_costs[b] =
+          (right_count > 0) ? surface_area(right_aabb) * right_count : 0;
+      }
+
+      BoxType left_aabb;
+      int32 left_count = 0;
+      for(int32 b = 0; b < NUM_BINS - 1; ++b)
+      {
+        left_aabb.include(bin_aabbs[b]);
+        left_count += bin_counts[b];
+        if(left_count == 0 || left_count == task.end - task.begin)
+        {
+          continue;
+        }
+
+        const FloatType cost =
+          surface_area(left_aabb) * left_count + right_costs[b + 1];
+        if(cost < best_cost)
+        {
+          best_cost = cost;
+          best_dim = d;
+          best_bin = b;
+        }
+      }
+    }
+
+    // split at the best bin, or at the middle if the centroids coincide, or
+    // at the median centroid along the largest extent past MAX_SAH_DEPTH
+    int32* first = items.data() + task.begin;
+    int32* last = items.data() + task.end;
+    int32 mid = (task.begin + task.end) / 2;
+    if(task.depth >= MAX_SAH_DEPTH)
+    {
+      int32 dim = 0;
+      for(int32 d = 1; d < NDIMS; ++d)
+      {
+        dim = (cmax[d] - cmin[d] > cmax[dim] - cmin[dim]) ? d : dim;
+      }
+      std::nth_element(first, items.data() + mid, last, [&](int32 a, int32 b) {
+        return centroids[a * NDIMS + dim] < centroids[b * NDIMS + dim];
+      });
+    }
+    else if(best_dim >= 0)
+    {
+      mid = static_cast<int32>(
+        std::partition(first,
+                       last,
+                       [&](int32 item) {
+                         return bin_of(item, best_dim) <= best_bin;
+                       }) -
+        items.data());
+    }
+    SLIC_ASSERT(mid > task.begin && mid < task.end);
+
+    // the leaves are numbered after the inner nodes, as in the radix tree
+    const int32 ranges[2][2] = {{task.begin, mid}, {mid, task.end}};
+    int32 children[2];
+    for(int32 side = 0; side < 2; ++side)
+    {
+      const int32 begin = ranges[side][0];
+      const int32 end = ranges[side][1];
+      if(end - begin == 1)
+      {
+        children[side] = inner_size + begin;
+      }
+      else
+      {
+        children[side] = num_nodes++;
+        tasks.push_back(Task {children[side], begin, end, task.depth + 1});
+      }
+    }
+    max_depth = std::max(max_depth, task.depth + 1);
+    left_children[task.node] = children[0];
+    right_children[task.node] = children[1];
+  }
+  SLIC_ASSERT(num_nodes == inner_size);
+  SLIC_ASSERT(max_depth < BVH_STACK_SIZE);
+
+  // STEP 3: reorder the boxes, and copy the tree to the allocator's memory
+  std::vector<BoxType> leaf_aabbs(size);
+  for(int32 i = 0; i < size; ++i)
+  {
+    leaf_aabbs[i] = aabbs[items[i]];
+  }
+
+  axom::copy(radix_tree.m_leafs, items.data(), size * sizeof(int32));
+  axom::copy(radix_tree.m_leaf_aabbs,
+             leaf_aabbs.data(),
+             size * sizeof(BoxType));
+  axom::copy(radix_tree.m_left_children,
+             left_children.data(),
+             inner_size * sizeof(int32));
+  axom::copy(radix_tree.m_right_children,
+             right_children.data(),
+             inner_size * sizeof(int32));
+  axom::copy(radix_tree.m_inner_aabbs,
+             inner_aabbs.data(),
+             inner_size * sizeof(BoxType));
+}
+
+} /* namespace linear_bvh */
+} /* namespace internal */
+} /* namespace spin */
+} /* namespace axom */
+
+#endif /* AXOM_SPIN_BUILD_SAH_TREE_H_ */
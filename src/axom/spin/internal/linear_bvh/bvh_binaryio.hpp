@@ -0,0 +1,315 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_SPIN_LINEAR_BVH_BINARYIO_HPP_
+#define AXOM_SPIN_LINEAR_BVH_BINARYIO_HPP_
+
+// axom core includes
+#include "axom/core/Types.hpp"                       // for fixed bitwidth types
+#include "axom/core/execution/execution_space.hpp"  // for execution spaces
+#include "axom/core/memory_management.hpp"           // for alloc()/free()
+#include "axom/core/utilities/AnnotationMacros.hpp"  // for annotations
+#include "axom/slic/interface/slic.hpp"              // for SLIC macros
+
+#include "axom/spin/internal/linear_bvh/aabb.hpp"
+#include "axom/spin/internal/linear_bvh/BVHData.hpp"
+#include "axom/spin/internal/linear_bvh/vec.hpp"
+
+// C/C++ includes
+#include <cstring>  // for memcpy(), strncmp()
+#include <fstream>  // for std::ifstream, std::ofstream
+#include <string>   // for std::string
+#include <vector>   // for std::vector
+
+/*!
+ * \file bvh_binaryio.hpp
+ *
+ * \brief Reads and writes the internal BVH data-structure to a binary file,
+ *  such that a BVH over a static geometry is built once and reloaded on the
+ *  subsequent runs.
+ *
+ * \note <b> File Layout </b>
+ * \verbatim
+ *
+ *   BVHFileHeader
+ *   bounds        AABB< FloatType, NDIMS >
+ *   inner nodes   (size-1)*4 vec4_t< FloatType >
+ *   leaf nodes    size int32
+ *
+ * \endverbatim
+ *
+ * \note The file stores the raw bytes of the BVH, i.e., it is read by a
+ *  machine with the same byte order and floating point format only.
+ */
+
+namespace axom
+{
+namespace spin
+{
+namespace internal
+{
+namespace linear_bvh
+{
+/*!
+ * \brief The header of a BVH file, which identifies the BVH and the boxes it
+ *  was built over.
+ */
+struct BVHFileHeader
+{
+  char magic[8];        // "AXOMBVH" followed by a null byte
+  int32 version;        // the version of the file layout
+  int32 ndims;          // the dimension of the BVH
+  int32 float_size;     // sizeof( FloatType )
+  int32 size;           // the number of leaves, including the fake box
+  int64 num_items;      // the number of boxes supplied to the BVH
+  uint64 boxes_hash;    // the hash of the boxes, see hash_boxes()
+  double scale_factor;  // the scale factor applied to the boxes
+};
+
+constexpr char BVH_FILE_MAGIC[8] = "AXOMBVH";
+constexpr int32 BVH_FILE_VERSION = 1;
+
+/*!
+ * \brief Computes a 64-bit FNV-1a hash of the supplied boxes.
+ *
+ * \param [in] boxes array of the bounding boxes, 2*NDIMS entries per box.
+ * \param [in] numItems the number of boxes.
+ *
+ * \note The boxes are copied to the host and hashed serially, in O(n) time,
+ *  which is much cheaper than a build. The hash detects a BVH file that is
+ *  stale, e.g., after the geometry changed, with a high probability.
+ */
+template <typename ExecSpace, int NDIMS, typename FloatType>
+uint64 hash_boxes(const FloatType* boxes, IndexType numItems);
+
+/*!
+ * \brief Writes the supplied BVH to a binary file.
+ *
+ * \param [in] fileName the name of the file.
+ * \param [in] bvh_data the internal BVH data-structure.
+ * \param [in] size the number of leaves of the BVH.
+ * \param [in] header the header of the file, see make_header().
+ *
+ * \return status true if the file was written, else, false.
+ */
+template <typename ExecSpace, typename FloatType, int NDIMS>
+bool write_bvh(const std::string& fileName,
+               const BVHData<FloatType, NDIMS>& bvh_data,
+               int32 size,
+               const BVHFileHeader& header);
+
+/*!
+ * \brief Reads a BVH that was written by write_bvh().
+ *
+ * \param [in] fileName the name of the file.
+ * \param [in] header the expected header of the file, see make_header().
+ * \param [in] allocatorID ID of the allocator used for the BVH.
+ * \param [out] bvh_data the internal BVH data-structure to populate.
+ *
+ * \return status true if the BVH was read, else, false, e.g., if the file
+ *  does not exist, or if its header does not match the expected header, in
+ *  which case bvh_data is not modified.
+ *
+ * \note On the host, the BVH is read in place, i.e., the cost of the read is
+ *  that of reading the file. On the device, it is staged on the host.
+ */
+template <typename ExecSpace, typename FloatType, int NDIMS>
+bool read_bvh(const std::string& fileName,
+              const BVHFileHeader& header,
+              int allocatorID,
+              BVHData<FloatType, NDIMS>& bvh_data);
+
+//------------------------------------------------------------------------------
+//                        IMPLEMENTATION
+//------------------------------------------------------------------------------
+
+/// Returns the header of the file of a BVH with the given parameters
+template <typename FloatType, int NDIMS>
+BVHFileHeader make_header(int32 size,
+                          IndexType numItems,
+                          uint64 boxes_hash,
+                          FloatType scale_factor)
+{
+  BVHFileHeader header;
+  memcpy(header.magic, BVH_FILE_MAGIC, sizeof(header.magic));
+  header.version = BVH_FILE_VERSION;
+  header.ndims = NDIMS;
+  header.float_size = sizeof(FloatType);
+  header.size = size;
+  header.num_items = numItems;
+  header.boxes_hash = boxes_hash;
+  header.scale_factor = scale_factor;
+  return header;
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace, int NDIMS, typename FloatType>
+uint64 hash_boxes(const FloatType* boxes, IndexType numItems)
+{
+  AXOM_PERF_MARK_FUNCTION("hash_boxes");
+
+  SLIC_ASSERT(boxes != nullptr);
+
+  constexpr uint64 FNV_OFFSET_BASIS = 14695981039346656037ULL;
+  constexpr uint64 FNV_PRIME = 1099511628211ULL;
+
+  const IndexType N = numItems * NDIMS * 2;
+  const FloatType* host_boxes = boxes;
+  std::vector<FloatType> staged_boxes;
+  if(execution_space<ExecSpace>::onDevice())
+  {
+    staged_boxes.resize(N);
+    axom::copy(staged_boxes.data(),
+               const_cast<FloatType*>(boxes),
+               N * sizeof(FloatType));
+    host_boxes = staged_boxes.data();
+  }
+
+  // NOTE: the boxes are hashed one value at a time, rather than one byte at a
+  // time, which is as fast as reading them
+  uint64 hash = FNV_OFFSET_BASIS;
+  for(IndexType i = 0; i < N; ++i)
+  {
+    uint64 bits = 0;
+    memcpy(&bits, &host_boxes[i], sizeof(FloatType));
+    hash = (hash ^ bits) * FNV_PRIME;
+  }
+
+  return hash;
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace, typename FloatType, int NDIMS>
+bool write_bvh(const std::string& fileName,
+               const BVHData<FloatType, NDIMS>& bvh_data,
+               int32 size,
+               const BVHFileHeader& header)
+{
+  AXOM_PERF_MARK_FUNCTION("write_bvh");
+
+  SLIC_ASSERT(bvh_data.m_inner_nodes != nullptr);
+  SLIC_ASSERT(size > 1);
+
+  using VecType = vec4_t<FloatType>;
+
+  // STEP 1: copy the BVH to the host, if needed
+  const int32 num_inner = (size - 1) * 4;
+  const VecType* inner_nodes = bvh_data.m_inner_nodes;
+  const int32* leaf_nodes = bvh_data.m_leaf_nodes;
+  std::vector<VecType> staged_inner_nodes;
+  std::vector<int32> staged_leaf_nodes;
+  if(execution_space<ExecSpace>::onDevice())
+  {
+    staged_inner_nodes.resize(num_inner);
+    staged_leaf_nodes.resize(size);
+    axom::copy(staged_inner_nodes.data(),
+               bvh_data.m_inner_nodes,
+               num_inner * sizeof(VecType));
+    axom::copy(staged_leaf_nodes.data(),
+               bvh_data.m_leaf_nodes,
+               size * sizeof(int32));
+    inner_nodes = staged_inner_nodes.data();
+    leaf_nodes = staged_leaf_nodes.data();
+  }
+
+  // STEP 2: write the header and the BVH
+  std::ofstream ofs(fileName.c_str(), std::ios::binary);
+  ofs.write(reinterpret_cast<const char*>(&header), sizeof(BVHFileHeader));
+  ofs.write(reinterpret_cast<const char*>(&bvh_data.m_bounds),
+            sizeof(AABB<FloatType, NDIMS>));
+  ofs.write(reinterpret_cast<const char*>(inner_nodes),
+            num_inner * sizeof(VecType));
+  ofs.write(reinterpret_cast<const char*>(leaf_nodes), size * sizeof(int32));
+  ofs.close();
+
+  return !ofs.fail();
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace, typename FloatType, int NDIMS>
+bool read_bvh(const std::string& fileName,
+              const BVHFileHeader& header,
+              int allocatorID,
+              BVHData<FloatType, NDIMS>& bvh_data)
+{
+  AXOM_PERF_MARK_FUNCTION("read_bvh");
+
+  using VecType = vec4_t<FloatType>;
+
+  std::ifstream ifs(fileName.c_str(), std::ios::binary);
+  if(!ifs.is_open())
+  {
+    SLIC_INFO("BVH file [" << fileName << "] does not exist");
+    return false;
+  }
+
+  // STEP 1: check that the file stores a BVH that is compatible with this
+  // BVH, and that was built over the same boxes
+  BVHFileHeader file_header;
+  ifs.read(reinterpret_cast<char*>(&file_header), sizeof(BVHFileHeader));
+  if(ifs.fail() ||
+     strncmp(file_header.magic, header.magic, sizeof(header.magic)) != 0 ||
+     file_header.version != header.version ||
+     file_header.ndims != header.ndims ||
+     file_header.float_size != header.float_size)
+  {
+    SLIC_WARNING("[" << fileName << "] is not a compatible BVH file!");
+    return false;
+  }
+
+  if(file_header.size != header.size ||
+     file_header.num_items != header.num_items ||
+     file_header.boxes_hash != header.boxes_hash ||
+     file_header.scale_factor != header.scale_factor)
+  {
+    SLIC_INFO("BVH file [" << fileName << "] was built over other boxes");
+    return false;
+  }
+
+  // STEP 2: read the BVH into the allocator's memory, staged on the host if
+  // the BVH is on the device
+  const int32 size = header.size;
+  const int32 num_inner = (size - 1) * 4;
+  const bool staged = execution_space<ExecSpace>::onDevice();
+
+  BVHData<FloatType, NDIMS> data;
+  data.allocate(size, allocatorID);
+
+  std::vector<VecType> staged_inner_nodes(staged ? num_inner : 0);
+  std::vector<int32> staged_leaf_nodes(staged ? size : 0);
+  VecType* inner_nodes =
+    staged ? staged_inner_nodes.data() : data.m_inner_nodes;
+  int32* leaf_nodes = staged ? staged_leaf_nodes.data() : data.m_leaf_nodes;
+
+  ifs.read(reinterpret_cast<char*>(&data.m_bounds),
+           sizeof(AABB<FloatType, NDIMS>));
+  ifs.read(reinterpret_cast<char*>(inner_nodes), num_inner * sizeof(VecType));
+  ifs.read(reinterpret_cast<char*>(leaf_nodes), size * sizeof(int32));
+  if(ifs.fail())
+  {
+    SLIC_WARNING("BVH file [" << fileName << "] is truncated!");
+    data.deallocate();
+    return false;
+  }
+
+  if(staged)
+  {
+    axom::copy(data.m_inner_nodes, inner_nodes, num_inner * sizeof(VecType));
+    axom::copy(data.m_leaf_nodes, leaf_nodes, size * sizeof(int32));
+  }
+
+  // STEP 3: replace the supplied BVH
+  bvh_data.deallocate();
+  bvh_data = data;
+
+  return true;
+}
+
+} /* namespace linear_bvh */
+} /* namespace internal */
+} /* namespace spin */
+} /* namespace axom */
+
+#endif /* AXOM_SPIN_LINEAR_BVH_BINARYIO_HPP_ */
@@ -12,6 +12,7 @@
 #include "axom/slic.hpp"         // for SLIC macros
 
 #include "axom/spin/internal/linear_bvh/BVHData.hpp"
+#include "axom/spin/internal/linear_bvh/WideBVHData.hpp"
 
 namespace axom
 {
@@ -29,6 +30,15 @@ namespace linear_bvh
 AXOM_HOST_DEVICE
 inline bool leaf_node(const int32& nodeIdx) { return (nodeIdx < 0); }
 
+/*!
+ * \brief The size of the stack of the binary BVH traversals.
+ *
+ * \note A traversal pushes at most one node per level of the BVH, hence, the
+ *  depth of the leaves must be less than BVH_STACK_SIZE, the root being at
+ *  depth 0. The wide BVH traversal scales its stack by the node width.
+ */
+constexpr int32 BVH_STACK_SIZE = 64;
+
 /*!
  * \brief Generic BVH traversal routine.
  *
@@ -68,7 +78,7 @@ AXOM_HOST_DEVICE inline void bvh_traverse(const vec4_t<FloatType>* inner_nodes,
 
   // setup stack
   constexpr int32 ISIZE = sizeof(int32);
-  constexpr int32 STACK_SIZE = 64;
+  constexpr int32 STACK_SIZE = BVH_STACK_SIZE;
   constexpr int32 BARRIER = -2000000000;
   int32 todo[STACK_SIZE];
   int32 stackptr = 0;
@@ -131,6 +141,186 @@ AXOM_HOST_DEVICE inline void bvh_traverse(const vec4_t<FloatType>* inner_nodes,
   }  // END while
 }
 
+/*!
+ * \brief Best-first BVH traversal routine for distance-ordered queries, e.g.,
+ *  nearest neighbor queries.
+ *
+ * \param [in] inner_nodes pointer to the BVH bins.
+ * \param [in] leaf_nodes pointer to the leaf node IDs.
+ * \param [in] p the primitive in query, e.g., a point.
+ * \param [in] L functor that computes the distance to the left bin
+ * \param [in] R functor that computes the distance to the right bin
+ * \param [in] A functor that defines the leaf action
+ * \param [in] bound the initial pruning bound, e.g., the max distance.
+ *
+ * \note The functors `L`, `R` take the same arguments as the traversal
+ *  predicates of bvh_traverse(), but return a lower bound of the distance from
+ *  the primitive to any item within the bin, e.g., the squared distance from
+ *  a point to the bin. The leaf action, `A`, takes the same arguments as the
+ *  leaf action of bvh_traverse() and returns the updated pruning bound, e.g.,
+ *  the distance to the k-th nearest item found so far.
+ *
+ * \note At each inner node, the traversal descends into the closer bin first
+ *  and defers the other bin, along with its distance, to the stack. Bins whose
+ *  distance is not below the current bound are pruned, both when they are
+ *  reached and when they are popped from the stack, since the bound may have
+ *  decreased in the meantime.
+ *
+ * \see BVHData for the details on the internal data layout of the BVH.
+ * \see TraversalPredicates for the bin distance functions.
+ */
+template <typename FloatType,
+          typename PrimitiveType,
+          typename LeftDistance,
+          typename RightDistance,
+          typename LeafAction>
+AXOM_HOST_DEVICE inline void bvh_traverse_nearest(
+  const vec4_t<FloatType>* inner_nodes,
+  const int32* leaf_nodes,
+  const PrimitiveType& p,
+  LeftDistance&& L,
+  RightDistance&& R,
+  LeafAction&& A,
+  FloatType bound)
+{
+  using VecType = vec4_t<FloatType>;
+
+  // setup stack, each deferred bin is stored along with its distance
+  constexpr int32 ISIZE = sizeof(int32);
+  constexpr int32 STACK_SIZE = BVH_STACK_SIZE;
+  constexpr int32 BARRIER = -2000000000;
+  int32 todo[STACK_SIZE];
+  FloatType todo_dist[STACK_SIZE];
+  int32 stackptr = 0;
+  todo[stackptr] = BARRIER;
+  todo_dist[stackptr] = 0;
+
+  int32 current_node = 0;
+  while(current_node != BARRIER)
+  {
+    bool pop = true;
+
+    if(!leaf_node(current_node))
+    {
+      const VecType first4 = inner_nodes[current_node + 0];
+      const VecType second4 = inner_nodes[current_node + 1];
+      const VecType third4 = inner_nodes[current_node + 2];
+
+      const FloatType l_dist = L(p, first4, second4);
+      const FloatType r_dist = R(p, second4, third4);
+
+      const bool in_left = (l_dist < bound);
+      const bool in_right = (r_dist < bound);
+
+      if(in_left || in_right)
+      {
+        VecType children = inner_nodes[current_node + 3];
+
+        // memcpy the int bits hidden in the floats
+        int32 l_child;
+        memcpy(&l_child, &children[0], ISIZE);
+        int32 r_child;
+        memcpy(&r_child, &children[1], ISIZE);
+
+        const bool left_first = in_left && (!in_right || l_dist <= r_dist);
+        current_node = left_first ? l_child : r_child;
+
+        if(in_left && in_right)
+        {
+          stackptr++;
+          todo[stackptr] = left_first ? r_child : l_child;
+          todo_dist[stackptr] = left_first ? r_dist : l_dist;
+        }
+
+        pop = false;
+      }
+
+    }  // END if
+    else
+    {
+      // compute leaf index
+      current_node = -current_node - 1;  // swap the neg address
+
+      // execute leaf action and tighten the bound
+      bound = A(current_node, leaf_nodes);
+    }  // END else
+
+    // pop the stack, skipping the bins that are farther than the bound
+    while(pop)
+    {
+      current_node = todo[stackptr];
+      const FloatType dist = todo_dist[stackptr];
+      stackptr--;
+      pop = (current_node != BARRIER) && !(dist < bound);
+    }
+
+  }  // END while
+}
+
+/*!
+ * \brief Traversal routine of a wide BVH.
+ *
+ * \param [in] nodes pointer to the nodes of the wide BVH.
+ * \param [in] leaf_nodes pointer to the leaf node IDs.
+ * \param [in] p the primitive in query, e.g., a point, ray, etc.
+ * \param [in] N functor that defines the check for all the bins of a node
+ * \param [in] A functor that defines the leaf action
+ *
+ * \note The supplied functor, `N`, is expected to take the primitive, p, and
+ *  a WideNode, and to return a bitmask of the bins of the node that satisfy
+ *  the traversal predicate, e.g., a WidePointPredicate.
+ *
+ * \note A node is popped from the stack at each step, and its children are
+ *  tested against the primitive at once. Hence, the traversal visits fewer
+ *  nodes than bvh_traverse(), and reads the bins of a node contiguously.
+ *
+ * \see WideBVHData, WideTraversalPredicates.hpp
+ */
+template <typename FloatType,
+          int NDIMS,
+          int WIDTH,
+          typename PrimitiveType,
+          typename NodeCheck,
+          typename LeafAction>
+AXOM_HOST_DEVICE inline void wide_bvh_traverse(
+  const WideNode<FloatType, NDIMS, WIDTH>* nodes,
+  const int32* leaf_nodes,
+  const PrimitiveType& p,
+  NodeCheck&& N,
+  LeafAction&& A)
+{
+  // setup stack, each node replaces its entry by at most WIDTH entries
+  constexpr int32 STACK_SIZE = BVH_STACK_SIZE * (WIDTH - 1) + 1;
+  int32 todo[STACK_SIZE];
+  int32 stackptr = 0;
+  todo[stackptr++] = 0;
+
+  while(stackptr > 0)
+  {
+    const int32 current_node = todo[--stackptr];
+
+    if(leaf_node(current_node))
+    {
+      // execute leaf action
+      A(-current_node - 1, leaf_nodes);
+      continue;
+    }
+
+    const WideNode<FloatType, NDIMS, WIDTH>& node = nodes[current_node];
+    const int32 mask = N(p, node);
+
+    // push the children in reverse order, such that the leaves are visited
+    // in the same order as in bvh_traverse()
+    for(int32 c = WIDTH - 1; c >= 0; --c)
+    {
+      if(mask & (1 << c))
+      {
+        todo[stackptr++] = node.children[c];
+      }
+    }
+  }  // END while
+}
+
 } /* namespace linear_bvh */
 } /* namespace internal */
 } /* namespace spin */
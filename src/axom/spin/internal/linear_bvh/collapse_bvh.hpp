@@ -0,0 +1,184 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_SPIN_COLLAPSE_BVH_H_
+#define AXOM_SPIN_COLLAPSE_BVH_H_
+
+// axom core includes
+#include "axom/core/Types.hpp"                       // for fixed bitwidth types
+#include "axom/core/memory_management.hpp"           // for alloc()/free()
+#include "axom/core/numerics/floating_point_limits.hpp"
+#include "axom/core/utilities/AnnotationMacros.hpp"  // for annotations
+#include "axom/slic/interface/slic_macros.hpp"       // for SLIC_ASSERT()
+
+#include "axom/spin/internal/linear_bvh/aabb.hpp"
+#include "axom/spin/internal/linear_bvh/BVHData.hpp"
+#include "axom/spin/internal/linear_bvh/WideBVHData.hpp"
+#include "axom/spin/internal/linear_bvh/bvh_traverse.hpp"  // for leaf_node()
+#include "axom/spin/internal/linear_bvh/refit_bvh.hpp"     // for get_bin()
+
+// C/C++ includes
+#include <cstring>  // for memcpy
+#include <vector>   // for std::vector
+
+namespace axom
+{
+namespace spin
+{
+namespace internal
+{
+namespace linear_bvh
+{
+/*!
+ * \brief Collapses a binary BVH into a wide BVH, whose inner nodes have up to
+ *  WIDTH children, for the traversal on the CPU.
+ *
+ * \param [in] bvh_data the internal binary BVH data-structure.
+ * \param [in] allocatorID ID of the allocator used for the wide BVH.
+ * \param [out] wide_data the internal wide BVH data-structure to populate.
+ *
+ * \note Each wide node is formed top-down from a binary node, by replacing
+ *  the inner child with the largest bin by its two children, until the node
+ *  has WIDTH children or only leaves. The bins of a wide node are hence bins
+ *  of the binary BVH, and a wide BVH yields the same candidates.
+ *
+ * \note The binary BVH must be accessible on the host. The collapse runs on
+ *  the host in O(n) time, for n leaves.
+ *
+ * \tparam WIDTH the maximum number of children of a node, i.e., 4 or 8
+ */
+template <int WIDTH, typename FloatType, int NDIMS>
+void collapse_bvh(const BVHData<FloatType, NDIMS>& bvh_data,
+                  int allocatorID,
+                  WideBVHData<FloatType, NDIMS>& wide_data);
+
+//------------------------------------------------------------------------------
+//                        IMPLEMENTATION
+//------------------------------------------------------------------------------
+template <int WIDTH, typename FloatType, int NDIMS>
+void collapse_bvh(const BVHData<FloatType, NDIMS>& bvh_data,
+                  int allocatorID,
+                  WideBVHData<FloatType, NDIMS>& wide_data)
+{
+  AXOM_PERF_MARK_FUNCTION("collapse_bvh");
+
+  AXOM_STATIC_ASSERT_MSG((WIDTH == 4) || (WIDTH == 8),
+                         "A wide BVH has 4 or 8 children per node");
+
+  using NodeType = WideNode<FloatType, NDIMS, WIDTH>;
+  using BoxType = AABB<FloatType, NDIMS>;
+
+  const vec4_t<FloatType>* inner_nodes = bvh_data.m_inner_nodes;
+  SLIC_ASSERT(inner_nodes != nullptr);
+
+  // a child of a binary node, along with its bin
+  struct Slot
+  {
+    int32 child;
+    BoxType bin;
+  };
+
+  // the children of the binary node at the given offset
+  auto get_children = [=](int32 offset, Slot& left, Slot& right) {
+    const vec4_t<FloatType> children = inner_nodes[offset + 3];
+
+    // memcpy the int bits hidden in the floats
+    memcpy(&left.child, &children[0], sizeof(int32));
+    memcpy(&right.child, &children[1], sizeof(int32));
+    left.bin = get_bin<FloatType, NDIMS>(inner_nodes + offset, 0);
+    right.bin = get_bin<FloatType, NDIMS>(inner_nodes + offset, 1);
+  };
+
+  // the offsets of the binary nodes that form the wide nodes, in
+  // breadth-first order, i.e., in the order of the wide nodes
+  std::vector<int32> queue(1, 0);
+  std::vector<NodeType> nodes;
+
+  for(std::size_t head = 0; head < queue.size(); ++head)
+  {
+    Slot slots[WIDTH];
+    int32 count = 2;
+    get_children(queue[head], slots[0], slots[1]);
+
+    while(count < WIDTH)
+    {
+      // open the inner child with the largest bin, in place, such that the
+      // children of a wide node remain in the order of the leaves
+      int32 largest = -1;
+      FloatType largest_area = -1;
+      for(int32 s = 0; s < count; ++s)
+      {
+        const FloatType area = surface_area(slots[s].bin);
+        if(!leaf_node(slots[s].child) && area > largest_area)
+        {
+          largest = s;
+          largest_area = area;
+        }
+      }
+
+      if(largest < 0)
+      {
+        break;
+      }
+
+      for(int32 s = count; s > largest + 1; --s)
+      {
+        slots[s] = slots[s - 1];
+      }
+      get_children(slots[largest].child, slots[largest], slots[largest + 1]);
+      ++count;
+    }
+
+    NodeType node;
+    for(int32 c = 0; c < WIDTH; ++c)
+    {
+      FloatType lo[NDIMS];
+      FloatType hi[NDIMS];
+      if(c < count)
+      {
+        slots[c].bin.min(lo);
+        slots[c].bin.max(hi);
+        if(leaf_node(slots[c].child))
+        {
+          node.children[c] = slots[c].child;
+        }
+        else
+        {
+          node.children[c] = static_cast<int32>(queue.size());
+          queue.push_back(slots[c].child);
+        }
+      }
+      else
+      {
+        // an unused slot, with an inverted bin
+        for(int32 d = 0; d < NDIMS; ++d)
+        {
+          lo[d] = numerics::floating_point_limits<FloatType>::max();
+          hi[d] = numerics::floating_point_limits<FloatType>::lowest();
+        }
+        node.children[c] = 0;
+      }
+
+      for(int32 d = 0; d < NDIMS; ++d)
+      {
+        node.lo[d][c] = lo[d];
+        node.hi[d][c] = hi[d];
+      }
+    }
+
+    nodes.push_back(node);
+  }
+
+  const int32 numNodes = static_cast<int32>(nodes.size());
+  wide_data.template allocate<WIDTH>(numNodes, allocatorID);
+  axom::copy(wide_data.m_nodes, nodes.data(), numNodes * sizeof(NodeType));
+}
+
+} /* namespace linear_bvh */
+} /* namespace internal */
+} /* namespace spin */
+} /* namespace axom */
+
+#endif /* AXOM_SPIN_COLLAPSE_BVH_H_ */
@@ -37,24 +37,28 @@ namespace linear_bvh
  * \param [out] bvh_data referene to the internal BVH data structure.
  *
  * \tparam FloatType the floating point precision, e.g., `double` or `float`
+ * \tparam MortonCodeType the type of the Morton codes of the radix tree
  *
  * \see BVH::build()
  */
 /// @{
 
-template <typename ExecSpace, typename FloatType>
-void emit_bvh(RadixTree<FloatType, 3>& data, BVHData<FloatType, 3>& bvh_data);
+template <typename ExecSpace, typename FloatType, typename MortonCodeType>
+void emit_bvh(RadixTree<FloatType, 3, MortonCodeType>& data,
+              BVHData<FloatType, 3>& bvh_data);
 
-template <typename ExecSpace, typename FloatType>
-void emit_bvh(RadixTree<FloatType, 2>& data, BVHData<FloatType, 2>& bvh_data);
+template <typename ExecSpace, typename FloatType, typename MortonCodeType>
+void emit_bvh(RadixTree<FloatType, 2, MortonCodeType>& data,
+              BVHData<FloatType, 2>& bvh_data);
 
 /// @}
 
 //------------------------------------------------------------------------------
 //                        IMPLEMENTATION
 //------------------------------------------------------------------------------
-template <typename ExecSpace, typename FloatType>
-void emit_bvh(RadixTree<FloatType, 3>& data, BVHData<FloatType, 3>& bvh_data)
+template <typename ExecSpace, typename FloatType, typename MortonCodeType>
+void emit_bvh(RadixTree<FloatType, 3, MortonCodeType>& data,
+              BVHData<FloatType, 3>& bvh_data)
 {
   AXOM_PERF_MARK_FUNCTION("emit_bvh3D");
 
@@ -145,8 +149,9 @@ void emit_bvh(RadixTree<FloatType, 3>& data, BVHData<FloatType, 3>& bvh_data)
 }
 
 //------------------------------------------------------------------------------
-template <typename ExecSpace, typename FloatType>
-void emit_bvh(RadixTree<FloatType, 2>& data, BVHData<FloatType, 2>& bvh_data)
+template <typename ExecSpace, typename FloatType, typename MortonCodeType>
+void emit_bvh(RadixTree<FloatType, 2, MortonCodeType>& data,
+              BVHData<FloatType, 2>& bvh_data)
 {
   AXOM_PERF_MARK_FUNCTION("emit_bvh2D");
 
@@ -163,6 +163,13 @@ inline AXOM_HOST_DEVICE axom::int32 clz(axom::int32 x)
   return axom::int32(n - x);
 }
 
+inline AXOM_HOST_DEVICE axom::int32 clz(axom::int64 x)
+{
+  const axom::int32 hi = static_cast<axom::int32>(x >> 32);
+  const axom::int32 lo = static_cast<axom::int32>(x & 0xFFFFFFFF);
+  return (hi != 0) ? clz(hi) : 32 + clz(lo);
+}
+
 inline AXOM_HOST_DEVICE axom::float64 pi()
 {
   return 3.14159265358979323846264338327950288;
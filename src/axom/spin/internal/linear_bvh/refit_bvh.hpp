@@ -0,0 +1,443 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_SPIN_REFIT_BVH_H_
+#define AXOM_SPIN_REFIT_BVH_H_
+
+// axom core includes
+#include "axom/core/Types.hpp"                       // for fixed bitwidth types
+#include "axom/core/memory_management.hpp"           // for alloc()/free()
+#include "axom/core/utilities/AnnotationMacros.hpp"  // for annotations
+#include "axom/slic/interface/slic_macros.hpp"       // for SLIC_ASSERT()
+
+#include "axom/core/execution/execution_space.hpp"
+#include "axom/core/execution/for_all.hpp"
+
+#include "axom/spin/internal/linear_bvh/vec.hpp"
+#include "axom/spin/internal/linear_bvh/aabb.hpp"
+#include "axom/spin/internal/linear_bvh/BVHData.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+// C/C++ includes
+#include <cstring>  // for memcpy
+
+namespace axom
+{
+namespace spin
+{
+namespace internal
+{
+namespace linear_bvh
+{
+/*!
+ * \brief Updates the bins of an existing BVH to enclose the supplied boxes,
+ *  while keeping the topology of the BVH, i.e., the tree and the order of the
+ *  leaves.
+ *
+ * \param [in] boxes array of the bounding boxes, 2*NDIMS entries per box.
+ * \param [in] numBoxes the number of boxes, in the order of the original boxes.
+ * \param [in] size the number of leaves of the BVH.
+ * \param [in] scale_factor scale factor applied to each box.
+ * \param [in] allocatorID ID of the allocator used for temporary buffers.
+ * \param [in,out] bvh_data the internal BVH data-structure to update.
+ *
+ * \note The bins are recomputed bottom-up in parallel: one thread per leaf
+ *  walks up the tree and the second thread to reach an inner node computes
+ *  its box, as in the construction of the radix tree.
+ *
+ * \note The leaves whose item ID is not less than numBoxes, i.e., the fake
+ *  box that is added for a single item, are set to the box at the origin.
+ *
+ * \see propagate_aabbs(), BVH::refit()
+ */
+template <typename ExecSpace, typename FloatType, int NDIMS>
+void refit_bvh(const FloatType* boxes,
+               int32 numBoxes,
+               int32 size,
+               FloatType scale_factor,
+               int allocatorID,
+               BVHData<FloatType, NDIMS>& bvh_data);
+
+/*!
+ * \brief Computes the surface area heuristic (SAH) cost of the BVH.
+ *
+ * \param [in] bvh_data the internal BVH data-structure.
+ * \param [in] size the number of leaves of the BVH.
+ *
+ * \return cost the sum of the surface areas of all the nodes, relative to the
+ *  surface area of the root, i.e., the expected number of nodes that a random
+ *  ray intersects, with unit traversal and intersection costs.
+ *
+ * \note In 2D, the surface area of a box is its perimeter.
+ */
+template <typename ExecSpace, typename FloatType, int NDIMS>
+FloatType sah_cost(const BVHData<FloatType, NDIMS>& bvh_data, int32 size);
+
+/*!
+ * \brief Computes the overlap of the bins and the depth of the leaves of the
+ *  BVH, which complement the SAH cost as measures of the quality of the BVH.
+ *
+ * \param [in] bvh_data the internal BVH data-structure.
+ * \param [in] size the number of leaves of the BVH.
+ * \param [in] allocatorID ID of the allocator used for temporary buffers.
+ * \param [out] overlap the average over the inner nodes of the surface area of
+ *  the intersection of the two bins of a node, relative to the surface area of
+ *  their union. A query in the overlap of two bins traverses both of them.
+ * \param [out] max_depth the depth of the deepest leaf, the root is at depth 0.
+ * \param [out] average_depth the average depth of the leaves.
+ */
+template <typename ExecSpace, typename FloatType, int NDIMS>
+void tree_quality(const BVHData<FloatType, NDIMS>& bvh_data,
+                  int32 size,
+                  int allocatorID,
+                  FloatType& overlap,
+                  int32& max_depth,
+                  FloatType& average_depth);
+
+//------------------------------------------------------------------------------
+//                        IMPLEMENTATION
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Returns the index of the entry of an inner node that stores the
+ *  coordinate of a corner of one of its bins.
+ *
+ * \param [in] side 0 for the left bin, 1 for the right bin.
+ * \param [in] corner 0 for the lower corner, 1 for the upper corner.
+ * \param [in] dim the dimension of the coordinate.
+ *
+ * \note The entries of the 2D bins follow the 3D layout, with the
+ *  z-coordinates set to zero.
+ *
+ * \see BVHData for the details on the internal data layout of the BVH.
+ */
+AXOM_HOST_DEVICE inline int32 bin_entry(int32 side, int32 corner, int32 dim)
+{
+  return 6 * side + 3 * corner + dim;
+}
+
+/*!
+ * \brief Returns the left (side=0) or right (side=1) bin of an inner node.
+ */
+template <typename FloatType, int NDIMS>
+AXOM_HOST_DEVICE inline AABB<FloatType, NDIMS> get_bin(
+  const vec4_t<FloatType>* node,
+  int32 side)
+{
+  Vec<FloatType, NDIMS> lo, hi;
+  for(int32 d = 0; d < NDIMS; ++d)
+  {
+    const int32 lo_entry = bin_entry(side, 0, d);
+    const int32 hi_entry = bin_entry(side, 1, d);
+    lo[d] = node[lo_entry / 4][lo_entry % 4];
+    hi[d] = node[hi_entry / 4][hi_entry % 4];
+  }
+
+  AABB<FloatType, NDIMS> aabb;
+  aabb.include(lo);
+  aabb.include(hi);
+  return aabb;
+}
+
+/*!
+ * \brief Sets the left (side=0) or right (side=1) bin of an inner node.
+ */
+template <typename FloatType, int NDIMS>
+AXOM_HOST_DEVICE inline void set_bin(vec4_t<FloatType>* node,
+                                     int32 side,
+                                     const AABB<FloatType, NDIMS>& aabb)
+{
+  FloatType lo[NDIMS];
+  FloatType hi[NDIMS];
+  aabb.min(lo);
+  aabb.max(hi);
+  for(int32 d = 0; d < NDIMS; ++d)
+  {
+    const int32 lo_entry = bin_entry(side, 0, d);
+    const int32 hi_entry = bin_entry(side, 1, d);
+    node[lo_entry / 4][lo_entry % 4] = lo[d];
+    node[hi_entry / 4][hi_entry % 4] = hi[d];
+  }
+}
+
+/*!
+ * \brief Recovers the parent of each node of the BVH, which only stores the
+ *  children of each inner node.
+ *
+ * \param [in] bvh_data the internal BVH data-structure.
+ * \param [in] size the number of leaves of the BVH.
+ * \param [out] parents array of length 2*size-1, the inner nodes come first,
+ *  followed by the leaves. The entry of a node is 2*parent+side, where side
+ *  is the bin of the parent that holds the node, or -1 for the root.
+ */
+template <typename ExecSpace, typename FloatType, int NDIMS>
+void get_parents(const BVHData<FloatType, NDIMS>& bvh_data,
+                 int32 size,
+                 int32* parents)
+{
+  AXOM_PERF_MARK_FUNCTION("get_parents");
+
+  const vec4_t<FloatType>* inner_nodes = bvh_data.m_inner_nodes;
+  const int32 inner_size = size - 1;
+
+  for_all<ExecSpace>(
+    inner_size,
+    AXOM_LAMBDA(int32 node) {
+      const vec4_t<FloatType> children = inner_nodes[node * 4 + 3];
+
+      // memcpy the int bits hidden in the floats
+      int32 child[2];
+      memcpy(&child[0], &children[0], sizeof(int32));
+      memcpy(&child[1], &children[1], sizeof(int32));
+
+      for(int32 side = 0; side < 2; ++side)
+      {
+        const int32 idx =
+          (child[side] < 0) ? inner_size - child[side] - 1 : child[side] / 4;
+        parents[idx] = 2 * node + side;
+      }
+
+      if(node == 0)
+      {
+        parents[0] = -1;
+      }
+    });
+}
+
+/*!
+ * \brief Returns the surface area of a 3D box, or the perimeter of a 2D box.
+ */
+/// @{
+template <typename FloatType>
+AXOM_HOST_DEVICE inline FloatType surface_area(const AABB<FloatType, 3>& aabb)
+{
+  const FloatType dx = aabb.m_x.length();
+  const FloatType dy = aabb.m_y.length();
+  const FloatType dz = aabb.m_z.length();
+  return 2 * (dx * dy + dy * dz + dz * dx);
+}
+
+template <typename FloatType>
+AXOM_HOST_DEVICE inline FloatType surface_area(const AABB<FloatType, 2>& aabb)
+{
+  return 2 * (aabb.m_x.length() + aabb.m_y.length());
+}
+/// @}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace, typename FloatType, int NDIMS>
+void refit_bvh(const FloatType* boxes,
+               int32 numBoxes,
+               int32 size,
+               FloatType scale_factor,
+               int allocatorID,
+               BVHData<FloatType, NDIMS>& bvh_data)
+{
+  AXOM_PERF_MARK_FUNCTION("refit_bvh");
+
+  SLIC_ASSERT(boxes != nullptr);
+  SLIC_ASSERT(size >= 2);
+  SLIC_ASSERT(numBoxes <= size);
+
+  constexpr int32 STRIDE = 2 * NDIMS;
+  constexpr int32 ROOT_PARENT = -1;
+  const int32 inner_size = size - 1;
+
+  vec4_t<FloatType>* inner_nodes = bvh_data.m_inner_nodes;
+  const int32* leaf_nodes = bvh_data.m_leaf_nodes;
+
+  // STEP 1: recover the parent of each node, along with the side of the
+  // parent that holds its bin
+  int32* parents = axom::allocate<int32>(inner_size + size, allocatorID);
+  int32* counters = axom::allocate<int32>(inner_size, allocatorID);
+
+  AXOM_PERF_MARK_SECTION("refit_bvh_parents",
+                         get_parents<ExecSpace>(bvh_data, size, parents););
+
+  for_all<ExecSpace>(
+    inner_size,
+    AXOM_LAMBDA(int32 node) { counters[node] = 0; });
+
+  // STEP 2: propagate the boxes of the leaves up to the root
+  using atomic_policy = typename axom::execution_space<ExecSpace>::atomic_policy;
+
+  AXOM_PERF_MARK_SECTION(
+    "refit_bvh_propagate",
+    for_all<ExecSpace>(
+      size,
+      AXOM_LAMBDA(int32 i) {
+        // the box of the leaf, scaled as in the construction of the BVH
+        const int32 item = leaf_nodes[i];
+        Vec<FloatType, NDIMS> lo, hi;
+        for(int32 d = 0; d < NDIMS; ++d)
+        {
+          lo[d] = (item < numBoxes) ? boxes[item * STRIDE + d] : 0;
+          hi[d] = (item < numBoxes) ? boxes[item * STRIDE + NDIMS + d] : 0;
+        }
+
+        AABB<FloatType, NDIMS> aabb;
+        aabb.include(lo);
+        aabb.include(hi);
+        aabb.scale(scale_factor);
+
+        int32 slot = parents[inner_size + i];
+        while(slot != ROOT_PARENT)
+        {
+          const int32 node = slot / 2;
+          set_bin(inner_nodes + node * 4, slot % 2, aabb);
+
+#if defined(__CUDA_ARCH__)
+          // make the bin visible to the thread that updates the parent, see
+          // propagate_aabbs()
+          __threadfence_system();
+#endif
+
+          const int32 old =
+            RAJA::atomicAdd<atomic_policy>(&(counters[node]), 1);
+          if(old == 0)
+          {
+            // the other bin of this node is not updated yet, the thread that
+            // updates it carries on
+            return;
+          }
+
+          const int32 sibling = 1 - slot % 2;
+          aabb.include(
+            get_bin<FloatType, NDIMS>(inner_nodes + node * 4, sibling));
+          slot = parents[node];
+        }
+      }););
+
+  axom::deallocate(parents);
+  axom::deallocate(counters);
+
+  // STEP 3: update the bounds from the bins of the root
+  vec4_t<FloatType> root[3];
+  axom::copy(root, inner_nodes, 3 * sizeof(vec4_t<FloatType>));
+
+  AABB<FloatType, NDIMS> bounds = get_bin<FloatType, NDIMS>(root, 0);
+  bounds.include(get_bin<FloatType, NDIMS>(root, 1));
+  bvh_data.m_bounds = bounds;
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace, typename FloatType, int NDIMS>
+FloatType sah_cost(const BVHData<FloatType, NDIMS>& bvh_data, int32 size)
+{
+  AXOM_PERF_MARK_FUNCTION("sah_cost");
+
+  SLIC_ASSERT(size >= 2);
+
+  const vec4_t<FloatType>* inner_nodes = bvh_data.m_inner_nodes;
+  const int32 inner_size = size - 1;
+
+  // every node other than the root is the bin of exactly one inner node
+  using reduce_policy = typename axom::execution_space<ExecSpace>::reduce_policy;
+  RAJA::ReduceSum<reduce_policy, FloatType> area(0);
+
+  for_all<ExecSpace>(
+    inner_size,
+    AXOM_LAMBDA(int32 node) {
+      const vec4_t<FloatType>* bins = inner_nodes + node * 4;
+      area += surface_area(get_bin<FloatType, NDIMS>(bins, 0)) +
+        surface_area(get_bin<FloatType, NDIMS>(bins, 1));
+    });
+
+  const FloatType root_area = surface_area(bvh_data.m_bounds);
+  return (root_area > 0) ? 1 + area.get() / root_area : 1;
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace, typename FloatType, int NDIMS>
+void tree_quality(const BVHData<FloatType, NDIMS>& bvh_data,
+                  int32 size,
+                  int allocatorID,
+                  FloatType& overlap,
+                  int32& max_depth,
+                  FloatType& average_depth)
+{
+  AXOM_PERF_MARK_FUNCTION("tree_quality");
+
+  SLIC_ASSERT(size >= 2);
+
+  const vec4_t<FloatType>* inner_nodes = bvh_data.m_inner_nodes;
+  const int32 inner_size = size - 1;
+
+  using reduce_policy = typename axom::execution_space<ExecSpace>::reduce_policy;
+
+  // STEP 1: the overlap of the two bins of each inner node
+  RAJA::ReduceSum<reduce_policy, FloatType> overlap_sum(0);
+
+  for_all<ExecSpace>(
+    inner_size,
+    AXOM_LAMBDA(int32 node) {
+      const vec4_t<FloatType>* bins = inner_nodes + node * 4;
+      const AABB<FloatType, NDIMS> left = get_bin<FloatType, NDIMS>(bins, 0);
+      const AABB<FloatType, NDIMS> right = get_bin<FloatType, NDIMS>(bins, 1);
+
+      FloatType lo[NDIMS], hi[NDIMS], rlo[NDIMS], rhi[NDIMS];
+      left.min(lo);
+      left.max(hi);
+      right.min(rlo);
+      right.max(rhi);
+
+      bool overlaps = true;
+      Vec<FloatType, NDIMS> ilo, ihi;
+      for(int32 d = 0; d < NDIMS; ++d)
+      {
+        ilo[d] = (lo[d] < rlo[d]) ? rlo[d] : lo[d];
+        ihi[d] = (hi[d] < rhi[d]) ? hi[d] : rhi[d];
+        overlaps = overlaps && (ilo[d] <= ihi[d]);
+      }
+
+      AABB<FloatType, NDIMS> both = left;
+      both.include(right);
+      const FloatType area = surface_area(both);
+
+      if(overlaps && area > 0)
+      {
+        AABB<FloatType, NDIMS> intersection;
+        intersection.include(ilo);
+        intersection.include(ihi);
+        overlap_sum += surface_area(intersection) / area;
+      }
+    });
+
+  overlap = overlap_sum.get() / inner_size;
+
+  // STEP 2: the depth of each leaf, by walking up to the root
+  int32* parents = axom::allocate<int32>(inner_size + size, allocatorID);
+  get_parents<ExecSpace>(bvh_data, size, parents);
+
+  RAJA::ReduceMax<reduce_policy, int32> depth_max(0);
+  RAJA::ReduceSum<reduce_policy, FloatType> depth_sum(0);
+
+  for_all<ExecSpace>(
+    size,
+    AXOM_LAMBDA(int32 i) {
+      int32 depth = 0;
+      for(int32 slot = parents[inner_size + i]; slot >= 0;
+          slot = parents[slot / 2])
+      {
+        depth++;
+      }
+
+      depth_max.max(depth);
+      depth_sum += depth;
+    });
+
+  axom::deallocate(parents);
+
+  max_depth = depth_max.get();
+  average_depth = depth_sum.get() / size;
+}
+
+} /* namespace linear_bvh */
+} /* namespace internal */
+} /* namespace spin */
+} /* namespace axom */
+
+#endif /* AXOM_SPIN_REFIT_BVH_H_ */
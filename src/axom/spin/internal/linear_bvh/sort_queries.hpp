@@ -0,0 +1,108 @@
+// Copyright (c) 2017-2020, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_SPIN_SORT_QUERIES_H_
+#define AXOM_SPIN_SORT_QUERIES_H_
+
+// axom core includes
+#include "axom/core/Types.hpp"                       // for fixed bitwidth types
+#include "axom/core/execution/for_all.hpp"           // for for_all()
+#include "axom/core/memory_management.hpp"           // for alloc()/free()
+#include "axom/core/utilities/AnnotationMacros.hpp"  // for annotations
+#include "axom/core/utilities/Utilities.hpp"         // for isNearlyEqual()
+
+#include "axom/spin/internal/linear_bvh/aabb.hpp"
+#include "axom/spin/internal/linear_bvh/build_radix_tree.hpp"
+#include "axom/spin/internal/linear_bvh/vec.hpp"
+
+namespace axom
+{
+namespace spin
+{
+namespace internal
+{
+namespace linear_bvh
+{
+/*!
+ * \brief Returns the order in which to process the supplied queries, such
+ *  that consecutive queries are close to each other.
+ *
+ * \param [in] getPosition functor that returns the position of the ith query,
+ *  e.g., a query point or the source point of a ray.
+ * \param [in] N the number of queries.
+ * \param [in] bounds the bounds of the BVH.
+ * \param [in] allocatorID ID of the allocator used for all allocations.
+ *
+ * \return order array of the IDs of the queries, in the Morton order of their
+ *  positions within the bounds of the BVH. The caller must deallocate it.
+ *
+ * \note The queries are sorted with the 30-bit Morton codes of the BVH build,
+ *  and the positions outside of the bounds are clamped to the bounds. Hence,
+ *  queries that are processed by consecutive threads traverse the same
+ *  subtrees, and share the nodes in cache.
+ */
+template <typename ExecSpace, typename FloatType, int NDIMS, typename PositionFunctor>
+int32* sort_queries(PositionFunctor&& getPosition,
+                    IndexType N,
+                    const AABB<FloatType, NDIMS>& bounds,
+                    int allocatorID);
+
+//------------------------------------------------------------------------------
+//                        IMPLEMENTATION
+//------------------------------------------------------------------------------
+template <typename ExecSpace, typename FloatType, int NDIMS, typename PositionFunctor>
+int32* sort_queries(PositionFunctor&& getPosition,
+                    IndexType N,
+                    const AABB<FloatType, NDIMS>& bounds,
+                    int allocatorID)
+{
+  AXOM_PERF_MARK_FUNCTION("sort_queries");
+
+  // the positions are normalized to the bounds, as the boxes in get_mcodes()
+  FloatType lo[NDIMS];
+  FloatType hi[NDIMS];
+  bounds.min(lo);
+  bounds.max(hi);
+
+  Vec<FloatType, NDIMS> min_coord, inv_extent;
+  for(int i = 0; i < NDIMS; ++i)
+  {
+    const FloatType extent = hi[i] - lo[i];
+    min_coord[i] = lo[i];
+    inv_extent[i] = utilities::isNearlyEqual<FloatType>(extent, .0f)
+      ? 0.f
+      : 1.f / extent;
+  }
+
+  const int32 size = static_cast<int32>(N);
+  uint32* mcodes = axom::allocate<uint32>(size, allocatorID);
+  int32* order = axom::allocate<int32>(size, allocatorID);
+
+  for_all<ExecSpace>(
+    size,
+    AXOM_LAMBDA(int32 i) {
+      const auto position = getPosition(i);
+
+      float32 coords[3] = {0.f, 0.f, 0.f};
+      for(int d = 0; d < NDIMS; ++d)
+      {
+        coords[d] = static_cast<float32>((position[d] - min_coord[d]) *
+                                         inv_extent[d]);
+      }
+      mcodes[i] = morton_encode<uint32>(coords[0], coords[1], coords[2]);
+    });
+
+  sort_mcodes<ExecSpace>(mcodes, size, order);
+
+  axom::deallocate(mcodes);
+  return order;
+}
+
+} /* namespace linear_bvh */
+} /* namespace internal */
+} /* namespace spin */
+} /* namespace axom */
+
+#endif /* AXOM_SPIN_SORT_QUERIES_H_ */
@@ -10,6 +10,7 @@
 #include "axom/core/execution/execution_space.hpp"
 #include "axom/core/memory_management.hpp"
 #include "axom/core/numerics/Matrix.hpp"
+#include "axom/core/numerics/floating_point_limits.hpp"
 
 // axom/primal includes
 #include "axom/primal/geometry/Point.hpp"
@@ -20,6 +21,7 @@
 
 #include "axom/spin/internal/linear_bvh/QueryAccessor.hpp"
 #include "axom/spin/internal/linear_bvh/TraversalPredicates.hpp"
+#include "axom/spin/internal/linear_bvh/bvh_traverse.hpp"
 
 // axom/mint includes
 #include "axom/mint/mesh/Mesh.hpp"
@@ -30,6 +32,16 @@
 // gtest includes
 #include "gtest/gtest.h"
 
+// C/C++ includes
+#include <algorithm>   // for std::sort(), std::min(), std::shuffle()
+#include <cmath>       // for std::pow()
+#include <cstdio>      // for std::remove()
+#include <functional>  // for std::function
+#include <numeric>     // for std::iota()
+#include <random>      // for std::mt19937
+#include <string>      // for std::string
+#include <vector>      // for std::vector
+
 using namespace axom;
 namespace xargs = mint::xargs;
 
@@ -79,6 +91,19 @@ void dump_ray(const std::string& file,
   ofs.close();
 }
 
+//------------------------------------------------------------------------------
+/*!
+ * \brief Checks that the given surface area costs of a BVH are equal, up to
+ *  rounding. The costs are parallel sums, whose rounding depends on the order
+ *  of the terms, hence, on the number of threads.
+ */
+template <typename FloatType>
+void expect_costs_near(FloatType actual, FloatType expected)
+{
+  constexpr FloatType REL_TOL = 1.e-4;
+  EXPECT_NEAR(actual, expected, REL_TOL * expected);
+}
+
 //------------------------------------------------------------------------------
 
 /*!
@@ -508,6 +533,7 @@ void check_build_bvh2d()
   EXPECT_EQ(allocatorID, axom::execution_space<ExecSpace>::allocatorID());
 
   bvh.setScaleFactor(1.0);  // i.e., no scaling
+  EXPECT_FALSE(bvh.getUse64BitMortonCodes());
   bvh.build();
 
   FloatType lo[NDIMS];
@@ -551,6 +577,7 @@ void check_build_bvh3d()
   EXPECT_EQ(allocatorID, axom::execution_space<ExecSpace>::allocatorID());
 
   bvh.setScaleFactor(1.0);  // i.e., no scaling
+  EXPECT_FALSE(bvh.getUse64BitMortonCodes());
   bvh.build();
 
   FloatType lo[NDIMS];
@@ -1070,21 +1097,27 @@ void check_find_rays2d()
  *  In addition, the test shifts the points by an offset to ensure that points
  *  outside the mesh return no candidate.
  *
+ * \param [in] N the number of mesh nodes along each dimension.
+ * \param [in] use64BitMortonCodes indicates whether to build the BVH using
+ *  64-bit Morton codes.
  */
 template <typename ExecSpace, typename FloatType>
-void check_find_points3d()
+void check_find_points3d(IndexType N = 4, bool use64BitMortonCodes = false)
 {
   constexpr int NDIMS = 3;
-  constexpr IndexType N = 4;
 
   const int current_allocator = axom::getDefaultAllocatorID();
   axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
 
   using PointType = primal::Point<double, NDIMS>;
 
+  // unit cells, i.e., N-1 cells along each dimension
+  const double L = static_cast<double>(N - 1);
+  const int NCELLS = static_cast<int>(N - 1);
+
   double lo[NDIMS] = {0.0, 0.0, 0.0};
-  double hi[NDIMS] = {3.0, 3.0, 3.0};
-  int res[NDIMS] = {N - 1, N - 1, N - 1};
+  double hi[NDIMS] = {L, L, L};
+  int res[NDIMS] = {NCELLS, NCELLS, NCELLS};
 
   mint::UniformMesh mesh(lo, hi, N, N, N);
   FloatType* xc = mesh.createField<FloatType>("xc", mint::CELL_CENTERED);
@@ -1098,6 +1131,7 @@ void check_find_points3d()
   // construct the BVH
   spin::BVH<NDIMS, ExecSpace, FloatType> bvh(aabbs, ncells);
   bvh.setScaleFactor(1.0);  // i.e., no scaling
+  bvh.setUse64BitMortonCodes(use64BitMortonCodes);
   bvh.build();
 
   FloatType min[NDIMS];
@@ -1130,7 +1164,7 @@ void check_find_points3d()
   axom::deallocate(candidates);
 
   // check points that are outside by shifting the query points
-  constexpr double OFFSET = 10.0;
+  const double OFFSET = L + 10.0;
   for(IndexType i = 0; i < ncells; ++i)
   {
     xc[i] += OFFSET;
@@ -1168,21 +1202,27 @@ void check_find_points3d()
  *  In addition, the test shifts the points by an offset to ensure that points
  *  outside the mesh return no candidate.
  *
+ * \param [in] N the number of mesh nodes along each dimension.
+ * \param [in] use64BitMortonCodes indicates whether to build the BVH using
+ *  64-bit Morton codes.
  */
 template <typename ExecSpace, typename FloatType>
-void check_find_points2d()
+void check_find_points2d(IndexType N = 4, bool use64BitMortonCodes = false)
 {
   constexpr int NDIMS = 2;
-  constexpr IndexType N = 4;
 
   const int current_allocator = axom::getDefaultAllocatorID();
   axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
 
   using PointType = primal::Point<double, NDIMS>;
 
+  // unit cells, i.e., N-1 cells along each dimension
+  const double L = static_cast<double>(N - 1);
+  const int NCELLS = static_cast<int>(N - 1);
+
   double lo[NDIMS] = {0.0, 0.0};
-  double hi[NDIMS] = {3.0, 3.0};
-  int res[NDIMS] = {N - 1, N - 1};
+  double hi[NDIMS] = {L, L};
+  int res[NDIMS] = {NCELLS, NCELLS};
 
   mint::UniformMesh mesh(lo, hi, N, N);
   FloatType* xc = mesh.createField<FloatType>("xc", mint::CELL_CENTERED);
@@ -1195,6 +1235,7 @@ void check_find_points2d()
   // construct the BVH
   spin::BVH<NDIMS, ExecSpace, FloatType> bvh(aabbs, ncells);
   bvh.setScaleFactor(1.0);  // i.e., no scaling
+  bvh.setUse64BitMortonCodes(use64BitMortonCodes);
   bvh.build();
 
   FloatType min[NDIMS];
@@ -1227,7 +1268,7 @@ void check_find_points2d()
   axom::deallocate(candidates);
 
   // check points that are outside by shifting the query points
-  constexpr double OFFSET = 10.0;
+  const double OFFSET = L + 10.0;
   for(IndexType i = 0; i < ncells; ++i)
   {
     xc[i] += OFFSET;
@@ -1390,201 +1431,1557 @@ void check_single_box3d()
   axom::setDefaultAllocator(current_allocator);
 }
 
-} /* end unnamed namespace */
-
-//------------------------------------------------------------------------------
-// UNIT TESTS
 //------------------------------------------------------------------------------
-TEST(spin_bvh, query_point_accessor)
+
+/*!
+ * \brief Tests the nearest neighbor queries of the BVH against a brute force
+ *  search.
+ *
+ *  The items are random points, each represented by a small bounding box
+ *  around it, and the exact distance functor computes the distance to the
+ *  point. The query points are random points within and around the bounds of
+ *  the items.
+ *
+ * \param [in] numItems the number of items in the BVH.
+ * \param [in] k the number of nearest items to find for each query point.
+ */
+template <int NDIMS, typename ExecSpace, typename FloatType>
+void check_find_nearest(IndexType numItems, IndexType k)
 {
-  constexpr double VAL = 42.0;
-  constexpr IndexType ID = 0;
+  constexpr int NUM_QUERIES = 100;
+  constexpr FloatType HALF_WIDTH = 0.01;
 
-  double x[] = {VAL};
-  double y[] = {VAL + 1.5};
-  double z[] = {VAL + 2.5};
+  const int current_allocator = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
 
-  namespace bvh = axom::spin::internal::linear_bvh;
-  using QueryAccessor2D = bvh::QueryAccessor<2, double>;
-  using QueryAccessor3D = bvh::QueryAccessor<3, double>;
-  using Point2D = bvh::Vec<double, 2>;
-  using Point3D = bvh::Vec<double, 3>;
+  using PointType = typename spin::BVH<NDIMS, ExecSpace, FloatType>::PointType;
 
-  Point2D test_point2d;
-  QueryAccessor2D::getPoint(test_point2d, ID, x, y, nullptr);
-  EXPECT_DOUBLE_EQ(test_point2d[0], x[ID]);
-  EXPECT_DOUBLE_EQ(test_point2d[1], y[ID]);
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<FloatType> item_dist(0., 10.);
+  std::uniform_real_distribution<FloatType> query_dist(-2., 12.);
 
-  Point3D test_point3d;
-  QueryAccessor3D::getPoint(test_point3d, 0, x, y, z);
-  EXPECT_DOUBLE_EQ(test_point3d[0], x[ID]);
-  EXPECT_DOUBLE_EQ(test_point3d[1], y[ID]);
-  EXPECT_DOUBLE_EQ(test_point3d[2], z[ID]);
-}
+  // generate the items and their bounding boxes
+  FloatType* items = axom::allocate<FloatType>(numItems * NDIMS);
+  FloatType* boxes = axom::allocate<FloatType>(numItems * NDIMS * 2);
+  for(IndexType i = 0; i < numItems; ++i)
+  {
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      items[i * NDIMS + d] = item_dist(gen);
+      boxes[i * NDIMS * 2 + d] = items[i * NDIMS + d] - HALF_WIDTH;
+      boxes[i * NDIMS * 2 + NDIMS + d] = items[i * NDIMS + d] + HALF_WIDTH;
+    }
+  }
 
-//------------------------------------------------------------------------------
-TEST(spin_bvh, query_ray_accessor)
-{
-  constexpr double VAL = 42.0;
-  constexpr IndexType ID = 0;
+  // generate the query points
+  FloatType* coords[3] = {nullptr, nullptr, nullptr};
+  for(int d = 0; d < NDIMS; ++d)
+  {
+    coords[d] = axom::allocate<FloatType>(NUM_QUERIES);
+    for(IndexType i = 0; i < NUM_QUERIES; ++i)
+    {
+      coords[d][i] = query_dist(gen);
+    }
+  }
 
-  double x[] = {VAL};
-  double y[] = {VAL + 1.5};
-  double z[] = {VAL + 2.5};
+  spin::BVH<NDIMS, ExecSpace, FloatType> bvh(boxes, numItems);
+  bvh.build();
 
-  double nx[] = {VAL};
-  double ny[] = {VAL + 1.5};
-  double nz[] = {VAL + 2.5};
+  auto sqDistance = AXOM_LAMBDA(IndexType item, const PointType& q)->FloatType
+  {
+    FloatType sqDist = 0.;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      const FloatType delta = q[d] - items[item * NDIMS + d];
+      sqDist += delta * delta;
+    }
+    return sqDist;
+  };
 
-  namespace bvh = axom::spin::internal::linear_bvh;
-  using QueryAccessor2D = bvh::QueryAccessor<2, double>;
-  using QueryAccessor3D = bvh::QueryAccessor<3, double>;
-  using Ray2D = bvh::Vec<double, 4>;
-  using Ray3D = bvh::Vec<double, 6>;
+  IndexType* nearest = axom::allocate<IndexType>(NUM_QUERIES * k);
+  FloatType* sqDistances = axom::allocate<FloatType>(NUM_QUERIES * k);
+  if(k == 1)
+  {
+    bvh.findNearest(nearest,
+                    sqDistances,
+                    NUM_QUERIES,
+                    sqDistance,
+                    coords[0],
+                    coords[1],
+                    coords[2]);
+  }
+  else
+  {
+    bvh.findKNearest(k,
+                     nearest,
+                     sqDistances,
+                     NUM_QUERIES,
+                     sqDistance,
+                     coords[0],
+                     coords[1],
+                     coords[2]);
+  }
 
-  Ray2D ray2d;
-  QueryAccessor2D::getRay(ray2d, ID, x, nx, y, ny, nullptr, nullptr);
-  EXPECT_DOUBLE_EQ(ray2d[0], x[ID]);
-  EXPECT_DOUBLE_EQ(ray2d[1], y[ID]);
+  // compare against the k smallest distances of a brute force search
+  const IndexType numFound = std::min(k, numItems);
+  std::vector<FloatType> expected(numItems);
+  for(IndexType i = 0; i < NUM_QUERIES; ++i)
+  {
+    PointType q;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      q[d] = coords[d][i];
+    }
 
-  EXPECT_DOUBLE_EQ(ray2d[2], nx[ID]);
-  EXPECT_DOUBLE_EQ(ray2d[3], ny[ID]);
+    for(IndexType item = 0; item < numItems; ++item)
+    {
+      expected[item] = sqDistance(item, q);
+    }
+    std::sort(expected.begin(), expected.end());
 
-  Ray3D ray3d;
-  QueryAccessor3D::getRay(ray3d, ID, x, nx, y, ny, z, nz);
-  EXPECT_DOUBLE_EQ(ray3d[0], x[ID]);
-  EXPECT_DOUBLE_EQ(ray3d[1], y[ID]);
-  EXPECT_DOUBLE_EQ(ray3d[2], z[ID]);
+    for(IndexType j = 0; j < numFound; ++j)
+    {
+      const IndexType item = nearest[i * k + j];
+      ASSERT_TRUE(item >= 0 && item < numItems);
+      EXPECT_EQ(sqDistances[i * k + j], expected[j]);
+      EXPECT_EQ(sqDistances[i * k + j], sqDistance(item, q));
+    }
 
-  EXPECT_DOUBLE_EQ(ray3d[3], nx[ID]);
-  EXPECT_DOUBLE_EQ(ray3d[4], ny[ID]);
-  EXPECT_DOUBLE_EQ(ray3d[5], nz[ID]);
+    for(IndexType j = numFound; j < k; ++j)
+    {
+      EXPECT_EQ(nearest[i * k + j], -1);
+      EXPECT_EQ(sqDistances[i * k + j],
+                axom::numerics::floating_point_limits<FloatType>::max());
+    }
+  }
+
+  for(int d = 0; d < NDIMS; ++d)
+  {
+    axom::deallocate(coords[d]);
+  }
+  axom::deallocate(nearest);
+  axom::deallocate(sqDistances);
+  axom::deallocate(items);
+  axom::deallocate(boxes);
+  axom::setDefaultAllocator(current_allocator);
 }
 
-TEST(spin_bvh, query_bounding_box_accessor)
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Tests that refitting a BVH to moved items yields the same bounds and
+ *  query results as a BVH built over the moved items.
+ *
+ *  The items are random points, each represented by a small bounding box
+ *  around it. The test first translates all the items, which does not change
+ *  the SAH cost of the BVH, and then shuffles them, which degrades the BVH.
+ *
+ * \param [in] numItems the number of items in the BVH.
+ */
+template <int NDIMS, typename ExecSpace, typename FloatType>
+void check_refit(IndexType numItems)
 {
-  constexpr double VAL = 42.0;
-  constexpr IndexType ID = 0;
+  constexpr int NUM_QUERIES = 100;
+  constexpr FloatType HALF_WIDTH = 0.01;
+  constexpr FloatType OFFSET = 5.0;
 
-  double xmin[] = {VAL};
-  double ymin[] = {VAL + 1.5};
-  double zmin[] = {VAL + 2.5};
+  const int current_allocator = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
 
-  double xmax[] = {VAL};
-  double ymax[] = {VAL + 1.5};
-  double zmax[] = {VAL + 2.5};
+  using BVHType = spin::BVH<NDIMS, ExecSpace, FloatType>;
+  using PointType = typename BVHType::PointType;
 
-  namespace bvh = axom::spin::internal::linear_bvh;
-  using QueryAccessor2D = bvh::QueryAccessor<2, double>;
-  using QueryAccessor3D = bvh::QueryAccessor<3, double>;
-  using BoundingBox2D = bvh::Vec<double, 4>;
-  using BoundingBox3D = bvh::Vec<double, 6>;
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<FloatType> dist(0., 10.);
 
-  BoundingBox2D box2D;
-  QueryAccessor2D::getBoundingBox(box2D, ID, xmin, xmax, ymin, ymax, nullptr, nullptr);
+  FloatType* items = axom::allocate<FloatType>(numItems * NDIMS);
+  FloatType* boxes = axom::allocate<FloatType>(numItems * NDIMS * 2);
+  for(IndexType i = 0; i < numItems * NDIMS; ++i)
+  {
+    items[i] = dist(gen);
+  }
 
-  EXPECT_DOUBLE_EQ(box2D[0], xmin[ID]);
-  EXPECT_DOUBLE_EQ(box2D[1], ymin[ID]);
+  auto set_boxes = [=]() {
+    for(IndexType i = 0; i < numItems; ++i)
+    {
+      for(int d = 0; d < NDIMS; ++d)
+      {
+        boxes[i * NDIMS * 2 + d] = items[i * NDIMS + d] - HALF_WIDTH;
+        boxes[i * NDIMS * 2 + NDIMS + d] = items[i * NDIMS + d] + HALF_WIDTH;
+      }
+    }
+  };
+  set_boxes();
 
-  EXPECT_DOUBLE_EQ(box2D[2], xmax[ID]);
-  EXPECT_DOUBLE_EQ(box2D[3], ymax[ID]);
+  FloatType* coords[3] = {nullptr, nullptr, nullptr};
+  for(int d = 0; d < NDIMS; ++d)
+  {
+    coords[d] = axom::allocate<FloatType>(NUM_QUERIES);
+  }
 
-  BoundingBox3D box3D;
-  QueryAccessor3D::getBoundingBox(box3D, ID, xmin, xmax, ymin, ymax, zmin, zmax);
+  auto sqDistance = AXOM_LAMBDA(IndexType item, const PointType& q)->FloatType
+  {
+    FloatType sqDist = 0.;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      const FloatType delta = q[d] - items[item * NDIMS + d];
+      sqDist += delta * delta;
+    }
+    return sqDist;
+  };
+
+  // checks the bounds and the nearest items against a BVH built from scratch
+  IndexType* nearest = axom::allocate<IndexType>(NUM_QUERIES);
+  FloatType* sqDistances = axom::allocate<FloatType>(NUM_QUERIES);
+  auto check_against_build = [&](const BVHType& refitted) {
+    BVHType built(boxes, numItems);
+    built.build();
+
+    FloatType lo[NDIMS], hi[NDIMS], built_lo[NDIMS], built_hi[NDIMS];
+    refitted.getBounds(lo, hi);
+    built.getBounds(built_lo, built_hi);
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      EXPECT_FLOAT_EQ(lo[d], built_lo[d]);
+      EXPECT_FLOAT_EQ(hi[d], built_hi[d]);
+    }
 
-  EXPECT_DOUBLE_EQ(box3D[0], xmin[ID]);
-  EXPECT_DOUBLE_EQ(box3D[1], ymin[ID]);
-  EXPECT_DOUBLE_EQ(box3D[2], zmin[ID]);
+    // queries within and around the bounds
+    std::uniform_real_distribution<FloatType> query_dist(-2., 17.);
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      for(IndexType i = 0; i < NUM_QUERIES; ++i)
+      {
+        coords[d][i] = query_dist(gen);
+      }
+    }
 
-  EXPECT_DOUBLE_EQ(box3D[3], xmax[ID]);
-  EXPECT_DOUBLE_EQ(box3D[4], ymax[ID]);
-  EXPECT_DOUBLE_EQ(box3D[5], zmax[ID]);
-}
+    refitted.findNearest(nearest,
+                         sqDistances,
+                         NUM_QUERIES,
+                         sqDistance,
+                         coords[0],
+                         coords[1],
+                         coords[2]);
 
-//------------------------------------------------------------------------------
-TEST(spin_bvh, traversal_predicates_boundingBoxIntersectsLeftBin)
-{
-  namespace bvh = axom::spin::internal::linear_bvh;
-  using TraversalPredicates2D = bvh::TraversalPredicates<2, double>;
-  using TraversalPredicates3D = bvh::TraversalPredicates<3, double>;
-  using BoundingBox2D = bvh::Vec<double, 4>;
-  using BoundingBox3D = bvh::Vec<double, 6>;
+    for(IndexType i = 0; i < NUM_QUERIES; ++i)
+    {
+      PointType q;
+      for(int d = 0; d < NDIMS; ++d)
+      {
+        q[d] = coords[d][i];
+      }
 
-  BoundingBox2D s1, s2;
-  s1[0] = 0.;  // LeftBin.xmin
-  s1[1] = 0.;  // LeftBin.ymin
-  s1[2] = 0.;  // LeftBin.zmin
+      FloatType expected =
+        axom::numerics::floating_point_limits<FloatType>::max();
+      for(IndexType item = 0; item < numItems; ++item)
+      {
+        expected = std::min(expected, sqDistance(item, q));
+      }
+      EXPECT_EQ(sqDistances[i], expected);
+    }
 
-  s1[3] = 1.;  // LeftBin.xmax
-  s2[0] = 1.;  // LeftBin.ymax
-  s2[1] = 1.;  // LeftBin.zmax
+    return built.getSurfaceAreaCost();
+  };
 
-  BoundingBox2D box2d;
-  box2d[0] = -1.0;
-  box2d[1] = -1.0;
-  box2d[2] = 1.0;
-  box2d[3] = 1.0;
-  EXPECT_TRUE(TraversalPredicates2D::boundingBoxIntersectsLeftBin(box2d, s1, s2));
+  BVHType bvh(boxes, numItems);
+  EXPECT_EQ(bvh.refit(boxes), spin::BVH_BUILD_FAILED);
+  bvh.build();
+  EXPECT_EQ(bvh.getRefitCostRatio(), 1.);
+  const FloatType build_cost = bvh.getSurfaceAreaCost();
+  EXPECT_GE(build_cost, 1.);
 
-  // non-intersecting
-  box2d[2] = -0.5;
-  box2d[3] = -0.5;
-  EXPECT_FALSE(TraversalPredicates2D::boundingBoxIntersectsLeftBin(box2d, s1, s2));
+  // translate the items, the BVH is as good as a new one
+  for(IndexType i = 0; i < numItems * NDIMS; ++i)
+  {
+    items[i] += OFFSET;
+  }
+  set_boxes();
+  EXPECT_EQ(bvh.refit(boxes), spin::BVH_BUILD_OK);
+  check_against_build(bvh);
 
-  BoundingBox3D box3d;
-  box3d[0] = -1.0;
-  box3d[1] = -1.0;
-  box3d[2] = -1.0;
-  box3d[3] = 1.0;
-  box3d[4] = 1.0;
-  box3d[5] = 1.0;
-  EXPECT_TRUE(TraversalPredicates3D::boundingBoxIntersectsLeftBin(box3d, s1, s2));
+  // NOTE: a single item is stored along with a fake box at the origin, hence,
+  // its BVH is not invariant by translation
+  if(numItems > 1)
+  {
+    EXPECT_NEAR(bvh.getRefitCostRatio(), 1., 1.e-3);
+
+    // shuffle the items, the BVH is valid but worse than a new one
+    std::vector<IndexType> perm(numItems);
+    std::iota(perm.begin(), perm.end(), 0);
+    std::shuffle(perm.begin(), perm.end(), gen);
+    std::vector<FloatType> shuffled(items, items + numItems * NDIMS);
+    for(IndexType i = 0; i < numItems; ++i)
+    {
+      for(int d = 0; d < NDIMS; ++d)
+      {
+        items[i * NDIMS + d] = shuffled[perm[i] * NDIMS + d];
+      }
+    }
+    set_boxes();
+    bvh.refit(boxes);
+    const FloatType rebuilt_cost = check_against_build(bvh);
+    EXPECT_GT(bvh.getRefitCostRatio(), 2.);
+    EXPECT_GT(bvh.getSurfaceAreaCost(), rebuilt_cost);
+
+    // a rebuild resets the ratio
+    bvh.build();
+    EXPECT_EQ(bvh.getRefitCostRatio(), 1.);
+    expect_costs_near(bvh.getSurfaceAreaCost(), rebuilt_cost);
+  }
 
-  // non-intersecting
-  box3d[3] = -0.5;
-  box3d[4] = -0.5;
-  box3d[5] = -0.5;
-  EXPECT_FALSE(TraversalPredicates3D::boundingBoxIntersectsLeftBin(box3d, s1, s2));
+  for(int d = 0; d < NDIMS; ++d)
+  {
+    axom::deallocate(coords[d]);
+  }
+  axom::deallocate(nearest);
+  axom::deallocate(sqDistances);
+  axom::deallocate(items);
+  axom::deallocate(boxes);
+  axom::setDefaultAllocator(current_allocator);
 }
 
 //------------------------------------------------------------------------------
-TEST(spin_bvh, traversal_predicates_boundingBoxIntersectsRightBin)
+/*!
+ * \brief Checks the point, ray and bounding box queries with a bounded buffer
+ *  per query, and with a functor that consumes the candidates, against the
+ *  default queries that traverse the BVH twice.
+ *
+ * \param [in] capacity the number of candidates buffered for each query.
+ */
+template <int NDIMS, typename ExecSpace, typename FloatType>
+void check_bounded_queries(IndexType capacity)
 {
-  namespace bvh = axom::spin::internal::linear_bvh;
-  using TraversalPredicates2D = bvh::TraversalPredicates<2, double>;
-  using TraversalPredicates3D = bvh::TraversalPredicates<3, double>;
-  using BoundingBox2D = bvh::Vec<double, 4>;
-  using BoundingBox3D = bvh::Vec<double, 6>;
+  constexpr IndexType NUM_ITEMS = 500;
+  constexpr IndexType NUM_QUERIES = 200;
 
-  BoundingBox2D s2, s3;
-  s2[2] = 0.;  // RightBin.xmin
-  s2[3] = 0.;  // RightBin.ymin
-  s3[0] = 0.;  // RightBin.zmin
+  const int current_allocator = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
 
-  s3[1] = 1.;  // RightBin.xmax
-  s3[2] = 1.;  // RightBin.ymax
-  s3[3] = 1.;  // RightBin.zmax
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<FloatType> coord(0., 10.);
+  std::uniform_real_distribution<FloatType> width(0.05, 1.5);
+  std::uniform_real_distribution<FloatType> direction(-1., 1.);
 
-  BoundingBox2D box2d;
-  box2d[0] = -1.0;
-  box2d[1] = -1.0;
-  box2d[2] = 1.0;
-  box2d[3] = 1.0;
-  EXPECT_TRUE(TraversalPredicates2D::boundingBoxIntersectsRightBin(box2d, s2, s3));
+  // boxes of different sizes, such that the number of candidates varies
+  FloatType* boxes = axom::allocate<FloatType>(NUM_ITEMS * NDIMS * 2);
+  for(IndexType i = 0; i < NUM_ITEMS; ++i)
+  {
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      const FloatType c = coord(gen);
+      const FloatType w = width(gen);
+      boxes[i * NDIMS * 2 + d] = c - w;
+      boxes[i * NDIMS * 2 + NDIMS + d] = c + w;
+    }
+  }
 
-  // non-intersecting
-  box2d[2] = -0.5;
-  box2d[3] = -0.5;
-  EXPECT_FALSE(
-    TraversalPredicates2D::boundingBoxIntersectsRightBin(box2d, s2, s3));
+  spin::BVH<NDIMS, ExecSpace, FloatType> bvh(boxes, NUM_ITEMS);
+  bvh.build();
+  EXPECT_EQ(bvh.getQueryCapacity(), 0);
+
+  // the points, the ray sources and the lower corners of the query boxes,
+  // along with the ray normals and the upper corners of the query boxes
+  FloatType* lo[3] = {nullptr, nullptr, nullptr};
+  FloatType* normal[3] = {nullptr, nullptr, nullptr};
+  FloatType* hi[3] = {nullptr, nullptr, nullptr};
+  for(int d = 0; d < NDIMS; ++d)
+  {
+    lo[d] = axom::allocate<FloatType>(NUM_QUERIES);
+    normal[d] = axom::allocate<FloatType>(NUM_QUERIES);
+    hi[d] = axom::allocate<FloatType>(NUM_QUERIES);
+    for(IndexType i = 0; i < NUM_QUERIES; ++i)
+    {
+      lo[d][i] = coord(gen);
+      normal[d][i] = direction(gen);
+      hi[d][i] = lo[d][i] + width(gen);
+    }
+  }
 
-  BoundingBox3D box3d;
-  box3d[0] = -1.0;
-  box3d[1] = -1.0;
-  box3d[2] = -1.0;
-  box3d[3] = 1.0;
-  box3d[4] = 1.0;
-  box3d[5] = 1.0;
+  IndexType* ref_offsets = axom::allocate<IndexType>(NUM_QUERIES);
+  IndexType* ref_counts = axom::allocate<IndexType>(NUM_QUERIES);
+  IndexType* ref_candidates = nullptr;
+  IndexType* offsets = axom::allocate<IndexType>(NUM_QUERIES);
+  IndexType* counts = axom::allocate<IndexType>(NUM_QUERIES);
+  IndexType* candidates = nullptr;
+  IndexType* visit_counts = axom::allocate<IndexType>(NUM_QUERIES);
+  IndexType* visited = nullptr;
+
+  // the results are the same for any capacity, in the same order
+  auto check_results = [&]() {
+    for(IndexType i = 0; i < NUM_QUERIES; ++i)
+    {
+      EXPECT_EQ(counts[i], ref_counts[i]);
+      EXPECT_EQ(offsets[i], ref_offsets[i]);
+      EXPECT_EQ(visit_counts[i], ref_counts[i]);
+      for(IndexType j = 0; j < ref_counts[i]; ++j)
+      {
+        EXPECT_EQ(candidates[offsets[i] + j], ref_candidates[offsets[i] + j]);
+        EXPECT_EQ(visited[offsets[i] + j], ref_candidates[offsets[i] + j]);
+      }
+    }
+
+    const IndexType max_count =
+      *std::max_element(ref_counts, ref_counts + NUM_QUERIES);
+    EXPECT_GT(max_count, 1);
+
+    axom::deallocate(ref_candidates);
+    axom::deallocate(candidates);
+    axom::deallocate(visited);
+    ref_candidates = nullptr;
+    candidates = nullptr;
+  };
+
+  // the visitor stores the candidates at the offsets of the reference
+  // results, which is safe since each query is visited by a single thread
+  auto prepare_visit = [&]() {
+    const IndexType total =
+      ref_offsets[NUM_QUERIES - 1] + ref_counts[NUM_QUERIES - 1];
+    visited = axom::allocate<IndexType>(total);
+    for(IndexType i = 0; i < NUM_QUERIES; ++i)
+    {
+      visit_counts[i] = 0;
+    }
+  };
+
+  // points
+  bvh.setQueryCapacity(0);
+  bvh.findPoints(ref_offsets,
+                 ref_counts,
+                 ref_candidates,
+                 NUM_QUERIES,
+                 lo[0],
+                 lo[1],
+                 lo[2]);
+  bvh.setQueryCapacity(capacity);
+  EXPECT_EQ(bvh.getQueryCapacity(), capacity);
+  bvh.findPoints(offsets, counts, candidates, NUM_QUERIES, lo[0], lo[1], lo[2]);
+
+  prepare_visit();
+  bvh.visitPoints(
+    NUM_QUERIES,
+    AXOM_LAMBDA(IndexType q, IndexType item) {
+      visited[ref_offsets[q] + visit_counts[q]++] = item;
+    },
+    lo[0],
+    lo[1],
+    lo[2]);
+  check_results();
+
+  // rays
+  bvh.setQueryCapacity(0);
+  bvh.findRays(ref_offsets,
+               ref_counts,
+               ref_candidates,
+               NUM_QUERIES,
+               lo[0],
+               normal[0],
+               lo[1],
+               normal[1],
+               lo[2],
+               normal[2]);
+  bvh.setQueryCapacity(capacity);
+  bvh.findRays(offsets,
+               counts,
+               candidates,
+               NUM_QUERIES,
+               lo[0],
+               normal[0],
+               lo[1],
+               normal[1],
+               lo[2],
+               normal[2]);
+
+  prepare_visit();
+  bvh.visitRays(
+    NUM_QUERIES,
+    AXOM_LAMBDA(IndexType q, IndexType item) {
+      visited[ref_offsets[q] + visit_counts[q]++] = item;
+    },
+    lo[0],
+    normal[0],
+    lo[1],
+    normal[1],
+    lo[2],
+    normal[2]);
+  check_results();
+
+  // bounding boxes
+  bvh.setQueryCapacity(0);
+  bvh.findBoundingBoxes(ref_offsets,
+                        ref_counts,
+                        ref_candidates,
+                        NUM_QUERIES,
+                        lo[0],
+                        hi[0],
+                        lo[1],
+                        hi[1],
+                        lo[2],
+                        hi[2]);
+  bvh.setQueryCapacity(capacity);
+  bvh.findBoundingBoxes(offsets,
+                        counts,
+                        candidates,
+                        NUM_QUERIES,
+                        lo[0],
+                        hi[0],
+                        lo[1],
+                        hi[1],
+                        lo[2],
+                        hi[2]);
+
+  prepare_visit();
+  bvh.visitBoundingBoxes(
+    NUM_QUERIES,
+    AXOM_LAMBDA(IndexType q, IndexType item) {
+      visited[ref_offsets[q] + visit_counts[q]++] = item;
+    },
+    lo[0],
+    hi[0],
+    lo[1],
+    hi[1],
+    lo[2],
+    hi[2]);
+  check_results();
+
+  for(int d = 0; d < NDIMS; ++d)
+  {
+    axom::deallocate(lo[d]);
+    axom::deallocate(normal[d]);
+    axom::deallocate(hi[d]);
+  }
+  axom::deallocate(ref_offsets);
+  axom::deallocate(ref_counts);
+  axom::deallocate(offsets);
+  axom::deallocate(counts);
+  axom::deallocate(visit_counts);
+  axom::deallocate(boxes);
+  axom::setDefaultAllocator(current_allocator);
+}
+
+//------------------------------------------------------------------------------
+/*!
+ * \brief Checks the point, ray and bounding box queries of a wide BVH, with
+ *  the given node width, against the queries of the binary BVH, before and
+ *  after a refit.
+ *
+ * \param [in] numItems the number of items in the BVH.
+ * \param [in] width the number of children per node of the wide BVH.
+ */
+template <int NDIMS, typename ExecSpace, typename FloatType>
+void check_wide_queries(IndexType numItems, int width)
+{
+  using BVHType = spin::BVH<NDIMS, ExecSpace, FloatType>;
+  constexpr IndexType NUM_QUERIES = 200;
+
+  const int current_allocator = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<FloatType> coord(0., 10.);
+  std::uniform_real_distribution<FloatType> extent(0.05, 1.5);
+  std::uniform_real_distribution<FloatType> direction(-1., 1.);
+
+  FloatType* boxes = axom::allocate<FloatType>(numItems * NDIMS * 2);
+  for(IndexType i = 0; i < numItems; ++i)
+  {
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      const FloatType c = coord(gen);
+      const FloatType w = extent(gen);
+      boxes[i * NDIMS * 2 + d] = c - w;
+      boxes[i * NDIMS * 2 + NDIMS + d] = c + w;
+    }
+  }
+
+  BVHType binary(boxes, numItems);
+  binary.build();
+  EXPECT_EQ(binary.getNodeWidth(), 2);
+
+  BVHType wide(boxes, numItems);
+  wide.setNodeWidth(width);
+  EXPECT_EQ(wide.getNodeWidth(), width);
+  wide.build();
+
+  // the points, the ray sources and the lower corners of the query boxes,
+  // along with the ray normals and the upper corners of the query boxes
+  FloatType* lo[3] = {nullptr, nullptr, nullptr};
+  FloatType* normal[3] = {nullptr, nullptr, nullptr};
+  FloatType* hi[3] = {nullptr, nullptr, nullptr};
+  for(int d = 0; d < NDIMS; ++d)
+  {
+    lo[d] = axom::allocate<FloatType>(NUM_QUERIES);
+    normal[d] = axom::allocate<FloatType>(NUM_QUERIES);
+    hi[d] = axom::allocate<FloatType>(NUM_QUERIES);
+    for(IndexType i = 0; i < NUM_QUERIES; ++i)
+    {
+      lo[d][i] = coord(gen);
+      normal[d][i] = direction(gen);
+      hi[d][i] = lo[d][i] + extent(gen);
+    }
+  }
+
+  IndexType* ref_offsets = axom::allocate<IndexType>(NUM_QUERIES);
+  IndexType* ref_counts = axom::allocate<IndexType>(NUM_QUERIES);
+  IndexType* offsets = axom::allocate<IndexType>(NUM_QUERIES);
+  IndexType* counts = axom::allocate<IndexType>(NUM_QUERIES);
+  IndexType* visit_counts = axom::allocate<IndexType>(NUM_QUERIES);
+
+  // the wide BVH yields the same candidates, in the same order, since the
+  // children of a wide node are ordered as the leaves of the binary BVH
+  using FindFunction =
+    std::function<void(BVHType&, IndexType*, IndexType*, IndexType*&)>;
+  using VisitFunction = std::function<void(BVHType&)>;
+
+  auto check_query = [&](const FindFunction& find, const VisitFunction& visit) {
+    IndexType* ref_candidates = nullptr;
+    IndexType* candidates = nullptr;
+    find(binary, ref_offsets, ref_counts, ref_candidates);
+    find(wide, offsets, counts, candidates);
+
+    for(IndexType i = 0; i < NUM_QUERIES; ++i)
+    {
+      visit_counts[i] = 0;
+    }
+    visit(wide);
+
+    IndexType total = 0;
+    for(IndexType i = 0; i < NUM_QUERIES; ++i)
+    {
+      EXPECT_EQ(counts[i], ref_counts[i]);
+      EXPECT_EQ(offsets[i], ref_offsets[i]);
+      EXPECT_EQ(visit_counts[i], ref_counts[i]);
+      for(IndexType j = 0; j < ref_counts[i]; ++j)
+      {
+        EXPECT_EQ(candidates[offsets[i] + j], ref_candidates[offsets[i] + j]);
+      }
+      total += ref_counts[i];
+    }
+    if(numItems > 1)
+    {
+      EXPECT_GT(total, 0);
+    }
+
+    axom::deallocate(ref_candidates);
+    axom::deallocate(candidates);
+  };
+
+  auto check_all_queries = [&]() {
+    // points
+    check_query(
+      [&](BVHType& bvh, IndexType* offs, IndexType* cnts, IndexType*& cands) {
+        bvh.findPoints(offs,
+                       cnts,
+                       cands,
+                       NUM_QUERIES,
+                       lo[0],
+                       lo[1],
+                       lo[2]);
+      },
+      [&](BVHType& bvh) {
+        bvh.visitPoints(
+          NUM_QUERIES,
+          AXOM_LAMBDA(IndexType q, IndexType AXOM_NOT_USED(item)) {
+            visit_counts[q]++;
+          },
+          lo[0],
+          lo[1],
+          lo[2]);
+      });
+
+    // rays
+    check_query(
+      [&](BVHType& bvh, IndexType* offs, IndexType* cnts, IndexType*& cands) {
+        bvh.findRays(offs,
+                     cnts,
+                     cands,
+                     NUM_QUERIES,
+                     lo[0],
+                     normal[0],
+                     lo[1],
+                     normal[1],
+                     lo[2],
+                     normal[2]);
+      },
+      [&](BVHType& bvh) {
+        bvh.visitRays(
+          NUM_QUERIES,
+          AXOM_LAMBDA(IndexType q, IndexType AXOM_NOT_USED(item)) {
+            visit_counts[q]++;
+          },
+          lo[0],
+          normal[0],
+          lo[1],
+          normal[1],
+          lo[2],
+          normal[2]);
+      });
+
+    // bounding boxes
+    check_query(
+      [&](BVHType& bvh, IndexType* offs, IndexType* cnts, IndexType*& cands) {
+        bvh.findBoundingBoxes(offs,
+                              cnts,
+                              cands,
+                              NUM_QUERIES,
+                              lo[0],
+                              hi[0],
+                              lo[1],
+                              hi[1],
+                              lo[2],
+                              hi[2]);
+      },
+      [&](BVHType& bvh) {
+        bvh.visitBoundingBoxes(
+          NUM_QUERIES,
+          AXOM_LAMBDA(IndexType q, IndexType AXOM_NOT_USED(item)) {
+            visit_counts[q]++;
+          },
+          lo[0],
+          hi[0],
+          lo[1],
+          hi[1],
+          lo[2],
+          hi[2]);
+      });
+  };
+
+  check_all_queries();
+
+  // with a bounded buffer per query
+  wide.setQueryCapacity(4);
+  check_all_queries();
+  wide.setQueryCapacity(0);
+
+  // the wide BVH is collapsed again from the refitted BVH
+  for(IndexType i = 0; i < numItems * NDIMS * 2; ++i)
+  {
+    boxes[i] += static_cast<FloatType>(0.5) * direction(gen);
+  }
+  for(IndexType i = 0; i < numItems; ++i)
+  {
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      FloatType& min = boxes[i * NDIMS * 2 + d];
+      FloatType& max = boxes[i * NDIMS * 2 + NDIMS + d];
+      if(max < min)
+      {
+        std::swap(min, max);
+      }
+    }
+  }
+  binary.refit(boxes);
+  wide.refit(boxes);
+  check_all_queries();
+
+  for(int d = 0; d < NDIMS; ++d)
+  {
+    axom::deallocate(lo[d]);
+    axom::deallocate(normal[d]);
+    axom::deallocate(hi[d]);
+  }
+  axom::deallocate(ref_offsets);
+  axom::deallocate(ref_counts);
+  axom::deallocate(offsets);
+  axom::deallocate(counts);
+  axom::deallocate(visit_counts);
+  axom::deallocate(boxes);
+  axom::setDefaultAllocator(current_allocator);
+}
+
+//------------------------------------------------------------------------------
+/*!
+ * \brief Checks the SAH build of the BVH against the Morton build, over thin
+ *  boxes of random orientations, as for the elongated triangles of a CAD
+ *  surface.
+ *
+ * \param [in] numItems the number of items in the BVH.
+ */
+template <int NDIMS, typename ExecSpace, typename FloatType>
+void check_sah_build(IndexType numItems)
+{
+  using BVHType = spin::BVH<NDIMS, ExecSpace, FloatType>;
+  constexpr IndexType NUM_QUERIES = 200;
+
+  const int current_allocator = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<FloatType> coord(0., 10.);
+  std::uniform_real_distribution<FloatType> length(1., 4.);
+  std::uniform_int_distribution<int> axis(0, NDIMS - 1);
+
+  // each box is long along one axis and thin along the others
+  FloatType* boxes = axom::allocate<FloatType>(numItems * NDIMS * 2);
+  for(IndexType i = 0; i < numItems; ++i)
+  {
+    const int long_axis = axis(gen);
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      const FloatType c = coord(gen);
+      const FloatType w = (d == long_axis) ? length(gen) : 0.01;
+      boxes[i * NDIMS * 2 + d] = c - w;
+      boxes[i * NDIMS * 2 + NDIMS + d] = c + w;
+    }
+  }
+
+  BVHType morton(boxes, numItems);
+  EXPECT_EQ(morton.getBuildStrategy(), spin::BVH_MORTON_BUILD);
+  morton.build();
+
+  BVHType sah(boxes, numItems);
+  sah.setBuildStrategy(spin::BVH_SAH_BUILD);
+  EXPECT_EQ(sah.getBuildStrategy(), spin::BVH_SAH_BUILD);
+  EXPECT_EQ(sah.build(), spin::BVH_BUILD_OK);
+
+  // the bounds of both BVHs enclose the same boxes
+  FloatType morton_min[NDIMS], morton_max[NDIMS];
+  FloatType sah_min[NDIMS], sah_max[NDIMS];
+  morton.getBounds(morton_min, morton_max);
+  sah.getBounds(sah_min, sah_max);
+  for(int d = 0; d < NDIMS; ++d)
+  {
+    EXPECT_EQ(sah_min[d], morton_min[d]);
+    EXPECT_EQ(sah_max[d], morton_max[d]);
+  }
+
+  // the SAH build yields a tighter BVH
+  const typename BVHType::Quality morton_quality = morton.getQuality();
+  const typename BVHType::Quality sah_quality = sah.getQuality();
+  EXPECT_LT(sah_quality.sahCost, morton_quality.sahCost);
+
+  expect_costs_near(morton_quality.sahCost, morton.getSurfaceAreaCost());
+  expect_costs_near(sah_quality.sahCost, sah.getSurfaceAreaCost());
+
+  const FloatType min_depth = std::log2(static_cast<FloatType>(numItems));
+  for(const auto& quality : {morton_quality, sah_quality})
+  {
+    EXPECT_GE(quality.overlap, 0.);
+    EXPECT_LE(quality.overlap, 1.);
+    EXPECT_GE(quality.averageDepth, min_depth);
+    EXPECT_LE(quality.averageDepth, quality.maxDepth);
+    EXPECT_LT(quality.maxDepth, numItems);
+    EXPECT_LT(quality.maxDepth, spin::internal::linear_bvh::BVH_STACK_SIZE);
+  }
+
+  // both BVHs find the same candidates, in a different order
+  FloatType* lo[3] = {nullptr, nullptr, nullptr};
+  FloatType* hi[3] = {nullptr, nullptr, nullptr};
+  for(int d = 0; d < NDIMS; ++d)
+  {
+    lo[d] = axom::allocate<FloatType>(NUM_QUERIES);
+    hi[d] = axom::allocate<FloatType>(NUM_QUERIES);
+    for(IndexType i = 0; i < NUM_QUERIES; ++i)
+    {
+      lo[d][i] = coord(gen);
+      hi[d][i] = lo[d][i] + 0.5;
+    }
+  }
+
+  IndexType* offsets[2];
+  IndexType* counts[2];
+  IndexType* candidates[2] = {nullptr, nullptr};
+  BVHType* bvhs[2] = {&morton, &sah};
+  for(int b = 0; b < 2; ++b)
+  {
+    offsets[b] = axom::allocate<IndexType>(NUM_QUERIES);
+    counts[b] = axom::allocate<IndexType>(NUM_QUERIES);
+    bvhs[b]->findBoundingBoxes(offsets[b],
+                               counts[b],
+                               candidates[b],
+                               NUM_QUERIES,
+                               lo[0],
+                               hi[0],
+                               lo[1],
+                               hi[1],
+                               lo[2],
+                               hi[2]);
+  }
+
+  IndexType total = 0;
+  for(IndexType i = 0; i < NUM_QUERIES; ++i)
+  {
+    ASSERT_EQ(counts[0][i], counts[1][i]);
+
+    std::vector<IndexType> expected(candidates[0] + offsets[0][i],
+                                    candidates[0] + offsets[0][i] + counts[0][i]);
+    std::vector<IndexType> actual(candidates[1] + offsets[1][i],
+                                  candidates[1] + offsets[1][i] + counts[1][i]);
+    std::sort(expected.begin(), expected.end());
+    std::sort(actual.begin(), actual.end());
+    EXPECT_EQ(actual, expected);
+    total += counts[0][i];
+  }
+  EXPECT_GT(total, 0);
+
+  // the refit of an SAH BVH keeps its topology
+  EXPECT_EQ(sah.refit(boxes), spin::BVH_BUILD_OK);
+  EXPECT_NEAR(sah.getRefitCostRatio(), 1., 1.e-6);
+
+  for(int b = 0; b < 2; ++b)
+  {
+    axom::deallocate(offsets[b]);
+    axom::deallocate(counts[b]);
+    axom::deallocate(candidates[b]);
+  }
+  for(int d = 0; d < NDIMS; ++d)
+  {
+    axom::deallocate(lo[d]);
+    axom::deallocate(hi[d]);
+  }
+  axom::deallocate(boxes);
+  axom::setDefaultAllocator(current_allocator);
+}
+
+//------------------------------------------------------------------------------
+/*!
+ * \brief Checks that the SAH build bounds the depth of the BVH over unit boxes
+ *  at x = 10^i, for which the SAH peels off a few boxes at each split.
+ *
+ * \param [in] numItems the number of items in the BVH.
+ */
+template <int NDIMS, typename ExecSpace>
+void check_sah_build_graded(IndexType numItems)
+{
+  using BVHType = spin::BVH<NDIMS, ExecSpace, double>;
+
+  const int current_allocator = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  // the boxes are also the queries, each box finds at least itself
+  double* boxes = axom::allocate<double>(numItems * NDIMS * 2);
+  double* lo[3] = {nullptr, nullptr, nullptr};
+  double* hi[3] = {nullptr, nullptr, nullptr};
+  for(int d = 0; d < NDIMS; ++d)
+  {
+    lo[d] = axom::allocate<double>(numItems);
+    hi[d] = axom::allocate<double>(numItems);
+  }
+
+  for(IndexType i = 0; i < numItems; ++i)
+  {
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      lo[d][i] = (d == 0) ? std::pow(10., i) : 0.;
+      hi[d][i] = lo[d][i] + 1.;
+      boxes[i * NDIMS * 2 + d] = lo[d][i];
+      boxes[i * NDIMS * 2 + NDIMS + d] = hi[d][i];
+    }
+  }
+
+  BVHType morton(boxes, numItems);
+  morton.build();
+
+  BVHType sah(boxes, numItems);
+  sah.setBuildStrategy(spin::BVH_SAH_BUILD);
+  EXPECT_EQ(sah.build(), spin::BVH_BUILD_OK);
+
+  const typename BVHType::Quality quality = sah.getQuality();
+  EXPECT_LT(quality.maxDepth, spin::internal::linear_bvh::BVH_STACK_SIZE);
+
+  IndexType* offsets[2];
+  IndexType* counts[2];
+  IndexType* candidates[2] = {nullptr, nullptr};
+  BVHType* bvhs[2] = {&morton, &sah};
+  for(int b = 0; b < 2; ++b)
+  {
+    offsets[b] = axom::allocate<IndexType>(numItems);
+    counts[b] = axom::allocate<IndexType>(numItems);
+    bvhs[b]->findBoundingBoxes(offsets[b],
+                               counts[b],
+                               candidates[b],
+                               numItems,
+                               lo[0],
+                               hi[0],
+                               lo[1],
+                               hi[1],
+                               lo[2],
+                               hi[2]);
+  }
+
+  for(IndexType i = 0; i < numItems; ++i)
+  {
+    ASSERT_EQ(counts[0][i], counts[1][i]);
+
+    std::vector<IndexType> expected(candidates[0] + offsets[0][i],
+                                    candidates[0] + offsets[0][i] + counts[0][i]);
+    std::vector<IndexType> actual(candidates[1] + offsets[1][i],
+                                  candidates[1] + offsets[1][i] + counts[1][i]);
+    std::sort(expected.begin(), expected.end());
+    std::sort(actual.begin(), actual.end());
+    EXPECT_EQ(actual, expected);
+    EXPECT_TRUE(std::binary_search(actual.begin(), actual.end(), i));
+  }
+
+  for(int b = 0; b < 2; ++b)
+  {
+    axom::deallocate(offsets[b]);
+    axom::deallocate(counts[b]);
+    axom::deallocate(candidates[b]);
+  }
+  for(int d = 0; d < NDIMS; ++d)
+  {
+    axom::deallocate(lo[d]);
+    axom::deallocate(hi[d]);
+  }
+  axom::deallocate(boxes);
+  axom::setDefaultAllocator(current_allocator);
+}
+
+//------------------------------------------------------------------------------
+/// Removes the file with the given name when it goes out of scope, even if an
+/// assertion returns early
+struct ScopedFileRemover
+{
+  std::string fileName;
+  ~ScopedFileRemover() { std::remove(fileName.c_str()); }
+};
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType>
+void check_binary_file(IndexType numItems, int width)
+{
+  using BVHType = spin::BVH<NDIMS, ExecSpace, FloatType>;
+  constexpr IndexType NUM_QUERIES = 200;
+
+  const std::string fileName = "spin_bvh_" + std::to_string(NDIMS) + "d_" +
+    std::to_string(numItems) + "_" + std::to_string(sizeof(FloatType)) +
+    ".bvh";
+  std::remove(fileName.c_str());
+  const ScopedFileRemover remover {fileName};
+
+  const int current_allocator = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<FloatType> coord(0., 10.);
+  std::uniform_real_distribution<FloatType> extent(0.05, 1.5);
+
+  const IndexType numValues = numItems * NDIMS * 2;
+  FloatType* boxes = axom::allocate<FloatType>(numValues);
+  for(IndexType i = 0; i < numItems; ++i)
+  {
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      const FloatType c = coord(gen);
+      const FloatType w = extent(gen);
+      boxes[i * NDIMS * 2 + d] = c - w;
+      boxes[i * NDIMS * 2 + NDIMS + d] = c + w;
+    }
+  }
+
+  // the file does not exist, and a BVH that was not built is not written
+  BVHType built(boxes, numItems);
+  EXPECT_EQ(built.readBinaryFile(fileName), spin::BVH_BUILD_FAILED);
+  EXPECT_EQ(built.writeBinaryFile(fileName), spin::BVH_BUILD_FAILED);
+
+  EXPECT_EQ(built.build(), spin::BVH_BUILD_OK);
+  EXPECT_EQ(built.writeBinaryFile(fileName), spin::BVH_BUILD_OK);
+
+  BVHType loaded(boxes, numItems);
+  loaded.setNodeWidth(width);
+  ASSERT_EQ(loaded.readBinaryFile(fileName), spin::BVH_BUILD_OK);
+
+  // the loaded BVH is identical to the built BVH
+  FloatType built_min[NDIMS], built_max[NDIMS];
+  FloatType loaded_min[NDIMS], loaded_max[NDIMS];
+  built.getBounds(built_min, built_max);
+  loaded.getBounds(loaded_min, loaded_max);
+  for(int d = 0; d < NDIMS; ++d)
+  {
+    EXPECT_EQ(loaded_min[d], built_min[d]);
+    EXPECT_EQ(loaded_max[d], built_max[d]);
+  }
+
+  // NOTE: the candidates below check that the BVHs are identical
+  expect_costs_near(loaded.getSurfaceAreaCost(), built.getSurfaceAreaCost());
+
+  FloatType* lo[3] = {nullptr, nullptr, nullptr};
+  FloatType* hi[3] = {nullptr, nullptr, nullptr};
+  for(int d = 0; d < NDIMS; ++d)
+  {
+    lo[d] = axom::allocate<FloatType>(NUM_QUERIES);
+    hi[d] = axom::allocate<FloatType>(NUM_QUERIES);
+    for(IndexType i = 0; i < NUM_QUERIES; ++i)
+    {
+      lo[d][i] = coord(gen);
+      hi[d][i] = lo[d][i] + 0.5;
+    }
+  }
+
+  IndexType* offsets[2];
+  IndexType* counts[2];
+  IndexType* candidates[2] = {nullptr, nullptr};
+  BVHType* bvhs[2] = {&built, &loaded};
+  for(int b = 0; b < 2; ++b)
+  {
+    offsets[b] = axom::allocate<IndexType>(NUM_QUERIES);
+    counts[b] = axom::allocate<IndexType>(NUM_QUERIES);
+    bvhs[b]->findBoundingBoxes(offsets[b],
+                               counts[b],
+                               candidates[b],
+                               NUM_QUERIES,
+                               lo[0],
+                               hi[0],
+                               lo[1],
+                               hi[1],
+                               lo[2],
+                               hi[2]);
+  }
+
+  for(IndexType i = 0; i < NUM_QUERIES; ++i)
+  {
+    ASSERT_EQ(counts[0][i], counts[1][i]);
+    for(IndexType j = 0; j < counts[0][i]; ++j)
+    {
+      EXPECT_EQ(candidates[1][offsets[1][i] + j],
+                candidates[0][offsets[0][i] + j]);
+    }
+  }
+
+  // a loaded BVH may be refit
+  EXPECT_EQ(loaded.refit(boxes), spin::BVH_BUILD_OK);
+  EXPECT_NEAR(loaded.getRefitCostRatio(), 1., 1.e-6);
+
+  // the file is not loaded over other boxes, or with another scale factor
+  FloatType* moved = axom::allocate<FloatType>(numValues);
+  axom::copy(moved, boxes, numValues * sizeof(FloatType));
+  moved[numValues - 1] += 0.5;
+
+  BVHType stale(moved, numItems);
+  EXPECT_EQ(stale.readBinaryFile(fileName), spin::BVH_BUILD_FAILED);
+  EXPECT_EQ(stale.build(), spin::BVH_BUILD_OK);
+
+  BVHType rescaled(boxes, numItems);
+  rescaled.setScaleFactor(1.01);
+  EXPECT_EQ(rescaled.readBinaryFile(fileName), spin::BVH_BUILD_FAILED);
+
+  // nor by a BVH of another dimension
+  spin::BVH<5 - NDIMS, ExecSpace, FloatType> other(boxes, numItems);
+  EXPECT_EQ(other.readBinaryFile(fileName), spin::BVH_BUILD_FAILED);
+
+  for(int b = 0; b < 2; ++b)
+  {
+    axom::deallocate(offsets[b]);
+    axom::deallocate(counts[b]);
+    axom::deallocate(candidates[b]);
+  }
+  for(int d = 0; d < NDIMS; ++d)
+  {
+    axom::deallocate(lo[d]);
+    axom::deallocate(hi[d]);
+  }
+  axom::deallocate(moved);
+  axom::deallocate(boxes);
+  axom::setDefaultAllocator(current_allocator);
+}
+
+//------------------------------------------------------------------------------
+/*!
+ * \brief Checks that the queries yield the same results, in the same order,
+ *  whether they are processed in Morton order or not.
+ *
+ * \param [in] numItems the number of items in the BVH.
+ * \param [in] capacity the query capacity, see BVH::setQueryCapacity().
+ */
+template <int NDIMS, typename ExecSpace, typename FloatType>
+void check_sorted_queries(IndexType numItems, IndexType capacity)
+{
+  using BVHType = spin::BVH<NDIMS, ExecSpace, FloatType>;
+  using PointType = typename BVHType::PointType;
+  constexpr IndexType NUM_QUERIES = 500;
+  constexpr IndexType K = 3;
+
+  const int current_allocator = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<FloatType> coord(0., 10.);
+  std::uniform_real_distribution<FloatType> extent(0.05, 1.5);
+  std::uniform_real_distribution<FloatType> direction(-1., 1.);
+
+  FloatType* boxes = axom::allocate<FloatType>(numItems * NDIMS * 2);
+  for(IndexType i = 0; i < numItems; ++i)
+  {
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      const FloatType c = coord(gen);
+      const FloatType w = extent(gen);
+      boxes[i * NDIMS * 2 + d] = c - w;
+      boxes[i * NDIMS * 2 + NDIMS + d] = c + w;
+    }
+  }
+
+  BVHType unsorted(boxes, numItems);
+  unsorted.setQueryCapacity(capacity);
+  unsorted.build();
+  EXPECT_FALSE(unsorted.getSortQueries());
+
+  BVHType sorted(boxes, numItems);
+  sorted.setQueryCapacity(capacity);
+  sorted.setSortQueries(true);
+  sorted.build();
+  EXPECT_TRUE(sorted.getSortQueries());
+
+  // the points, the ray sources and the lower corners of the query boxes,
+  // along with the ray normals and the upper corners of the query boxes
+  FloatType* lo[3] = {nullptr, nullptr, nullptr};
+  FloatType* normal[3] = {nullptr, nullptr, nullptr};
+  FloatType* hi[3] = {nullptr, nullptr, nullptr};
+  for(int d = 0; d < NDIMS; ++d)
+  {
+    lo[d] = axom::allocate<FloatType>(NUM_QUERIES);
+    normal[d] = axom::allocate<FloatType>(NUM_QUERIES);
+    hi[d] = axom::allocate<FloatType>(NUM_QUERIES);
+    for(IndexType i = 0; i < NUM_QUERIES; ++i)
+    {
+      lo[d][i] = coord(gen);
+      normal[d][i] = direction(gen);
+      hi[d][i] = lo[d][i] + 0.5;
+    }
+  }
+
+  IndexType* offsets[2];
+  IndexType* counts[2];
+  IndexType* candidates[2];
+  for(int b = 0; b < 2; ++b)
+  {
+    offsets[b] = axom::allocate<IndexType>(NUM_QUERIES);
+    counts[b] = axom::allocate<IndexType>(NUM_QUERIES);
+  }
+
+  // checks that both BVHs found the same candidates, in the caller's order
+  auto check_candidates = [&]() {
+    for(IndexType i = 0; i < NUM_QUERIES; ++i)
+    {
+      ASSERT_EQ(offsets[0][i], offsets[1][i]);
+      ASSERT_EQ(counts[0][i], counts[1][i]);
+      for(IndexType j = 0; j < counts[0][i]; ++j)
+      {
+        EXPECT_EQ(candidates[1][offsets[1][i] + j],
+                  candidates[0][offsets[0][i] + j]);
+      }
+    }
+    for(int b = 0; b < 2; ++b)
+    {
+      axom::deallocate(candidates[b]);
+    }
+  };
+
+  BVHType* bvhs[2] = {&unsorted, &sorted};
+  for(int b = 0; b < 2; ++b)
+  {
+    candidates[b] = nullptr;
+    bvhs[b]->findPoints(offsets[b],
+                        counts[b],
+                        candidates[b],
+                        NUM_QUERIES,
+                        lo[0],
+                        lo[1],
+                        lo[2]);
+  }
+  check_candidates();
+
+  for(int b = 0; b < 2; ++b)
+  {
+    candidates[b] = nullptr;
+    bvhs[b]->findRays(offsets[b],
+                      counts[b],
+                      candidates[b],
+                      NUM_QUERIES,
+                      lo[0],
+                      normal[0],
+                      lo[1],
+                      normal[1],
+                      lo[2],
+                      normal[2]);
+  }
+  check_candidates();
+
+  for(int b = 0; b < 2; ++b)
+  {
+    candidates[b] = nullptr;
+    bvhs[b]->findBoundingBoxes(offsets[b],
+                               counts[b],
+                               candidates[b],
+                               NUM_QUERIES,
+                               lo[0],
+                               hi[0],
+                               lo[1],
+                               hi[1],
+                               lo[2],
+                               hi[2]);
+  }
+
+  // the visit methods are called with the IDs of the supplied queries
+  IndexType* visits = axom::allocate<IndexType>(NUM_QUERIES);
+  for(IndexType i = 0; i < NUM_QUERIES; ++i)
+  {
+    visits[i] = 0;
+  }
+  sorted.visitBoundingBoxes(
+    NUM_QUERIES,
+    AXOM_LAMBDA(IndexType q, IndexType AXOM_NOT_USED(item)) { visits[q]++; },
+    lo[0],
+    hi[0],
+    lo[1],
+    hi[1],
+    lo[2],
+    hi[2]);
+  for(IndexType i = 0; i < NUM_QUERIES; ++i)
+  {
+    EXPECT_EQ(visits[i], counts[1][i]);
+  }
+  check_candidates();
+  axom::deallocate(visits);
+
+  // the k nearest items, to the centers of the boxes
+  const FloatType* items = boxes;
+  auto sqDistance = AXOM_LAMBDA(IndexType item, const PointType& q)->FloatType
+  {
+    FloatType sq = 0;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      const FloatType c = 0.5 *
+        (items[item * NDIMS * 2 + d] + items[item * NDIMS * 2 + NDIMS + d]);
+      sq += (q[d] - c) * (q[d] - c);
+    }
+    return sq;
+  };
+
+  IndexType* nearest[2];
+  FloatType* sqDistances[2];
+  for(int b = 0; b < 2; ++b)
+  {
+    nearest[b] = axom::allocate<IndexType>(NUM_QUERIES * K);
+    sqDistances[b] = axom::allocate<FloatType>(NUM_QUERIES * K);
+    bvhs[b]->findKNearest(K,
+                          nearest[b],
+                          sqDistances[b],
+                          NUM_QUERIES,
+                          sqDistance,
+                          lo[0],
+                          lo[1],
+                          lo[2]);
+  }
+  for(IndexType i = 0; i < NUM_QUERIES * K; ++i)
+  {
+    EXPECT_EQ(nearest[1][i], nearest[0][i]);
+    EXPECT_EQ(sqDistances[1][i], sqDistances[0][i]);
+  }
+
+  for(int b = 0; b < 2; ++b)
+  {
+    axom::deallocate(offsets[b]);
+    axom::deallocate(counts[b]);
+    axom::deallocate(nearest[b]);
+    axom::deallocate(sqDistances[b]);
+  }
+  for(int d = 0; d < NDIMS; ++d)
+  {
+    axom::deallocate(lo[d]);
+    axom::deallocate(normal[d]);
+    axom::deallocate(hi[d]);
+  }
+  axom::deallocate(boxes);
+  axom::setDefaultAllocator(current_allocator);
+}
+
+} /* end unnamed namespace */
+
+//------------------------------------------------------------------------------
+// UNIT TESTS
+//------------------------------------------------------------------------------
+TEST(spin_bvh, query_point_accessor)
+{
+  constexpr double VAL = 42.0;
+  constexpr IndexType ID = 0;
+
+  double x[] = {VAL};
+  double y[] = {VAL + 1.5};
+  double z[] = {VAL + 2.5};
+
+  namespace bvh = axom::spin::internal::linear_bvh;
+  using QueryAccessor2D = bvh::QueryAccessor<2, double>;
+  using QueryAccessor3D = bvh::QueryAccessor<3, double>;
+  using Point2D = bvh::Vec<double, 2>;
+  using Point3D = bvh::Vec<double, 3>;
+
+  Point2D test_point2d;
+  QueryAccessor2D::getPoint(test_point2d, ID, x, y, nullptr);
+  EXPECT_DOUBLE_EQ(test_point2d[0], x[ID]);
+  EXPECT_DOUBLE_EQ(test_point2d[1], y[ID]);
+
+  Point3D test_point3d;
+  QueryAccessor3D::getPoint(test_point3d, 0, x, y, z);
+  EXPECT_DOUBLE_EQ(test_point3d[0], x[ID]);
+  EXPECT_DOUBLE_EQ(test_point3d[1], y[ID]);
+  EXPECT_DOUBLE_EQ(test_point3d[2], z[ID]);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, query_ray_accessor)
+{
+  constexpr double VAL = 42.0;
+  constexpr IndexType ID = 0;
+
+  double x[] = {VAL};
+  double y[] = {VAL + 1.5};
+  double z[] = {VAL + 2.5};
+
+  double nx[] = {VAL};
+  double ny[] = {VAL + 1.5};
+  double nz[] = {VAL + 2.5};
+
+  namespace bvh = axom::spin::internal::linear_bvh;
+  using QueryAccessor2D = bvh::QueryAccessor<2, double>;
+  using QueryAccessor3D = bvh::QueryAccessor<3, double>;
+  using Ray2D = bvh::Vec<double, 4>;
+  using Ray3D = bvh::Vec<double, 6>;
+
+  Ray2D ray2d;
+  QueryAccessor2D::getRay(ray2d, ID, x, nx, y, ny, nullptr, nullptr);
+  EXPECT_DOUBLE_EQ(ray2d[0], x[ID]);
+  EXPECT_DOUBLE_EQ(ray2d[1], y[ID]);
+
+  EXPECT_DOUBLE_EQ(ray2d[2], nx[ID]);
+  EXPECT_DOUBLE_EQ(ray2d[3], ny[ID]);
+
+  Ray3D ray3d;
+  QueryAccessor3D::getRay(ray3d, ID, x, nx, y, ny, z, nz);
+  EXPECT_DOUBLE_EQ(ray3d[0], x[ID]);
+  EXPECT_DOUBLE_EQ(ray3d[1], y[ID]);
+  EXPECT_DOUBLE_EQ(ray3d[2], z[ID]);
+
+  EXPECT_DOUBLE_EQ(ray3d[3], nx[ID]);
+  EXPECT_DOUBLE_EQ(ray3d[4], ny[ID]);
+  EXPECT_DOUBLE_EQ(ray3d[5], nz[ID]);
+}
+
+TEST(spin_bvh, query_bounding_box_accessor)
+{
+  constexpr double VAL = 42.0;
+  constexpr IndexType ID = 0;
+
+  double xmin[] = {VAL};
+  double ymin[] = {VAL + 1.5};
+  double zmin[] = {VAL + 2.5};
+
+  double xmax[] = {VAL};
+  double ymax[] = {VAL + 1.5};
+  double zmax[] = {VAL + 2.5};
+
+  namespace bvh = axom::spin::internal::linear_bvh;
+  using QueryAccessor2D = bvh::QueryAccessor<2, double>;
+  using QueryAccessor3D = bvh::QueryAccessor<3, double>;
+  using BoundingBox2D = bvh::Vec<double, 4>;
+  using BoundingBox3D = bvh::Vec<double, 6>;
+
+  BoundingBox2D box2D;
+  QueryAccessor2D::getBoundingBox(box2D, ID, xmin, xmax, ymin, ymax, nullptr, nullptr);
+
+  EXPECT_DOUBLE_EQ(box2D[0], xmin[ID]);
+  EXPECT_DOUBLE_EQ(box2D[1], ymin[ID]);
+
+  EXPECT_DOUBLE_EQ(box2D[2], xmax[ID]);
+  EXPECT_DOUBLE_EQ(box2D[3], ymax[ID]);
+
+  BoundingBox3D box3D;
+  QueryAccessor3D::getBoundingBox(box3D, ID, xmin, xmax, ymin, ymax, zmin, zmax);
+
+  EXPECT_DOUBLE_EQ(box3D[0], xmin[ID]);
+  EXPECT_DOUBLE_EQ(box3D[1], ymin[ID]);
+  EXPECT_DOUBLE_EQ(box3D[2], zmin[ID]);
+
+  EXPECT_DOUBLE_EQ(box3D[3], xmax[ID]);
+  EXPECT_DOUBLE_EQ(box3D[4], ymax[ID]);
+  EXPECT_DOUBLE_EQ(box3D[5], zmax[ID]);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, traversal_predicates_boundingBoxIntersectsLeftBin)
+{
+  namespace bvh = axom::spin::internal::linear_bvh;
+  using TraversalPredicates2D = bvh::TraversalPredicates<2, double>;
+  using TraversalPredicates3D = bvh::TraversalPredicates<3, double>;
+  using BoundingBox2D = bvh::Vec<double, 4>;
+  using BoundingBox3D = bvh::Vec<double, 6>;
+
+  BoundingBox2D s1, s2;
+  s1[0] = 0.;  // LeftBin.xmin
+  s1[1] = 0.;  // LeftBin.ymin
+  s1[2] = 0.;  // LeftBin.zmin
+
+  s1[3] = 1.;  // LeftBin.xmax
+  s2[0] = 1.;  // LeftBin.ymax
+  s2[1] = 1.;  // LeftBin.zmax
+
+  BoundingBox2D box2d;
+  box2d[0] = -1.0;
+  box2d[1] = -1.0;
+  box2d[2] = 1.0;
+  box2d[3] = 1.0;
+  EXPECT_TRUE(TraversalPredicates2D::boundingBoxIntersectsLeftBin(box2d, s1, s2));
+
+  // non-intersecting
+  box2d[2] = -0.5;
+  box2d[3] = -0.5;
+  EXPECT_FALSE(TraversalPredicates2D::boundingBoxIntersectsLeftBin(box2d, s1, s2));
+
+  BoundingBox3D box3d;
+  box3d[0] = -1.0;
+  box3d[1] = -1.0;
+  box3d[2] = -1.0;
+  box3d[3] = 1.0;
+  box3d[4] = 1.0;
+  box3d[5] = 1.0;
+  EXPECT_TRUE(TraversalPredicates3D::boundingBoxIntersectsLeftBin(box3d, s1, s2));
+
+  // non-intersecting
+  box3d[3] = -0.5;
+  box3d[4] = -0.5;
+  box3d[5] = -0.5;
+  EXPECT_FALSE(TraversalPredicates3D::boundingBoxIntersectsLeftBin(box3d, s1, s2));
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, traversal_predicates_boundingBoxIntersectsRightBin)
+{
+  namespace bvh = axom::spin::internal::linear_bvh;
+  using TraversalPredicates2D = bvh::TraversalPredicates<2, double>;
+  using TraversalPredicates3D = bvh::TraversalPredicates<3, double>;
+  using BoundingBox2D = bvh::Vec<double, 4>;
+  using BoundingBox3D = bvh::Vec<double, 6>;
+
+  BoundingBox2D s2, s3;
+  s2[2] = 0.;  // RightBin.xmin
+  s2[3] = 0.;  // RightBin.ymin
+  s3[0] = 0.;  // RightBin.zmin
+
+  s3[1] = 1.;  // RightBin.xmax
+  s3[2] = 1.;  // RightBin.ymax
+  s3[3] = 1.;  // RightBin.zmax
+
+  BoundingBox2D box2d;
+  box2d[0] = -1.0;
+  box2d[1] = -1.0;
+  box2d[2] = 1.0;
+  box2d[3] = 1.0;
+  EXPECT_TRUE(TraversalPredicates2D::boundingBoxIntersectsRightBin(box2d, s2, s3));
+
+  // non-intersecting
+  box2d[2] = -0.5;
+  box2d[3] = -0.5;
+  EXPECT_FALSE(
+    TraversalPredicates2D::boundingBoxIntersectsRightBin(box2d, s2, s3));
+
+  BoundingBox3D box3d;
+  box3d[0] = -1.0;
+  box3d[1] = -1.0;
+  box3d[2] = -1.0;
+  box3d[3] = 1.0;
+  box3d[4] = 1.0;
+  box3d[5] = 1.0;
   EXPECT_TRUE(TraversalPredicates3D::boundingBoxIntersectsRightBin(box3d, s2, s3));
 
   // non-intersecting
@@ -1799,6 +3196,34 @@ TEST(spin_bvh, find_points_2d_sequential)
   check_find_points2d<axom::SEQ_EXEC, float>();
 }
 
+//------------------------------------------------------------------------------
+TEST(spin_bvh, find_points_3d_morton_codes_sequential)
+{
+  // large enough for the radix sort of the Morton codes to kick in
+  constexpr IndexType N = 25;
+
+  for(bool use64Bit : {false, true})
+  {
+    check_find_points3d<axom::SEQ_EXEC, double>(N, use64Bit);
+    check_find_points3d<axom::SEQ_EXEC, float>(N, use64Bit);
+  }
+  check_find_points3d<axom::SEQ_EXEC, double>(4, true);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, find_points_2d_morton_codes_sequential)
+{
+  // large enough for the radix sort of the Morton codes to kick in
+  constexpr IndexType N = 129;
+
+  for(bool use64Bit : {false, true})
+  {
+    check_find_points2d<axom::SEQ_EXEC, double>(N, use64Bit);
+    check_find_points2d<axom::SEQ_EXEC, float>(N, use64Bit);
+  }
+  check_find_points2d<axom::SEQ_EXEC, double>(4, true);
+}
+
 //------------------------------------------------------------------------------
 TEST(spin_bvh, single_box2d_sequential)
 {
@@ -1813,6 +3238,198 @@ TEST(spin_bvh, single_box3d_sequential)
   check_single_box3d<axom::SEQ_EXEC, float>();
 }
 
+//------------------------------------------------------------------------------
+TEST(spin_bvh, find_nearest_2d_sequential)
+{
+  check_find_nearest<2, axom::SEQ_EXEC, double>(500, 1);
+  check_find_nearest<2, axom::SEQ_EXEC, float>(500, 1);
+  check_find_nearest<2, axom::SEQ_EXEC, double>(500, 8);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, find_nearest_3d_sequential)
+{
+  check_find_nearest<3, axom::SEQ_EXEC, double>(500, 1);
+  check_find_nearest<3, axom::SEQ_EXEC, float>(500, 1);
+  check_find_nearest<3, axom::SEQ_EXEC, double>(500, 8);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, find_nearest_fewer_items_than_k)
+{
+  // a single item, with the fake box that build() adds, and a few items
+  check_find_nearest<3, axom::SEQ_EXEC, double>(1, 1);
+  check_find_nearest<3, axom::SEQ_EXEC, double>(1, 3);
+  check_find_nearest<2, axom::SEQ_EXEC, double>(5, 10);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, refit_2d_sequential)
+{
+  check_refit<2, axom::SEQ_EXEC, double>(1);
+  check_refit<2, axom::SEQ_EXEC, double>(500);
+  check_refit<2, axom::SEQ_EXEC, float>(500);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, refit_3d_sequential)
+{
+  check_refit<3, axom::SEQ_EXEC, double>(1);
+  check_refit<3, axom::SEQ_EXEC, double>(500);
+  check_refit<3, axom::SEQ_EXEC, float>(500);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, bounded_queries_2d_sequential)
+{
+  // a capacity of 1 overflows for most queries, 1000 for none of them
+  check_bounded_queries<2, axom::SEQ_EXEC, double>(1);
+  check_bounded_queries<2, axom::SEQ_EXEC, double>(4);
+  check_bounded_queries<2, axom::SEQ_EXEC, float>(1000);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, bounded_queries_3d_sequential)
+{
+  check_bounded_queries<3, axom::SEQ_EXEC, double>(1);
+  check_bounded_queries<3, axom::SEQ_EXEC, double>(4);
+  check_bounded_queries<3, axom::SEQ_EXEC, float>(1000);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, wide_queries_2d_sequential)
+{
+  check_wide_queries<2, axom::SEQ_EXEC, double>(500, 4);
+  check_wide_queries<2, axom::SEQ_EXEC, float>(500, 8);
+  check_wide_queries<2, axom::SEQ_EXEC, double>(1, 4);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, wide_queries_3d_sequential)
+{
+  check_wide_queries<3, axom::SEQ_EXEC, double>(500, 4);
+  check_wide_queries<3, axom::SEQ_EXEC, float>(500, 8);
+  check_wide_queries<3, axom::SEQ_EXEC, double>(1, 8);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, sah_build_2d_sequential)
+{
+  check_sah_build<2, axom::SEQ_EXEC, double>(500);
+  check_sah_build<2, axom::SEQ_EXEC, float>(500);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, sah_build_3d_sequential)
+{
+  check_sah_build<3, axom::SEQ_EXEC, double>(500);
+  check_sah_build<3, axom::SEQ_EXEC, float>(500);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, sah_build_graded_sequential)
+{
+  check_sah_build_graded<2, axom::SEQ_EXEC>(250);
+  check_sah_build_graded<3, axom::SEQ_EXEC>(250);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, sah_build_single_box)
+{
+  const double box[] = {0., 0., 0., 1., 1., 1.};
+  const double point[] = {0.5};
+
+  spin::BVH<3, axom::SEQ_EXEC, double> bvh(box, 1);
+  bvh.setBuildStrategy(spin::BVH_SAH_BUILD);
+  EXPECT_EQ(bvh.build(), spin::BVH_BUILD_OK);
+  EXPECT_EQ(bvh.getQuality().maxDepth, 1);
+
+  IndexType offset = -1;
+  IndexType count = -1;
+  IndexType* candidates = nullptr;
+  bvh.findPoints(&offset, &count, candidates, 1, point, point, point);
+  ASSERT_EQ(count, 1);
+  EXPECT_EQ(offset, 0);
+  EXPECT_EQ(candidates[0], 0);
+  axom::deallocate(candidates);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, binary_file_2d_sequential)
+{
+  check_binary_file<2, axom::SEQ_EXEC, double>(500, 2);
+  check_binary_file<2, axom::SEQ_EXEC, float>(500, 4);
+  check_binary_file<2, axom::SEQ_EXEC, double>(1, 2);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, binary_file_3d_sequential)
+{
+  check_binary_file<3, axom::SEQ_EXEC, double>(500, 2);
+  check_binary_file<3, axom::SEQ_EXEC, float>(500, 8);
+  check_binary_file<3, axom::SEQ_EXEC, double>(1, 2);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, sorted_queries_2d_sequential)
+{
+  check_sorted_queries<2, axom::SEQ_EXEC, double>(500, 0);
+  check_sorted_queries<2, axom::SEQ_EXEC, float>(500, 4);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, sorted_queries_3d_sequential)
+{
+  check_sorted_queries<3, axom::SEQ_EXEC, double>(500, 0);
+  check_sorted_queries<3, axom::SEQ_EXEC, float>(500, 4);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, use_aligned_allocator)
+{
+  constexpr int NDIMS = 3;
+  constexpr int NUM_BOXES = 2;
+  using exec = axom::SEQ_EXEC;
+  using FloatType = double;
+
+  for(int allocID :
+      {axom::getAlignedAllocatorID(), axom::getHugePageAllocatorID()})
+  {
+    // two disjoint boxes, in [0,1]^3 and in [2,3]^3
+    FloatType* boxes = axom::allocate<FloatType>(NUM_BOXES * 6, allocID);
+    for(int i = 0; i < NUM_BOXES * 6; ++i)
+    {
+      boxes[i] = 2.0 * (i / 6) + ((i % 6 < 3) ? 0.0 : 1.0);
+    }
+
+    spin::BVH<NDIMS, exec, FloatType> bvh(boxes, NUM_BOXES, allocID);
+    EXPECT_EQ(bvh.getAllocatorID(), allocID);
+    bvh.build();
+
+    FloatType xc[NUM_BOXES] = {0.5, 2.5};
+    FloatType yc[NUM_BOXES] = {0.5, 2.5};
+    FloatType zc[NUM_BOXES] = {0.5, 2.5};
+    IndexType offsets[NUM_BOXES];
+    IndexType counts[NUM_BOXES];
+    IndexType* candidates = nullptr;
+    bvh.findPoints(offsets, counts, candidates, NUM_BOXES, xc, yc, zc);
+    ASSERT_TRUE(candidates != nullptr);
+
+    // the BVH allocates its buffers with the supplied aligned allocator
+    umpire::ResourceManager& rm = umpire::ResourceManager::getInstance();
+    EXPECT_EQ(rm.getAllocator(candidates).getId(), allocID);
+
+    for(int i = 0; i < NUM_BOXES; ++i)
+    {
+      EXPECT_EQ(counts[i], 1);
+      EXPECT_EQ(candidates[offsets[i]], i);
+    }
+
+    axom::deallocate(boxes);
+    axom::deallocate(candidates);
+  }
+}
+
 //------------------------------------------------------------------------------
 #ifdef AXOM_USE_OPENMP
 
@@ -1871,6 +3488,34 @@ TEST(spin_bvh, find_points_2d_omp)
   check_find_points2d<axom::OMP_EXEC, float>();
 }
 
+//------------------------------------------------------------------------------
+TEST(spin_bvh, find_points_3d_morton_codes_omp)
+{
+  // large enough for the radix sort of the Morton codes to kick in
+  constexpr IndexType N = 25;
+
+  for(bool use64Bit : {false, true})
+  {
+    check_find_points3d<axom::OMP_EXEC, double>(N, use64Bit);
+    check_find_points3d<axom::OMP_EXEC, float>(N, use64Bit);
+  }
+  check_find_points3d<axom::OMP_EXEC, double>(4, true);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, find_points_2d_morton_codes_omp)
+{
+  // large enough for the radix sort of the Morton codes to kick in
+  constexpr IndexType N = 129;
+
+  for(bool use64Bit : {false, true})
+  {
+    check_find_points2d<axom::OMP_EXEC, double>(N, use64Bit);
+    check_find_points2d<axom::OMP_EXEC, float>(N, use64Bit);
+  }
+  check_find_points2d<axom::OMP_EXEC, double>(4, true);
+}
+
 //------------------------------------------------------------------------------
 TEST(spin_bvh, single_box2d_omp)
 {
@@ -1884,6 +3529,100 @@ TEST(spin_bvh, single_box3d_omp)
   check_single_box3d<axom::OMP_EXEC, double>();
 }
 
+//------------------------------------------------------------------------------
+TEST(spin_bvh, find_nearest_2d_omp)
+{
+  check_find_nearest<2, axom::OMP_EXEC, double>(500, 1);
+  check_find_nearest<2, axom::OMP_EXEC, float>(500, 8);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, find_nearest_3d_omp)
+{
+  check_find_nearest<3, axom::OMP_EXEC, double>(500, 1);
+  check_find_nearest<3, axom::OMP_EXEC, float>(500, 8);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, refit_2d_omp)
+{
+  check_refit<2, axom::OMP_EXEC, double>(500);
+  check_refit<2, axom::OMP_EXEC, float>(500);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, refit_3d_omp)
+{
+  check_refit<3, axom::OMP_EXEC, double>(500);
+  check_refit<3, axom::OMP_EXEC, float>(500);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, bounded_queries_2d_omp)
+{
+  check_bounded_queries<2, axom::OMP_EXEC, double>(1);
+  check_bounded_queries<2, axom::OMP_EXEC, double>(1000);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, bounded_queries_3d_omp)
+{
+  check_bounded_queries<3, axom::OMP_EXEC, double>(1);
+  check_bounded_queries<3, axom::OMP_EXEC, double>(1000);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, sah_build_2d_omp)
+{
+  check_sah_build<2, axom::OMP_EXEC, double>(500);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, sah_build_3d_omp)
+{
+  check_sah_build<3, axom::OMP_EXEC, double>(500);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, binary_file_2d_omp)
+{
+  check_binary_file<2, axom::OMP_EXEC, double>(500, 4);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, binary_file_3d_omp)
+{
+  check_binary_file<3, axom::OMP_EXEC, double>(500, 4);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, sorted_queries_2d_omp)
+{
+  check_sorted_queries<2, axom::OMP_EXEC, double>(500, 0);
+  check_sorted_queries<2, axom::OMP_EXEC, double>(500, 4);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, sorted_queries_3d_omp)
+{
+  check_sorted_queries<3, axom::OMP_EXEC, double>(500, 0);
+  check_sorted_queries<3, axom::OMP_EXEC, double>(500, 4);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, wide_queries_2d_omp)
+{
+  check_wide_queries<2, axom::OMP_EXEC, double>(500, 4);
+  check_wide_queries<2, axom::OMP_EXEC, double>(500, 8);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, wide_queries_3d_omp)
+{
+  check_wide_queries<3, axom::OMP_EXEC, double>(500, 4);
+  check_wide_queries<3, axom::OMP_EXEC, double>(500, 8);
+}
+
 #endif
 
 //------------------------------------------------------------------------------